@@ -8,6 +8,10 @@
  */
 
 #include "rf_controller.h"
+#include "rf_guard.h"
+#include "rf_rx_queue.h"
+#include "rf_tx_queue.h"
+#include <stdatomic.h>
 #include <string.h>
 #include <stdlib.h>
 
@@ -34,9 +38,59 @@ static uint8_t current_antenna = 0;
 static bool antenna_diversity_enabled = false;
 static uint8_t redundancy_level = 0;
 
-/* Triple Modular Redundancy (TMR) buffers for radiation hardening */
-static uint8_t tmr_config_copies[3][sizeof(rf_config_t)];
-static uint8_t tmr_state_copies[3][sizeof(rf_state_t)];
+/* Redundant copies for radiation hardening. The state is hot, written per
+ * packet a field at a time; the configuration is cold and only rewritten
+ * by rf_configure(). Both are checked against a checksum and voted only
+ * when it fails. */
+static uint8_t config_copies[RF_GUARD_MAX_COPIES][sizeof(rf_config_t)];
+static uint8_t state_copies[RF_GUARD_MAX_COPIES][sizeof(rf_state_t)];
+static rf_guard_t config_guard;
+static rf_guard_t state_guard;
+
+_Static_assert(sizeof(rf_state_t) % sizeof(uint32_t) == 0, "the state guard works on whole words");
+
+/* Record a write to a field of current_state in its copies */
+#define STATE_SYNC(field) rf_guard_sync(&state_guard, &current_state.field, sizeof(current_state.field))
+#define STATE_ADD(field, delta) rf_guard_add32(&state_guard, &current_state.field, (uint32_t)(delta))
+
+/* Queued transmit path; the radio owns tx_batch while tx_busy is set */
+static rf_txq_t tx_queue;
+static rf_tx_batch_t tx_batch;
+static bool tx_busy = false;
+
+static void tx_pump(void);
+
+/* Receive ring, filled by the driver when no rx_callback is registered */
+static rf_rxq_t rx_queue;
+
+/* Stamps received frames; rf_receive_batch() reports how long they waited */
+static rf_clock_t rx_clock = NULL;
+static rf_latency_callback_t rx_latency_callback = NULL;
+static void* rx_latency_callback_data = NULL;
+
+/* Traffic counters, bumped from the driver interrupts and the caller alike.
+ * A read-modify-write of the guarded state could lose counts between the
+ * two, so these live outside it and rf_get_state() copies them in. */
+static struct {
+    _Atomic uint32_t packets_sent;
+    _Atomic uint32_t bytes_sent;
+    _Atomic uint32_t tx_batches;
+    _Atomic uint32_t packets_received;
+    _Atomic uint32_t bytes_received;
+    _Atomic uint32_t packet_errors;
+} traffic;
+
+#define TRAFFIC_ADD(field, delta) \
+    atomic_fetch_add_explicit(&traffic.field, (uint32_t)(delta), memory_order_relaxed)
+
+static void traffic_reset(void) {
+    atomic_store_explicit(&traffic.packets_sent, 0, memory_order_relaxed);
+    atomic_store_explicit(&traffic.bytes_sent, 0, memory_order_relaxed);
+    atomic_store_explicit(&traffic.tx_batches, 0, memory_order_relaxed);
+    atomic_store_explicit(&traffic.packets_received, 0, memory_order_relaxed);
+    atomic_store_explicit(&traffic.bytes_received, 0, memory_order_relaxed);
+    atomic_store_explicit(&traffic.packet_errors, 0, memory_order_relaxed);
+}
 
 /**
  * @brief Update status and notify callback if registered
@@ -45,6 +99,7 @@ static uint8_t tmr_state_copies[3][sizeof(rf_state_t)];
  */
 static void update_status(rf_status_t status) {
     current_state.status = status;
+    STATE_SYNC(status);
     
     /* Notify status change via callback if registered */
     if (status_callback != NULL) {
@@ -53,82 +108,15 @@ static void update_status(rf_status_t status) {
 }
 
 /**
- * @brief Perform Triple Modular Redundancy (TMR) protection on a data structure
+ * @brief (Re)start protection of the configuration and state
  *
- * @param data Pointer to the data to protect
- * @param copies Array of TMR copies
- * @param size Size of the data structure
- * @return true if correction was successful, false if uncorrectable error
+ * @param copies Redundant copies to keep; 0 disables protection
  */
-static bool tmr_protect(void* data, uint8_t copies[][sizeof(rf_state_t)], size_t size) {
-    if (redundancy_level == 0) {
-        return true; /* TMR disabled, no protection */
-    }
-    
-    /* Copy original data to TMR buffers */
-    for (int i = 0; i < redundancy_level; i++) {
-        memcpy(copies[i], data, size);
-    }
-    
-    return true;
-}
-
-/**
- * @brief Recover data using Triple Modular Redundancy (TMR)
- *
- * @param data Pointer to the data to recover
- * @param copies Array of TMR copies
- * @param size Size of the data structure
- * @return true if recovery was successful, false if uncorrectable error
- */
-static bool tmr_recover(void* data, uint8_t copies[][sizeof(rf_state_t)], size_t size) {
-    if (redundancy_level < 2) {
-        return true; /* Not enough redundancy for recovery */
-    }
-    
-    /* Simple majority voting for recovery */
-    int errors_detected = 0;
-    
-    /* Check if original data matches any copy */
-    bool match_found = false;
-    for (int i = 0; i < redundancy_level; i++) {
-        if (memcmp(data, copies[i], size) == 0) {
-            match_found = true;
-            break;
-        }
-    }
-    
-    if (!match_found) {
-        /* Original data doesn't match any copy, attempt recovery */
-        if (redundancy_level >= 3) {
-            /* With 3 copies, we can do majority voting */
-            /* This is a simplified implementation - a real one would vote bit by bit */
-            if (memcmp(copies[0], copies[1], size) == 0) {
-                /* Copies 0 and 1 match, use them */
-                memcpy(data, copies[0], size);
-                errors_detected = 1;
-            } else if (memcmp(copies[0], copies[2], size) == 0) {
-                /* Copies 0 and 2 match, use them */
-                memcpy(data, copies[0], size);
-                errors_detected = 1;
-            } else if (memcmp(copies[1], copies[2], size) == 0) {
-                /* Copies 1 and 2 match, use them */
-                memcpy(data, copies[1], size);
-                errors_detected = 1;
-            } else {
-                /* All three copies are different, uncorrectable error */
-                current_state.radiation_errors++;
-                return false;
-            }
-        } else {
-            /* With 2 copies, we can only detect errors, not correct them */
-            current_state.radiation_errors++;
-            return false;
-        }
-    }
-    
-    current_state.radiation_errors += errors_detected;
-    return true;
+static void guard_start(uint8_t copies) {
+    rf_guard_init(&config_guard, &current_config, &config_copies[0][0], sizeof(rf_config_t),
+                  copies, RF_GUARD_COLD);
+    rf_guard_init(&state_guard, &current_state, &state_copies[0][0], sizeof(rf_state_t),
+                  copies, RF_GUARD_HOT);
 }
 
 /**
@@ -144,6 +132,11 @@ rf_status_t rf_init(void) {
     /* Initialize state variables */
     memset(&current_state, 0, sizeof(rf_state_t));
     current_state.status = RF_STATUS_OK;
+    STATE_SYNC(status);
+    rf_txq_init(&tx_queue);
+    rf_rxq_init(&rx_queue);
+    traffic_reset();
+    __atomic_store_n(&tx_busy, false, __ATOMIC_RELEASE);
     
     /* Set defaults for configuration */
     memset(&current_config, 0, sizeof(rf_config_t));
@@ -181,9 +174,11 @@ rf_status_t rf_init(void) {
         redundancy_level = current_config.redundancy_level;
         radiation_hardening_init(redundancy_level);
         
-        /* Protect initial configuration and state with TMR */
-        tmr_protect(&current_config, (uint8_t (*)[sizeof(rf_state_t)])tmr_config_copies, sizeof(rf_config_t));
-        tmr_protect(&current_state, tmr_state_copies, sizeof(rf_state_t));
+        /* Protect initial configuration and state */
+        guard_start(redundancy_level);
+    } else {
+        redundancy_level = 0;
+        guard_start(0);
     }
     
     rf_initialized = true;
@@ -295,7 +290,7 @@ rf_status_t rf_configure(const rf_config_t* config) {
     
     if (!config_success) {
         update_status(RF_STATUS_CONFIG_ERROR);
-        current_state.error_count++;
+        STATE_ADD(error_count, 1);
         return RF_STATUS_CONFIG_ERROR;
     }
     
@@ -305,17 +300,46 @@ rf_status_t rf_configure(const rf_config_t* config) {
     /* Update redundancy level if changed */
     if (config->radiation_hardening) {
         redundancy_level = config->redundancy_level;
-        
-        /* Protect new configuration with TMR */
-        tmr_protect(&current_config, (uint8_t (*)[sizeof(rf_state_t)])tmr_config_copies, sizeof(rf_config_t));
     } else {
         redundancy_level = 0;
     }
     
+    /* Protect the new configuration, with the new number of copies */
+    guard_start(redundancy_level);
+    
     update_status(RF_STATUS_OK);
     return RF_STATUS_OK;
 }
 
+/**
+ * @brief Perform radiation-hardening mitigation
+ *
+ * Scrubs the cold configuration and the hot state: each is checked
+ * against its checksum, repaired from the copies when it fails, and
+ * copies that drifted are refreshed.
+ *
+ * @return RF_STATUS_OK on success, RF_STATUS_RADIATION_ERROR if a region could not be repaired
+ */
+rf_status_t rf_radiation_mitigation(void) {
+    if (!rf_initialized) {
+        return RF_STATUS_INIT_ERROR;
+    }
+    
+    rf_guard_result_t config_result = rf_guard_scrub(&config_guard);
+    rf_guard_result_t state_result = rf_guard_scrub(&state_guard);
+    
+    if (config_result == RF_GUARD_CORRECTED || state_result == RF_GUARD_CORRECTED) {
+        STATE_ADD(radiation_errors, 1);
+    }
+    if (config_result == RF_GUARD_UNCORRECTABLE || state_result == RF_GUARD_UNCORRECTABLE) {
+        STATE_ADD(radiation_errors, 1);
+        STATE_ADD(error_count, 1);
+        update_status(RF_STATUS_RADIATION_ERROR);
+        return RF_STATUS_RADIATION_ERROR;
+    }
+    return RF_STATUS_OK;
+}
+
 /**
  * @brief Start transmission of RF packet
  *
@@ -330,12 +354,13 @@ rf_status_t rf_transmit(const rf_packet_t* packet) {
     if (packet == NULL || packet->data == NULL || packet->length == 0 || 
         packet->length > MAX_PACKET_SIZE) {
         update_status(RF_STATUS_TX_ERROR);
-        current_state.error_count++;
+        STATE_ADD(error_count, 1);
         return RF_STATUS_TX_ERROR;
     }
     
     /* Set state to transmitting */
     current_state.is_transmitting = true;
+    STATE_SYNC(is_transmitting);
     
     bool tx_success = false;
     
@@ -350,19 +375,16 @@ rf_status_t rf_transmit(const rf_packet_t* packet) {
     
     if (!tx_success) {
         current_state.is_transmitting = false;
+        STATE_SYNC(is_transmitting);
         update_status(RF_STATUS_TX_ERROR);
-        current_state.error_count++;
+        STATE_ADD(error_count, 1);
         return RF_STATUS_TX_ERROR;
     }
     
     /* Update statistics */
-    current_state.tx_packets++;
-    current_state.tx_bytes += packet->length;
+    TRAFFIC_ADD(packets_sent, 1);
+    TRAFFIC_ADD(bytes_sent, packet->length);
     
-    /* Apply TMR protection to updated state */
-    if (current_config.radiation_hardening) {
-        tmr_protect(&current_state, tmr_state_copies, sizeof(rf_state_t));
-    }
     
     update_status(RF_STATUS_OK);
     return RF_STATUS_OK;
@@ -384,12 +406,13 @@ rf_status_t rf_transmit_async(const rf_packet_t* packet, rf_tx_callback_t callba
     if (packet == NULL || packet->data == NULL || packet->length == 0 || 
         packet->length > MAX_PACKET_SIZE) {
         update_status(RF_STATUS_TX_ERROR);
-        current_state.error_count++;
+        STATE_ADD(error_count, 1);
         return RF_STATUS_TX_ERROR;
     }
     
     /* Set state to transmitting */
     current_state.is_transmitting = true;
+    STATE_SYNC(is_transmitting);
     
     bool tx_success = false;
     
@@ -404,24 +427,150 @@ rf_status_t rf_transmit_async(const rf_packet_t* packet, rf_tx_callback_t callba
     
     if (!tx_success) {
         current_state.is_transmitting = false;
+        STATE_SYNC(is_transmitting);
         update_status(RF_STATUS_TX_ERROR);
-        current_state.error_count++;
+        STATE_ADD(error_count, 1);
         return RF_STATUS_TX_ERROR;
     }
     
     /* Update statistics */
-    current_state.tx_packets++;
-    current_state.tx_bytes += packet->length;
+    TRAFFIC_ADD(packets_sent, 1);
+    TRAFFIC_ADD(bytes_sent, packet->length);
     
-    /* Apply TMR protection to updated state */
-    if (current_config.radiation_hardening) {
-        tmr_protect(&current_state, tmr_state_copies, sizeof(rf_state_t));
-    }
     
     update_status(RF_STATUS_OK);
     return RF_STATUS_OK;
 }
 
+/**
+ * @brief Driver completion for a queued batch; runs in the radio context
+ *
+ * @param success Whether the batch was sent
+ * @param user_data Unused
+ */
+static void tx_batch_done(bool success, void* user_data) {
+    (void)user_data;
+    
+    if (success) {
+        TRAFFIC_ADD(packets_sent, tx_batch.count);
+        TRAFFIC_ADD(bytes_sent, tx_batch.bytes);
+        TRAFFIC_ADD(tx_batches, 1);
+    } else {
+        STATE_ADD(error_count, 1);
+    }
+    rf_txq_complete(&tx_queue, &tx_batch, success ? RF_STATUS_OK : RF_STATUS_TX_ERROR);
+    
+    /* Hand the radio back and keep draining */
+    current_state.is_transmitting = false;
+    STATE_SYNC(is_transmitting);
+    __atomic_store_n(&tx_busy, false, __ATOMIC_RELEASE);
+    tx_pump();
+}
+
+/**
+ * @brief Hand the next batch to the transceiver
+ *
+ * @return true if the driver accepted the batch and will call tx_batch_done
+ */
+static bool tx_start_batch(void) {
+    if (rf_txq_next_batch(&tx_queue, &tx_batch) == 0) {
+        return false;
+    }
+    
+    /* One wake-up and preamble for the whole batch */
+    current_state.is_transmitting = true;
+    STATE_SYNC(is_transmitting);
+    bool tx_started = false;
+    
+    if (current_config.band == RF_BAND_UHF) {
+        tx_started = ax5043_transmit_batch(tx_batch.data, tx_batch.length, tx_batch.count,
+                                           tx_batch_done, NULL);
+    } else if (current_config.band == RF_BAND_S) {
+        tx_started = at86rf233_transmit_batch(tx_batch.data, tx_batch.length, tx_batch.count,
+                                              tx_batch_done, NULL);
+    }
+    
+    if (!tx_started) {
+        current_state.is_transmitting = false;
+        STATE_SYNC(is_transmitting);
+        STATE_ADD(error_count, 1);
+        rf_txq_complete(&tx_queue, &tx_batch, RF_STATUS_TX_ERROR);
+    }
+    return tx_started;
+}
+
+/**
+ * @brief Start a batch if frames are queued and the radio is idle
+ *
+ * Called from both the submitter and the driver completion; the busy flag
+ * makes sure only one of them drives the radio at a time.
+ */
+static void tx_pump(void) {
+    while (rf_txq_pending(&tx_queue) && !__atomic_exchange_n(&tx_busy, true, __ATOMIC_ACQ_REL)) {
+        if (tx_start_batch()) {
+            return;
+        }
+        __atomic_store_n(&tx_busy, false, __ATOMIC_RELEASE);
+    }
+}
+
+/**
+ * @brief Get a pooled transmit buffer to build a frame in place
+ *
+ * @return Packet descriptor, or NULL if every buffer is in use
+ */
+rf_packet_t* rf_tx_alloc(void) {
+    if (!rf_initialized) {
+        return NULL;
+    }
+    return rf_txq_acquire(&tx_queue);
+}
+
+/**
+ * @brief Queue a frame built in a buffer from rf_tx_alloc()
+ *
+ * @param packet Packet from rf_tx_alloc(); data and length must be set
+ * @return RF_STATUS_OK if queued, appropriate error code otherwise
+ */
+rf_status_t rf_tx_submit(rf_packet_t* packet) {
+    if (!rf_initialized) {
+        return RF_STATUS_INIT_ERROR;
+    }
+    
+    if (packet == NULL || rf_txq_push(&tx_queue, packet) != RF_STATUS_OK) {
+        STATE_ADD(error_count, 1);
+        return RF_STATUS_TX_ERROR;
+    }
+    
+    tx_pump();
+    return RF_STATUS_OK;
+}
+
+/**
+ * @brief Return a buffer from rf_tx_alloc() without sending it
+ *
+ * @param packet Packet from rf_tx_alloc()
+ */
+void rf_tx_free(rf_packet_t* packet) {
+    if (packet != NULL) {
+        rf_txq_release(&tx_queue, packet);
+    }
+}
+
+/**
+ * @brief Collect the outcome of queued frames and free their buffers
+ *
+ * @param completions Filled with up to max completions, in send order
+ * @param max Capacity of completions
+ * @return Number of completions written
+ */
+size_t rf_tx_poll_completions(rf_tx_completion_t* completions, size_t max) {
+    if (completions == NULL) {
+        return 0;
+    }
+    return rf_txq_poll(&tx_queue, completions, max);
+}
+
 /**
  * @brief Start receiving RF packets
  *
@@ -434,18 +583,13 @@ rf_status_t rf_start_receive(rf_rx_callback_t callback, void* user_data) {
         return RF_STATUS_INIT_ERROR;
     }
     
-    if (callback == NULL) {
-        update_status(RF_STATUS_RX_ERROR);
-        current_state.error_count++;
-        return RF_STATUS_RX_ERROR;
-    }
-    
-    /* Store callback and user data */
+    /* Store callback and user data; without a callback, frames are queued for rf_receive_batch() */
     rx_callback = callback;
     rx_callback_data = user_data;
     
     /* Set state to receiving */
     current_state.is_receiving = true;
+    STATE_SYNC(is_receiving);
     
     bool rx_success = false;
     
@@ -460,17 +604,14 @@ rf_status_t rf_start_receive(rf_rx_callback_t callback, void* user_data) {
     
     if (!rx_success) {
         current_state.is_receiving = false;
+        STATE_SYNC(is_receiving);
         rx_callback = NULL;
         rx_callback_data = NULL;
         update_status(RF_STATUS_RX_ERROR);
-        current_state.error_count++;
+        STATE_ADD(error_count, 1);
         return RF_STATUS_RX_ERROR;
     }
     
-    /* Apply TMR protection to updated state */
-    if (current_config.radiation_hardening) {
-        tmr_protect(&current_state, tmr_state_copies, sizeof(rf_state_t));
-    }
     
     update_status(RF_STATUS_OK);
     return RF_STATUS_OK;
@@ -485,16 +626,32 @@ rf_status_t rf_start_receive(rf_rx_callback_t callback, void* user_data) {
  * @param user_data User data passed to receive function
  */
 static void rx_internal_callback(const uint8_t* data, size_t length, int8_t rssi, void* user_data) {
+    /* Batched delivery: one copy out of the driver and back to the radio */
+    if (rx_callback == NULL) {
+        rf_rx_slot_t* slot = length <= RF_RX_FRAME_SIZE ? rf_rxq_reserve(&rx_queue) : NULL;
+        if (slot != NULL) {
+            memcpy(slot->data, data, length);
+            slot->length = (uint32_t)length;
+            slot->rssi = rssi;
+            slot->snr = 0;
+            slot->received_ns = rx_clock != NULL ? rx_clock() : 0;
+            rf_rxq_commit(&rx_queue);
+        }
+        return;
+    }
+    
     /* Update statistics */
-    current_state.rx_packets++;
-    current_state.rx_bytes += length;
-    current_state.last_rssi = rssi;
+    TRAFFIC_ADD(packets_received, 1);
+    TRAFFIC_ADD(bytes_received, length);
+    current_state.metrics.rssi_dbm = rssi;
+    STATE_SYNC(metrics.rssi_dbm);
     
     /* Create packet structure */
     rf_packet_t packet;
     packet.data = data;
     packet.length = length;
     packet.rssi = rssi;
+    packet.received_ns = 0;
     
     /* Apply error detection/correction if enabled */
     if (current_config.fec != RF_FEC_NONE) {
@@ -518,7 +675,7 @@ static void rx_internal_callback(const uint8_t* data, size_t length, int8_t rssi
         }
         
         if (!decode_success) {
-            current_state.rx_errors++;
+            TRAFFIC_ADD(packet_errors, 1);
             return; /* Skip callback if decode failed */
         }
     }
@@ -528,10 +685,129 @@ static void rx_internal_callback(const uint8_t* data, size_t length, int8_t rssi
         rx_callback(&packet, user_data);
     }
     
-    /* Apply TMR protection to updated state */
-    if (current_config.radiation_hardening) {
-        tmr_protect(&current_state, tmr_state_copies, sizeof(rf_state_t));
+}
+
+/**
+ * @brief Decode a queued frame in place according to the configured FEC
+ *
+ * @param packet Packet pointing into the receive ring
+ * @return true if the frame is usable
+ */
+static bool rx_decode(rf_packet_t* packet) {
+    switch (current_config.fec) {
+        case RF_FEC_HAMMING:
+            return fec_decode_hamming(packet->data, packet->length);
+        case RF_FEC_GOLAY:
+            return fec_decode_golay(packet->data, packet->length);
+        case RF_FEC_REED_SOLOMON:
+            return fec_decode_reed_solomon(packet->data, packet->length);
+        default:
+            return true;
+    }
+}
+
+/**
+ * @brief Take received frames in one batch
+ *
+ * @param out Filled with up to max packets, oldest first
+ * @param max Capacity of out
+ * @param timeout_ms Time to wait for a first frame if none is queued
+ * @return Number of packets written
+ */
+size_t rf_receive_batch(rf_packet_t* out, size_t max, uint32_t timeout_ms) {
+    if (!rf_initialized || out == NULL || max == 0) {
+        return 0;
+    }
+    
+    /* The previous batch is done with; give its slots back to the driver */
+    rf_rxq_release(&rx_queue);
+    
+    if (rf_rxq_available(&rx_queue) == 0 && timeout_ms > 0 && current_state.is_receiving) {
+        /* Sleep until the next receive interrupt or the timeout */
+        if (current_config.band == RF_BAND_UHF) {
+            ax5043_wait_receive(timeout_ms);
+        } else if (current_config.band == RF_BAND_S) {
+            at86rf233_wait_receive(timeout_ms);
+        }
+    }
+    
+    size_t taken = rf_rxq_acquire(&rx_queue, out, max);
+    uint64_t now_ns = taken > 0 && rx_clock != NULL ? rx_clock() : 0;
+    
+    /* FEC runs here rather than in the interrupt; drop frames that fail */
+    size_t count = 0;
+    for (size_t i = 0; i < taken; i++) {
+        if (current_config.fec != RF_FEC_NONE && !rx_decode(&out[i])) {
+            TRAFFIC_ADD(packet_errors, 1);
+            continue;
+        }
+        TRAFFIC_ADD(packets_received, 1);
+        TRAFFIC_ADD(bytes_received, out[i].length);
+        current_state.metrics.rssi_dbm = out[i].rssi;
+        STATE_SYNC(metrics.rssi_dbm);
+        
+        /* Time from the driver queueing the frame to handing it out */
+        if (now_ns != 0 && out[i].received_ns != 0 && now_ns >= out[i].received_ns) {
+            uint64_t latency_ns = now_ns - out[i].received_ns;
+            uint64_t latency_us = latency_ns / 1000;
+            if (latency_us > current_state.metrics.rx_latency_max_us) {
+                current_state.metrics.rx_latency_max_us =
+                    latency_us > UINT32_MAX ? UINT32_MAX : (uint32_t)latency_us;
+                STATE_SYNC(metrics.rx_latency_max_us);
+            }
+            if (rx_latency_callback != NULL) {
+                rx_latency_callback(latency_ns, rx_latency_callback_data);
+            }
+        }
+        out[count++] = out[i];
+    }
+    
+    current_state.metrics.rx_overflows = rf_rxq_overflows(&rx_queue);
+    STATE_SYNC(metrics.rx_overflows);
+    current_state.metrics.rx_high_watermark = rf_rxq_high_watermark(&rx_queue);
+    STATE_SYNC(metrics.rx_high_watermark);
+    return count;
+}
+
+/**
+ * @brief Set the clock that stamps received frames
+ *
+ * @param clock Time source, or NULL to stop stamping
+ */
+void rf_set_clock(rf_clock_t clock) {
+    rx_clock = clock;
+}
+
+/**
+ * @brief Report the receive latency of every frame rf_receive_batch() returns
+ *
+ * @param callback Function to call, or NULL to stop reporting
+ * @param user_data User data pointer passed to callback
+ */
+void rf_set_rx_latency_callback(rf_latency_callback_t callback, void* user_data) {
+    rx_latency_callback = callback;
+    rx_latency_callback_data = user_data;
+}
+
+/**
+ * @brief Get the current state of the RF controller
+ *
+ * @param state Filled with a snapshot of the state and metrics
+ * @return RF_STATUS_OK on success, appropriate error code otherwise
+ */
+rf_status_t rf_get_state(rf_state_t* state) {
+    if (state == NULL) {
+        return RF_STATUS_CONFIG_ERROR;
     }
+    
+    *state = current_state;
+    state->metrics.packets_sent = atomic_load_explicit(&traffic.packets_sent, memory_order_relaxed);
+    state->metrics.bytes_sent = atomic_load_explicit(&traffic.bytes_sent, memory_order_relaxed);
+    state->metrics.tx_batches = atomic_load_explicit(&traffic.tx_batches, memory_order_relaxed);
+    state->metrics.packets_received = atomic_load_explicit(&traffic.packets_received, memory_order_relaxed);
+    state->metrics.bytes_received = atomic_load_explicit(&traffic.bytes_received, memory_order_relaxed);
+    state->metrics.packet_errors = atomic_load_explicit(&traffic.packet_errors, memory_order_relaxed);
+    return RF_STATUS_OK;
 }
 
 /**
@@ -561,19 +837,16 @@ rf_status_t rf_stop_receive(void) {
     
     if (!rx_stop_success) {
         update_status(RF_STATUS_RX_ERROR);
-        current_state.error_count++;
+        STATE_ADD(error_count, 1);
         return RF_STATUS_RX_ERROR;
     }
     
     /* Reset receiving state */
     current_state.is_receiving = false;
+    STATE_SYNC(is_receiving);
     rx_callback = NULL;
     rx_callback_data = NULL;
     
-    /* Apply TMR protection to updated state */
-    if (current_config.radiation_hardening) {
-        tmr_protect(&current_state, tmr_state_copies, sizeof(rf_state_t));
-    }
     
     update_status(RF_STATUS_OK);
     return RF_STATUS_OK;
@@ -613,7 +886,7 @@ rf_status_t rf_set_power_state(rf_power_state_t power_state) {
                 break;
             default:
                 update_status(RF_STATUS_CONFIG_ERROR);
-                current_state.error_count++;
+                STATE_ADD(error_count, 1);
                 return RF_STATUS_CONFIG_ERROR;
         }
         
@@ -638,7 +911,7 @@ rf_status_t rf_set_power_state(rf_power_state_t power_state) {
                 break;
             default:
                 update_status(RF_STATUS_CONFIG_ERROR);
-                current_state.error_count++;
+                STATE_ADD(error_count, 1);
                 return RF_STATUS_CONFIG_ERROR;
         }
         
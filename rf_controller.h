@@ -12,6 +12,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 /**
  * @brief RF operating frequency bands
@@ -95,6 +96,12 @@ typedef struct {
 
 /**
  * @brief RF signal metrics
+ *
+ * The packet, byte, error and batch counters are written from both the
+ * driver interrupt and the caller's context, so the controller keeps them
+ * in atomic counters and copies them in when rf_get_state() takes a
+ * snapshot. The receive ring and latency fields have a single writer,
+ * rf_receive_batch().
  */
 typedef struct {
     int16_t rssi_dbm;          /**< Received Signal Strength Indicator in dBm */
@@ -105,6 +112,10 @@ typedef struct {
     uint32_t packets_sent;     /**< Number of packets sent */
     uint32_t bytes_received;   /**< Number of bytes successfully received */
     uint32_t bytes_sent;       /**< Number of bytes sent */
+    uint32_t tx_batches;       /**< Radio wake-ups used for queued frames */
+    uint32_t rx_overflows;     /**< Frames dropped because the receive ring was full */
+    uint32_t rx_high_watermark; /**< Most frames ever waiting in the receive ring */
+    uint32_t rx_latency_max_us; /**< Longest wait of a frame in the receive ring; needs rf_set_clock() */
 } rf_metrics_t;
 
 /**
@@ -136,13 +147,34 @@ typedef struct {
     int16_t rssi;              /**< RSSI for received packets */
     int16_t snr;               /**< SNR for received packets */
     bool is_ack_required;      /**< Whether acknowledgment is required */
+    uint64_t received_ns;      /**< Driver receive time on the rf_set_clock() clock; 0 if unknown */
 } rf_packet_t;
 
+/**
+ * @brief Outcome of one frame queued with rf_tx_submit()
+ */
+typedef struct {
+    uint16_t packet_id;        /**< packet_id of the frame */
+    uint8_t priority;          /**< Priority it was queued at */
+    uint32_t length;           /**< Bytes sent */
+    rf_status_t status;        /**< RF_STATUS_OK or RF_STATUS_TX_ERROR */
+} rf_tx_completion_t;
+
 /**
  * @brief Callback function type for packet reception
  */
 typedef void (*rf_rx_callback_t)(rf_packet_t* packet, void* user_data);
 
+/**
+ * @brief Monotonic time source in nanoseconds, callable from interrupt context
+ */
+typedef uint64_t (*rf_clock_t)(void);
+
+/**
+ * @brief Callback receiving the time one frame waited in the receive ring
+ */
+typedef void (*rf_latency_callback_t)(uint64_t latency_ns, void* user_data);
+
 /* Function Prototypes */
 
 /**
@@ -175,6 +207,44 @@ rf_status_t rf_configure(const rf_config_t* config);
  */
 rf_status_t rf_transmit(const rf_packet_t* packet);
 
+/**
+ * @brief Get a pooled transmit buffer to build a frame in place
+ *
+ * The packet's data points at 256 bytes owned by the caller
+ * until it is passed to rf_tx_submit() or rf_tx_free().
+ *
+ * @return Packet descriptor, or NULL if every buffer is in use
+ */
+rf_packet_t* rf_tx_alloc(void);
+
+/**
+ * @brief Queue a frame built in a buffer from rf_tx_alloc()
+ *
+ * Frames are sent by priority (7 first), several per radio wake-up and
+ * preamble; the call does not wait for the radio. Collect the outcome
+ * with rf_tx_poll_completions(), which also frees the buffer.
+ *
+ * @param packet Packet from rf_tx_alloc(); data and length must be set
+ * @return RF_STATUS_OK if queued; on error the buffer stays with the caller
+ */
+rf_status_t rf_tx_submit(rf_packet_t* packet);
+
+/**
+ * @brief Return a buffer from rf_tx_alloc() without sending it
+ *
+ * @param packet Packet from rf_tx_alloc()
+ */
+void rf_tx_free(rf_packet_t* packet);
+
+/**
+ * @brief Collect the outcome of queued frames and free their buffers
+ *
+ * @param completions Filled with up to max completions, in send order
+ * @param max Capacity of completions
+ * @return Number of completions written
+ */
+size_t rf_tx_poll_completions(rf_tx_completion_t* completions, size_t max);
+
 /**
  * @brief Start reception of RF packets
  *
@@ -185,6 +255,43 @@ rf_status_t rf_transmit(const rf_packet_t* packet);
  */
 rf_status_t rf_receive(rf_rx_callback_t callback, void* user_data, uint32_t timeout_ms);
 
+/**
+ * @brief Take received frames in one batch
+ *
+ * While reception runs without a callback, the driver writes frames into
+ * a preallocated ring instead of calling up from interrupt context. The
+ * returned packets point into that ring and stay valid until the next
+ * call, which hands their slots back to the driver. Call from one context.
+ *
+ * @param out Filled with up to max packets, oldest first
+ * @param max Capacity of out
+ * @param timeout_ms Time to wait for a first frame if none is queued (0 to poll)
+ * @return Number of packets written
+ */
+size_t rf_receive_batch(rf_packet_t* out, size_t max, uint32_t timeout_ms);
+
+/**
+ * @brief Set the clock that stamps received frames
+ *
+ * Without a clock, frames carry no receive time and receive latency is
+ * not measured.
+ *
+ * @param clock Time source, or NULL to stop stamping
+ */
+void rf_set_clock(rf_clock_t clock);
+
+/**
+ * @brief Report the receive latency of every frame rf_receive_batch() returns
+ *
+ * The latency runs from the driver queueing a frame to rf_receive_batch()
+ * handing it out, on the rf_set_clock() clock. The callback runs in the
+ * caller of rf_receive_batch(), e.g. to feed a latency histogram.
+ *
+ * @param callback Function to call, or NULL to stop reporting
+ * @param user_data User data pointer passed to callback
+ */
+void rf_set_rx_latency_callback(rf_latency_callback_t callback, void* user_data);
+
 /**
  * @brief Stop ongoing RF reception
  *
@@ -266,7 +373,9 @@ rf_status_t rf_set_status_callback(void (*callback)(rf_status_t status, void* us
  * @brief Perform radiation-hardening mitigation
  *
  * Performs error detection and correction operations to mitigate
- * radiation-induced Single Event Upsets (SEUs).
+ * radiation-induced Single Event Upsets (SEUs). Packet handling only keeps
+ * the redundant copies current; call this periodically from a background
+ * context to check the configuration and state and repair them.
  *
  * @return RF_STATUS_OK on success, appropriate error code otherwise
  */
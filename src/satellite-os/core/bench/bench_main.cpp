@@ -0,0 +1,56 @@
+/**
+ * @file bench_main.cpp
+ * @brief Entry point for the SkyMesh core microbenchmarks
+ *
+ * Run with --benchmark_out=<file> --benchmark_out_format=json to record
+ * results for comparison across releases. --metrics_out=<file> also writes
+ * the binary snapshot of the core metrics registry the runs filled in, in
+ * the format of MetricsRegistry::encodeSnapshot().
+ */
+
+#include "skymesh/core/logger.h"
+#include "skymesh/core/metrics.h"
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv) {
+    // Keep component logging out of the benchmark report; a stream without
+    // a buffer discards everything written to it
+    static std::ostream discarded(nullptr);
+    skymesh::core::Logger::instance().setStreams(discarded, discarded);
+
+    // Take our own flag out before the library sees the arguments
+    static constexpr char kMetricsFlag[] = "--metrics_out=";
+    std::string metricsPath;
+    int kept = 1;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strncmp(argv[i], kMetricsFlag, sizeof(kMetricsFlag) - 1) == 0) {
+            metricsPath = argv[i] + sizeof(kMetricsFlag) - 1;
+        } else {
+            argv[kept++] = argv[i];
+        }
+    }
+    argc = kept;
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    if (!metricsPath.empty()) {
+        const std::vector<uint8_t> snapshot = skymesh::core::MetricsRegistry::instance().encodeSnapshot();
+        std::ofstream out(metricsPath, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(snapshot.data()), static_cast<std::streamsize>(snapshot.size()));
+        if (!out) {
+            return 1;
+        }
+    }
+    return 0;
+}
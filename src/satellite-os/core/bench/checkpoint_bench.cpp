@@ -0,0 +1,133 @@
+/**
+ * @file checkpoint_bench.cpp
+ * @brief Microbenchmarks for checkpoint commits and the task manager warm restart
+ */
+
+#include "skymesh/core/checkpoint_store.h"
+#include "skymesh/core/orbital_task_manager.h"
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+using namespace skymesh::core;
+
+namespace {
+
+// Page-aligned memory standing in for an MRAM window
+class Region {
+public:
+    Region() : bytes_(CheckpointStore::requiredSize() + kCheckpointPageSize) {}
+
+    void* base() {
+        const uintptr_t address = reinterpret_cast<uintptr_t>(bytes_.data());
+        return reinterpret_cast<void*>((address + kCheckpointPageSize - 1) & ~uintptr_t{kCheckpointPageSize - 1});
+    }
+
+    size_t size() const { return CheckpointStore::requiredSize(); }
+
+private:
+    std::vector<uint8_t> bytes_;
+};
+
+OrbitalTask makeFutureTask(int64_t index) {
+    OrbitalTask task;
+    task.name = "BenchTask" + std::to_string(index);
+    task.type = TaskType::PAYLOAD_OPERATION;
+    task.priority = TaskPriority::NORMAL;
+    task.scheduled_time = std::chrono::system_clock::now() + std::chrono::hours(1) + std::chrono::milliseconds(index);
+    task.timeout = std::chrono::milliseconds(5000);
+    task.recovery_strategy = RecoveryStrategy::RETRY;
+    task.radiation_protected = false;
+    task.retry_count = 0;
+    task.task_function = [](const TaskContext&) { return true; };
+    return task;
+}
+
+std::unique_ptr<OrbitalTaskManager> startPlanned(int64_t count) {
+    auto manager = createOrbitalTaskManager();
+    manager->start();
+    std::vector<OrbitalTask> plan;
+    plan.reserve(count);
+    for (int64_t i = 0; i < count; ++i) {
+        plan.push_back(makeFutureTask(i));
+    }
+    manager->scheduleTasks(std::move(plan));
+    return manager;
+}
+
+std::function<bool(const TaskContext&)> resolveNoop(const OrbitalTask&) {
+    return [](const TaskContext&) { return true; };
+}
+
+} // anonymous namespace
+
+// Section commit of range(0) KiB where one page changed since the last commit
+static void BM_CheckpointIncrementalCommit(benchmark::State& state) {
+    Region region;
+    auto store = CheckpointStore::openRegion(region.base(), region.size());
+    const size_t size = static_cast<size_t>(state.range(0)) * 1024;
+    size_t capacity = 0;
+    uint8_t* staged = store->stage(CheckpointSection::TASKS, capacity);
+    std::memset(staged, 0x5A, size);
+    store->commit(CheckpointSection::TASKS, size);
+    store->commit(CheckpointSection::TASKS, size);
+
+    uint8_t value = 0;
+    for (auto _ : state) {
+        staged[size / 2] = ++value;
+        benchmark::DoNotOptimize(store->commit(CheckpointSection::TASKS, size));
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+BENCHMARK(BM_CheckpointIncrementalCommit)->Arg(64)->Arg(1024)->Arg(8192);
+
+// saveCheckpoint() of range(0) queued tasks, one of them suspended and
+// resumed per iteration so the schedule is always dirty
+static void BM_CheckpointTaskSave(benchmark::State& state) {
+    Region region;
+    auto store = CheckpointStore::openRegion(region.base(), region.size());
+    auto manager = startPlanned(state.range(0));
+    const std::string task_id = manager->scheduleTask(makeFutureTask(state.range(0)));
+
+    for (auto _ : state) {
+        manager->suspendTask(task_id);
+        manager->resumeTask(task_id);
+        benchmark::DoNotOptimize(manager->saveCheckpoint(*store));
+    }
+
+    manager->stop();
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CheckpointTaskSave)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+// Warm restart of range(0) tasks into a freshly started manager; the
+// target is under 100 ms for 10k tasks
+static void BM_CheckpointWarmRestart(benchmark::State& state) {
+    Region region;
+    auto store = CheckpointStore::openRegion(region.base(), region.size());
+    {
+        auto manager = startPlanned(state.range(0));
+        manager->saveCheckpoint(*store);
+        manager->stop();
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto manager = createOrbitalTaskManager();
+        manager->start();
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(manager->restoreCheckpoint(*store, resolveNoop));
+
+        state.PauseTiming();
+        manager->stop();
+        manager.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CheckpointWarmRestart)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,186 @@
+/**
+ * @file command_control_bench.cpp
+ * @brief Microbenchmarks for CommandControl validation and dispatch latency
+ */
+
+#include "skymesh/core/command_control.h"
+#include "skymesh/core/crc32c.h"
+
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace skymesh::core;
+
+namespace {
+
+constexpr uint16_t kProbeCode = 0x0001;
+constexpr uint16_t kFloodCode = 0x0002;
+
+int64_t steadyNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// An uplinked plan of count keyed commands with payload_size data bytes each
+std::vector<Command> makeSignedPlan(CommandControl& control, size_t count, size_t payload_size) {
+    std::vector<Command> plan;
+    plan.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        plan.push_back(control.createCommand(kFloodCode, CommandPriority::NORMAL,
+                                             std::vector<uint8_t>(payload_size, static_cast<uint8_t>(i))));
+    }
+    return plan;
+}
+
+} // anonymous namespace
+
+// CRC32C throughput over range(0) bytes
+static void BM_Crc32c(benchmark::State& state) {
+    std::vector<uint8_t> buffer(static_cast<size_t>(state.range(0)), 0x6B);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(crc32c(buffer.data(), buffer.size()));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+    state.SetLabel(crc32cHardwareAccelerated() ? "hardware" : "table");
+}
+BENCHMARK(BM_Crc32c)->Arg(64)->Arg(4096);
+
+// Signing 64 commands of range(0) payload bytes, one at a time (range(1) = 0)
+// or four lanes at a time (range(1) = 1)
+static void BM_CommandSignatures(benchmark::State& state) {
+    CommandControl control(nullptr, nullptr, nullptr, nullptr);
+    const std::vector<Command> plan = makeSignedPlan(control, 64, static_cast<size_t>(state.range(0)));
+    CommandKey key{};
+    key[0] = 0x42;
+    const CommandKeySchedule schedule(key);
+    std::vector<const Command*> commands;
+    std::vector<const CommandKeySchedule*> schedules(plan.size(), &schedule);
+    for (const Command& command : plan) {
+        commands.push_back(&command);
+    }
+    std::vector<CommandSignature> signatures(plan.size());
+
+    for (auto _ : state) {
+        if (state.range(1) == 0) {
+            for (size_t i = 0; i < plan.size(); ++i) {
+                signatures[i] = computeCommandSignature(plan[i], schedule);
+            }
+        } else {
+            computeCommandSignatures(commands.data(), schedules.data(), plan.size(), signatures.data());
+        }
+        benchmark::DoNotOptimize(signatures.data());
+    }
+    state.SetItemsProcessed(state.iterations() * plan.size());
+    state.SetBytesProcessed(state.iterations() * plan.size() * (16 + state.range(0)));
+}
+BENCHMARK(BM_CommandSignatures)->ArgsProduct({{16, 256}, {0, 1}});
+
+// Admitting a signed 64-command plan through processCommand (range(0) = 0)
+// or processCommandBatch (range(0) = 1)
+static void BM_SignedPlanAdmission(benchmark::State& state) {
+    CommandControl control(nullptr, nullptr, nullptr, nullptr);
+    control.initialize();
+    control.registerCommandHandler(kFloodCode, [](const Command&, std::string&) {
+        return CommandStatus::SUCCESS;
+    });
+    CommandKey key{};
+    key[9] = 0x77;
+    control.setSourceKey(CommandSource::ONBOARD_SCHEDULER, key);
+    const std::vector<Command> plan = makeSignedPlan(control, 64, 32);
+
+    for (auto _ : state) {
+        if (state.range(0) == 0) {
+            for (const Command& command : plan) {
+                benchmark::DoNotOptimize(control.processCommand(command));
+            }
+        } else {
+            benchmark::DoNotOptimize(control.processCommandBatch(plan));
+        }
+        state.PauseTiming();
+        control.waitForIdle();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * plan.size());
+}
+BENCHMARK(BM_SignedPlanAdmission)->Arg(0)->Arg(1);
+
+// processCommand() admission cost: validation, signature check and enqueue
+static void BM_CommandAdmission(benchmark::State& state) {
+    CommandControl control(nullptr, nullptr, nullptr, nullptr);
+    control.initialize();
+    control.registerCommandHandler(kFloodCode, [](const Command&, std::string&) {
+        return CommandStatus::SUCCESS;
+    });
+    const bool keyed = state.range(0) != 0;
+    if (keyed) {
+        CommandKey key{};
+        key[3] = 0xA5;
+        control.setSourceKey(CommandSource::ONBOARD_SCHEDULER, key);
+    }
+    Command command = control.createCommand(kFloodCode, CommandPriority::NORMAL, std::vector<uint8_t>(64, 0x3C));
+
+    for (auto _ : state) {
+        if (control.processCommand(command) != CommandStatus::PENDING) {
+            state.PauseTiming();
+            control.waitForIdle();
+            state.ResumeTiming();
+        }
+    }
+    control.waitForIdle();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CommandAdmission)->Arg(0)->Arg(1);
+
+// Time from processCommand() to an EMERGENCY handler starting while range(0)
+// MESH_PEER threads keep the routine queues full
+static void BM_EmergencyLatencyUnderFlood(benchmark::State& state) {
+    CommandControl control(nullptr, nullptr, nullptr, nullptr);
+    control.initialize();
+
+    std::atomic<int64_t> started_ns{0};
+    control.registerCommandHandler(kProbeCode, [&started_ns](const Command&, std::string&) {
+        started_ns.store(steadyNowNs(), std::memory_order_release);
+        return CommandStatus::SUCCESS;
+    });
+    control.registerCommandHandler(kFloodCode, [](const Command&, std::string&) {
+        const auto until = std::chrono::steady_clock::now() + std::chrono::microseconds(20);
+        while (std::chrono::steady_clock::now() < until) {
+        }
+        return CommandStatus::SUCCESS;
+    });
+
+    std::atomic<bool> flooding{true};
+    std::vector<std::thread> peers;
+    for (int64_t t = 0; t < state.range(0); ++t) {
+        peers.emplace_back([&control, &flooding] {
+            Command flood = control.createCommand(kFloodCode, CommandPriority::NORMAL, {});
+            flood.source = CommandSource::MESH_PEER;
+            while (flooding.load(std::memory_order_relaxed)) {
+                control.processCommand(flood);
+            }
+        });
+    }
+
+    Command probe = control.createCommand(kProbeCode, CommandPriority::EMERGENCY, {});
+    for (auto _ : state) {
+        started_ns.store(0, std::memory_order_relaxed);
+
+        int64_t queued_ns = steadyNowNs();
+        control.processCommand(probe);
+        while (started_ns.load(std::memory_order_acquire) == 0) {
+            std::this_thread::yield();
+        }
+
+        state.SetIterationTime((started_ns.load() - queued_ns) * 1e-9);
+    }
+
+    flooding = false;
+    for (auto& peer : peers) {
+        peer.join();
+    }
+    control.waitForIdle();
+}
+BENCHMARK(BM_EmergencyLatencyUnderFlood)->Arg(0)->Arg(4)->UseManualTime()->Unit(benchmark::kMicrosecond);
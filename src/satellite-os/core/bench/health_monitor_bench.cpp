@@ -0,0 +1,95 @@
+/**
+ * @file health_monitor_bench.cpp
+ * @brief Microbenchmarks for HealthMonitor queries under concurrent polling
+ */
+
+#include "skymesh/core/health_monitor.h"
+#include "skymesh/core/health_report_codec.h"
+
+#include <benchmark/benchmark.h>
+#include <array>
+#include <memory>
+
+using namespace skymesh::core;
+
+namespace {
+
+// Shared by all benchmark threads, with the monitoring loop running
+std::unique_ptr<HealthMonitor> g_monitor;
+
+void setUpMonitor(const benchmark::State&) {
+    g_monitor = createHealthMonitor();
+    g_monitor->initialize(10);
+    g_monitor->registerComponent("obc", ComponentType::PROCESSOR);
+    g_monitor->registerComponent("eps", ComponentType::POWER_SYSTEM);
+    g_monitor->registerComponent("radio", ComponentType::COMMUNICATION_SYSTEM);
+    g_monitor->registerTemperatureSensor("obc_temp", ComponentType::PROCESSOR, 25.0f);
+    g_monitor->registerTemperatureSensor("eps_temp", ComponentType::POWER_SYSTEM, 20.0f);
+    g_monitor->registerTemperatureSensor("radio_temp", ComponentType::COMMUNICATION_SYSTEM, 30.0f);
+    g_monitor->start();
+}
+
+void tearDownMonitor(const benchmark::State&) {
+    g_monitor->stop();
+    g_monitor.reset();
+}
+
+} // anonymous namespace
+
+static void BM_HealthMonitorComponentQuery(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(g_monitor->getComponentHealth("obc"));
+    }
+}
+BENCHMARK(BM_HealthMonitorComponentQuery)
+    ->Setup(setUpMonitor)->Teardown(tearDownMonitor)
+    ->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_HealthMonitorAllComponents(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(g_monitor->getAllComponentHealth());
+    }
+}
+BENCHMARK(BM_HealthMonitorAllComponents)
+    ->Setup(setUpMonitor)->Teardown(tearDownMonitor)
+    ->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_HealthMonitorRadiationQuery(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(g_monitor->getRadiationData());
+    }
+}
+BENCHMARK(BM_HealthMonitorRadiationQuery)
+    ->Setup(setUpMonitor)->Teardown(tearDownMonitor)
+    ->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_HealthMonitorTemperatureTrend(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(g_monitor->getTemperatureStats(
+            ComponentType::PROCESSOR, std::chrono::seconds(60)));
+    }
+}
+BENCHMARK(BM_HealthMonitorTemperatureTrend)
+    ->Setup(setUpMonitor)->Teardown(tearDownMonitor)
+    ->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_HealthMonitorEncodeReport(benchmark::State& state) {
+    std::array<uint8_t, HealthReportEncoder::kMaxFrameBytes> frame;
+    const bool full = state.range(0) != 0;
+    // Acknowledge one report so the delta variant has a base
+    uint16_t sequence = 0;
+    bool delta = false;
+    const size_t base = g_monitor->encodeHealthReport(frame.data(), frame.size(), true);
+    if (HealthReportDecoder::readHeader(frame.data(), base, sequence, delta)) {
+        g_monitor->acknowledgeHealthReport(sequence);
+    }
+    size_t bytes = 0;
+    for (auto _ : state) {
+        bytes = g_monitor->encodeHealthReport(frame.data(), frame.size(), full);
+        benchmark::DoNotOptimize(frame.data());
+    }
+    state.counters["bytes"] = static_cast<double>(bytes);
+}
+BENCHMARK(BM_HealthMonitorEncodeReport)
+    ->Setup(setUpMonitor)->Teardown(tearDownMonitor)
+    ->Arg(1)->Arg(0);
@@ -0,0 +1,50 @@
+/**
+ * @file mesh_simulation_bench.cpp
+ * @brief Macrobenchmarks of simulated mesh time per wall second
+ */
+
+#include "skymesh/core/mesh_simulation.h"
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+
+using namespace skymesh::core;
+
+namespace {
+
+MeshSimulationConfig benchMesh(int64_t satellites) {
+    MeshSimulationConfig config;
+    config.satellites = static_cast<size_t>(satellites);
+    config.seed = 3;
+    config.link.loss_probability = 0.01;
+    CommandKey key{};
+    key.fill(0x5C);
+    config.mesh_key = key;
+    return config;
+}
+
+} // anonymous namespace
+
+// One simulated minute of range(0) satellites in a 4-ary tree with a ring,
+// with a broadcast every 10 s; the "sim_s_per_s" counter is the speed-up
+// over real time
+static void BM_MeshSimulatedMinute(benchmark::State& state) {
+    MeshSimulation mesh(benchMesh(state.range(0)));
+    mesh.connectTree(4);
+    mesh.connectRing();
+    mesh.start();
+    mesh.run(std::chrono::seconds(10));   // Let the first sweeps and samples settle
+
+    for (auto _ : state) {
+        for (int i = 0; i < 6; ++i) {
+            mesh.broadcastCommand({0x01});
+            benchmark::DoNotOptimize(mesh.run(std::chrono::seconds(10)));
+        }
+    }
+
+    state.counters["sim_s_per_s"] = benchmark::Counter(
+        static_cast<double>(state.iterations()) * 60.0, benchmark::Counter::kIsRate);
+    state.counters["frames"] = static_cast<double>(mesh.stats().frames_sent);
+    mesh.stop();
+}
+BENCHMARK(BM_MeshSimulatedMinute)->Arg(10)->Arg(100)->Arg(300)->Unit(benchmark::kMillisecond);
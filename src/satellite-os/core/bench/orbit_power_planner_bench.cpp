@@ -0,0 +1,58 @@
+/**
+ * @file orbit_power_planner_bench.cpp
+ * @brief Microbenchmarks for the orbit power planner
+ */
+
+#include "skymesh/core/orbit_power_planner.h"
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <string>
+
+using namespace skymesh::core;
+using namespace std::chrono_literals;
+
+// One plan() per control tick: three orbits at 30 s steps with
+// range(0) queued payload tasks
+static void BM_OrbitPowerPlannerPlan(benchmark::State& state) {
+    PowerManager power_manager;
+    power_manager.initialize({SubsystemID::OBC, SubsystemID::SENSORS});
+    power_manager.enableSubsystem(SubsystemID::SENSORS, 0.2f);
+    power_manager.updateOrbitPowerProfile(3600, 2100);
+
+    OrbitPowerPlanner planner(power_manager);
+    const auto now = std::chrono::system_clock::now();
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        OrbitalTask task{};
+        task.task_id = "payload-" + std::to_string(i);
+        task.type = TaskType::PAYLOAD_OPERATION;
+        task.scheduled_time = now + std::chrono::minutes(5 * i);
+        task.timeout = 2min;
+        planner.addTask(task);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(planner.plan(now));
+    }
+}
+BENCHMARK(BM_OrbitPowerPlannerPlan)->Arg(0)->Arg(16)->Arg(64);
+
+static void BM_OrbitPowerPlannerCanAfford(benchmark::State& state) {
+    PowerManager power_manager;
+    power_manager.initialize({SubsystemID::SENSORS});
+    power_manager.enableSubsystem(SubsystemID::SENSORS, 0.2f);
+    power_manager.updateOrbitPowerProfile(3600, 2100);
+
+    OrbitPowerPlanner planner(power_manager);
+    const auto now = std::chrono::system_clock::now();
+    planner.plan(now);
+
+    OrbitalTask task{};
+    task.task_id = "query";
+    task.type = TaskType::PAYLOAD_OPERATION;
+    task.timeout = 10min;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(planner.canAfford(task, {now + 1h, now + 2h}));
+    }
+}
+BENCHMARK(BM_OrbitPowerPlannerCanAfford);
@@ -0,0 +1,72 @@
+/**
+ * @file power_manager_bench.cpp
+ * @brief Microbenchmarks for the PowerManager update, budget and scrubbing paths
+ */
+
+#include "skymesh/core/power_manager.h"
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace skymesh::core;
+
+namespace {
+
+const std::vector<SubsystemID> kAllSubsystems = {
+    SubsystemID::RF_SYSTEM, SubsystemID::OBC, SubsystemID::ADCS,
+    SubsystemID::THERMAL, SubsystemID::PAYLOAD, SubsystemID::SENSORS
+};
+
+void initializePowered(PowerManager& power_manager) {
+    power_manager.initialize(kAllSubsystems);
+    for (SubsystemID subsystem : kAllSubsystems) {
+        power_manager.enableSubsystem(subsystem, 0.5f);
+    }
+}
+
+} // anonymous namespace
+
+static void BM_PowerManagerUpdate(benchmark::State& state) {
+    PowerManager power_manager;
+    initializePowered(power_manager);
+
+    for (auto _ : state) {
+        power_manager.update(100);
+    }
+}
+BENCHMARK(BM_PowerManagerUpdate);
+
+static void BM_PowerManagerGetPowerBudget(benchmark::State& state) {
+    PowerManager power_manager;
+    initializePowered(power_manager);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(power_manager.getPowerBudget());
+    }
+}
+BENCHMARK(BM_PowerManagerGetPowerBudget);
+
+// Fixed-size snapshot read through the seqlock, without the vector copy
+static void BM_PowerManagerBudgetSnapshot(benchmark::State& state) {
+    PowerManager power_manager;
+    initializePowered(power_manager);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(power_manager.getPowerBudgetSnapshot());
+    }
+}
+BENCHMARK(BM_PowerManagerBudgetSnapshot);
+
+// setSubsystemPowerLevel() applies an incremental budget update and
+// republishes the snapshot; scrubbing itself runs from update()
+static void BM_PowerManagerScrubbing(benchmark::State& state) {
+    PowerManager power_manager;
+    initializePowered(power_manager);
+
+    float level = 0.5f;
+    for (auto _ : state) {
+        level = level > 0.9f ? 0.1f : level + 0.01f;
+        benchmark::DoNotOptimize(power_manager.setSubsystemPowerLevel(SubsystemID::PAYLOAD, level));
+    }
+}
+BENCHMARK(BM_PowerManagerScrubbing);
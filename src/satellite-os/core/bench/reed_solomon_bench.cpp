@@ -0,0 +1,97 @@
+/**
+ * @file reed_solomon_bench.cpp
+ * @brief Microbenchmarks for the CCSDS Reed-Solomon codec
+ */
+
+#include "skymesh/core/reed_solomon.h"
+
+#include <benchmark/benchmark.h>
+#include <array>
+#include <random>
+#include <vector>
+
+using namespace skymesh::core;
+
+namespace {
+
+using Codeword = std::array<uint8_t, kRsCodewordSize>;
+
+// count full codewords with random data and valid parity
+std::vector<Codeword> makeCodewords(size_t count) {
+    std::mt19937 rng(42);
+    std::vector<Codeword> codewords(count);
+    for (auto& codeword : codewords) {
+        for (size_t i = 0; i < kRsMaxDataSize; ++i) {
+            codeword[i] = static_cast<uint8_t>(rng());
+        }
+        rsEncode(codeword.data(), kRsMaxDataSize, codeword.data() + kRsMaxDataSize);
+    }
+    return codewords;
+}
+
+} // anonymous namespace
+
+// Data bytes encoded per second, one codeword at a time (range(0) = 0) or
+// through the interleaved batch codec (range(0) = 1)
+static void BM_RsEncode(benchmark::State& state) {
+    std::vector<Codeword> codewords = makeCodewords(64);
+    std::vector<const uint8_t*> data;
+    std::vector<uint8_t*> parity;
+    for (auto& codeword : codewords) {
+        data.push_back(codeword.data());
+        parity.push_back(codeword.data() + kRsMaxDataSize);
+    }
+
+    for (auto _ : state) {
+        if (state.range(0) == 0) {
+            for (size_t i = 0; i < codewords.size(); ++i) {
+                rsEncode(data[i], kRsMaxDataSize, parity[i]);
+            }
+        } else {
+            rsEncodeBatch(data.data(), parity.data(), kRsMaxDataSize, codewords.size());
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * codewords.size() * kRsMaxDataSize);
+}
+BENCHMARK(BM_RsEncode)->Arg(0)->Arg(1);
+
+// Decoding error-free codewords, the common case on a healthy link
+static void BM_RsDecodeClean(benchmark::State& state) {
+    std::vector<Codeword> codewords = makeCodewords(64);
+    std::vector<uint8_t*> data;
+    std::vector<uint8_t*> parity;
+    for (auto& codeword : codewords) {
+        data.push_back(codeword.data());
+        parity.push_back(codeword.data() + kRsMaxDataSize);
+    }
+
+    for (auto _ : state) {
+        if (state.range(0) == 0) {
+            for (size_t i = 0; i < codewords.size(); ++i) {
+                benchmark::DoNotOptimize(rsDecode(data[i], kRsMaxDataSize, parity[i]));
+            }
+        } else {
+            benchmark::DoNotOptimize(rsDecodeBatch(data.data(), parity.data(), kRsMaxDataSize, codewords.size()));
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * codewords.size() * kRsMaxDataSize);
+}
+BENCHMARK(BM_RsDecodeClean)->Arg(0)->Arg(1);
+
+// Correcting range(0) symbol errors in one codeword
+static void BM_RsDecodeErrors(benchmark::State& state) {
+    const Codeword clean = makeCodewords(1)[0];
+    Codeword received = clean;
+    for (int64_t e = 0; e < state.range(0); ++e) {
+        received[static_cast<size_t>(e) * 13] ^= 0x3C;
+    }
+
+    for (auto _ : state) {
+        Codeword codeword = received;
+        benchmark::DoNotOptimize(rsDecode(codeword.data(), kRsMaxDataSize, codeword.data() + kRsMaxDataSize));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * kRsMaxDataSize);
+}
+BENCHMARK(BM_RsDecodeErrors)->Arg(1)->Arg(16);
@@ -0,0 +1,128 @@
+/**
+ * @file rf_tmr_bench.cpp
+ * @brief Microbenchmarks for the RF controller's state protection
+ *
+ * rf_transmit() itself needs the transceiver drivers, which are not part of
+ * this build, so these benchmarks measure the per-packet work it adds when
+ * radiation hardening is on. The whole-struct copies and vote are kept as a
+ * baseline for the field-granular rf_guard updates that replaced them.
+ */
+
+extern "C" {
+#include "skymesh/core/rf_controller.h"
+}
+#include "skymesh/core/rf_guard.h"
+#include "skymesh/core/tmr.h"
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+
+using namespace skymesh::core;
+
+namespace {
+
+template <typename T>
+struct TmrCopies {
+    unsigned char copies[3][sizeof(T)];
+};
+
+template <typename T>
+void protect(const T& data, TmrCopies<T>& tmr) {
+    for (auto& copy : tmr.copies) {
+        std::memcpy(copy, &data, sizeof(T));
+    }
+}
+
+// Votes the copies back into agreement and restores the live value from them
+template <typename T>
+bool recover(T& data, TmrCopies<T>& tmr) {
+    bool corrected = tmrScrub(tmr.copies[0], tmr.copies[1], tmr.copies[2], sizeof(T));
+    std::memcpy(&data, tmr.copies[0], sizeof(T));
+    return corrected;
+}
+
+} // anonymous namespace
+
+// The rf_transmit() bookkeeping: bump counters, then refresh all copies
+static void BM_RfTransmitStateProtect(benchmark::State& state) {
+    rf_state_t rf_state{};
+    TmrCopies<rf_state_t> tmr{};
+
+    for (auto _ : state) {
+        rf_state.metrics.packets_sent++;
+        rf_state.metrics.bytes_sent += 128;
+        protect(rf_state, tmr);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * 3 * sizeof(rf_state_t));
+}
+BENCHMARK(BM_RfTransmitStateProtect);
+
+// Recovery when the live copy is intact (range(0) == 0) or corrupted
+static void BM_RfStateRecover(benchmark::State& state) {
+    const bool corrupt = state.range(0) != 0;
+    rf_state_t rf_state{};
+    rf_state.metrics.packets_sent = 42;
+    TmrCopies<rf_state_t> tmr{};
+    protect(rf_state, tmr);
+
+    // The corrupted case flips a bit in the live copy; the vote over the
+    // intact copies restores it each iteration
+    for (auto _ : state) {
+        if (corrupt) {
+            reinterpret_cast<unsigned char*>(&rf_state)[0] ^= 0x01;
+        }
+        benchmark::DoNotOptimize(recover(rf_state, tmr));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_RfStateRecover)->Arg(0)->Arg(1);
+
+static void BM_RfConfigProtect(benchmark::State& state) {
+    rf_config_t config{};
+    TmrCopies<rf_config_t> tmr{};
+
+    for (auto _ : state) {
+        config.frequency_hz++;
+        protect(config, tmr);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * 3 * sizeof(rf_config_t));
+}
+BENCHMARK(BM_RfConfigProtect);
+
+// The same bookkeeping through the state guard: two counters, three copies each
+static void BM_RfGuardCounterUpdate(benchmark::State& state) {
+    rf_state_t rf_state{};
+    uint8_t copies[RF_GUARD_MAX_COPIES][sizeof(rf_state_t)];
+    rf_guard_t guard;
+    rf_guard_init(&guard, &rf_state, &copies[0][0], sizeof(rf_state), 3, RF_GUARD_HOT);
+
+    for (auto _ : state) {
+        rf_guard_add32(&guard, &rf_state.metrics.packets_sent, 1);
+        rf_guard_add32(&guard, &rf_state.metrics.bytes_sent, 128);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_RfGuardCounterUpdate);
+
+// Background check of the state when intact (range(0) == 0) or with an upset
+static void BM_RfGuardVerify(benchmark::State& state) {
+    const bool corrupt = state.range(0) != 0;
+    rf_state_t rf_state{};
+    rf_state.metrics.packets_sent = 42;
+    uint8_t copies[RF_GUARD_MAX_COPIES][sizeof(rf_state_t)];
+    rf_guard_t guard;
+    rf_guard_init(&guard, &rf_state, &copies[0][0], sizeof(rf_state), 3, RF_GUARD_HOT);
+
+    for (auto _ : state) {
+        if (corrupt) {
+            reinterpret_cast<unsigned char*>(&rf_state)[8] ^= 0x01;
+        }
+        benchmark::DoNotOptimize(rf_guard_verify(&guard));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_RfGuardVerify)->Arg(0)->Arg(1);
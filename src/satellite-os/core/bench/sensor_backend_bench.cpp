@@ -0,0 +1,56 @@
+/**
+ * @file sensor_backend_bench.cpp
+ * @brief Microbenchmarks for simulated sensor reads under concurrency
+ */
+
+#include "skymesh/core/sensor_backend.h"
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <memory>
+#include <string>
+
+using namespace skymesh::core;
+
+namespace {
+
+// Shared by all benchmark threads, as a satellite's subsystems share one backend
+std::shared_ptr<SensorBackend> g_sensors;
+
+void setUpSensors(const benchmark::State&) {
+    g_sensors = createSimulatedSensorBackend();
+}
+
+void tearDownSensors(const benchmark::State&) {
+    g_sensors.reset();
+}
+
+} // anonymous namespace
+
+static void BM_SimulatedTemperatureRead(benchmark::State& state) {
+    const std::string sensor_id = "sensor_" + std::to_string(state.thread_index());
+    const TemperatureChannel channel{sensor_id, ComponentType::PROCESSOR, 25.0f};
+    auto now = g_sensors->now();
+    float celsius = 0.0f;
+    for (auto _ : state) {
+        now += std::chrono::milliseconds(100);
+        g_sensors->readTemperature(channel, now, celsius);
+        benchmark::DoNotOptimize(celsius);
+    }
+}
+BENCHMARK(BM_SimulatedTemperatureRead)
+    ->Setup(setUpSensors)->Teardown(tearDownSensors)
+    ->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_SimulatedDoseRateRead(benchmark::State& state) {
+    auto now = g_sensors->now();
+    float rate = 0.0f;
+    for (auto _ : state) {
+        now += std::chrono::milliseconds(100);
+        g_sensors->readDoseRate(now, rate);
+        benchmark::DoNotOptimize(rate);
+    }
+}
+BENCHMARK(BM_SimulatedDoseRateRead)
+    ->Setup(setUpSensors)->Teardown(tearDownSensors)
+    ->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,182 @@
+/**
+ * @file task_manager_bench.cpp
+ * @brief Microbenchmarks for OrbitalTaskManager scheduling, dispatch and TMR
+ */
+
+#include "skymesh/core/orbital_task_manager.h"
+
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace skymesh::core;
+
+namespace {
+
+OrbitalTask makeTask(std::chrono::system_clock::time_point when) {
+    OrbitalTask task;
+    task.name = "BenchTask";
+    task.type = TaskType::PAYLOAD_OPERATION;
+    task.priority = TaskPriority::NORMAL;
+    task.scheduled_time = when;
+    task.timeout = std::chrono::milliseconds(5000);
+    task.recovery_strategy = RecoveryStrategy::RETRY;
+    task.radiation_protected = false;
+    task.retry_count = 0;
+    task.task_function = [](const TaskContext&) { return true; };
+    return task;
+}
+
+// Tasks due in an hour stay in the timer queue and never run
+std::vector<OrbitalTask> makeFuturePlan(int64_t count) {
+    auto far_future = std::chrono::system_clock::now() + std::chrono::hours(1);
+    std::vector<OrbitalTask> plan;
+    plan.reserve(count);
+    for (int64_t i = 0; i < count; ++i) {
+        plan.push_back(makeTask(far_future + std::chrono::milliseconds(i)));
+    }
+    return plan;
+}
+
+std::unique_ptr<OrbitalTaskManager> startManager(uint32_t workers) {
+    auto manager = createOrbitalTaskManager();
+    ExecutionPoolConfig config;
+    config.worker_count = workers;
+    manager->configureExecutionPool(config);
+    manager->start();
+    return manager;
+}
+
+int64_t steadyNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // anonymous namespace
+
+// Individual scheduleTask calls for a plan of range(0) tasks
+static void BM_ScheduleTask(benchmark::State& state) {
+    const int64_t plan_size = state.range(0);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto manager = startManager(1);
+        std::vector<OrbitalTask> plan = makeFuturePlan(plan_size);
+        state.ResumeTiming();
+
+        for (auto& task : plan) {
+            benchmark::DoNotOptimize(manager->scheduleTask(std::move(task)));
+        }
+
+        state.PauseTiming();
+        manager->stop();
+        manager.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * plan_size);
+}
+BENCHMARK(BM_ScheduleTask)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+// One scheduleTasks call for a plan of range(0) tasks
+static void BM_ScheduleTasksBatch(benchmark::State& state) {
+    const int64_t plan_size = state.range(0);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto manager = startManager(1);
+        std::vector<OrbitalTask> plan = makeFuturePlan(plan_size);
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(manager->scheduleTasks(std::move(plan)));
+
+        state.PauseTiming();
+        manager->stop();
+        manager.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * plan_size);
+}
+BENCHMARK(BM_ScheduleTasksBatch)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+// Time from scheduleTask() to the task function starting, with range(0)
+// future tasks queued and a 1 ms recurring task keeping the pool busy
+static void BM_DispatchLatency(benchmark::State& state) {
+    auto manager = startManager(2);
+    manager->scheduleTasks(makeFuturePlan(state.range(0)));
+
+    OrbitalTask background = makeTask(std::chrono::system_clock::now());
+    background.type = TaskType::TELEMETRY;
+    std::string background_id = manager->scheduleRecurringTask(background, std::chrono::milliseconds(1));
+
+    std::atomic<int64_t> started_ns{0};
+    OrbitalTask probe = makeTask(std::chrono::system_clock::now());
+    probe.priority = TaskPriority::HIGH;
+    probe.task_function = [&started_ns](const TaskContext&) {
+        started_ns.store(steadyNowNs(), std::memory_order_release);
+        return true;
+    };
+
+    for (auto _ : state) {
+        started_ns.store(0, std::memory_order_relaxed);
+        probe.scheduled_time = std::chrono::system_clock::now();
+
+        int64_t scheduled_ns = steadyNowNs();
+        manager->scheduleTask(probe);
+        while (started_ns.load(std::memory_order_acquire) == 0) {
+            std::this_thread::yield();
+        }
+
+        state.SetIterationTime((started_ns.load() - scheduled_ns) * 1e-9);
+    }
+
+    manager->cancelTask(background_id);
+    manager->stop();
+}
+BENCHMARK(BM_DispatchLatency)->Arg(0)->Arg(10000)->UseManualTime()->Unit(benchmark::kMicrosecond);
+
+// Schedule-to-completion of a task with range(0) microseconds of work;
+// range(1) is -1 for no TMR, otherwise the TmrMode value
+static void BM_TmrExecution(benchmark::State& state) {
+    const auto work = std::chrono::microseconds(state.range(0));
+    const int64_t mode = state.range(1);
+
+    auto manager = startManager(2);
+
+    std::atomic<bool> completed{false};
+    manager->registerCompletionCallback([&completed](const TaskResult&) {
+        completed.store(true, std::memory_order_release);
+    }, TaskType::PAYLOAD_OPERATION);
+
+    OrbitalTask task = makeTask(std::chrono::system_clock::now());
+    task.radiation_protected = mode >= 0;
+    task.tmr_mode = mode >= 0 ? static_cast<TmrMode>(mode) : TmrMode::SEQUENTIAL;
+    task.task_function = [work](const TaskContext&) {
+        // Busy work, so replicas compete for cores like real computations
+        auto until = std::chrono::steady_clock::now() + work;
+        while (std::chrono::steady_clock::now() < until) {
+        }
+        return true;
+    };
+
+    for (auto _ : state) {
+        completed.store(false, std::memory_order_relaxed);
+        task.scheduled_time = std::chrono::system_clock::now();
+        manager->scheduleTask(task);
+        while (!completed.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    }
+
+    manager->stop();
+}
+BENCHMARK(BM_TmrExecution)
+    ->ArgNames({"work_us", "tmr_mode"})
+    ->ArgsProduct({{0, 200}, {-1,
+                              static_cast<int64_t>(TmrMode::SEQUENTIAL),
+                              static_cast<int64_t>(TmrMode::PARALLEL),
+                              static_cast<int64_t>(TmrMode::DUAL_TIE_BREAK)}})
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,75 @@
+/**
+ * @file telemetry_stream_bench.cpp
+ * @brief Microbenchmarks for telemetry collection into downlink frames
+ */
+
+#include "skymesh/core/command_control.h"
+#include "skymesh/core/telemetry_stream.h"
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+using namespace skymesh::core;
+
+namespace {
+
+struct TelemetrySources {
+    std::shared_ptr<PowerManager> power = std::make_shared<PowerManager>();
+    std::shared_ptr<HealthMonitor> health = createHealthMonitor();
+    std::shared_ptr<OrbitalTaskManager> tasks = createOrbitalTaskManager();
+
+    TelemetrySources() {
+        power->initialize({SubsystemID::RF_SYSTEM, SubsystemID::OBC, SubsystemID::ADCS,
+                           SubsystemID::THERMAL, SubsystemID::PAYLOAD, SubsystemID::SENSORS});
+        power->enableSubsystem(SubsystemID::OBC, 0.1f);
+        health->initialize(60000);
+        for (int i = 0; i < 16; ++i) {
+            const std::string id = "component_" + std::to_string(i);
+            health->registerComponent(id, ComponentType::PROCESSOR);
+            health->registerTemperatureSensor(id + "_temp", ComponentType::PROCESSOR, 20.0f + i);
+        }
+    }
+};
+
+// Radio side: send everything queued and report it done
+void drainRadio(rf_txq_t& queue) {
+    rf_tx_batch_t batch;
+    while (rf_txq_next_batch(&queue, &batch) > 0) {
+        rf_txq_complete(&queue, &batch, RF_STATUS_OK);
+    }
+}
+
+} // anonymous namespace
+
+// Full sweeps through collectTelemetry(), one heap-allocated packet per frame
+static void BM_CollectTelemetryPackets(benchmark::State& state) {
+    TelemetrySources sources;
+    CommandControl control(nullptr, sources.power, sources.tasks, sources.health);
+    size_t frames = 0;
+    for (auto _ : state) {
+        std::vector<TelemetryPacket> packets = control.collectTelemetry(true);
+        frames += packets.size();
+        benchmark::DoNotOptimize(packets.data());
+    }
+    state.counters["frames"] = benchmark::Counter(static_cast<double>(frames), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_CollectTelemetryPackets);
+
+// Full sweeps serialized in place into the RF transmit pool
+static void BM_StreamTelemetryToRf(benchmark::State& state) {
+    TelemetrySources sources;
+    CommandControl control(nullptr, sources.power, sources.tasks, sources.health);
+    auto queue = std::make_unique<rf_txq_t>();
+    rf_txq_init(queue.get());
+    RfTxQueueSink sink(*queue, 2);
+    for (auto _ : state) {
+        while (!control.streamTelemetry(sink, true)) {
+            drainRadio(*queue);
+        }
+        drainRadio(*queue);
+    }
+    sink.reclaim();
+    state.counters["frames"] = benchmark::Counter(static_cast<double>(sink.sent()), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_StreamTelemetryToRf);
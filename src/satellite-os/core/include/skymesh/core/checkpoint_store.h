@@ -0,0 +1,249 @@
+/**
+ * @file checkpoint_store.h
+ * @brief Versioned, checksummed state checkpoints in a memory-mapped file or MRAM region
+ *
+ * A checkpoint holds one section per subsystem, so a warm restart after a
+ * watchdog reset resumes from the last saved state instead of waiting for
+ * the ground to uplink it again. Each section has two slots. A commit
+ * writes the slot not in use and then publishes it by rewriting the
+ * header copy that does not hold the current header. A reset at any point
+ * leaves the previous state readable, never a mix of old and new.
+ *
+ * A commit only writes the pages that differ from what the target slot
+ * already holds, and a section equal to its published copy is not written
+ * at all. State that changes a little between checkpoints therefore costs
+ * a compare, and whole-state rewrites never wear out MRAM or fill the page
+ * cache with write-back.
+ *
+ * Reading back needs no decoding step. Sections hold fixed-layout records
+ * that restore code reads in place from the mapping once a CRC pass has
+ * validated them. If the published slot is corrupt, the other slot is
+ * used when it still holds an intact older copy.
+ *
+ * Layout; offsets are page aligned and values are in native byte order,
+ * since a checkpoint is read back by the processor that wrote it:
+ *
+ *     page 0, page 1   header copies: magic, version, generation, layout,
+ *                      per section the active slot and, per slot, the
+ *                      generation, size and CRC32C; CRC32C of the header
+ *     per section      two slots of the section's capacity, in section order
+ */
+
+#ifndef SKYMESH_CORE_CHECKPOINT_STORE_H
+#define SKYMESH_CORE_CHECKPOINT_STORE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace skymesh {
+namespace core {
+
+/**
+ * @brief Subsystem state held by a checkpoint
+ */
+enum class CheckpointSection : uint8_t {
+    TASKS = 0,    ///< Queued, suspended and conditional tasks with their triggers
+    POWER = 1,    ///< Power mode, subsystem table and battery model
+    HEALTH = 2    ///< Radiation totals, component health and the telemetry history rings
+};
+
+/// Number of CheckpointSection values
+constexpr size_t kCheckpointSectionCount = 3;
+
+/// Unit of comparison and write-back; every slot starts on a page boundary
+constexpr size_t kCheckpointPageSize = 4096;
+
+/**
+ * @brief Capacity of each section; a store only opens a checkpoint written with the same layout
+ */
+struct CheckpointLayout {
+    /// Bytes per slot, indexed by CheckpointSection; rounded up to whole pages
+    std::array<size_t, kCheckpointSectionCount> capacity{{8u << 20, kCheckpointPageSize, 2u << 20}};
+};
+
+/**
+ * @brief Outcome of reading a section
+ */
+enum class CheckpointReadStatus {
+    VALID,        ///< Latest committed copy
+    PREVIOUS,     ///< The latest copy was corrupt; this is the one committed before it
+    EMPTY,        ///< Never committed
+    CORRUPT       ///< No intact copy; the subsystem must fall back to its defaults
+};
+
+/**
+ * @brief Validated section contents, pointing into the mapped checkpoint
+ *
+ * Stays valid until the section's slot is overwritten, at the earliest by
+ * the second commit of the section after the read.
+ */
+struct CheckpointView {
+    const uint8_t* data = nullptr;   ///< Section bytes, aligned to kCheckpointPageSize
+    size_t size = 0;                 ///< Section length
+    uint64_t generation = 0;         ///< Header generation that committed it
+};
+
+/**
+ * @brief Counters of a CheckpointStore
+ */
+struct CheckpointStats {
+    uint64_t commits = 0;            ///< Commits that wrote a slot
+    uint64_t unchanged = 0;          ///< Commits skipped because the section had not changed
+    uint64_t pagesCompared = 0;      ///< Pages checked against the target slot
+    uint64_t pagesWritten = 0;       ///< Pages that differed and were written
+    uint64_t fallbacks = 0;          ///< Reads that fell back to the previous copy
+    uint64_t corrupt = 0;            ///< Reads that found no intact copy
+};
+
+/**
+ * @brief Makes written bytes durable, e.g. msync() or an MRAM write barrier
+ */
+using CheckpointFlush = std::function<void(const void* address, size_t length)>;
+
+/**
+ * @class CheckpointStore
+ * @brief Double-buffered section store over a mapped region
+ *
+ * Commits and reads are serialized by an internal lock, so any thread may
+ * save a section. Sections are independent: each restores from its own
+ * latest intact copy.
+ */
+class CheckpointStore {
+public:
+    /**
+     * @brief Bytes a region must have to hold a layout
+     */
+    static size_t requiredSize(const CheckpointLayout& layout = CheckpointLayout{});
+
+    /**
+     * @brief Map a checkpoint file, creating or resizing it if needed
+     *
+     * Writes are made durable with msync(). A file written with another
+     * layout, or no valid checkpoint at all, is reformatted empty.
+     * @param path File to map
+     * @param layout Section capacities
+     * @return Store, or nullptr if the file cannot be mapped
+     */
+    static std::unique_ptr<CheckpointStore> openFile(const std::string& path,
+                                                     const CheckpointLayout& layout = CheckpointLayout{});
+
+    /**
+     * @brief Use memory the caller has mapped, such as an MRAM window
+     * @param base Start of the region, aligned to kCheckpointPageSize
+     * @param size Region length, at least requiredSize(layout)
+     * @param layout Section capacities
+     * @param flush Called after each write that must be durable; none for memory that is durable on store
+     * @return Store, or nullptr if the region is too small or misaligned
+     */
+    static std::unique_ptr<CheckpointStore> openRegion(void* base, size_t size,
+                                                       const CheckpointLayout& layout = CheckpointLayout{},
+                                                       CheckpointFlush flush = nullptr);
+
+    ~CheckpointStore();
+
+    CheckpointStore(const CheckpointStore&) = delete;
+    CheckpointStore& operator=(const CheckpointStore&) = delete;
+
+    /**
+     * @brief Whether a valid checkpoint was found when the store was opened
+     */
+    bool recovered() const { return recovered_; }
+
+    /**
+     * @brief Capacity of a section in bytes
+     */
+    size_t capacity(CheckpointSection section) const;
+
+    /**
+     * @brief Validate a section and locate it in the mapping
+     * @param section Section to read
+     * @param out Set to the section contents if the result is VALID or PREVIOUS
+     */
+    CheckpointReadStatus read(CheckpointSection section, CheckpointView& out) const;
+
+    /**
+     * @brief Buffer to build a section's next contents in, before commit()
+     *
+     * The buffer holds whatever was staged last; callers overwrite it from
+     * the start. It is owned by the store and reused by every commit.
+     * @param section Section to stage
+     * @param capacity Set to the buffer size, the section capacity
+     */
+    uint8_t* stage(CheckpointSection section, size_t& capacity);
+
+    /**
+     * @brief Publish the first size staged bytes as the section's new contents
+     * @return false if size exceeds the section capacity
+     */
+    bool commit(CheckpointSection section, size_t size);
+
+    /**
+     * @brief Forget every section, e.g. after the ground orders a cold start
+     */
+    void clear();
+
+    /**
+     * @brief Get the store counters
+     */
+    CheckpointStats stats() const;
+
+private:
+    struct SlotDescriptor {
+        uint64_t generation;       // Header generation that committed the slot; 0 = never
+        uint64_t size;
+        uint32_t crc;
+        uint32_t reserved;
+    };
+
+    struct SectionDescriptor {
+        uint8_t active;            // Slot holding the latest copy
+        uint8_t reserved[7];
+        SlotDescriptor slots[2];
+    };
+
+    struct Header {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t sectionCount;
+        uint64_t generation;
+        uint64_t capacity[kCheckpointSectionCount];
+        SectionDescriptor sections[kCheckpointSectionCount];
+        uint32_t crc;              // CRC32C of everything before it
+        uint32_t reserved;
+    };
+
+    CheckpointStore(uint8_t* base, size_t size, const CheckpointLayout& layout,
+                    CheckpointFlush flush, std::function<void()> unmap);
+
+    void open();
+    bool validHeader(const Header& header) const;
+    void publishHeader(const Header& header);
+    uint8_t* slotAddress(size_t section, size_t slot) const;
+    bool intact(size_t section, size_t slot, const Header& header) const;
+    void flushRange(const uint8_t* address, size_t length) const;
+
+    uint8_t* base_;
+    size_t size_;
+    std::array<size_t, kCheckpointSectionCount> capacity_;
+    std::array<size_t, kCheckpointSectionCount> offset_;
+    CheckpointFlush flush_;
+    std::function<void()> unmap_;
+
+    mutable std::mutex mutex_;
+    Header current_{};
+    size_t current_copy_ = 0;
+    bool recovered_ = false;
+    std::array<std::vector<uint8_t>, kCheckpointSectionCount> staging_;
+    mutable CheckpointStats stats_;
+};
+
+} // namespace core
+} // namespace skymesh
+
+#endif // SKYMESH_CORE_CHECKPOINT_STORE_H
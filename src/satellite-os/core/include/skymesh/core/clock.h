@@ -0,0 +1,155 @@
+/**
+ * @file clock.h
+ * @brief Injectable time source and timer executor for the core subsystems
+ *
+ * By default the subsystems run on real threads and the wall clock. Given
+ * an Executor, the task manager, health monitor and command dispatcher
+ * start no threads of their own. Instead they post their next deadline to
+ * the executor and do the due work inline when it fires, reading time
+ * from the executor's clock.
+ *
+ * SimulationExecutor is a single-threaded discrete-event loop over
+ * simulated time. Time jumps from one event to the next, so any number of
+ * satellites can share one thread and run as fast as their work allows.
+ * Runs with the same inputs run the same events in the same order.
+ */
+
+#ifndef SKYMESH_CORE_CLOCK_H
+#define SKYMESH_CORE_CLOCK_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace skymesh {
+namespace core {
+
+/**
+ * @brief Source of the current mission time
+ */
+class Clock {
+public:
+    virtual ~Clock() = default;
+
+    /**
+     * @brief Current time
+     */
+    virtual std::chrono::system_clock::time_point now() const = 0;
+};
+
+/**
+ * @brief Shared wall clock
+ */
+std::shared_ptr<const Clock> systemClock();
+
+/**
+ * @brief Identifies scheduled work for Executor::cancel(); 0 is never used
+ */
+using TimerId = uint64_t;
+
+/**
+ * @class Executor
+ * @brief Clock that runs deferred work once it reaches a given time
+ */
+class Executor : public Clock {
+public:
+    /**
+     * @brief Run work once the clock reaches a time
+     *
+     * Work due at the same time runs in the order it was scheduled. Work
+     * may schedule or cancel other work.
+     * @param when Earliest time to run; the past means as soon as possible
+     * @param work Function to run
+     * @return Identifier for cancel()
+     */
+    virtual TimerId scheduleAt(std::chrono::system_clock::time_point when, std::function<void()> work) = 0;
+
+    /**
+     * @brief Drop scheduled work that has not started
+     * @return false if it already ran, was cancelled, or is unknown
+     */
+    virtual bool cancel(TimerId id) = 0;
+};
+
+/**
+ * @class SimulationExecutor
+ * @brief Discrete-event executor over simulated time
+ *
+ * Time only moves when the loop is run, and work runs on the thread that
+ * runs it. Other threads may schedule and cancel work at any time.
+ */
+class SimulationExecutor : public Executor {
+public:
+    /// Default simulated start time, 2030-01-01T00:00:00Z
+    static constexpr std::chrono::seconds kDefaultEpoch{1893456000};
+
+    /**
+     * @brief Constructor
+     * @param epoch Simulated time the loop starts at
+     */
+    explicit SimulationExecutor(std::chrono::system_clock::time_point epoch =
+                                    std::chrono::system_clock::time_point(kDefaultEpoch));
+
+    std::chrono::system_clock::time_point now() const override;
+    TimerId scheduleAt(std::chrono::system_clock::time_point when, std::function<void()> work) override;
+    bool cancel(TimerId id) override;
+
+    /**
+     * @brief Advance to the earliest scheduled work and run it
+     * @return false if nothing is scheduled
+     */
+    bool runNext();
+
+    /**
+     * @brief Run everything due up to a time, then move the clock there
+     * @param until Time to stop at; work scheduled for it runs
+     * @return Number of work items run
+     */
+    size_t runUntil(std::chrono::system_clock::time_point until);
+
+    /**
+     * @brief Run for a span of simulated time
+     * @return Number of work items run
+     */
+    size_t runFor(std::chrono::nanoseconds duration);
+
+    /**
+     * @brief Number of work items scheduled and not yet run or cancelled
+     */
+    size_t pending() const;
+
+    /**
+     * @brief Number of work items run since construction
+     */
+    uint64_t executed() const { return executed_.load(std::memory_order_relaxed); }
+
+private:
+    struct Event {
+        std::chrono::system_clock::time_point when;
+        TimerId id;     // Increasing, so equal times run in scheduling order
+
+        bool operator>(const Event& other) const {
+            return when != other.when ? when > other.when : id > other.id;
+        }
+    };
+
+    // Pop the next live event due by until; false if there is none
+    bool takeNext(std::chrono::system_clock::time_point until, std::function<void()>& work);
+
+    mutable std::mutex mutex_;
+    std::vector<Event> events_;                               // Min-heap; may hold cancelled ids
+    std::unordered_map<TimerId, std::function<void()>> work_; // Live events
+    TimerId next_id_ = 1;
+    std::atomic<int64_t> now_ns_;                             // Readable without the lock
+    std::atomic<uint64_t> executed_{0};
+};
+
+} // namespace core
+} // namespace skymesh
+
+#endif // SKYMESH_CORE_CLOCK_H
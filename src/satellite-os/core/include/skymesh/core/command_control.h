@@ -20,14 +20,25 @@
 #include <vector>
 #include <functional>
 #include <memory>
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <mutex>
+#include <thread>
+#include <unordered_map>
 
 // Include dependencies for subsystem coordination
 #include "skymesh/core/rf_controller.h"
+#include "skymesh/core/checkpoint_store.h"
+#include "skymesh/core/clock.h"
 #include "skymesh/core/power_manager.h"
 #include "skymesh/core/orbital_task_manager.h"
 #include "skymesh/core/health_monitor.h"
+#include "skymesh/core/metrics.h"
+#include "skymesh/core/mpmc_ring.h"
+#include "skymesh/core/reed_solomon.h"
+#include "skymesh/core/telemetry_stream.h"
 
 namespace skymesh {
 namespace core {
@@ -58,6 +69,11 @@ enum class CommandPriority {
     DEFERRED = 4     ///< Non-critical operations to be executed when resources available
 };
 
+/**
+ * @brief Number of CommandPriority values, used to size per-priority tables
+ */
+constexpr size_t kCommandPriorityCount = 5;
+
 /**
  * @brief Command status codes
  */
@@ -84,6 +100,38 @@ enum class CommandSource {
     RECOVERY_SYSTEM = 4      ///< Command from system recovery mechanisms
 };
 
+/**
+ * @brief Number of CommandSource values, used to size per-source tables
+ */
+constexpr size_t kCommandSourceCount = 5;
+
+/**
+ * @brief Size of a command signature in bytes
+ */
+constexpr size_t kCommandSignatureSize = 8;
+
+/**
+ * @brief Authentication key shared with one command source
+ */
+using CommandKey = std::array<uint8_t, 16>;
+
+/**
+ * @brief Command authentication tag
+ */
+using CommandSignature = std::array<uint8_t, kCommandSignatureSize>;
+
+/**
+ * @brief SipHash-2-4 initial state derived from a CommandKey
+ *
+ * Derived once when a key is provisioned so signing and verification skip
+ * the key setup.
+ */
+struct CommandKeySchedule {
+    explicit CommandKeySchedule(const CommandKey& key);
+    
+    uint64_t v[4];               ///< Initial SipHash state words
+};
+
 /**
  * @brief Structure representing a satellite command
  * 
@@ -104,14 +152,39 @@ struct Command {
     mutable uint16_t commandCode_copy2;  ///< Redundant copy 2 for TMR
     
     // Validation methods
-    bool validateChecksum() const;
-    bool validateSignature() const;
-    bool validateTMR() const;
+    bool validateChecksum() const;       ///< CRC32C of the voted command code and data matches checksum
+    bool validateSignature() const;      ///< Signature is well formed: empty or kCommandSignatureSize bytes
+    bool validateTMR() const;            ///< All three copies of the command code agree
     
     // TMR voting mechanism
     uint16_t getCommandCodeTMR() const;
 };
 
+/**
+ * @brief CRC32C of a command's voted code and data, as stored in Command::checksum
+ */
+uint32_t computeCommandChecksum(const Command& command);
+
+/**
+ * @brief Keyed SipHash-2-4 tag over a command's ID, code, priority, source, timestamp and data
+ */
+CommandSignature computeCommandSignature(const Command& command, const CommandKey& key);
+
+/**
+ * @brief computeCommandSignature() with a precomputed key schedule
+ */
+CommandSignature computeCommandSignature(const Command& command, const CommandKeySchedule& schedule);
+
+/**
+ * @brief Sign count commands, hashing four at a time in interleaved lanes
+ *
+ * Commands are grouped by length so the lanes stay in lockstep; each
+ * command may use a different key. signatures[i] receives the tag of
+ * commands[i] under schedules[i].
+ */
+void computeCommandSignatures(const Command* const* commands, const CommandKeySchedule* const* schedules,
+                              size_t count, CommandSignature* signatures);
+
 /**
  * @brief Telemetry data structure
  * 
@@ -129,9 +202,9 @@ struct TelemetryPacket {
     bool validateChecksum() const;
     
     // Error correction code
-    std::vector<uint8_t> ecc;    ///< Error correction code
-    void generateECC();
-    bool applyECCCorrection();
+    std::vector<uint8_t> ecc;    ///< RS(255,223) parity, kRsParitySize bytes per kRsMaxDataSize data bytes
+    void generateECC();          ///< Encode data into ecc, reusing ecc's storage
+    bool applyECCCorrection();   ///< Correct data in place; false if any block was uncorrectable
 };
 
 /**
@@ -139,12 +212,40 @@ struct TelemetryPacket {
  */
 using CommandCallback = std::function<void(CommandStatus, const std::string&)>;
 
+/**
+ * @brief Handler that executes one command code
+ *
+ * Runs on a dispatch thread with no CommandControl lock held. Returns the
+ * command's status and may set details for the completion callback.
+ */
+using CommandHandler = std::function<CommandStatus(const Command& command, std::string& details)>;
+
+/**
+ * @brief Counters kept by the command dispatcher
+ */
+struct CommandDispatchStats {
+    uint64_t executed{0};         ///< Commands that ran, whatever their status
+    uint64_t rejected{0};         ///< Commands that failed validation or authentication
+    uint64_t rateLimited{0};      ///< Commands refused by their source's rate limit
+    uint64_t queueFull{0};        ///< Commands refused because their priority queue was full
+    std::array<std::chrono::nanoseconds, kCommandPriorityCount> maxQueueLatency{};  ///< Longest wait from queueing to execution, per priority
+};
+
 /**
  * @class CommandControl
  * @brief Core command and control system for satellite operations
  * 
  * Manages command processing, telemetry collection, and subsystem coordination
  * with radiation-tolerant design principles.
+ *
+ * Accepted commands go into a bounded lock-free queue per priority and are
+ * executed by registered handlers on dedicated dispatch threads, never
+ * under a lock. EMERGENCY commands have a thread of their own, so they
+ * neither wait behind queued work nor behind a command already running;
+ * the other priorities share one thread that always takes the highest
+ * queued priority next. Each source can be rate limited so that, for
+ * example, a flood of MESH_PEER commands cannot crowd out the ground.
+ * Given an executor, the lanes run as passes on it instead of threads.
  */
 class CommandControl {
 public:
@@ -198,6 +299,19 @@ public:
      */
     bool queueCommand(const Command& command, CommandCallback callback = nullptr);
     
+    /**
+     * @brief Process a burst of received commands, such as an uplinked plan
+     * 
+     * Applies the same checks as processCommand(), but verifies signatures
+     * in multi-buffer batches and wakes the dispatcher once per burst.
+     * 
+     * @param commands Commands in uplink order
+     * @param callback Optional completion callback, shared by every command
+     * @return Status of each command, in the same order
+     */
+    std::vector<CommandStatus> processCommandBatch(const std::vector<Command>& commands,
+                                                   CommandCallback callback = nullptr);
+    
     /**
      * @brief Create a new command for internal execution
      * 
@@ -214,11 +328,28 @@ public:
     /**
      * @brief Collect telemetry from all subsystems
      * 
+     * Runs a whole sweep of the telemetry stream, one packet per frame,
+     * abandoning any sweep paused in streamTelemetry().
+     * 
      * @param fullTelemetry If true, collect comprehensive telemetry
      * @return Vector of telemetry packets
      */
     std::vector<TelemetryPacket> collectTelemetry(bool fullTelemetry = false);
     
+    /**
+     * @brief Stream telemetry from all subsystems into a frame sink
+     * 
+     * Starts a sweep if none is paused, then serializes frames directly
+     * into the sink's buffers until the sweep ends or the sink runs out of
+     * buffers. Call again once the downlink has drained to resume a paused
+     * sweep where it stopped.
+     * 
+     * @param sink Frame destination, e.g. an RfTxQueueSink
+     * @param fullTelemetry If true, a new sweep collects comprehensive telemetry
+     * @return True if the sweep completed, false if it is paused
+     */
+    bool streamTelemetry(TelemetrySink& sink, bool fullTelemetry = false);
+    
     /**
      * @brief Queue telemetry for transmission
      * 
@@ -303,41 +434,213 @@ public:
      */
     bool isSystemSecure() const;
     
+    // ---- State Checkpoints ----
+    
+    /**
+     * @brief Set the checkpoint that state is saved to and restored from
+     * 
+     * @param store Checkpoint store, e.g. from CheckpointStore::openFile()
+     * @param resolver Rebinds restored tasks to their functions; without one no task is restored
+     */
+    void setCheckpointStore(std::shared_ptr<CheckpointStore> store, TaskFunctionResolver resolver = nullptr);
+    
+    /**
+     * @brief Save the task, power and health state to the checkpoint
+     * 
+     * Call from the thread that drives the power manager. Sections that
+     * have not changed since the last save are not rewritten.
+     * 
+     * @return True if every subsystem was saved
+     */
+    bool checkpointState();
+    
+    /**
+     * @brief Resume from the checkpoint after a reset
+     * 
+     * Restores power and health state, then reschedules tasks. Call after
+     * the subsystems are initialized and before the health monitor is
+     * started. A checkpoint that exists but fails its integrity checks
+     * leaves the affected subsystems at their defaults and enters safe mode.
+     * 
+     * @return True if a checkpoint was found and fully restored
+     */
+    bool warmRestart();
+    
+    // ---- Command Dispatch ----
+    
+    /**
+     * @brief Dispatch on an executor instead of dispatch threads
+     * 
+     * Call before initialize(). Each lane then drains its queues in a pass
+     * posted to the executor, in the same priority order, and queueing
+     * latency, rate limits and command timestamps follow the executor's
+     * clock. Run the executor rather than calling waitForIdle().
+     * 
+     * @param executor Executor to dispatch on; nullptr for dispatch threads
+     * @return False if the dispatcher is already running
+     */
+    bool setExecutor(std::shared_ptr<Executor> executor);
+    
+    /**
+     * @brief Set the handler that executes a command code
+     * 
+     * Replaces any handler registered for the code. Safe while commands are
+     * being dispatched; running handlers are not interrupted.
+     * 
+     * @param commandCode Command operation code
+     * @param handler Handler to run, or nullptr to remove it
+     * @return True if registration successful
+     */
+    bool registerCommandHandler(uint16_t commandCode, CommandHandler handler);
+    
+    /**
+     * @brief Limit the rate at which a source's commands are accepted
+     * 
+     * @param source Command source to limit
+     * @param commandsPerSecond Sustained rate; 0 removes the limit
+     * @param burst Commands accepted back to back before the rate applies
+     */
+    void setRateLimit(CommandSource source, double commandsPerSecond, uint32_t burst = 1);
+    
+    /**
+     * @brief Require commands from a source to be signed with a key
+     * 
+     * Commands from a source without a key are accepted unsigned.
+     * 
+     * @param source Command source
+     * @param key Key shared with the source
+     */
+    void setSourceKey(CommandSource source, const CommandKey& key);
+    
+    /**
+     * @brief Wait until every queued command has been executed
+     * 
+     * Commands held back by the current system mode count as queued.
+     * 
+     * @param timeout Longest time to wait
+     * @return False on timeout
+     */
+    bool waitForIdle(std::chrono::milliseconds timeout = std::chrono::seconds(5));
+    
+    /**
+     * @brief Get the dispatcher counters
+     */
+    CommandDispatchStats getDispatchStats() const;
+    
+    /**
+     * @brief Get the current system mode
+     */
+    SystemMode getSystemMode() const { return m_currentMode.load(); }
+    
 private:
+    // One queued command with its completion callback
+    struct QueuedCommand {
+        Command command{};
+        CommandCallback callback;
+        int64_t enqueuedNs{0};        // dispatchNowNs() when queued
+    };
+    
+    // A dispatch thread serving a contiguous range of priorities, with the
+    // same wake-up handshake as NotificationBus
+    struct DispatchLane {
+        size_t firstPriority{0};
+        size_t lastPriority{0};
+        std::thread thread;
+        std::mutex wakeMutex;
+        std::condition_variable wake;
+        std::atomic<uint64_t> signals{0};
+        std::atomic<bool> waiting{false};
+        TimerId pass{0};              // Pending executor pass, guarded by wakeMutex
+    };
+    
+    // Generic cell rate algorithm: one atomic per source, no lock
+    struct SourceRateLimit {
+        std::atomic<int64_t> intervalNs{0};       // 0 = unlimited
+        std::atomic<int64_t> toleranceNs{0};
+        std::atomic<int64_t> theoreticalArrivalNs{0};
+    };
+    
+    using HandlerTable = std::unordered_map<uint16_t, CommandHandler>;
+    using KeyTable = std::array<std::shared_ptr<const CommandKeySchedule>, kCommandSourceCount>;
+    
+    static constexpr size_t kCommandQueueCapacity = 256;
+
     // Subsystem references
     std::shared_ptr<RFController> m_rfController;
     std::shared_ptr<PowerManager> m_powerManager;
     std::shared_ptr<OrbitalTaskManager> m_orbitalTaskManager;
     std::shared_ptr<HealthMonitor> m_healthMonitor;
     
-    // Command processing queues
-    std::vector<std::pair<Command, CommandCallback>> m_highPriorityQueue;
-    std::vector<std::pair<Command, CommandCallback>> m_normalPriorityQueue;
-    std::vector<std::pair<Command, CommandCallback>> m_lowPriorityQueue;
+    // Command processing queues, indexed by CommandPriority
+    std::array<std::unique_ptr<BoundedMpmcRing<QueuedCommand>>, kCommandPriorityCount> m_commandQueues;
+    std::array<DispatchLane, 2> m_lanes;      // EMERGENCY; HIGH to DEFERRED
+    std::shared_ptr<Executor> m_executor;     // Runs the lanes instead of threads; set while stopped
+    std::array<SourceRateLimit, kCommandSourceCount> m_rateLimits;
+    
+    // Copy-on-write tables, read by the dispatch threads without locking
+    std::mutex m_tableMutex;
+    std::shared_ptr<const HandlerTable> m_handlers;
+    std::shared_ptr<const KeyTable> m_keys;
     
     // Synchronization and protection
-    std::mutex m_commandQueueMutex;
-    std::mutex m_telemetryQueueMutex;
+    std::mutex m_telemetryQueueMutex;             // Guards m_telemetryCollector
+    TelemetryCollector m_telemetryCollector;
     std::atomic<bool> m_isProcessingCommands;
+    std::atomic<bool> m_stopping;
+    std::atomic<uint32_t> m_nextCommandId;
+    
+    // Idle tracking for waitForIdle()
+    std::atomic<size_t> m_pendingCommands;
+    std::mutex m_idleMutex;
+    std::condition_variable m_idle;
+    
+    // Dispatcher counters
+    std::atomic<uint64_t> m_executedCount;
+    std::atomic<uint64_t> m_rejectedCount;
+    std::atomic<uint64_t> m_rateLimitedCount;
+    std::atomic<uint64_t> m_queueFullCount;
+    std::array<std::atomic<int64_t>, kCommandPriorityCount> m_maxQueueLatencyNs;
+    
+    // Registry histograms: queueing latency per priority, handler run time
+    std::array<LatencyHistogram*, kCommandPriorityCount> m_dispatchLatency;
+    LatencyHistogram& m_executionTime;
     
     // Internal state
     std::atomic<SystemMode> m_currentMode;
     std::atomic<bool> m_inSafeMode;
     std::atomic<uint32_t> m_lastErrorCode;
     
+    // State checkpoints, guarded by m_checkpointMutex
+    std::mutex m_checkpointMutex;
+    std::shared_ptr<CheckpointStore> m_checkpointStore;
+    TaskFunctionResolver m_taskResolver;
+    
     // Private implementation methods
     bool authenticateCommand(const Command& command);
     bool validateCommandParameters(const Command& command);
     void executeCommand(const Command& command, CommandCallback callback);
     void processCommandQueues();
     
+    // Dispatch internals
+    CommandStatus checkCommand(const Command& command);
+    CommandStatus rejectCommand(const Command& command, CommandStatus status);
+    CommandStatus enqueueCommand(const Command& command, CommandCallback callback);
+    bool acquireRateToken(CommandSource source);
+    bool isPriorityRunnable(size_t priority) const;
+    bool dispatchNext(DispatchLane& lane);
+    void dispatchLoop(DispatchLane& lane);
+    void dispatchPass(DispatchLane& lane);
+    void signalLane(DispatchLane& lane);
+    int64_t dispatchNowNs() const;
+    void stopDispatch();
+    
     // Radiation mitigation methods
     bool performTripleCommandValidation(const Command& command);
     void scrubCommandQueue();
     void performStateValidation();
     
-    // Error recovery methods
-    void recordSubsystemState();
+    // Error recovery methods (m_checkpointMutex must be held)
+    bool recordSubsystemState();
     bool restoreLastKnownGoodState();
     void notifyGroundOfStateChange(uint16_t stateChangeType);
 };
@@ -0,0 +1,41 @@
+/**
+ * @file crc32c.h
+ * @brief CRC32C (Castagnoli) checksums with hardware acceleration
+ *
+ * Uses the SSE4.2 or ARMv8 CRC32 instructions when the CPU provides them
+ * and a slicing-by-8 table otherwise. All paths produce identical values.
+ */
+
+#ifndef SKYMESH_CORE_CRC32C_H
+#define SKYMESH_CORE_CRC32C_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace skymesh {
+namespace core {
+
+/**
+ * @brief Extend a finished CRC32C with size more bytes
+ *
+ * crc32cExtend(crc32c(a), b) equals the CRC32C of a followed by b.
+ * @param crc CRC32C of the preceding bytes, or 0 to start a new checksum
+ */
+uint32_t crc32cExtend(uint32_t crc, const void* data, size_t size);
+
+/**
+ * @brief CRC32C of size bytes
+ */
+inline uint32_t crc32c(const void* data, size_t size) {
+    return crc32cExtend(0, data, size);
+}
+
+/**
+ * @brief Whether crc32cExtend uses CRC32 instructions on this CPU
+ */
+bool crc32cHardwareAccelerated();
+
+} // namespace core
+} // namespace skymesh
+
+#endif // SKYMESH_CORE_CRC32C_H
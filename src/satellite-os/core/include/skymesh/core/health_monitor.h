@@ -19,9 +19,16 @@
 #include <mutex>
 #include <thread>
 
+#include "skymesh/core/telemetry_ring.h"
+
 namespace skymesh {
 namespace core {
 
+class CheckpointStore;
+class Executor;
+class NotificationBus;
+class SensorBackend;
+
 /**
  * @brief Component health status enumeration
  */
@@ -81,6 +88,19 @@ struct ComponentHealth {
     std::chrono::system_clock::time_point last_updated;  ///< Last update timestamp
 };
 
+/**
+ * @brief Point-in-time copy of everything a health report carries
+ *
+ * Components and sensors are listed in registration order, which is the
+ * schema binary health reports index them by.
+ */
+struct HealthSnapshot {
+    std::chrono::system_clock::time_point timestamp;  ///< Capture time
+    RadiationData radiation;                          ///< Latest radiation data
+    std::vector<ComponentHealth> components;          ///< Health of every registered component
+    std::vector<TemperatureData> temperatures;        ///< Latest reading of every registered sensor
+};
+
 /**
  * @brief Health alert configuration
  */
@@ -92,6 +112,22 @@ struct HealthAlertConfig {
     uint8_t priority;              ///< Alert priority (0-255, 0 highest)
 };
 
+/**
+ * @brief Adaptive sampling rates for one monitored source
+ *
+ * A source is sampled at the fast interval while it shows an excursion
+ * (high dose rate, or a temperature above the warning threshold or moving
+ * quickly), at the quiet interval once it has stayed nominal for
+ * quiet_after_samples consecutive samples, and at the nominal interval
+ * otherwise.
+ */
+struct SamplingPolicy {
+    std::chrono::milliseconds nominal_interval{1000};  ///< Interval in normal conditions
+    std::chrono::milliseconds fast_interval{250};      ///< Interval during excursions
+    std::chrono::milliseconds quiet_interval{4000};    ///< Interval once conditions have settled
+    uint32_t quiet_after_samples = 10;                 ///< Nominal samples before the quiet interval applies
+};
+
 /**
  * @brief Callback function type for health status change notifications
  */
@@ -99,6 +135,9 @@ using HealthStatusCallback = std::function<void(const ComponentHealth&)>;
 
 /**
  * @brief Interface for the satellite health monitoring system
+ *
+ * Query methods read published snapshots and per-sensor telemetry rings,
+ * so they never wait for a monitoring pass to finish.
  */
 class HealthMonitor {
 public:
@@ -106,6 +145,10 @@ public:
 
     /**
      * @brief Initialize the health monitoring system
+     *
+     * Resets every source to a default SamplingPolicy with the polling
+     * interval as its nominal interval, a quarter of it as the fast
+     * interval and four times it as the quiet interval.
      * @param polling_interval_ms Interval for regular health checks in milliseconds
      * @return true if initialization successful, false otherwise
      */
@@ -122,6 +165,53 @@ public:
      */
     virtual void stop() = 0;
 
+    /**
+     * @brief Add a component to monitor
+     * @param component_id Unique identifier for the component
+     * @param type Component type; temperature sensors of this type feed its health
+     * @return false if the ID is already registered or the component table is full
+     */
+    virtual bool registerComponent(const std::string& component_id, ComponentType type) = 0;
+
+    /**
+     * @brief Add a temperature sensor to sample on every poll
+     * @param sensor_id Unique sensor identifier
+     * @param component Component the sensor measures
+     * @param initial_celsius Starting reading for simulated sensors
+     * @return false if the ID is already registered or the sensor table is full
+     */
+    virtual bool registerTemperatureSensor(const std::string& sensor_id, ComponentType component,
+                                           float initial_celsius = 20.0f) = 0;
+
+    /**
+     * @brief Set the sampling rates for the sensors and health checks of a component type
+     * @param component Component type
+     * @param policy Sampling policy; intervals are clamped to at least 1 ms
+     */
+    virtual void setSamplingPolicy(ComponentType component, const SamplingPolicy& policy) = 0;
+
+    /**
+     * @brief Set the sampling rates for the radiation sensor
+     * @param policy Sampling policy; intervals are clamped to at least 1 ms
+     */
+    virtual void setRadiationSamplingPolicy(const SamplingPolicy& policy) = 0;
+
+    /**
+     * @brief Interval the monitor currently samples a component type at
+     * @param component Component type
+     * @return Interval chosen after the type's latest sample
+     */
+    virtual std::chrono::milliseconds currentSamplingInterval(ComponentType component) const = 0;
+
+    /**
+     * @brief Wake the monitor to sample the radiation sensor and a component type now
+     *
+     * For use after an event such as a detected single event upset; the
+     * regular schedule continues from the new sample.
+     * @param component Component type to check
+     */
+    virtual void requestImmediateCheck(ComponentType component) = 0;
+
     /**
      * @brief Get the current health status of a component
      * @param component_id Unique identifier for the component
@@ -137,6 +227,10 @@ public:
 
     /**
      * @brief Register a callback for health status changes
+     *
+     * Callbacks run on the notification bus thread, never on the monitoring
+     * thread. A component that keeps reporting the same status and
+     * diagnostic is notified once, when the status is first reported.
      * @param callback Function to call when component health changes
      * @param component_type Optional component type to filter notifications
      * @return Callback ID for later removal
@@ -171,6 +265,51 @@ public:
     virtual TemperatureData getTemperature(ComponentType component,
                                            const std::string& sensor_id = "") const = 0;
 
+    /**
+     * @brief Radiation dose rate statistics over a trailing window
+     * @param window Window length, ending at the latest sample
+     * @return Dose rate statistics in rads/hour
+     */
+    virtual TelemetryWindowStats getDoseRateStats(std::chrono::milliseconds window) const = 0;
+
+    /**
+     * @brief Temperature statistics over a trailing window
+     * @param component Component type
+     * @param window Window length, ending at the latest sample
+     * @param sensor_id Optional specific sensor ID; defaults to the component's first sensor
+     * @return Temperature statistics in Celsius; empty if no such sensor
+     */
+    virtual TelemetryWindowStats getTemperatureStats(ComponentType component,
+                                                     std::chrono::milliseconds window,
+                                                     const std::string& sensor_id = "") const = 0;
+
+    /**
+     * @brief Capture the latest health data without waiting for the monitoring pass
+     * @return Snapshot of radiation, component health and temperatures
+     */
+    virtual HealthSnapshot getHealthSnapshot() const = 0;
+
+    /**
+     * @brief Encode a binary health report into a caller-provided buffer
+     *
+     * Produces a report delta-encoded against the last acknowledged one,
+     * or a full report when full_report is set, nothing has been
+     * acknowledged yet, or the component or sensor set has changed since.
+     * A full report always fits in HealthReportEncoder::kMaxFrameBytes.
+     * @param buffer Destination, e.g. an RF packet buffer
+     * @param capacity Size of the destination in bytes
+     * @param full_report Force a full report
+     * @return Bytes written, or 0 if the report did not fit
+     */
+    virtual size_t encodeHealthReport(uint8_t* buffer, size_t capacity, bool full_report = false) = 0;
+
+    /**
+     * @brief Record that the ground received a report, making it the delta base
+     * @param sequence Sequence number of the received report
+     * @return false if the report is no longer in the encoder's history
+     */
+    virtual bool acknowledgeHealthReport(uint16_t sequence) = 0;
+
     /**
      * @brief Initiate recovery procedure for a component
      * @param component_id Identifier for the component to recover
@@ -180,18 +319,46 @@ public:
 
     /**
      * @brief Report health information to ground station
-     * @param full_report If true, send comprehensive health data
+     *
+     * Sends one binary report, see encodeHealthReport().
+     * @param full_report If true, send a full report rather than a delta
      * @return true if report was queued successfully
      */
     virtual bool reportToGround(bool full_report = false) = 0;
+
+    /**
+     * @brief Save radiation totals, component health and the telemetry history
+     * @param store Checkpoint to write the HEALTH section of
+     * @return true if the section was committed
+     */
+    virtual bool saveCheckpoint(CheckpointStore& store) = 0;
+
+    /**
+     * @brief Restore what saveCheckpoint() saved, after a reset
+     *
+     * Applies to the components and temperature sensors registered under
+     * the same IDs; anything else in the checkpoint is ignored. Call after
+     * registration and before start() or any telemetry query.
+     * @param store Checkpoint to read the HEALTH section of
+     * @return true if the saved state was applied
+     */
+    virtual bool restoreCheckpoint(const CheckpointStore& store) = 0;
 };
 
 /**
  * @brief Factory function to create health monitor instance
  * @param config_path Path to configuration file (optional)
+ * @param notification_bus Bus to deliver status callbacks on; a private one is created if empty
+ * @param sensors Source of radiation and temperature readings, whose clock
+ *                stamps all telemetry; a steady simulation if empty
+ * @param executor Runs sampling inline on this executor, on its clock, instead
+ *                 of a monitoring thread; give the sensors the same clock
  * @return Unique pointer to HealthMonitor implementation
  */
-std::unique_ptr<HealthMonitor> createHealthMonitor(const std::string& config_path = "");
+std::unique_ptr<HealthMonitor> createHealthMonitor(const std::string& config_path = "",
+                                                   std::shared_ptr<NotificationBus> notification_bus = nullptr,
+                                                   std::shared_ptr<SensorBackend> sensors = nullptr,
+                                                   std::shared_ptr<Executor> executor = nullptr);
 
 } // namespace core
 } // namespace skymesh
@@ -0,0 +1,165 @@
+/**
+ * @file health_report_codec.h
+ * @brief Compact binary health reports for the downlink
+ *
+ * Reports are written straight into a caller-provided buffer, such as a
+ * TelemetryPacket payload or rf_packet_t data, and a full report always
+ * fits one RF frame. Values are quantized to fixed point:
+ *
+ * | Field             | Encoding                          |
+ * |-------------------|-----------------------------------|
+ * | total dose        | u32, 0.01 rad                     |
+ * | dose rate         | u16, 0.1 rad/hour                 |
+ * | upsets            | u16, saturating                   |
+ * | status            | 3-bit HealthStatus code           |
+ * | health percentage | u8, 0.5 % steps                   |
+ * | temperature       | i16, 0.01 Celsius                 |
+ *
+ * All multi-byte fields are little endian. A full report is
+ *
+ *     u8 version/flags, u16 sequence, u32 time (s since epoch),
+ *     u32 dose, u16 dose rate, u16 upsets,
+ *     u8 component count, packed 3-bit statuses, u8 health each,
+ *     u8 sensor count, i16 temperature each
+ *
+ * A delta report carries the sequence of the acknowledged base report, a
+ * section mask, and per section a change bitmap followed by zigzag varint
+ * differences (statuses of changed components stay 3-bit packed). The
+ * component and sensor order is the registration order of the monitor.
+ */
+
+#ifndef SKYMESH_CORE_HEALTH_REPORT_CODEC_H
+#define SKYMESH_CORE_HEALTH_REPORT_CODEC_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "skymesh/core/health_monitor.h"
+
+namespace skymesh {
+namespace core {
+
+/**
+ * @brief Report contents after quantization, as both ends hold them
+ */
+struct QuantizedHealthReport {
+    static constexpr size_t kMaxComponents = 64;
+    static constexpr size_t kMaxSensors = 64;
+
+    uint16_t sequence = 0;
+    uint32_t time_s = 0;
+    uint32_t total_dose = 0;                          ///< 0.01 rad
+    uint16_t dose_rate = 0;                           ///< 0.1 rad/hour
+    uint16_t upsets = 0;
+    uint8_t component_count = 0;
+    uint8_t sensor_count = 0;
+    std::array<uint8_t, kMaxComponents> status{};     ///< HealthStatus codes
+    std::array<uint8_t, kMaxComponents> health{};     ///< 0.5 % steps
+    std::array<int16_t, kMaxSensors> temperature{};   ///< 0.01 Celsius
+};
+
+/**
+ * @brief Health report as decoded on the ground
+ */
+struct DecodedHealthReport {
+    uint16_t sequence = 0;                            ///< Report sequence number
+    bool delta = false;                               ///< Whether the report was delta encoded
+    std::chrono::system_clock::time_point timestamp;  ///< Capture time, to the second
+    float total_dose = 0.0f;                          ///< Cumulative dose in rads
+    float dose_rate = 0.0f;                           ///< Dose rate in rads/hour
+    uint32_t single_event_upsets = 0;                 ///< Upset count
+    std::vector<HealthStatus> status;                 ///< Per component, in schema order
+    std::vector<float> health_percentage;             ///< Per component, in schema order
+    std::vector<float> temperature_celsius;           ///< Per sensor, in schema order
+};
+
+/**
+ * @class HealthReportEncoder
+ * @brief Encodes health snapshots into full or delta binary reports
+ *
+ * Keeps the last few sent reports so an acknowledgement can make any of
+ * them the delta base. Encoding never allocates. Not thread-safe.
+ */
+class HealthReportEncoder {
+public:
+    /// Largest report; MAX_PACKET_SIZE of the RF controller
+    static constexpr size_t kMaxFrameBytes = 256;
+
+    /// Sent reports remembered for acknowledgement
+    static constexpr size_t kHistory = 8;
+
+    /**
+     * @brief Encode a snapshot
+     * @param snapshot Health data; at most QuantizedHealthReport::kMaxComponents
+     *                 components and kMaxSensors sensors
+     * @param buffer Destination
+     * @param capacity Size of the destination in bytes
+     * @param full Force a full report even if a delta is possible
+     * @return Bytes written, or 0 if the report did not fit or the snapshot is too large
+     */
+    size_t encode(const HealthSnapshot& snapshot, uint8_t* buffer, size_t capacity, bool full = false);
+
+    /**
+     * @brief Make a sent report the base for later deltas
+     * @param sequence Sequence number of the acknowledged report
+     * @return false if the report is not in the history
+     */
+    bool acknowledge(uint16_t sequence);
+
+    /**
+     * @brief Sequence number the next report will carry
+     */
+    uint16_t nextSequence() const { return next_sequence_; }
+
+    /**
+     * @brief Quantize a snapshot as the encoder would
+     */
+    static bool quantize(const HealthSnapshot& snapshot, QuantizedHealthReport& out);
+
+private:
+    // Sent reports, indexed by sequence modulo kHistory
+    std::array<QuantizedHealthReport, kHistory> history_{};
+    size_t history_count_ = 0;
+    QuantizedHealthReport base_{};
+    bool has_base_ = false;
+    uint16_t next_sequence_ = 0;
+    QuantizedHealthReport current_{};
+};
+
+/**
+ * @class HealthReportDecoder
+ * @brief Decodes binary health reports, resolving deltas against earlier reports
+ *
+ * Remembers the last few decoded reports; a delta is decodable as long as
+ * its base is among them. Not thread-safe.
+ */
+class HealthReportDecoder {
+public:
+    /**
+     * @brief Decode one report
+     * @param data Report bytes
+     * @param size Number of bytes
+     * @param out Decoded report
+     * @return false if the report is malformed or its delta base is unknown
+     */
+    bool decode(const uint8_t* data, size_t size, DecodedHealthReport& out);
+
+    /**
+     * @brief Read the sequence number and kind of a report without decoding it
+     * @return false if the data is not a report of a known version
+     */
+    static bool readHeader(const uint8_t* data, size_t size, uint16_t& sequence, bool& delta);
+
+private:
+    std::array<QuantizedHealthReport, HealthReportEncoder::kHistory> history_{};
+    size_t history_count_ = 0;
+    size_t history_next_ = 0;
+};
+
+} // namespace core
+} // namespace skymesh
+
+#endif // SKYMESH_CORE_HEALTH_REPORT_CODEC_H
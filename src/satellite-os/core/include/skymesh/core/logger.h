@@ -0,0 +1,314 @@
+/**
+ * @file logger.h
+ * @brief Asynchronous structured logger for the SkyMesh core
+ *
+ * Log calls encode their arguments into a fixed-size record on a lock-free
+ * ring; a background thread formats and writes the records. Levels below
+ * SKYMESH_LOG_LEVEL are removed at compile time, arguments included.
+ */
+
+#ifndef SKYMESH_CORE_LOGGER_H
+#define SKYMESH_CORE_LOGGER_H
+
+#include "skymesh/core/mpmc_ring.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+
+/**
+ * @brief Minimum level compiled into the build (0 = DEBUG ... 3 = ERROR)
+ */
+#ifndef SKYMESH_LOG_LEVEL
+#define SKYMESH_LOG_LEVEL 1
+#endif
+
+namespace skymesh {
+namespace core {
+
+/**
+ * @brief Log severity levels
+ */
+enum class LogLevel : uint8_t {
+    DEBUG = 0,    ///< Detailed diagnostics, normally compiled out
+    INFO = 1,     ///< Normal operational messages
+    WARNING = 2,  ///< Unexpected but recoverable conditions
+    ERROR = 3     ///< Failures requiring attention
+};
+
+namespace detail {
+
+/// Bytes of encoded arguments carried by one log record
+constexpr size_t kLogPayloadBytes = 480;
+
+// Writes log arguments into a record payload, truncating when it is full
+class LogPayloadWriter {
+public:
+    LogPayloadWriter(uint8_t* data, size_t capacity) : data_(data), capacity_(capacity) {}
+
+    template <typename T>
+    void putRaw(const T& value) {
+        if (size_ + sizeof(T) > capacity_) {
+            truncated_ = true;
+            size_ = capacity_;
+            return;
+        }
+        std::memcpy(data_ + size_, &value, sizeof(T));
+        size_ += sizeof(T);
+    }
+
+    void putString(const char* text, size_t length) {
+        if (size_ + sizeof(uint16_t) > capacity_) {
+            truncated_ = true;
+            size_ = capacity_;
+            return;
+        }
+        size_t room = capacity_ - size_ - sizeof(uint16_t);
+        uint16_t stored = static_cast<uint16_t>(length < room ? length : room);
+        putRaw(stored);
+        std::memcpy(data_ + size_, text, stored);
+        size_ += stored;
+        truncated_ = truncated_ || stored < length;
+    }
+
+    size_t size() const { return size_; }
+    bool truncated() const { return truncated_; }
+
+private:
+    uint8_t* data_;
+    size_t capacity_;
+    size_t size_ = 0;
+    bool truncated_ = false;
+};
+
+// Reads arguments back out of a payload; yields empty values past the end
+class LogPayloadReader {
+public:
+    LogPayloadReader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+    template <typename T>
+    T getRaw() {
+        T value{};
+        if (pos_ + sizeof(T) <= size_) {
+            std::memcpy(&value, data_ + pos_, sizeof(T));
+            pos_ += sizeof(T);
+        } else {
+            pos_ = size_;
+        }
+        return value;
+    }
+
+    std::string_view getString() {
+        uint16_t length = getRaw<uint16_t>();
+        size_t available = size_ - pos_;
+        size_t taken = length < available ? length : available;
+        std::string_view text(reinterpret_cast<const char*>(data_ + pos_), taken);
+        pos_ += taken;
+        return text;
+    }
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+    size_t pos_ = 0;
+};
+
+template <typename T>
+constexpr bool kIsLogString = std::is_same<T, const char*>::value ||
+                              std::is_same<T, char*>::value ||
+                              std::is_same<T, std::string>::value ||
+                              std::is_same<T, std::string_view>::value;
+
+template <typename T>
+void encodeLogArg(LogPayloadWriter& writer, const T& value) {
+    using Arg = std::decay_t<T>;
+    if constexpr (kIsLogString<Arg>) {
+        std::string_view text(value);
+        writer.putString(text.data(), text.size());
+    } else if constexpr (std::is_same<Arg, bool>::value) {
+        writer.putRaw(value);
+    } else if constexpr (std::is_enum<Arg>::value) {
+        writer.putRaw(static_cast<int64_t>(value));
+    } else if constexpr (std::is_integral<Arg>::value && std::is_signed<Arg>::value) {
+        writer.putRaw(static_cast<int64_t>(value));
+    } else if constexpr (std::is_integral<Arg>::value) {
+        writer.putRaw(static_cast<uint64_t>(value));
+    } else if constexpr (std::is_floating_point<Arg>::value) {
+        writer.putRaw(static_cast<double>(value));
+    } else {
+        static_assert(std::is_arithmetic<Arg>::value, "Unsupported log argument type");
+    }
+}
+
+template <typename Arg>
+void decodeLogArg(LogPayloadReader& reader, std::ostream& out) {
+    if constexpr (kIsLogString<Arg>) {
+        out << reader.getString();
+    } else if constexpr (std::is_same<Arg, bool>::value) {
+        out << (reader.getRaw<bool>() ? "true" : "false");
+    } else if constexpr (std::is_enum<Arg>::value ||
+                         (std::is_integral<Arg>::value && std::is_signed<Arg>::value)) {
+        out << reader.getRaw<int64_t>();
+    } else if constexpr (std::is_integral<Arg>::value) {
+        out << reader.getRaw<uint64_t>();
+    } else {
+        out << reader.getRaw<double>();
+    }
+}
+
+template <typename... Args>
+void formatLogPayload(std::ostream& out, const uint8_t* data, size_t size) {
+    LogPayloadReader reader(data, size);
+    (decodeLogArg<Args>(reader, out), ...);
+}
+
+} // namespace detail
+
+/**
+ * @brief One queued log message with its arguments still encoded
+ */
+struct LogRecord {
+    std::chrono::system_clock::time_point timestamp;
+    LogLevel level = LogLevel::INFO;
+    bool truncated = false;
+    uint16_t size = 0;
+    const char* component = "";
+    void (*format)(std::ostream&, const uint8_t*, size_t) = nullptr;
+    uint8_t payload[detail::kLogPayloadBytes];
+};
+
+/**
+ * @brief Asynchronous logger draining a bounded ring on a background thread
+ *
+ * Producers never block: when the ring is full the message is dropped and
+ * counted, and the drain thread reports the number of drops. Messages are
+ * written as "<UTC time> [LEVEL] component: message", errors to the error
+ * stream and everything else to the output stream.
+ */
+class Logger {
+public:
+    /// Default ring capacity in records
+    static constexpr size_t kDefaultCapacity = 1024;
+
+    /**
+     * @brief Process-wide logger used by the SKYMESH_LOG_* macros
+     */
+    static Logger& instance();
+
+    /**
+     * @brief Construct a stopped logger writing to std::cout / std::cerr
+     * @param capacity Ring capacity in records
+     */
+    explicit Logger(size_t capacity = kDefaultCapacity);
+    ~Logger();
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    /**
+     * @brief Start the drain thread
+     */
+    void start();
+
+    /**
+     * @brief Write out queued messages and stop the drain thread
+     */
+    void stop();
+
+    /**
+     * @brief Queue a message built from the concatenation of its arguments
+     *
+     * Arguments may be strings, arithmetic values or enums; they are copied
+     * into the record and formatted later, so they need not outlive the call.
+     *
+     * @param level Message severity
+     * @param component Subsystem name; must have static storage duration
+     * @param args Message fragments
+     */
+    template <typename... Args>
+    void log(LogLevel level, const char* component, const Args&... args) {
+        bool queued = ring_.tryEmplace([&](LogRecord& record) {
+            record.timestamp = std::chrono::system_clock::now();
+            record.level = level;
+            record.component = component;
+            record.format = &detail::formatLogPayload<std::decay_t<Args>...>;
+
+            detail::LogPayloadWriter writer(record.payload, sizeof(record.payload));
+            (detail::encodeLogArg(writer, args), ...);
+            record.size = static_cast<uint16_t>(writer.size());
+            record.truncated = writer.truncated();
+        });
+
+        if (queued) {
+            accepted_.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Block until every message queued before the call has been written
+     */
+    void flush();
+
+    /**
+     * @brief Redirect output; both streams must outlive their use by the logger
+     */
+    void setStreams(std::ostream& out, std::ostream& err);
+
+    /**
+     * @brief Total messages dropped because the ring was full
+     */
+    uint64_t droppedCount() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    void drainThread();
+    size_t drainBatch();
+
+    BoundedMpmcRing<LogRecord> ring_;
+    std::atomic<uint64_t> accepted_{0};
+    std::atomic<uint64_t> dropped_{0};
+
+    // Drain state
+    std::mutex drain_mutex_;
+    std::condition_variable drain_condition_;
+    std::condition_variable flushed_condition_;
+    std::thread drain_thread_;
+    bool running_ = false;
+    uint64_t written_ = 0;
+    uint64_t reported_drops_ = 0;
+    std::ostream* out_;
+    std::ostream* err_;
+};
+
+} // namespace core
+} // namespace skymesh
+
+/**
+ * @brief Log at a fixed level; compiled out entirely below SKYMESH_LOG_LEVEL
+ */
+#define SKYMESH_LOG_AT(level, component, ...)                                       \
+    do {                                                                            \
+        if constexpr (static_cast<int>(level) >= SKYMESH_LOG_LEVEL) {              \
+            ::skymesh::core::Logger::instance().log((level), (component), __VA_ARGS__); \
+        }                                                                           \
+    } while (0)
+
+#define SKYMESH_LOG_DEBUG(component, ...) \
+    SKYMESH_LOG_AT(::skymesh::core::LogLevel::DEBUG, component, __VA_ARGS__)
+#define SKYMESH_LOG_INFO(component, ...) \
+    SKYMESH_LOG_AT(::skymesh::core::LogLevel::INFO, component, __VA_ARGS__)
+#define SKYMESH_LOG_WARNING(component, ...) \
+    SKYMESH_LOG_AT(::skymesh::core::LogLevel::WARNING, component, __VA_ARGS__)
+#define SKYMESH_LOG_ERROR(component, ...) \
+    SKYMESH_LOG_AT(::skymesh::core::LogLevel::ERROR, component, __VA_ARGS__)
+
+#endif // SKYMESH_CORE_LOGGER_H
@@ -0,0 +1,185 @@
+/**
+ * @file mesh_simulation.h
+ * @brief Discrete-event simulation of a satellite mesh in one process
+ *
+ * Every satellite runs the real power manager, health monitor, task
+ * manager and command dispatcher, all on one shared SimulationExecutor, so
+ * hundreds of them advance together in simulated time as fast as their
+ * work allows. Satellites talk over simulated RF links with latency, a bit
+ * rate, a bounded transmit queue and seeded loss and corruption.
+ *
+ * Two kinds of traffic cross the links:
+ *
+ * - Broadcast commands enter at satellite 0 from the ground and are
+ *   flooded to every satellite as signed CommandSource::MESH_PEER
+ *   commands, each satellite forwarding a broadcast the first time it runs.
+ * - Telemetry sweeps stream from every satellite toward satellite 0 along
+ *   a shortest-path tree, pausing when the uplink's queue is full.
+ *
+ * The same configuration and calls replay the same run.
+ */
+
+#ifndef SKYMESH_CORE_MESH_SIMULATION_H
+#define SKYMESH_CORE_MESH_SIMULATION_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "skymesh/core/clock.h"
+#include "skymesh/core/command_control.h"
+
+namespace skymesh {
+namespace core {
+
+/**
+ * @brief Model of one RF link, applied to each direction separately
+ */
+struct RfLinkProfile {
+    std::chrono::microseconds latency{5000};   ///< Propagation and processing delay
+    double bit_rate = 1.0e6;                   ///< Bits per second; frames are serialized one at a time
+    double loss_probability = 0.0;             ///< Chance a frame never arrives
+    double corruption_probability = 0.0;       ///< Chance a frame arrives with one byte flipped
+    size_t queue_limit = 32;                   ///< Frames queued or in flight before sends are refused
+};
+
+/**
+ * @brief Mesh size, link model and per-satellite cadence
+ */
+struct MeshSimulationConfig {
+    size_t satellites = 16;                                  ///< Number of satellites
+    uint64_t seed = 1;                                       ///< Seed of sensor noise and link loss
+    RfLinkProfile link;                                      ///< Model of every link
+    std::chrono::milliseconds power_update_interval{1000};  ///< PowerManager::update() period
+    std::chrono::milliseconds telemetry_interval{10000};    ///< Telemetry emit period; 0 disables telemetry
+    uint32_t health_polling_ms = 1000;                       ///< Health monitor polling interval
+    std::optional<CommandKey> mesh_key;                      ///< Signs MESH_PEER and ground commands; unsigned if empty
+    std::chrono::system_clock::time_point epoch{SimulationExecutor::kDefaultEpoch};  ///< Simulated start time
+};
+
+/**
+ * @brief Counters of a mesh simulation
+ */
+struct MeshSimulationStats {
+    uint64_t frames_sent = 0;           ///< Frames accepted by a link
+    uint64_t frames_delivered = 0;      ///< Frames that reached the far end
+    uint64_t frames_lost = 0;           ///< Frames the link lost
+    uint64_t frames_corrupted = 0;      ///< Frames delivered with a flipped byte
+    uint64_t queue_drops = 0;           ///< Sends refused by a full link queue
+    uint64_t commands_accepted = 0;     ///< Commands queued by a dispatcher
+    uint64_t commands_rejected = 0;     ///< Commands a dispatcher refused or could not decode
+    uint64_t broadcasts_executed = 0;   ///< Broadcast commands run, counting each satellite once
+    uint64_t telemetry_frames = 0;      ///< Valid telemetry frames that reached satellite 0
+    uint64_t telemetry_bytes = 0;       ///< Bytes of those frames
+    std::chrono::nanoseconds simulated_time{0};  ///< Simulated time since start()
+};
+
+/**
+ * @brief Spread of one broadcast through the mesh
+ */
+struct BroadcastCoverage {
+    size_t reached = 0;                         ///< Satellites that ran it
+    std::chrono::nanoseconds max_latency{0};    ///< Slowest satellite, from uplink to execution
+};
+
+/**
+ * @class MeshSimulation
+ * @brief Satellites, links and a shared executor
+ *
+ * Connect the topology, start(), then run() for spans of simulated time.
+ * Not thread-safe; everything runs on the thread calling run().
+ */
+class MeshSimulation {
+public:
+    /// Command code of flooded broadcasts; the data starts with a u32 broadcast id
+    static constexpr uint16_t kBroadcastCommandCode = 0x4D01;
+
+    explicit MeshSimulation(const MeshSimulationConfig& config = MeshSimulationConfig());
+    ~MeshSimulation();
+
+    MeshSimulation(const MeshSimulation&) = delete;
+    MeshSimulation& operator=(const MeshSimulation&) = delete;
+
+    /**
+     * @brief Add a bidirectional link
+     * @return false if either satellite is out of range, they are the same, or already linked
+     */
+    bool link(size_t a, size_t b);
+
+    /**
+     * @brief Link satellites as a tree rooted at 0, each with up to fanout children
+     */
+    void connectTree(size_t fanout);
+
+    /**
+     * @brief Link every satellite to the next, and the last to the first
+     */
+    void connectRing();
+
+    /**
+     * @brief Start every satellite's subsystems and recurring tasks
+     */
+    bool start();
+
+    /**
+     * @brief Stop every satellite's tasks and sampling; frames still on a link are dropped
+     */
+    void stop();
+
+    /**
+     * @brief Run a span of simulated time
+     * @return Number of executor events run
+     */
+    size_t run(std::chrono::nanoseconds duration);
+
+    /**
+     * @brief Uplink a broadcast command to satellite 0
+     * @param payload Data carried after the broadcast id
+     * @param priority Priority on every satellite
+     * @return Broadcast id for coverage(), or 0 if satellite 0 refused it
+     */
+    uint32_t broadcastCommand(const std::vector<uint8_t>& payload,
+                              CommandPriority priority = CommandPriority::NORMAL);
+
+    /**
+     * @brief How far a broadcast has spread
+     */
+    BroadcastCoverage coverage(uint32_t broadcast_id) const;
+
+    /**
+     * @brief Hops from satellite 0, or SIZE_MAX if unreachable
+     */
+    size_t hopsToRoot(size_t satellite) const;
+
+    /**
+     * @brief Get the simulation counters
+     */
+    MeshSimulationStats stats() const;
+
+    /**
+     * @brief Number of satellites
+     */
+    size_t size() const;
+
+    /**
+     * @brief Shared executor every satellite runs on
+     */
+    SimulationExecutor& executor();
+
+    /**
+     * @brief Command dispatcher of a satellite, e.g. to register handlers
+     */
+    CommandControl& commandControl(size_t satellite);
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+} // namespace core
+} // namespace skymesh
+
+#endif // SKYMESH_CORE_MESH_SIMULATION_H
@@ -0,0 +1,165 @@
+/**
+ * @file mpmc_ring.h
+ * @brief Bounded lock-free multi-producer/multi-consumer ring buffer
+ *
+ * Sequence-numbered cell design (D. Vyukov): each producer or consumer
+ * claims a slot with a single CAS on its position counter, and hands the
+ * slot over by publishing the cell's sequence number. No operation blocks
+ * or allocates after construction.
+ */
+
+#ifndef SKYMESH_CORE_MPMC_RING_H
+#define SKYMESH_CORE_MPMC_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace skymesh {
+namespace core {
+
+/**
+ * @brief Fixed-capacity lock-free queue
+ * @tparam T Element type; must be default constructible and move assignable
+ */
+template <typename T>
+class BoundedMpmcRing {
+public:
+    /**
+     * @brief Construct an empty ring
+     * @param capacity Minimum number of elements, rounded up to a power of two
+     */
+    explicit BoundedMpmcRing(size_t capacity)
+        : capacity_(roundUpPowerOfTwo(capacity < 2 ? 2 : capacity)),
+          mask_(capacity_ - 1),
+          cells_(new Cell[capacity_]) {
+        for (size_t i = 0; i < capacity_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedMpmcRing(const BoundedMpmcRing&) = delete;
+    BoundedMpmcRing& operator=(const BoundedMpmcRing&) = delete;
+
+    /**
+     * @brief Claim a free slot and fill it in place
+     * @param fill Callable invoked as fill(T&) on the claimed slot
+     * @return false if the ring is full
+     */
+    template <typename Fill>
+    bool tryEmplace(Fill&& fill) {
+        Cell* cell = nullptr;
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        fill(cell->value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Push a value
+     * @return false if the ring is full
+     */
+    bool tryPush(T value) {
+        return tryEmplace([&value](T& slot) { slot = std::move(value); });
+    }
+
+    /**
+     * @brief Take the oldest element and hand it to a consumer in place
+     * @param consume Callable invoked as consume(T&) before the slot is released
+     * @return false if the ring is empty
+     */
+    template <typename Consume>
+    bool tryConsume(Consume&& consume) {
+        Cell* cell = nullptr;
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+
+            if (diff == 0) {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        consume(cell->value);
+        cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pop the oldest element
+     * @return false if the ring is empty
+     */
+    bool tryPop(T& out) {
+        return tryConsume([&out](T& slot) { out = std::move(slot); });
+    }
+
+    /**
+     * @brief Approximate number of queued elements
+     */
+    size_t sizeApprox() const {
+        size_t enqueued = enqueue_pos_.load(std::memory_order_relaxed);
+        size_t dequeued = dequeue_pos_.load(std::memory_order_relaxed);
+        return enqueued >= dequeued ? enqueued - dequeued : 0;
+    }
+
+    /**
+     * @brief Number of slots in the ring
+     */
+    size_t capacity() const { return capacity_; }
+
+private:
+    static constexpr size_t kCacheLine = 64;
+
+    struct alignas(kCacheLine) Cell {
+        std::atomic<size_t> sequence{0};
+        T value{};
+    };
+
+    static size_t roundUpPowerOfTwo(size_t value) {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    const size_t capacity_;
+    const size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+
+    alignas(kCacheLine) std::atomic<size_t> enqueue_pos_{0};
+    alignas(kCacheLine) std::atomic<size_t> dequeue_pos_{0};
+};
+
+} // namespace core
+} // namespace skymesh
+
+#endif // SKYMESH_CORE_MPMC_RING_H
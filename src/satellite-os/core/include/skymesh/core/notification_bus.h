@@ -0,0 +1,285 @@
+/**
+ * @file notification_bus.h
+ * @brief Asynchronous delivery of subsystem notifications to subscribers
+ *
+ * Publishers enqueue events into a bounded per-topic queue and return
+ * immediately; one delivery thread per bus runs the subscriber callbacks.
+ * A slow subscriber therefore delays other subscribers on the same bus but
+ * never the subsystem that published, and publishing never happens under
+ * a lock a callback could need. Subscriber lists are copy-on-write, so
+ * subscribing and unsubscribing never block delivery.
+ */
+
+#ifndef SKYMESH_CORE_NOTIFICATION_BUS_H
+#define SKYMESH_CORE_NOTIFICATION_BUS_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "skymesh/core/logger.h"
+#include "skymesh/core/mpmc_ring.h"
+
+namespace skymesh {
+namespace core {
+
+/**
+ * @brief Queue of events a NotificationBus delivers
+ */
+class NotificationTopicBase {
+public:
+    virtual ~NotificationTopicBase() = default;
+
+    /**
+     * @brief Deliver every queued event; called on the bus delivery thread
+     * @return Number of events delivered
+     */
+    virtual size_t deliverPending() = 0;
+};
+
+/**
+ * @class NotificationBus
+ * @brief Delivery thread shared by any number of notification topics
+ *
+ * The thread starts on construction and stops, after delivering what is
+ * still queued, on destruction. Share one bus between subsystems to run
+ * all their callbacks on a single thread.
+ */
+class NotificationBus {
+public:
+    NotificationBus();
+    ~NotificationBus();
+
+    NotificationBus(const NotificationBus&) = delete;
+    NotificationBus& operator=(const NotificationBus&) = delete;
+
+    /**
+     * @brief Start delivering a topic's events
+     */
+    void attach(NotificationTopicBase* topic);
+
+    /**
+     * @brief Stop delivering a topic's events
+     *
+     * Waits for a delivery round in progress, so the topic may be destroyed
+     * once this returns.
+     */
+    void detach(NotificationTopicBase* topic);
+
+    /**
+     * @brief Wake the delivery thread after an event was enqueued
+     */
+    void signal();
+
+    /**
+     * @brief Wait until every event enqueued before the call has been delivered
+     * @param timeout Longest time to wait
+     * @return false on timeout; returns true at once on the delivery thread
+     */
+    bool flush(std::chrono::milliseconds timeout = std::chrono::seconds(5));
+
+    /**
+     * @brief Wait for a delivery round in progress to finish
+     *
+     * After an unsubscribe, guarantees the removed callback is no longer
+     * running. Returns at once on the delivery thread.
+     */
+    void waitForDelivery();
+
+    /**
+     * @brief Number of events delivered since construction
+     */
+    uint64_t deliveredCount() const { return delivered_.load(std::memory_order_relaxed); }
+
+private:
+    void deliveryLoop();
+    bool onDeliveryThread() const;
+
+    // Held for each delivery round; guards topics_
+    mutable std::mutex delivery_mutex_;
+    std::vector<NotificationTopicBase*> topics_;
+
+    // Wake-up handshake: publishers bump signals_ and notify only while
+    // the delivery thread is waiting
+    std::mutex wake_mutex_;
+    std::condition_variable wake_;
+    std::condition_variable flushed_;
+    std::atomic<uint64_t> signals_{0};
+    std::atomic<bool> waiting_{false};
+    uint64_t completed_signals_{0};   // Guarded by wake_mutex_
+    bool stopping_{false};            // Guarded by wake_mutex_
+
+    std::atomic<uint64_t> delivered_{0};
+    std::thread thread_;
+};
+
+/**
+ * @class NotificationTopic
+ * @brief Bounded queue of one kind of event, with filtered subscribers
+ * @tparam Event Event type; default constructible and movable
+ * @tparam Filter Subscription filter, compared with == against the filter an event is published with
+ *
+ * publish() is safe from any thread and never blocks; when the queue is
+ * full the event is dropped and counted. Callbacks run on the bus
+ * delivery thread, in publish order.
+ */
+template <typename Event, typename Filter>
+class NotificationTopic : public NotificationTopicBase {
+public:
+    using Callback = std::function<void(const Event&)>;
+
+    /**
+     * @brief Constructor
+     * @param name Topic name used as the log component; must have static storage duration
+     * @param bus Bus to deliver on
+     * @param capacity Queued events before publish() starts dropping
+     */
+    NotificationTopic(const char* name, std::shared_ptr<NotificationBus> bus, size_t capacity = 256)
+        : name_(name),
+          bus_(std::move(bus)),
+          queue_(capacity),
+          subscribers_(std::make_shared<const std::vector<Subscriber>>()) {
+        bus_->attach(this);
+    }
+
+    ~NotificationTopic() override {
+        bus_->detach(this);
+    }
+
+    NotificationTopic(const NotificationTopic&) = delete;
+    NotificationTopic& operator=(const NotificationTopic&) = delete;
+
+    /**
+     * @brief Add a subscriber
+     * @return Subscription ID for unsubscribe()
+     */
+    int subscribe(Callback callback, Filter filter) {
+        std::lock_guard<std::mutex> lock(subscribe_mutex_);
+        auto updated = std::make_shared<std::vector<Subscriber>>(*std::atomic_load(&subscribers_));
+        const int id = next_id_++;
+        updated->push_back({id, std::move(callback), filter});
+        subscriber_count_.store(updated->size(), std::memory_order_relaxed);
+        std::atomic_store(&subscribers_, std::shared_ptr<const std::vector<Subscriber>>(std::move(updated)));
+        return id;
+    }
+
+    /**
+     * @brief Remove a subscriber; its callback is not running once this returns
+     * @return false if the ID is unknown
+     */
+    bool unsubscribe(int id) {
+        {
+            std::lock_guard<std::mutex> lock(subscribe_mutex_);
+            auto current = std::atomic_load(&subscribers_);
+            auto updated = std::make_shared<std::vector<Subscriber>>();
+            updated->reserve(current->size());
+            for (const auto& subscriber : *current) {
+                if (subscriber.id != id) {
+                    updated->push_back(subscriber);
+                }
+            }
+            if (updated->size() == current->size()) {
+                return false;
+            }
+            subscriber_count_.store(updated->size(), std::memory_order_relaxed);
+            std::atomic_store(&subscribers_, std::shared_ptr<const std::vector<Subscriber>>(std::move(updated)));
+        }
+        bus_->waitForDelivery();
+        return true;
+    }
+
+    /**
+     * @brief Queue an event for the subscribers whose filter matches
+     *
+     * Without any subscribers the event is discarded without being queued.
+     * @return false if the queue was full and the event was dropped
+     */
+    bool publish(const Event& event, Filter filter) {
+        if (subscriber_count_.load(std::memory_order_relaxed) == 0) {
+            return true;
+        }
+        const bool queued = queue_.tryEmplace([&](Pending& slot) {
+            slot.event = event;
+            slot.filter = filter;
+        });
+        if (!queued) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        bus_->signal();
+        return true;
+    }
+
+    /**
+     * @brief Wait until every event published so far has been delivered
+     */
+    bool flush(std::chrono::milliseconds timeout = std::chrono::seconds(5)) {
+        return bus_->flush(timeout);
+    }
+
+    /**
+     * @brief Number of events dropped because the queue was full
+     */
+    uint64_t droppedCount() const { return dropped_.load(std::memory_order_relaxed); }
+
+    size_t deliverPending() override {
+        const auto subscribers = std::atomic_load(&subscribers_);
+        size_t delivered = 0;
+        Pending pending;
+        while (queue_.tryPop(pending)) {
+            for (const auto& subscriber : *subscribers) {
+                if (!(subscriber.filter == pending.filter)) {
+                    continue;
+                }
+                try {
+                    subscriber.callback(pending.event);
+                } catch (const std::exception& e) {
+                    SKYMESH_LOG_ERROR(name_, "Exception in notification callback (ID: ",
+                                      subscriber.id, "): ", e.what());
+                } catch (...) {
+                    SKYMESH_LOG_ERROR(name_, "Unknown exception in notification callback (ID: ",
+                                      subscriber.id, ")");
+                }
+            }
+            ++delivered;
+        }
+        return delivered;
+    }
+
+private:
+    struct Subscriber {
+        int id;
+        Callback callback;
+        Filter filter;
+    };
+
+    struct Pending {
+        Event event{};
+        Filter filter{};
+    };
+
+    const char* const name_;
+    const std::shared_ptr<NotificationBus> bus_;
+    BoundedMpmcRing<Pending> queue_;
+
+    std::mutex subscribe_mutex_;
+    std::shared_ptr<const std::vector<Subscriber>> subscribers_;
+    int next_id_{0};
+    std::atomic<size_t> subscriber_count_{0};
+
+    std::atomic<uint64_t> dropped_{0};
+};
+
+} // namespace core
+} // namespace skymesh
+
+#endif // SKYMESH_CORE_NOTIFICATION_BUS_H
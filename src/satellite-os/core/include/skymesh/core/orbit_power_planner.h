@@ -0,0 +1,260 @@
+/**
+ * @file orbit_power_planner.h
+ * @brief Forward-looking battery and power mode planner for SkyMesh satellites
+ *
+ * Simulates the main battery state of charge over the next few orbits from
+ * the eclipse schedule given to PowerManager::updateOrbitPowerProfile(), the
+ * current subsystem draw and the queued task load. The result is a
+ * predicted power mode timeline and an admission decision per queued task,
+ * so power-hungry work can be placed where the battery can carry it instead
+ * of being cut off when update() crosses a threshold mid-pass.
+ */
+
+#ifndef SKYMESH_ORBIT_POWER_PLANNER_H
+#define SKYMESH_ORBIT_POWER_PLANNER_H
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "skymesh/core/orbital_task_manager.h"
+#include "skymesh/core/power_manager.h"
+
+namespace skymesh {
+namespace core {
+
+/**
+ * @brief Orbit power planner configuration
+ */
+struct OrbitPlannerConfig {
+    float battery_capacity_wh = 10.0f;           ///< Main battery capacity in watt-hours
+    uint32_t horizon_orbits = 3;                 ///< Orbits simulated ahead
+    std::chrono::seconds step{30};               ///< Integration step
+    float reserve_state_of_charge = 0.30f;       ///< Lowest predicted charge an admitted task may leave
+};
+
+/**
+ * @brief Power a task is expected to draw while it runs
+ */
+struct TaskPowerDemand {
+    SubsystemID subsystem;                       ///< Subsystem the task mainly powers
+    float average_power_w;                       ///< Average draw in watts
+    float peak_power_w;                          ///< Peak draw in watts
+    std::chrono::milliseconds duration;          ///< Expected run time
+};
+
+/**
+ * @brief Interval of time in which a task may start
+ */
+struct PlanningWindow {
+    std::chrono::system_clock::time_point start; ///< Earliest start
+    std::chrono::system_clock::time_point end;   ///< Latest start
+};
+
+/**
+ * @brief Stretch of the plan with a single predicted power mode
+ */
+struct PowerModeSegment {
+    std::chrono::system_clock::time_point start; ///< Segment start
+    std::chrono::system_clock::time_point end;   ///< Segment end
+    PowerMode mode;                              ///< Mode update() is predicted to select
+    float min_state_of_charge;                   ///< Lowest predicted charge within the segment
+};
+
+/**
+ * @brief Planned admission of a queued task
+ */
+struct AdmissionDecision {
+    std::string task_id;                         ///< Task identifier
+    std::chrono::system_clock::time_point start; ///< Planned start (scheduled time, or now if overdue)
+    bool admitted;                               ///< Whether the battery can carry the task there
+    float min_state_of_charge;                   ///< Lowest predicted charge from the start on
+};
+
+/**
+ * @class OrbitPowerPlanner
+ * @brief Predicts battery charge and power modes over the next orbits
+ *
+ * The planner reads the PowerManager through its lock-free budget snapshot,
+ * so plan() can run every tick on any thread. Queued tasks are admitted in
+ * start order; an admitted task's load is part of the trajectory later
+ * tasks are checked against, while a rejected task's load is not.
+ *
+ * Until an orbit profile has been given to the PowerManager there is
+ * nothing to plan against; plan() returns false and every query admits.
+ * All methods are thread-safe.
+ */
+class OrbitPowerPlanner {
+public:
+    /**
+     * @brief Constructor
+     * @param powerManager Source of the budget and orbit profile; must outlive the planner
+     * @param config Planner configuration
+     */
+    explicit OrbitPowerPlanner(const PowerManager& powerManager, OrbitPlannerConfig config = {});
+
+    OrbitPowerPlanner(const OrbitPowerPlanner&) = delete;
+    OrbitPowerPlanner& operator=(const OrbitPowerPlanner&) = delete;
+
+    /**
+     * @brief Add or replace a queued task's load
+     * @param task Task; its scheduled time is the planned start
+     */
+    void addTask(const OrbitalTask& task);
+
+    /**
+     * @brief Remove a queued task's load
+     * @param taskId ID of the task
+     * @return True if the task was known
+     */
+    bool removeTask(const std::string& taskId);
+
+    /**
+     * @brief Replace the queued loads with the pending tasks of a task manager
+     * @param taskManager Task manager to read pending tasks from
+     * @return Number of tasks now queued in the planner
+     */
+    size_t syncPendingTasks(const OrbitalTaskManager& taskManager);
+
+    /**
+     * @brief Simulate the horizon from the current budget
+     * @param now Start of the horizon
+     * @return False if no orbit profile is known yet
+     */
+    bool plan(std::chrono::system_clock::time_point now = std::chrono::system_clock::now());
+
+    /**
+     * @brief Predicted power modes over the planned horizon
+     * @return Consecutive segments from the start of the horizon; empty without a plan
+     */
+    std::vector<PowerModeSegment> modeTimeline() const;
+
+    /**
+     * @brief Predicted power mode at a point in the horizon
+     * @param time Point in time; clamped to the horizon
+     * @return Predicted mode, or the current mode without a plan
+     */
+    PowerMode predictedModeAt(std::chrono::system_clock::time_point time) const;
+
+    /**
+     * @brief Predicted main battery state of charge at a point in the horizon
+     * @param time Point in time; clamped to the horizon
+     * @return State of charge (0.0-1.0)
+     */
+    float predictedStateOfCharge(std::chrono::system_clock::time_point time) const;
+
+    /**
+     * @brief Admission decision for a queued task from the last plan()
+     * @param taskId ID of the task
+     * @return Decision if the task was part of the last plan
+     */
+    std::optional<AdmissionDecision> decisionFor(const std::string& taskId) const;
+
+    /**
+     * @brief Check whether a task can start somewhere in a window
+     *
+     * A queued task admitted at a start inside the window is affordable
+     * there. Otherwise the task is checked on top of the planned load: the
+     * predicted mode at its start must be NORMAL and its energy must not
+     * take the predicted charge below the reserve for the rest of the
+     * horizon. Starts beyond the horizon are never promised.
+     *
+     * @param task Task to check
+     * @param window Window in which the task may start
+     * @return True if an affordable start exists
+     */
+    bool canAfford(const OrbitalTask& task, const PlanningWindow& window) const;
+
+    /**
+     * @brief Earliest affordable start for a task within a window
+     * @param task Task to place
+     * @param window Window in which the task may start
+     * @return Start time, or empty if the task cannot be afforded in the window
+     */
+    std::optional<std::chrono::system_clock::time_point> findAffordableStart(
+        const OrbitalTask& task, const PlanningWindow& window) const;
+
+    /**
+     * @brief Expected power draw of a task
+     *
+     * Uses the task's declared energy and peak power where given, and
+     * otherwise the subsystem its type uses at full power for its timeout.
+     * @param task Task to estimate
+     * @return Expected demand
+     */
+    static TaskPowerDemand estimateDemand(const OrbitalTask& task);
+
+private:
+    struct QueuedLoad {
+        std::string taskId;
+        std::chrono::system_clock::time_point start;
+        TaskPowerDemand demand;
+    };
+
+    const PowerManager& powerManager;
+    const OrbitPlannerConfig config;
+    mutable std::mutex mutex;
+
+    std::vector<QueuedLoad> loads;
+
+    // Per-orbit generation table, rebuilt only when the profile changes
+    std::vector<float> orbitGeneration;
+    uint32_t tableSunlightSeconds = 0;
+    uint32_t tableEclipseSeconds = 0;
+    float tableSolarInput = -1.0f;
+
+    // Horizon arrays, one entry per step
+    std::vector<float> netPower;
+    std::vector<float> stateOfCharge;
+    std::vector<float> suffixMinCharge;
+    std::vector<PowerMode> modes;
+
+    std::vector<AdmissionDecision> decisions;
+    std::chrono::system_clock::time_point horizonStart;
+    float initialCharge = 0.0f;
+    PowerMode initialMode = PowerMode::NORMAL;
+    bool planned = false;
+
+    /**
+     * @brief Rebuild the per-orbit generation table if the profile changed
+     */
+    void updateGenerationTable(const PowerBudgetSnapshot& snapshot);
+
+    /**
+     * @brief Integrate charge and modes from a step to the end of the horizon
+     */
+    void integrateFrom(size_t step);
+
+    /**
+     * @brief Step index of a point in time, clamped to the horizon
+     */
+    size_t stepAt(std::chrono::system_clock::time_point time) const;
+
+    /**
+     * @brief Battery charge a demand consumes, as a state-of-charge fraction
+     */
+    float chargeFraction(const TaskPowerDemand& demand) const;
+
+    /**
+     * @brief Predicted mode at the start of a step
+     */
+    PowerMode modeBefore(size_t step) const;
+
+    /**
+     * @brief Check a demand starting at a step against the current trajectory
+     */
+    bool affordableAt(size_t step, float charge) const;
+
+    /**
+     * @brief Earliest affordable step for a demand in a window; caller holds mutex
+     */
+    std::optional<size_t> findAffordableStep(const OrbitalTask& task, const PlanningWindow& window) const;
+};
+
+} // namespace core
+} // namespace skymesh
+
+#endif // SKYMESH_ORBIT_POWER_PLANNER_H
@@ -0,0 +1,109 @@
+/**
+ * @file orbit_trigger_index.h
+ * @brief Spatial index for orbit-position task triggers
+ *
+ * Buckets orbit triggers into a latitude/longitude grid so that each
+ * position update only examines triggers near the ground track, and
+ * detects triggers crossed between two consecutive position samples.
+ */
+
+#ifndef SKYMESH_CORE_ORBIT_TRIGGER_INDEX_H
+#define SKYMESH_CORE_ORBIT_TRIGGER_INDEX_H
+
+#include "skymesh/core/orbital_task_manager.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace skymesh {
+namespace core {
+
+/**
+ * @brief Latitude/longitude grid of orbit triggers
+ *
+ * Each trigger is stored in every grid cell its tolerance box overlaps,
+ * with the box wrapped across the antimeridian where needed. Not thread-safe.
+ */
+class OrbitTriggerIndex {
+public:
+    /**
+     * @brief Construct an empty index
+     * @param cell_size_deg Grid cell edge length in degrees
+     */
+    explicit OrbitTriggerIndex(double cell_size_deg = 2.0);
+
+    /**
+     * @brief Add a trigger to the index
+     * @param id Caller-chosen identifier, unique within the index
+     * @param target Position that fires the trigger
+     * @param position_tolerance_deg Latitude/longitude half-width of the trigger box
+     * @param altitude_tolerance_km Altitude half-height of the trigger box
+     */
+    void insert(uint64_t id, const OrbitPosition& target,
+                double position_tolerance_deg, double altitude_tolerance_km);
+
+    /**
+     * @brief Remove a trigger from the index
+     * @param id Identifier passed to insert()
+     * @return true if the trigger was present
+     */
+    bool remove(uint64_t id);
+
+    /**
+     * @brief Find triggers whose box the spacecraft passed through
+     *
+     * The path between the two samples is taken as a straight segment in
+     * latitude, longitude (the shorter way around) and altitude.
+     *
+     * @param previous Previous position sample
+     * @param current Current position sample
+     * @param hits Receives the ids of matching triggers (appended)
+     */
+    void querySegment(const OrbitPosition& previous, const OrbitPosition& current,
+                      std::vector<uint64_t>& hits) const;
+
+    /**
+     * @brief Find triggers whose box contains a single position
+     * @param position Position sample
+     * @param hits Receives the ids of matching triggers (appended)
+     */
+    void queryPoint(const OrbitPosition& position, std::vector<uint64_t>& hits) const {
+        querySegment(position, position, hits);
+    }
+
+    /**
+     * @brief Number of triggers in the index
+     */
+    size_t size() const { return triggers_.size(); }
+
+private:
+    struct Trigger {
+        double latitude;
+        double longitude;
+        double altitude_km;
+        double position_tolerance_deg;
+        double altitude_tolerance_km;
+        std::vector<uint64_t> cells;
+    };
+
+    // Append the keys of all cells overlapping a box; longitudes may lie outside [-180, 180)
+    void collectCells(double lat_lo, double lat_hi, double lon_lo, double lon_hi,
+                      std::vector<uint64_t>& cells) const;
+
+    // Test a segment against a trigger box with Liang-Barsky clipping
+    static bool segmentHitsTrigger(const Trigger& trigger,
+                                   double lat0, double lon0, double alt0,
+                                   double dlat, double dlon, double dalt);
+
+    double cell_size_deg_;
+    int lat_cells_;
+    int lon_cells_;
+    std::unordered_map<uint64_t, Trigger> triggers_;
+    std::unordered_map<uint64_t, std::vector<uint64_t>> cells_;
+};
+
+} // namespace core
+} // namespace skymesh
+
+#endif // SKYMESH_CORE_ORBIT_TRIGGER_INDEX_H
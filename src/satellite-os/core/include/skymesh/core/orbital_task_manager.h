@@ -10,6 +10,7 @@
 #ifndef SKYMESH_ORBITAL_TASK_MANAGER_H
 #define SKYMESH_ORBITAL_TASK_MANAGER_H
 
+#include <array>
 #include <chrono>
 #include <cstdint>
 #include <string>
@@ -18,10 +19,16 @@
 #include <memory>
 #include <map>
 #include <optional>
+#include <string_view>
+
+#include "skymesh/core/clock.h"
 
 namespace skymesh {
 namespace core {
 
+class NotificationBus;
+class CheckpointStore;
+
 /**
  * @brief Task execution priority levels
  */
@@ -45,6 +52,11 @@ enum class TaskStatus {
     SUSPENDED     ///< Task execution temporarily suspended
 };
 
+/**
+ * @brief Number of TaskStatus values, used to size per-status tables
+ */
+constexpr size_t kTaskStatusCount = static_cast<size_t>(TaskStatus::SUSPENDED) + 1;
+
 /**
  * @brief Task types for orbital operations
  */
@@ -71,6 +83,15 @@ enum class RecoveryStrategy {
     SAFE_MODE           ///< Enter safe mode and await instructions
 };
 
+/**
+ * @brief How the replicas of a radiation-protected task are executed
+ */
+enum class TmrMode {
+    SEQUENTIAL,         ///< Three replicas back-to-back on the dispatching worker
+    PARALLEL,           ///< Three replicas concurrently; returns once two agree
+    DUAL_TIE_BREAK      ///< Two replicas concurrently; a third runs only if they disagree
+};
+
 /**
  * @brief Task execution context
  */
@@ -95,8 +116,11 @@ struct OrbitalTask {
     std::chrono::milliseconds timeout;           ///< Maximum execution time
     RecoveryStrategy recovery_strategy;          ///< Strategy for handling execution failures
     bool radiation_protected;                    ///< Whether task uses radiation protection
+    TmrMode tmr_mode = TmrMode::SEQUENTIAL;      ///< Replica execution mode when radiation protected
     uint32_t retry_count;                        ///< Number of retry attempts for failures
     std::map<std::string, std::string> metadata; ///< Additional task metadata
+    float energy_cost_wh = 0.0f;                 ///< Declared energy per run in watt-hours (0 = estimate from type)
+    float peak_power_w = 0.0f;                   ///< Declared peak draw in watts (0 = estimate from type)
 };
 
 /**
@@ -126,12 +150,84 @@ struct OrbitPosition {
 
 /**
  * @brief Schedule trigger conditions
+ *
+ * A conditional task is released once, by whichever of its triggers is
+ * satisfied first.
  */
 struct TriggerCondition {
     std::optional<OrbitPosition> orbit_position; ///< Trigger at specific orbit position
     std::optional<std::string> event_name;       ///< Trigger on named event
     std::optional<std::chrono::system_clock::time_point> time_point; ///< Trigger at specific time
     std::optional<std::string> dependency_task_id; ///< Trigger after another task completes
+    double position_tolerance_deg = 5.0;         ///< Latitude/longitude half-width of the orbit trigger box
+    double altitude_tolerance_km = 10.0;         ///< Altitude half-height of the orbit trigger box
+};
+
+/**
+ * @brief Worker pool configuration for task execution
+ *
+ * Workers pull from per-priority ready lanes. Reserved workers are held back
+ * for a priority level and everything more urgent, so lower-priority work can
+ * never occupy the whole pool.
+ *
+ * Attitude control and orbital maneuver tasks default to one at a time;
+ * other types default to unlimited. Entries in max_concurrent_by_type
+ * override those defaults.
+ *
+ * Concurrent TMR replicas run on a separate pool with one slot per replica.
+ * With pinning enabled, slot i is bound to core i (modulo the core count), so
+ * the three replicas of a task always execute on different cores.
+ *
+ * With an executor the manager starts no threads at all: due tasks and
+ * their TMR replicas run one at a time inline on the executor, and task
+ * times come from its clock. The worker and replica settings are then unused.
+ */
+struct ExecutionPoolConfig {
+    uint32_t worker_count = 1;                           ///< Worker threads (0 = one per hardware core)
+    std::map<TaskPriority, uint32_t> reserved_workers;   ///< Workers reserved for this priority and above
+    std::map<TaskType, uint32_t> max_concurrent_by_type; ///< Concurrency limit per task type (0 = unlimited; absent = default)
+    uint32_t tmr_threads_per_replica = 1;                ///< Threads serving each TMR replica slot
+    bool pin_tmr_replicas = false;                       ///< Pin each replica slot to its own CPU core
+    std::shared_ptr<Executor> executor;                  ///< Run tasks on this executor instead of worker threads
+};
+
+/**
+ * @brief Retention limits for stored task results
+ *
+ * When any limit is exceeded the oldest results are evicted, and completed
+ * or canceled one-shot tasks are forgotten along with their results. A
+ * forgotten task still reports its final status and still releases tasks
+ * that depend on it. Failed tasks stay until recovered or canceled. A limit
+ * of zero disables that check.
+ */
+struct ResultRetentionPolicy {
+    size_t max_results = 10000;                  ///< Results kept at most
+    std::chrono::seconds max_age{0};             ///< Results older than this are evicted
+    size_t max_bytes = 0;                        ///< Approximate memory budget for results
+};
+
+/**
+ * @brief Lightweight view of a task passed to query visitors
+ *
+ * The string views are only valid for the duration of the visitor call.
+ */
+struct TaskSummary {
+    std::string_view task_id;                    ///< Task identifier
+    std::string_view name;                       ///< Human-readable name
+    TaskType type;                               ///< Task type
+    TaskPriority priority;                       ///< Task priority
+    TaskStatus status;                           ///< Status when the query started
+    std::chrono::system_clock::time_point scheduled_time;  ///< Next scheduled execution time
+};
+
+/**
+ * @brief Task execution counters, as reported to the ground
+ */
+struct TaskMetrics {
+    uint64_t tasks_executed = 0;                 ///< Task runs finished, successful or not
+    uint64_t tasks_failed = 0;                   ///< Task runs that failed
+    uint64_t radiation_events = 0;               ///< Runs that detected a radiation event
+    std::array<uint32_t, kTaskStatusCount> tasks_by_status{};  ///< Known tasks, indexed by TaskStatus
 };
 
 /**
@@ -139,6 +235,64 @@ struct TriggerCondition {
  */
 using TaskCompletionCallback = std::function<void(const TaskResult&)>;
 
+/**
+ * @brief Rebinds a task restored from a checkpoint to the code it runs
+ *
+ * Checkpoints hold task definitions but not their functions. The resolver
+ * gets the restored task, with its ID, name, type and metadata, and returns
+ * the function to run, or an empty function to drop the task.
+ */
+using TaskFunctionResolver = std::function<std::function<bool(const TaskContext&)>(const OrbitalTask&)>;
+
+/**
+ * @brief What the dispatcher does with a due task
+ */
+enum class AdmissionAction {
+    ADMIT,              ///< Dispatch now
+    DEFER,              ///< Requeue until not_before, then ask again
+    COALESCE            ///< Hold with other tasks of its type and release them together
+};
+
+/**
+ * @brief Admission stage verdict for one task
+ */
+struct TaskAdmission {
+    AdmissionAction action = AdmissionAction::ADMIT;       ///< What to do with the task
+    std::chrono::system_clock::time_point not_before{};    ///< DEFER: retry time; COALESCE: latest group release
+    uint32_t batch_size = 0;                               ///< COALESCE: release once this many are held (0 = at not_before only)
+};
+
+/**
+ * @brief Pluggable admission stage of the dispatch pipeline
+ *
+ * Consulted for each due task before it takes a worker. Calls are made with
+ * the dispatch queue locked, so implementations must be quick and must not
+ * call back into the task manager. Tasks released from a coalesced group
+ * are dispatched without another admission check.
+ */
+class TaskAdmissionPolicy {
+public:
+    virtual ~TaskAdmissionPolicy() = default;
+
+    /**
+     * @brief Decide whether a due task may be dispatched
+     * @param task Task about to be dispatched
+     * @param now Dispatch time
+     * @return Verdict for the task
+     */
+    virtual TaskAdmission admit(const OrbitalTask& task, std::chrono::system_clock::time_point now) = 0;
+
+    /**
+     * @brief Called when a coalesced group is released for dispatch
+     * @param type Task type of the group
+     * @param tasks Released tasks, valid only for the duration of the call
+     */
+    virtual void onBatchReleased(TaskType type, const std::vector<const OrbitalTask*>& tasks) {
+        (void)type;
+        (void)tasks;
+    }
+};
+
 /**
  * @brief Interface for the satellite orbital task management system
  */
@@ -153,6 +307,23 @@ public:
      */
     virtual bool initialize(const std::string& config_path = "") = 0;
 
+    /**
+     * @brief Configure the task execution worker pool
+     *
+     * Must be called before start(). Reservations must leave at least one
+     * worker for every priority level.
+     *
+     * @param config Worker pool configuration
+     * @return true if the configuration was accepted
+     */
+    virtual bool configureExecutionPool(const ExecutionPoolConfig& config) = 0;
+
+    /**
+     * @brief Install the admission stage consulted before dispatch
+     * @param policy Admission policy; nullptr dispatches every due task
+     */
+    virtual void setAdmissionPolicy(std::shared_ptr<TaskAdmissionPolicy> policy) = 0;
+
     /**
      * @brief Start the task management system
      * @return true if successfully started
@@ -171,6 +342,24 @@ public:
      */
     virtual std::string scheduleTask(const OrbitalTask& task) = 0;
 
+    /**
+     * @brief Schedule a task for one-time execution, taking ownership of it
+     * @param task Task to schedule
+     * @return task_id if scheduling successful, empty string otherwise
+     */
+    virtual std::string scheduleTask(OrbitalTask&& task) = 0;
+
+    /**
+     * @brief Schedule a batch of tasks for one-time execution
+     *
+     * Equivalent to scheduling each task in turn, but takes each internal
+     * lock once and wakes the workers once for the whole batch.
+     *
+     * @param tasks Tasks to schedule; moved from
+     * @return task_id per task, in order; empty for tasks that were rejected
+     */
+    virtual std::vector<std::string> scheduleTasks(std::vector<OrbitalTask>&& tasks) = 0;
+
     /**
      * @brief Schedule a task based on a trigger condition
      * @param task Task to schedule
@@ -196,6 +385,13 @@ public:
      */
     virtual bool cancelTask(const std::string& task_id) = 0;
 
+    /**
+     * @brief Cancel a batch of scheduled tasks
+     * @param task_ids IDs of the tasks to cancel
+     * @return Number of tasks canceled
+     */
+    virtual size_t cancelTasks(const std::vector<std::string>& task_ids) = 0;
+
     /**
      * @brief Suspend a running or scheduled task
      * @param task_id ID of the task to suspend
@@ -237,8 +433,41 @@ public:
      */
     virtual std::vector<OrbitalTask> getTasksByStatus(TaskStatus status) const = 0;
 
+    /**
+     * @brief Visit tasks without copying them or blocking dispatch
+     *
+     * Matching tasks are collected first, so the visitor runs without any
+     * task manager lock held and may call back into the manager.
+     *
+     * @param status Only visit tasks with this status; all tasks if empty
+     * @param visitor Called per task; return false to stop early
+     * @return Number of tasks visited
+     */
+    virtual size_t visitTasks(std::optional<TaskStatus> status,
+                              const std::function<bool(const TaskSummary&)>& visitor) const = 0;
+
+    /**
+     * @brief Visit stored results from oldest to newest, without copying
+     *
+     * The visitor runs with the result store locked and must not call back
+     * into the task manager; workers publishing results wait meanwhile.
+     *
+     * @param visitor Called per result; return false to stop early
+     * @return Number of results visited
+     */
+    virtual size_t visitTaskResults(const std::function<bool(const TaskResult&)>& visitor) const = 0;
+
+    /**
+     * @brief Set the retention limits for stored results
+     * @param policy Retention limits; applied immediately
+     */
+    virtual void configureResultRetention(const ResultRetentionPolicy& policy) = 0;
+
     /**
      * @brief Register callback for task completion notification
+     *
+     * Callbacks run on the notification bus thread, so a slow callback
+     * never holds up task execution.
      * @param callback Function to call when a task completes
      * @param task_type Optional task type to filter notifications
      * @return Callback ID for later removal
@@ -264,6 +493,13 @@ public:
      */
     virtual OrbitPosition getCurrentOrbitalPosition() const = 0;
 
+    /**
+     * @brief Publish a named event, releasing conditional tasks waiting on it
+     * @param event_name Name matched against TriggerCondition::event_name
+     * @return Number of tasks released by this event
+     */
+    virtual size_t publishEvent(const std::string& event_name) = 0;
+
     /**
      * @brief Trigger recovery for a failed task
      * @param task_id ID of the failed task
@@ -273,19 +509,49 @@ public:
     virtual bool recoverTask(const std::string& task_id, 
                             RecoveryStrategy strategy = RecoveryStrategy::RETRY) = 0;
 
+    /**
+     * @brief Get the task execution counters without copying any task
+     * @return Counters and per-status task counts at the time of the call
+     */
+    virtual TaskMetrics getTaskMetrics() const = 0;
+
     /**
      * @brief Report task execution metrics to ground station
      * @return true if report was queued successfully
      */
     virtual bool reportTaskMetrics() = 0;
+
+    /**
+     * @brief Save pending, suspended and conditional tasks to a checkpoint
+     *
+     * Running tasks are saved as pending, so they run again after a restart.
+     * The section is not rewritten if no task changed since the last save.
+     * @param store Checkpoint to write the TASKS section of
+     * @return false if the tasks do not fit the section
+     */
+    virtual bool saveCheckpoint(CheckpointStore& store) = 0;
+
+    /**
+     * @brief Reschedule the tasks of a checkpoint, keeping their IDs
+     *
+     * Pending tasks are queued, suspended ones wait for resumeTask(), and
+     * conditional tasks that had not fired are armed again. Tasks the
+     * resolver has no function for are dropped.
+     * @param store Checkpoint to read the TASKS section of
+     * @param resolver Supplies each restored task's function
+     * @return Number of tasks restored
+     */
+    virtual size_t restoreCheckpoint(const CheckpointStore& store, const TaskFunctionResolver& resolver) = 0;
 };
 
 /**
  * @brief Factory function to create orbital task manager instance
  * @param config_path Path to configuration file (optional)
+ * @param notification_bus Bus to deliver completion callbacks on; a private one is created if empty
  * @return Unique pointer to OrbitalTaskManager implementation
  */
-std::unique_ptr<OrbitalTaskManager> createOrbitalTaskManager(const std::string& config_path = "");
+std::unique_ptr<OrbitalTaskManager> createOrbitalTaskManager(const std::string& config_path = "",
+                                                             std::shared_ptr<NotificationBus> notification_bus = nullptr);
 
 } // namespace core
 } // namespace skymesh
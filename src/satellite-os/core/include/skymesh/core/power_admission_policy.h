@@ -0,0 +1,116 @@
+/**
+ * @file power_admission_policy.h
+ * @brief Power-aware admission stage for the orbital task manager
+ *
+ * Holds back work the current power mode cannot carry instead of letting it
+ * run and fail. In constrained modes non-essential tasks are deferred and
+ * COMMUNICATION tasks are coalesced so several of them share one RF burst
+ * window, saving the transceiver warm-up each separate wake-up would cost.
+ */
+
+#ifndef SKYMESH_POWER_ADMISSION_POLICY_H
+#define SKYMESH_POWER_ADMISSION_POLICY_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "skymesh/core/orbit_power_planner.h"
+#include "skymesh/core/orbital_task_manager.h"
+#include "skymesh/core/power_manager.h"
+
+namespace skymesh {
+namespace core {
+
+/**
+ * @brief RF burst window opened for a released group of COMMUNICATION tasks
+ */
+struct RfBurstWindow {
+    std::chrono::milliseconds duration;          ///< Combined timeout of the grouped tasks
+    float power_level;                           ///< RF power level covering the highest declared peak (0.0-1.0)
+    uint32_t task_count;                         ///< Tasks sharing the window
+};
+
+/**
+ * @brief Power-aware admission policy configuration
+ */
+struct PowerAdmissionConfig {
+    std::chrono::milliseconds deferral{std::chrono::seconds(60)};  ///< Retry delay for deferred tasks
+    std::chrono::milliseconds burst_hold{std::chrono::minutes(5)}; ///< Longest a COMMUNICATION task waits for its burst
+    uint32_t burst_batch_size = 4;               ///< Release a burst early once this many tasks are waiting
+    std::chrono::milliseconds plan_lookahead{std::chrono::minutes(30)}; ///< How far ahead to look for an affordable start
+
+    /**
+     * @brief Called when a burst window opens, with the dispatch queue locked
+     *
+     * PowerManager is single-writer, so this should hand the window to the
+     * power control thread (for prepareForRFBurst()) rather than call it.
+     */
+    std::function<void(const RfBurstWindow&)> on_rf_burst;
+};
+
+/**
+ * @class PowerAwareAdmissionPolicy
+ * @brief Admits, defers or coalesces tasks based on the current power mode
+ *
+ * - CRITICAL priority tasks are always admitted.
+ * - NORMAL: tasks that declare an energy cost, and PAYLOAD_OPERATION
+ *   tasks, are checked against the OrbitPowerPlanner when one is given
+ *   and deferred to their earliest affordable start.
+ * - LOW_POWER and CRITICAL: COMMUNICATION tasks are coalesced into RF
+ *   bursts, and tasks the mode does not need are deferred.
+ * - EMERGENCY and HIBERNATION: only power management and health checks run.
+ *
+ * Reads the PowerManager through its lock-free budget snapshot, so it is
+ * safe to call from the task manager's worker threads.
+ */
+class PowerAwareAdmissionPolicy : public TaskAdmissionPolicy {
+public:
+    /**
+     * @brief Constructor
+     * @param powerManager Source of the current power mode; must outlive the policy
+     * @param planner Optional planner for energy checks; must outlive the policy
+     * @param config Policy configuration
+     */
+    explicit PowerAwareAdmissionPolicy(const PowerManager& powerManager,
+                                       const OrbitPowerPlanner* planner = nullptr,
+                                       PowerAdmissionConfig config = {});
+
+    TaskAdmission admit(const OrbitalTask& task, std::chrono::system_clock::time_point now) override;
+    void onBatchReleased(TaskType type, const std::vector<const OrbitalTask*>& tasks) override;
+
+    /**
+     * @brief Number of deferrals issued
+     */
+    uint64_t deferredCount() const { return deferred.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Number of RF burst windows opened for coalesced tasks
+     */
+    uint64_t burstCount() const { return bursts.load(std::memory_order_relaxed); }
+
+private:
+    const PowerManager& powerManager;
+    const OrbitPowerPlanner* planner;
+    const PowerAdmissionConfig config;
+
+    std::atomic<uint64_t> deferred{0};
+    std::atomic<uint64_t> bursts{0};
+
+    /**
+     * @brief Whether a task type may run in a power mode
+     */
+    static bool allowedInMode(TaskType type, PowerMode mode);
+
+    /**
+     * @brief Verdict deferring a task by the configured delay, or to a given time
+     */
+    TaskAdmission defer(std::chrono::system_clock::time_point until);
+};
+
+} // namespace core
+} // namespace skymesh
+
+#endif // SKYMESH_POWER_ADMISSION_POLICY_H
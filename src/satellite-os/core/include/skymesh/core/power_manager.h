@@ -20,13 +20,18 @@
 #include <memory>
 #include <atomic>
 #include <chrono>
-#include <unordered_map>
+#include <utility>
 #include <cstring> // for strcmp
 
+#include "skymesh/core/seqlock.h"
+#include "skymesh/core/tmr.h"
+
 namespace skymesh {
 namespace core {
 // Forward declarations
+class CheckpointStore;
 class RFController;
+class SensorBackend;
 /**
  * @enum PowerMode
  * @brief Power modes for the satellite
@@ -62,6 +67,18 @@ enum class SubsystemID {
     SENSORS         ///< Sensors array
 };
 
+/**
+ * @brief Number of SubsystemID values, used to size per-subsystem tables
+ */
+constexpr size_t kSubsystemCount = static_cast<size_t>(SubsystemID::SENSORS) + 1;
+
+/**
+ * @brief Table index (and bitmask position) of a subsystem
+ */
+constexpr size_t subsystemIndex(SubsystemID subsystem) {
+    return static_cast<size_t>(subsystem);
+}
+
 /**
  * @struct PowerSourceStatus
  * @brief Status information for a power source
@@ -101,6 +118,54 @@ struct PowerBudget {
     float solarInputRate;                ///< Current solar input rate in watts
 };
 
+/**
+ * @struct PowerBudgetSnapshot
+ * @brief Fixed-size copy of the power budget for lock-free polling
+ *
+ * Only the first subsystemCount entries of subsystems are valid, in
+ * SubsystemID order.
+ */
+struct PowerBudgetSnapshot {
+    float totalAvailable;                ///< Total available power in watts
+    float totalConsumption;              ///< Total current consumption in watts
+    float projectedAvailable;            ///< Projected available power (next orbit) in watts
+    float batteryReserve;                ///< Battery reserve in watt-hours
+    float solarInputRate;                ///< Current solar input rate in watts
+    PowerMode currentMode;               ///< Current power mode
+    uint32_t subsystemCount;             ///< Number of valid entries in subsystems
+    std::array<PowerConsumption, kSubsystemCount> subsystems; ///< Active subsystem consumption
+    std::chrono::system_clock::time_point sourcesUpdated; ///< When source readings were last refreshed
+    uint32_t orbitSunlightSeconds;       ///< Sunlit part of the orbit (0 until a profile is given)
+    uint32_t orbitEclipseSeconds;        ///< Eclipsed part of the orbit
+    std::chrono::system_clock::time_point orbitEpoch; ///< Start of a sunlit phase in the current profile
+};
+
+/**
+ * @brief Power mode the automatic state-of-charge thresholds select
+ *
+ * Applies the same hysteresis as PowerManager::update(), so planners that
+ * simulate future charge predict the transitions update() will make.
+ * @param current Current power mode
+ * @param stateOfCharge Main battery state of charge (0.0-1.0)
+ * @return Next power mode; current if no threshold is crossed
+ */
+PowerMode automaticPowerMode(PowerMode current, float stateOfCharge);
+
+/**
+ * @brief Power accounted for a subsystem running at a power level
+ * @param subsystem The subsystem
+ * @param powerLevel Power level (0.0-1.0)
+ * @return Consumption in watts, on the same scale as PowerBudget::totalConsumption
+ */
+float subsystemPowerDraw(SubsystemID subsystem, float powerLevel);
+
+/**
+ * @brief Peak power a subsystem can draw
+ * @param subsystem The subsystem
+ * @return Peak power in watts
+ */
+float subsystemPeakPower(SubsystemID subsystem);
+
 /**
  * @class PowerManager
  * @brief Manages the satellite power system
@@ -117,9 +182,9 @@ protected:
     // Protected interface for radiation testing
     struct RadiationTestInterface {
         static void* getInternalStatePtr(PowerManager* pm, const char* memberName) {
-            if (strcmp(memberName, "currentMode") == 0) return &pm->currentMode;
-            if (strcmp(memberName, "subsystemStates") == 0) return &pm->subsystemStates;
-            if (strcmp(memberName, "subsystemPowerLevels") == 0) return &pm->subsystemPowerLevels;
+            if (strcmp(memberName, "currentMode") == 0) return pm->currentMode.unsafeCopy(0);
+            if (strcmp(memberName, "subsystemStates") == 0) return &pm->subsystems.unsafeCopy(0)->enabledMask;
+            if (strcmp(memberName, "subsystemPowerLevels") == 0) return pm->subsystems.unsafeCopy(0)->powerLevels.data();
             return nullptr;
         }
     };
@@ -127,13 +192,20 @@ protected:
 public:
     /**
      * @brief Constructor
+     * @param sensors Source of power source readings, whose clock also times
+     *                update() and the orbit profile; without one the readings
+     *                are modelled from panel efficiency and battery health on
+     *                the wall clock
      */
-    PowerManager();
+    explicit PowerManager(std::shared_ptr<SensorBackend> sensors = nullptr);
     
     /**
      * @brief Destructor
      */
     virtual ~PowerManager();
+    
+    PowerManager(const PowerManager&) = delete;
+    PowerManager& operator=(const PowerManager&) = delete;
 
     /**
      * @brief Initialize the power management system
@@ -179,12 +251,26 @@ public:
     
     /**
      * @brief Get the current power budget
+     *
+     * Built from the published snapshot; safe to call from any thread.
      * @return Current power budget information
      */
     PowerBudget getPowerBudget() const;
     
+    /**
+     * @brief Get the current power budget without locking or allocating
+     *
+     * Safe to call from any thread, concurrently with the thread driving
+     * the power manager. Reflects every completed state change.
+     * @return Latest published budget snapshot
+     */
+    PowerBudgetSnapshot getPowerBudgetSnapshot() const;
+    
     /**
      * @brief Get the status of a specific power source
+     *
+     * Returns the cached reading; lastUpdated is when it was taken. Readings
+     * are refreshed by update() once they are older than the refresh period.
      * @param source The power source to check
      * @return Status information for the specified power source
      */
@@ -213,6 +299,9 @@ public:
     
     /**
      * @brief Update system with orbit information
+     *
+     * The profile is published in the budget snapshot with the time of the
+     * call as the start of a sunlit phase, for OrbitPowerPlanner.
      * @param timeInSunlight Predicted time in sunlight (seconds)
      * @param timeInEclipse Predicted time in eclipse (seconds)
      */
@@ -259,47 +348,116 @@ public:
      * @param deltaTimeMs Time since last update in milliseconds
      */
     void update(uint32_t deltaTimeMs);
+    
+    /**
+     * @brief Save the power mode, subsystem table, battery model and orbit profile
+     * @param store Checkpoint to write the POWER section of
+     * @return True if the section was committed
+     */
+    bool saveCheckpoint(CheckpointStore& store) const;
+    
+    /**
+     * @brief Restore the state saved by saveCheckpoint()
+     *
+     * Call after initialize() with the same subsystems. The state is applied
+     * as saved, without mode transitions or warning callbacks. A corrupt or
+     * out-of-range checkpoint leaves the current state untouched.
+     * @param store Checkpoint to read the POWER section of
+     * @return True if the saved state was applied
+     */
+    bool restoreCheckpoint(const CheckpointStore& store);
 
 private:
     // Current power mode
-    std::atomic<PowerMode> currentMode;
+    Tmr<PowerMode> currentMode;
     
-    // Subsystem power states (enabled/disabled)
-    std::unordered_map<SubsystemID, bool> subsystemStates;
+    /**
+     * @brief Per-subsystem state as parallel arrays indexed by subsystemIndex()
+     *
+     * Bit i of each mask corresponds to entry i of the arrays, so budget and
+     * consumption calculations are plain loops over contiguous storage.
+     */
+    struct SubsystemTable {
+        uint32_t enabledMask = 0;     ///< Subsystems currently powered
+        uint32_t registeredMask = 0;  ///< Subsystems under power management
+        std::array<float, kSubsystemCount> powerLevels{}; ///< Power levels (0.0-1.0)
+    };
     
-    // Subsystem power levels (0.0-1.0)
-    std::unordered_map<SubsystemID, float> subsystemPowerLevels;
+    // Subsystem power states and levels, one cache line per copy
+    Tmr<SubsystemTable, kTmrCacheLine> subsystems;
     
-    // Registered callbacks for power warnings
-    std::unordered_map<uint32_t, std::function<void(PowerMode)>> powerWarningCallbacks;
+    // Solar panel efficiency factors
+    std::array<float, 6> solarPanelEfficiencies;
+    
+    // Registered callbacks for power warnings, in registration (ID) order
+    std::vector<std::pair<uint32_t, std::function<void(PowerMode)>>> powerWarningCallbacks;
     
     // Next callback ID for registration
     uint32_t nextCallbackId;
     
-    // Solar panel efficiency factors
-    std::array<float, 6> solarPanelEfficiencies;
-    
     // Battery health indicators
     float mainBatteryHealth;
     float backupBatteryHealth;
     
+    /**
+     * @brief RF power allocations for different communication modes (0.0-1.0)
+     */
+    struct RfPowerAllocations {
+        float standard;   ///< Standard communications
+        float burst;      ///< Burst transmissions
+        float emergency;  ///< Emergency communications
+    };
+    
     // RF power allocations for different modes
-    float rfStandardPowerAllocation;
-    float rfBurstPowerAllocation;
-    float rfEmergencyPowerAllocation;
+    Tmr<RfPowerAllocations> rfAllocations;
+    
+    // Incremental scrubber over the TMR-protected state above
+    TmrScrubber scrubber;
+    
+    // Source of power source readings, if any
+    std::shared_ptr<SensorBackend> sensorBackend;
+    
+    // Cached power source readings, indexed by PowerSource
+    std::array<PowerSourceStatus, 3> sourceReadings;
+    
+    // Writer-side budget, kept current as state changes
+    PowerBudgetSnapshot budgetState;
+    
+    // Budget published to lock-free readers
+    SeqLock<PowerBudgetSnapshot> publishedBudget;
     
     /**
-     * @brief Calculate available power
+     * @brief Calculate available power from the cached source readings
      * @return Total available power in watts
      */
     float calculateAvailablePower() const;
     
     /**
-     * @brief Calculate current power consumption
+     * @brief Current power consumption, maintained incrementally
      * @return Total current consumption in watts
      */
     float calculateCurrentConsumption() const;
     
+    /**
+     * @brief Take new power source readings and update the derived budget fields
+     */
+    void refreshSourceReadings();
+    
+    /**
+     * @brief Time the source readings are stamped with
+     */
+    std::chrono::system_clock::time_point readingTime() const;
+    
+    /**
+     * @brief Recompute the whole budget from the subsystem table and publish it
+     */
+    void rebuildBudget();
+    
+    /**
+     * @brief Publish the writer-side budget to readers
+     */
+    void publishBudget();
+    
     /**
      * @brief Implement power-saving algorithm based on current status
      * @return Suggested power mode based on conditions
@@ -307,15 +465,21 @@ private:
     PowerMode determineSuggestedPowerMode() const;
     
     /**
-     * @brief Apply triple modular redundancy to critical measurements
-     * @param measurements Array of redundant measurements
-     * @return Error-corrected measurement value
+     * @brief Record a subsystem's enabled state and power level
+     * @param subsystem The subsystem to update
+     * @param enabled Whether the subsystem is powered
+     * @param powerLevel Power level (0.0-1.0)
+     */
+    void setSubsystemState(SubsystemID subsystem, bool enabled, float powerLevel);
+    
+    /**
+     * @brief Clear invalid state bits and out-of-range power levels
+     * @return True if anything had to be corrected
      */
-    template<typename T>
-    T applyTMR(const std::array<T, 3>& measurements) const;
+    bool scrubSubsystemTable();
     
     /**
-     * @brief Apply error detection and correction to power controls
+     * @brief Scrub the next slice of protected state and validate the subsystem table
      */
     void applyScrubbing();
     
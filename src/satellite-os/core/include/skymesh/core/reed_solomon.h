@@ -0,0 +1,77 @@
+/**
+ * @file reed_solomon.h
+ * @brief CCSDS Reed-Solomon (255,223) forward error correction
+ *
+ * Implements the code of CCSDS 131.0-B: symbols in GF(256) with field
+ * polynomial x^8+x^7+x^2+x+1, generator roots alpha^(11j) for j = 112..143,
+ * and Berlekamp's dual basis for the symbols on the wire. Each codeword
+ * carries up to 223 data bytes and 32 parity bytes and corrects up to 16
+ * symbol errors. Shorter data is a shortened codeword: the missing leading
+ * bytes count as zeros and are not transmitted.
+ *
+ * Encoding writes parity into a caller-provided buffer, typically directly
+ * after the data, and never allocates. The batch functions interleave up
+ * to 16 codewords into the lanes of one vector register, multiplying with
+ * SSSE3 or NEON split-table lookups where available.
+ */
+
+#ifndef SKYMESH_CORE_REED_SOLOMON_H
+#define SKYMESH_CORE_REED_SOLOMON_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace skymesh {
+namespace core {
+
+/// Symbols in a full codeword
+constexpr size_t kRsCodewordSize = 255;
+/// Data symbols in a full codeword
+constexpr size_t kRsMaxDataSize = 223;
+/// Parity symbols appended to every codeword
+constexpr size_t kRsParitySize = 32;
+/// Symbol errors a codeword can correct
+constexpr size_t kRsCorrectableErrors = kRsParitySize / 2;
+
+/**
+ * @brief Compute the parity of one codeword
+ * @param data size data bytes, at most kRsMaxDataSize
+ * @param parity Destination for kRsParitySize bytes; data + size encodes
+ *        the codeword in place
+ */
+void rsEncode(const uint8_t* data, size_t size, uint8_t* parity);
+
+/**
+ * @brief Correct one codeword in place
+ * @param data size data bytes, at most kRsMaxDataSize
+ * @param parity The codeword's kRsParitySize parity bytes
+ * @return Number of corrected symbols, or -1 if the codeword has more
+ *         errors than the code can correct; it is then left unchanged
+ */
+int rsDecode(uint8_t* data, size_t size, uint8_t* parity);
+
+/**
+ * @brief Compute the parity of count codewords with the same data size
+ *
+ * parity[i] receives the parity of data[i], as rsEncode() would write it.
+ */
+void rsEncodeBatch(const uint8_t* const* data, uint8_t* const* parity, size_t size, size_t count);
+
+/**
+ * @brief Correct count codewords with the same data size in place
+ * @param corrected Optional; corrected[i] receives what rsDecode() would
+ *        return for codeword i
+ * @return Number of codewords that could not be corrected
+ */
+size_t rsDecodeBatch(uint8_t* const* data, uint8_t* const* parity, size_t size, size_t count,
+                     int* corrected = nullptr);
+
+/**
+ * @brief Whether the batch functions use SIMD multiply kernels on this CPU
+ */
+bool rsSimdAccelerated();
+
+} // namespace core
+} // namespace skymesh
+
+#endif // SKYMESH_CORE_REED_SOLOMON_H
@@ -0,0 +1,134 @@
+/**
+ * @file rf_guard.h
+ * @brief Checksummed redundant copies for RF controller state
+ *
+ * A guard protects one region of memory with up to three copies and a
+ * checksum of the live data. Writes touch only the changed words; the
+ * copies are voted or restored only when the checksum no longer matches.
+ *
+ * Hot regions, updated per packet, use a word-parity checksum that each
+ * write adjusts in O(1). Cold regions, rewritten rarely, use CRC32C and
+ * are rechecked by a periodic scrub.
+ */
+
+#ifndef RF_GUARD_H
+#define RF_GUARD_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RF_GUARD_MAX_COPIES  3   /**< Redundant copies per region */
+
+/**
+ * @brief Outcome of checking a region
+ */
+typedef enum {
+    RF_GUARD_OK = 0,           /**< Data, copies and checksum agree */
+    RF_GUARD_CORRECTED,        /**< An upset was found and repaired */
+    RF_GUARD_UNCORRECTABLE     /**< No candidate matched the checksum */
+} rf_guard_result_t;
+
+/**
+ * @brief How a region's checksum is kept
+ */
+typedef enum {
+    RF_GUARD_HOT = 0,          /**< Word parity, updated incrementally on every write */
+    RF_GUARD_COLD              /**< CRC32C, recomputed when the region is written */
+} rf_guard_kind_t;
+
+/**
+ * @brief A protected region; the data and copies are owned by the caller
+ */
+typedef struct {
+    uint8_t* data;             /**< Live data */
+    uint8_t* copies;           /**< copy_count copies of size bytes, back to back */
+    size_t size;               /**< Region size; a multiple of 4 for hot regions */
+    uint8_t copy_count;        /**< Copies kept, 0 to RF_GUARD_MAX_COPIES */
+    rf_guard_kind_t kind;      /**< Checksum used */
+    uint32_t checksum;         /**< Checksum of the live data */
+} rf_guard_t;
+
+/**
+ * @brief CRC32C (Castagnoli) of a byte range
+ *
+ * @param data Bytes to checksum
+ * @param size Number of bytes
+ * @return CRC32C of the range
+ */
+uint32_t rf_crc32c(const void* data, size_t size);
+
+/**
+ * @brief Start guarding a region with its current contents
+ *
+ * @param guard Guard to initialize
+ * @param data Live data
+ * @param copies Storage for copy_count copies of size bytes
+ * @param size Region size
+ * @param copy_count Copies to keep; 0 disables protection
+ * @param kind Checksum to keep
+ */
+void rf_guard_init(rf_guard_t* guard, void* data, uint8_t* copies, size_t size,
+                   uint8_t copy_count, rf_guard_kind_t kind);
+
+/**
+ * @brief Record a write to part of the region
+ *
+ * Call after changing the live field. Costs a few word writes per copy
+ * for a hot region; a cold region's CRC is recomputed.
+ *
+ * @param guard Guard of the region holding the field
+ * @param field First byte written
+ * @param size Bytes written
+ */
+void rf_guard_sync(rf_guard_t* guard, const void* field, size_t size);
+
+/**
+ * @brief Add to a 32-bit counter in a guarded region
+ *
+ * @param guard Guard of the region holding the counter
+ * @param counter Counter to update
+ * @param delta Amount to add
+ */
+void rf_guard_add32(rf_guard_t* guard, uint32_t* counter, uint32_t delta);
+
+/**
+ * @brief Record a rewrite of the whole region
+ *
+ * @param guard Guard of the region
+ */
+void rf_guard_commit(rf_guard_t* guard);
+
+/**
+ * @brief Check the live data against its checksum, repairing it if needed
+ *
+ * Only computes the checksum when the region is intact. On a mismatch the
+ * copies are voted, or with fewer than three tried one by one, and the
+ * first candidate that matches the checksum is restored. If none does, the
+ * live data holds the vote of three copies, or is left as is.
+ *
+ * @param guard Guard of the region
+ * @return Outcome of the check
+ */
+rf_guard_result_t rf_guard_verify(rf_guard_t* guard);
+
+/**
+ * @brief Verify the live data, then bring every copy back into agreement
+ *
+ * Catches upsets in the copies themselves, which rf_guard_verify() does
+ * not look at; run it periodically from a background context.
+ *
+ * @param guard Guard of the region
+ * @return Outcome of the scrub
+ */
+rf_guard_result_t rf_guard_scrub(rf_guard_t* guard);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RF_GUARD_H */
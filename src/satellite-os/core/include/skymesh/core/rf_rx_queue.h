@@ -0,0 +1,145 @@
+/**
+ * @file rf_rx_queue.h
+ * @brief Lock-free receive ring for the RF controller
+ *
+ * The driver writes each frame straight into a preallocated, cache-aligned
+ * slot and commits it; the consumer takes many committed frames at once
+ * and reads them in place, returning the slots when it is done. Frames that
+ * arrive while every slot is full are dropped and counted.
+ *
+ * One context produces (the driver receive interrupt: reserve, commit) and
+ * one consumes (acquire, release); the ring is single-producer,
+ * single-consumer.
+ */
+
+#ifndef RF_RX_QUEUE_H
+#define RF_RX_QUEUE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "rf_controller.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RF_RX_RING_SIZE      64   /**< Frame slots; a power of two */
+#define RF_RX_FRAME_SIZE     256  /**< Bytes per slot, the largest RF packet */
+
+#ifndef RF_CACHE_ALIGNED
+#define RF_CACHE_ALIGNED __attribute__((aligned(64)))
+#endif
+
+/**
+ * @brief One received frame, written in place by the driver
+ */
+typedef struct {
+    RF_CACHE_ALIGNED uint8_t data[RF_RX_FRAME_SIZE];  /**< Frame contents */
+    uint32_t length;                                  /**< Bytes received */
+    int16_t rssi;                                     /**< RSSI of the frame */
+    int16_t snr;                                      /**< SNR of the frame */
+    uint64_t received_ns;                             /**< Receive time, copied to rf_packet_t; 0 if unknown */
+} rf_rx_slot_t;
+
+/**
+ * @brief Receive ring; statically allocatable, initialize with rf_rxq_init()
+ */
+typedef struct {
+    RF_CACHE_ALIGNED uint32_t head;   /**< Oldest unreleased frame; consumer side */
+    uint32_t held;                    /**< Frames acquired and not yet released; consumer only */
+    RF_CACHE_ALIGNED uint32_t tail;   /**< Next slot to fill; producer side */
+    uint32_t overflows;               /**< Frames dropped on a full ring; producer only */
+    uint32_t high_watermark;          /**< Most frames ever waiting; producer only */
+    rf_rx_slot_t slots[RF_RX_RING_SIZE];
+} rf_rxq_t;
+
+/**
+ * @brief Initialize an empty ring with zeroed counters
+ *
+ * @param queue Ring to initialize
+ */
+void rf_rxq_init(rf_rxq_t* queue);
+
+/**
+ * @brief Get the next free slot to receive a frame into
+ *
+ * Producer side. Fill the slot, received_ns included, then rf_rxq_commit()
+ * it; an uncommitted slot is simply reused by the next reservation. A full
+ * ring counts an overflow, since the frame has nowhere to go.
+ *
+ * @param queue Ring to fill
+ * @return Slot of RF_RX_FRAME_SIZE bytes, or NULL if the ring is full
+ */
+rf_rx_slot_t* rf_rxq_reserve(rf_rxq_t* queue);
+
+/**
+ * @brief Publish the slot from the last rf_rxq_reserve()
+ *
+ * Producer side. The slot's length must already be set.
+ *
+ * @param queue Ring the slot was reserved from
+ */
+void rf_rxq_commit(rf_rxq_t* queue);
+
+/**
+ * @brief Copy a frame into the ring
+ *
+ * Producer side, for drivers that hand over their own buffer rather than
+ * filling a reserved slot.
+ *
+ * @param queue Ring to fill
+ * @param data Frame contents
+ * @param length Frame length
+ * @param rssi RSSI of the frame
+ * @return false if the frame was too long or the ring was full
+ */
+bool rf_rxq_push(rf_rxq_t* queue, const uint8_t* data, size_t length, int16_t rssi);
+
+/**
+ * @brief Number of committed frames not yet acquired
+ *
+ * @param queue Ring to check
+ */
+uint32_t rf_rxq_available(const rf_rxq_t* queue);
+
+/**
+ * @brief Take committed frames, oldest first, without copying them
+ *
+ * Consumer side. Each packet's data points into its slot and stays valid
+ * until rf_rxq_release(). Frames already acquired are not returned again.
+ *
+ * @param queue Ring to take from
+ * @param out Filled with up to max packets
+ * @param max Capacity of out
+ * @return Number of packets written
+ */
+size_t rf_rxq_acquire(rf_rxq_t* queue, rf_packet_t* out, size_t max);
+
+/**
+ * @brief Return every acquired slot to the producer
+ *
+ * @param queue Ring the frames were acquired from
+ */
+void rf_rxq_release(rf_rxq_t* queue);
+
+/**
+ * @brief Frames dropped because the ring was full
+ *
+ * @param queue Ring to read
+ */
+uint32_t rf_rxq_overflows(const rf_rxq_t* queue);
+
+/**
+ * @brief Most frames ever waiting in the ring at once
+ *
+ * @param queue Ring to read
+ */
+uint32_t rf_rxq_high_watermark(const rf_rxq_t* queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RF_RX_QUEUE_H */
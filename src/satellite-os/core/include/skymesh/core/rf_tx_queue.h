@@ -0,0 +1,156 @@
+/**
+ * @file rf_tx_queue.h
+ * @brief Zero-copy, priority-ordered transmit queue for the RF controller
+ *
+ * Frames are written in place into buffers from a preallocated pool,
+ * queued by rf_packet_t.priority, and handed to the radio in batches that
+ * share one wake-up and preamble. Completions are reported through a ring
+ * the submitter polls, rather than one callback per frame.
+ *
+ * Two contexts use a queue: the submitter (acquire, push, poll, release)
+ * and the radio (next_batch, complete), typically a driver completion
+ * interrupt. Each side must be a single context; the rings between them
+ * are lock-free single-producer, single-consumer.
+ */
+
+#ifndef RF_TX_QUEUE_H
+#define RF_TX_QUEUE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "rf_controller.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RF_TX_POOL_SIZE      32   /**< Frame buffers in the pool (at most 32) */
+#define RF_TX_FRAME_SIZE     256  /**< Bytes per frame buffer, the largest RF packet */
+#define RF_TX_PRIORITIES     8    /**< Priority levels; 7 is sent first */
+#define RF_TX_BATCH_MAX      8    /**< Frames sent behind one wake-up and preamble */
+
+#ifndef RF_CACHE_ALIGNED
+#define RF_CACHE_ALIGNED __attribute__((aligned(64)))
+#endif
+
+/**
+ * @brief Frames handed to the radio together
+ */
+typedef struct {
+    const uint8_t* data[RF_TX_BATCH_MAX];  /**< Frame contents, in send order */
+    uint32_t length[RF_TX_BATCH_MAX];      /**< Frame lengths */
+    uint8_t slot[RF_TX_BATCH_MAX];         /**< Pool slots, for rf_txq_complete() */
+    uint8_t count;                         /**< Number of frames */
+    uint32_t bytes;                        /**< Total length */
+} rf_tx_batch_t;
+
+/**
+ * @brief Single-producer, single-consumer ring of pool slots
+ *
+ * Holds at most RF_TX_POOL_SIZE entries, which is every slot, so a push
+ * can never find it full.
+ */
+typedef struct {
+    RF_CACHE_ALIGNED uint32_t head;  /**< Next entry to pop; consumer side */
+    RF_CACHE_ALIGNED uint32_t tail;  /**< Next entry to push; producer side */
+    uint8_t slots[RF_TX_POOL_SIZE];
+} rf_tx_ring_t;
+
+/**
+ * @brief Transmit queue; statically allocatable, initialize with rf_txq_init()
+ */
+typedef struct {
+    RF_CACHE_ALIGNED uint8_t buffers[RF_TX_POOL_SIZE][RF_TX_FRAME_SIZE];
+    rf_packet_t packets[RF_TX_POOL_SIZE];             /**< Descriptor of each buffer */
+    uint32_t free_mask;                               /**< Free slots; submitter only */
+    rf_tx_ring_t pending[RF_TX_PRIORITIES];           /**< Queued slots per priority */
+    rf_tx_ring_t completed;                           /**< Sent slots awaiting rf_txq_poll() */
+    rf_status_t completed_status[RF_TX_POOL_SIZE];    /**< Outcome per completed slot */
+} rf_txq_t;
+
+/**
+ * @brief Initialize a queue with every buffer free
+ *
+ * @param queue Queue to initialize
+ */
+void rf_txq_init(rf_txq_t* queue);
+
+/**
+ * @brief Take a free buffer to build a frame in
+ *
+ * The returned packet's data points at RF_TX_FRAME_SIZE bytes of pool
+ * memory; fill it in place, set length, priority and packet_id, then pass
+ * it to rf_txq_push() or back to rf_txq_release().
+ *
+ * @param queue Queue to allocate from
+ * @return Packet descriptor, or NULL if every buffer is in use
+ */
+rf_packet_t* rf_txq_acquire(rf_txq_t* queue);
+
+/**
+ * @brief Queue an acquired packet for transmission
+ *
+ * Priorities above RF_TX_PRIORITIES - 1 are clamped. On error the packet
+ * stays with the caller.
+ *
+ * @param queue Queue the packet was acquired from
+ * @param packet Packet from rf_txq_acquire()
+ * @return RF_STATUS_OK, or RF_STATUS_TX_ERROR for a foreign packet or invalid length
+ */
+rf_status_t rf_txq_push(rf_txq_t* queue, rf_packet_t* packet);
+
+/**
+ * @brief Return an acquired packet without sending it
+ *
+ * @param queue Queue the packet was acquired from
+ * @param packet Packet from rf_txq_acquire()
+ */
+void rf_txq_release(rf_txq_t* queue, rf_packet_t* packet);
+
+/**
+ * @brief Whether any frame is queued and not yet taken by the radio
+ *
+ * @param queue Queue to check
+ */
+bool rf_txq_pending(const rf_txq_t* queue);
+
+/**
+ * @brief Take the next frames to send, highest priority first
+ *
+ * Radio side. Takes up to RF_TX_BATCH_MAX frames, oldest first within a
+ * priority.
+ *
+ * @param queue Queue to take from
+ * @param batch Filled with the frames to send
+ * @return Number of frames taken
+ */
+uint8_t rf_txq_next_batch(rf_txq_t* queue, rf_tx_batch_t* batch);
+
+/**
+ * @brief Report the outcome of a batch
+ *
+ * Radio side. Every frame of the batch gets the same status.
+ *
+ * @param queue Queue the batch came from
+ * @param batch Batch from rf_txq_next_batch()
+ * @param status RF_STATUS_OK if the batch was sent
+ */
+void rf_txq_complete(rf_txq_t* queue, const rf_tx_batch_t* batch, rf_status_t status);
+
+/**
+ * @brief Collect completions and return their buffers to the pool
+ *
+ * @param queue Queue to poll
+ * @param completions Filled with up to max completions, in completion order
+ * @param max Capacity of completions
+ * @return Number of completions written
+ */
+size_t rf_txq_poll(rf_txq_t* queue, rf_tx_completion_t* completions, size_t max);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RF_TX_QUEUE_H */
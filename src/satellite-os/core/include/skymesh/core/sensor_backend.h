@@ -0,0 +1,194 @@
+/**
+ * @file sensor_backend.h
+ * @brief Source of the physical readings HealthMonitor and PowerManager sample
+ *
+ * A backend either wraps the flight sensor drivers or simulates them.
+ * The simulation is a pure function of its seed, the sensor and the
+ * simulated time: noise comes from a counter-based generator keyed by
+ * the sample time, so results do not depend on thread interleaving or
+ * sampling rate, and runs with the same seed reproduce exactly. Its clock
+ * can run faster than real time to cover whole orbits in seconds, or
+ * follow a SimulationExecutor so readings track simulated time.
+ */
+
+#ifndef SKYMESH_CORE_SENSOR_BACKEND_H
+#define SKYMESH_CORE_SENSOR_BACKEND_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "skymesh/core/clock.h"
+#include "skymesh/core/health_monitor.h"
+#include "skymesh/core/power_manager.h"
+
+namespace skymesh {
+namespace core {
+
+/**
+ * @class CounterRng
+ * @brief Counter-based pseudo-random generator
+ *
+ * Output i of a stream is a hash of (seed, stream, i), so any output can
+ * be computed directly and copies on different threads never contend.
+ */
+class CounterRng {
+public:
+    CounterRng(uint64_t seed, uint64_t stream) : key_(mix(seed ^ mix(stream + kGolden))) {}
+
+    /**
+     * @brief Output at an arbitrary counter value
+     */
+    uint64_t at(uint64_t counter) const { return mix(key_ + counter * kGolden); }
+
+    /**
+     * @brief Next output in sequence
+     */
+    uint64_t next() { return at(counter_++); }
+
+    /**
+     * @brief Uniform value in [-1, 1) at a counter value
+     */
+    float symmetric(uint64_t counter) const {
+        return static_cast<float>(static_cast<double>(at(counter) >> 11) * 0x1.0p-52 - 1.0);
+    }
+
+private:
+    static constexpr uint64_t kGolden = 0x9e3779b97f4a7c15ull;
+
+    // SplitMix64 finalizer
+    static uint64_t mix(uint64_t z) {
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    uint64_t key_;
+    uint64_t counter_ = 0;
+};
+
+/**
+ * @brief Temperature sensor a reading is requested for
+ */
+struct TemperatureChannel {
+    const std::string& sensor_id;   ///< Unique sensor identifier
+    ComponentType component;        ///< Component being measured
+    float nominal_celsius;          ///< Temperature the sensor was registered with
+};
+
+/**
+ * @class SensorBackend
+ * @brief Provides radiation, temperature and power source readings
+ *
+ * Implementations must be safe to call from several threads, since one
+ * backend is usually shared by the subsystems of a satellite. A read
+ * returns false when the sensor cannot be read; callers then keep their
+ * previous value.
+ */
+class SensorBackend {
+public:
+    virtual ~SensorBackend() = default;
+
+    /**
+     * @brief Time to stamp readings with
+     *
+     * The system clock for hardware; the simulated time for a simulation.
+     */
+    virtual std::chrono::system_clock::time_point now() const = 0;
+
+    /**
+     * @brief Read the radiation dose rate
+     * @param now Time of the reading, from now()
+     * @param rads_per_hour Dose rate in rads/hour
+     */
+    virtual bool readDoseRate(std::chrono::system_clock::time_point now, float& rads_per_hour) = 0;
+
+    /**
+     * @brief Read a temperature sensor
+     * @param channel Sensor to read
+     * @param now Time of the reading, from now()
+     * @param celsius Temperature in Celsius
+     */
+    virtual bool readTemperature(const TemperatureChannel& channel,
+                                 std::chrono::system_clock::time_point now, float& celsius) = 0;
+
+    /**
+     * @brief Read the electrical state of a power source
+     * @param source Power source
+     * @param now Time of the reading, from now()
+     * @param status Voltage, current, temperature and state of charge; the
+     *               source and timestamp are left to the caller
+     */
+    virtual bool readPowerSource(PowerSource source, std::chrono::system_clock::time_point now,
+                                 PowerSourceStatus& status) = 0;
+};
+
+/**
+ * @brief Driver entry points the hardware backend reads through
+ *
+ * Any entry left empty reports its sensor as unavailable.
+ */
+struct HardwareSensorDrivers {
+    std::function<bool(float& rads_per_hour)> read_dose_rate;
+    std::function<bool(const TemperatureChannel& channel, float& celsius)> read_temperature;
+    std::function<bool(PowerSource source, PowerSourceStatus& status)> read_power_source;
+};
+
+/**
+ * @brief Orbit and sensor model of the simulated backend
+ *
+ * The defaults are a 90 minute LEO orbit crossing the South Atlantic
+ * Anomaly every third orbit. steady() disables the orbit effects, leaving
+ * only sensor noise around the nominal values.
+ */
+struct SimulationProfile {
+    uint64_t seed = 1;                                    ///< Seed of all simulated noise
+    double time_scale = 1.0;                              ///< Simulated seconds per real second; unused with a clock
+    std::chrono::system_clock::time_point epoch{};        ///< Simulated start time; the clock's start time if zero
+    std::shared_ptr<const Clock> clock;                   ///< Time source, e.g. a SimulationExecutor; scaled real time if empty
+
+    std::chrono::seconds orbit_period{5400};              ///< Orbit period; each orbit starts sunlit
+    double eclipse_fraction = 0.35;                       ///< Part of the orbit in eclipse
+
+    float thermal_swing_celsius = 15.0f;                  ///< Equilibrium offset from nominal in sunlight (+) and eclipse (-)
+    std::chrono::seconds thermal_time_constant{900};      ///< First-order thermal lag
+    float temperature_noise_celsius = 0.25f;              ///< Peak sensor noise
+
+    float background_dose_rate = 0.05f;                   ///< Dose rate outside the SAA in rads/hour
+    float saa_peak_dose_rate = 5.0f;                      ///< Extra dose rate at the centre of an SAA pass
+    uint32_t saa_orbit_interval = 3;                      ///< Orbits between SAA passes; 0 disables them
+    double saa_orbit_phase = 0.55;                        ///< Orbit phase where an SAA pass starts
+    std::chrono::seconds saa_duration{600};               ///< Length of an SAA pass
+    float dose_rate_noise = 0.05f;                        ///< Peak sensor noise in rads/hour
+
+    /**
+     * @brief Profile with no eclipse cycle or SAA, only sensor noise
+     */
+    static SimulationProfile steady(uint64_t seed = 1) {
+        SimulationProfile profile;
+        profile.seed = seed;
+        profile.thermal_swing_celsius = 0.0f;
+        profile.saa_orbit_interval = 0;
+        profile.eclipse_fraction = 0.0;
+        return profile;
+    }
+};
+
+/**
+ * @brief Create a backend reading the flight sensors
+ * @param drivers Driver entry points
+ */
+std::shared_ptr<SensorBackend> createHardwareSensorBackend(HardwareSensorDrivers drivers);
+
+/**
+ * @brief Create a seeded, orbit-driven sensor simulation
+ * @param profile Orbit and sensor model
+ */
+std::shared_ptr<SensorBackend> createSimulatedSensorBackend(const SimulationProfile& profile = SimulationProfile());
+
+} // namespace core
+} // namespace skymesh
+
+#endif // SKYMESH_CORE_SENSOR_BACKEND_H
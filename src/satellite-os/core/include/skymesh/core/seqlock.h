@@ -0,0 +1,103 @@
+/**
+ * @file seqlock.h
+ * @brief Single-writer sequence lock for publishing small snapshots
+ */
+
+#ifndef SKYMESH_CORE_SEQLOCK_H
+#define SKYMESH_CORE_SEQLOCK_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+namespace skymesh {
+namespace core {
+
+/**
+ * @brief Publishes copies of a trivially copyable value to lock-free readers
+ *
+ * One writer thread calls store(); any number of threads call load(), which
+ * never blocks the writer and retries only if a store overlapped the read.
+ * The value is held as relaxed atomic words, so concurrent access is
+ * race-free without locking.
+ */
+template <typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable<T>::value, "SeqLock requires a trivially copyable type");
+
+public:
+    SeqLock() : SeqLock(T{}) {}
+
+    explicit SeqLock(const T& value) {
+        writeWords(value);
+    }
+
+    SeqLock(const SeqLock&) = delete;
+    SeqLock& operator=(const SeqLock&) = delete;
+
+    /**
+     * @brief Publish a new value; must only be called from the writer thread
+     */
+    void store(const T& value) {
+        const uint32_t sequence = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        writeWords(value);
+        sequence_.store(sequence + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Read a consistent copy of the latest published value
+     */
+    T load() const {
+        std::array<uint64_t, kWords> words;
+        for (;;) {
+            const uint32_t before = sequence_.load(std::memory_order_acquire);
+            if (before & 1u) {
+                std::this_thread::yield();
+                continue;
+            }
+            for (size_t i = 0; i < kWords; ++i) {
+                words[i] = words_[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence_.load(std::memory_order_relaxed) == before) {
+                break;
+            }
+        }
+
+        T value;
+        std::memcpy(static_cast<void*>(&value), words.data(), sizeof(T));
+        return value;
+    }
+
+    /**
+     * @brief Number of completed stores, for change detection by pollers
+     */
+    uint32_t version() const {
+        return sequence_.load(std::memory_order_acquire) / 2;
+    }
+
+private:
+    static constexpr size_t kWords = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    void writeWords(const T& value) {
+        std::array<uint64_t, kWords> words{};
+        std::memcpy(words.data(), &value, sizeof(T));
+        for (size_t i = 0; i < kWords; ++i) {
+            words_[i].store(words[i], std::memory_order_relaxed);
+        }
+    }
+
+    std::atomic<uint32_t> sequence_{0};
+    std::array<std::atomic<uint64_t>, kWords> words_;
+};
+
+} // namespace core
+} // namespace skymesh
+
+#endif // SKYMESH_CORE_SEQLOCK_H
@@ -0,0 +1,119 @@
+/**
+ * @file task_result_store.h
+ * @brief Bounded store for task execution results
+ *
+ * Keeps the latest result of each task in completion order and evicts the
+ * oldest results once the configured retention policy is exceeded.
+ */
+
+#ifndef SKYMESH_CORE_TASK_RESULT_STORE_H
+#define SKYMESH_CORE_TASK_RESULT_STORE_H
+
+#include "skymesh/core/orbital_task_manager.h"
+
+#include <chrono>
+#include <functional>
+#include <list>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace skymesh {
+namespace core {
+
+/**
+ * @brief Task results ordered by completion, bounded by a retention policy
+ *
+ * Re-storing the result of a task that is already present overwrites it in
+ * place and moves it to the young end, so a recurring task occupies a single
+ * slot and its steady-state updates do not allocate. Not thread-safe.
+ */
+class TaskResultStore {
+public:
+    /**
+     * @brief Construct an empty store
+     * @param policy Initial retention limits
+     */
+    explicit TaskResultStore(const ResultRetentionPolicy& policy = ResultRetentionPolicy());
+
+    /**
+     * @brief Replace the retention policy and evict down to it
+     * @param policy New retention limits
+     * @param evicted If not null, receives the IDs of evicted results
+     */
+    void setPolicy(const ResultRetentionPolicy& policy, std::vector<std::string>* evicted = nullptr);
+
+    /**
+     * @brief Current retention policy
+     */
+    const ResultRetentionPolicy& policy() const { return policy_; }
+
+    /**
+     * @brief Store the latest result of a task, evicting old results as needed
+     * @param result Result to store; replaces any earlier result for the task
+     * @param evicted If not null, receives the IDs of evicted results
+     */
+    void put(const TaskResult& result, std::vector<std::string>* evicted = nullptr);
+
+    /**
+     * @brief Copy out the stored result of a task
+     * @param task_id Task identifier
+     * @return The result, or nullopt if none is stored
+     */
+    std::optional<TaskResult> get(const std::string& task_id) const;
+
+    /**
+     * @brief Whether a result is stored for a task
+     */
+    bool contains(const std::string& task_id) const { return index_.count(task_id) != 0; }
+
+    /**
+     * @brief Drop the stored result of a task
+     * @param task_id Task identifier
+     * @return true if a result was stored
+     */
+    bool erase(const std::string& task_id);
+
+    /**
+     * @brief Visit stored results from oldest to newest, without copying
+     * @param visitor Called per result; return false to stop early
+     * @return Number of results visited
+     */
+    size_t visit(const std::function<bool(const TaskResult&)>& visitor) const;
+
+    /**
+     * @brief Number of stored results
+     */
+    size_t size() const { return index_.size(); }
+
+    /**
+     * @brief Approximate memory held by stored results, in bytes
+     */
+    size_t bytes() const { return bytes_; }
+
+    /**
+     * @brief Approximate memory held by one result, in bytes
+     */
+    static size_t estimateBytes(const TaskResult& result);
+
+private:
+    struct Slot {
+        TaskResult result;
+        std::chrono::steady_clock::time_point stored_at;
+        size_t bytes = 0;
+    };
+
+    // Evict from the old end until the policy holds
+    void evict(std::chrono::steady_clock::time_point now, std::vector<std::string>* evicted);
+
+    ResultRetentionPolicy policy_;
+    std::list<Slot> order_;  // Front = oldest
+    std::unordered_map<std::string, std::list<Slot>::iterator> index_;
+    size_t bytes_ = 0;
+};
+
+} // namespace core
+} // namespace skymesh
+
+#endif // SKYMESH_CORE_TASK_RESULT_STORE_H
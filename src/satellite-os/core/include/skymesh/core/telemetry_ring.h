@@ -0,0 +1,261 @@
+/**
+ * @file telemetry_ring.h
+ * @brief Fixed-capacity telemetry time series with lock-free windowed queries
+ *
+ * One writer appends timestamped samples; any number of readers query the
+ * latest sample or min/max/mean/rate over a trailing time window. Storage
+ * is allocated once at construction. The writer folds every sample into a
+ * per-block summary as it arrives, so a window query touches one summary
+ * per block instead of every sample. Readers validate against the write
+ * position afterwards, seqlock style, and retry only if the writer lapped
+ * the samples they were reading.
+ */
+
+#ifndef SKYMESH_CORE_TELEMETRY_RING_H
+#define SKYMESH_CORE_TELEMETRY_RING_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace skymesh {
+namespace core {
+
+/**
+ * @brief One telemetry sample
+ */
+struct TelemetrySample {
+    std::chrono::system_clock::time_point timestamp;  ///< Measurement time
+    float value;                                      ///< Measured value
+};
+
+/**
+ * @brief Statistics over a trailing window of samples
+ */
+struct TelemetryWindowStats {
+    uint32_t count = 0;            ///< Samples in the window; all other fields are zero when empty
+    float min = 0.0f;              ///< Lowest value
+    float max = 0.0f;              ///< Highest value
+    float mean = 0.0f;             ///< Mean value
+    float latest = 0.0f;           ///< Value of the newest sample
+    float rate_per_second = 0.0f;  ///< Change from the oldest to the newest sample, per second
+    std::chrono::system_clock::time_point oldest;  ///< Timestamp of the oldest sample in the window
+    std::chrono::system_clock::time_point newest;  ///< Timestamp of the newest sample
+};
+
+/**
+ * @brief Single-writer, multi-reader ring of telemetry samples
+ * @tparam Capacity Number of samples kept; a power of two and a multiple of kBlockSize
+ *
+ * Samples are pushed in non-decreasing time order. A window query spans at
+ * most Capacity - kBlockSize samples, leaving the writer a block of slack
+ * before a concurrent reader has to retry.
+ */
+template <size_t Capacity>
+class TelemetryRing {
+public:
+    static constexpr size_t kBlockSize = 16;
+    /// Most samples copyRecent() returns
+    static constexpr size_t kHistoryLimit = Capacity - kBlockSize;
+
+    static_assert(Capacity >= 2 * kBlockSize, "TelemetryRing needs at least two blocks");
+    static_assert((Capacity & (Capacity - 1)) == 0, "TelemetryRing capacity must be a power of two");
+
+    TelemetryRing() = default;
+    TelemetryRing(const TelemetryRing&) = delete;
+    TelemetryRing& operator=(const TelemetryRing&) = delete;
+
+    /**
+     * @brief Append a sample; must only be called from the writer thread
+     */
+    void push(std::chrono::system_clock::time_point timestamp, float value) {
+        const uint64_t index = head_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[index & kMask];
+        Block& block = blocks_[(index / kBlockSize) & kBlockMask];
+
+        // Readers that see any of the stores below also see the head
+        // that makes them detect the overwrite
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.time.store(timestamp.time_since_epoch().count(), std::memory_order_relaxed);
+        slot.value.store(value, std::memory_order_relaxed);
+
+        if (index % kBlockSize == 0) {
+            block.min.store(value, std::memory_order_relaxed);
+            block.max.store(value, std::memory_order_relaxed);
+            block.sum.store(value, std::memory_order_relaxed);
+        } else {
+            block.min.store(std::min(block.min.load(std::memory_order_relaxed), value), std::memory_order_relaxed);
+            block.max.store(std::max(block.max.load(std::memory_order_relaxed), value), std::memory_order_relaxed);
+            block.sum.store(block.sum.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        head_.store(index + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Read the newest sample
+     * @return false if no sample has been pushed
+     */
+    bool latest(TelemetrySample& out) const {
+        for (;;) {
+            const uint64_t head = head_.load(std::memory_order_acquire);
+            if (head == 0) {
+                return false;
+            }
+            out = readSample(head - 1);
+            if (stillValid(head - 1)) {
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @brief Statistics over the samples of the last span, ending at the newest sample
+     * @param span Window length; samples exactly span older than the newest are included
+     */
+    TelemetryWindowStats window(std::chrono::system_clock::duration span) const {
+        for (;;) {
+            TelemetryWindowStats stats;
+            const uint64_t head = head_.load(std::memory_order_acquire);
+            if (head == 0) {
+                return stats;
+            }
+            const uint64_t lowest = head > kWindowLimit ? head - kWindowLimit : 0;
+
+            const TelemetrySample newest = readSample(head - 1);
+            const auto horizon = (newest.timestamp - span).time_since_epoch().count();
+
+            // First sample inside the window
+            uint64_t lo = lowest;
+            uint64_t hi = head - 1;
+            while (lo < hi) {
+                const uint64_t mid = lo + (hi - lo) / 2;
+                if (slots_[mid & kMask].time.load(std::memory_order_relaxed) < horizon) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+            const TelemetrySample oldest = readSample(lo);
+
+            stats.count = static_cast<uint32_t>(head - lo);
+            stats.min = oldest.value;
+            stats.max = oldest.value;
+            double sum = 0.0;
+
+            uint64_t index = lo;
+            while (index < head) {
+                if (index % kBlockSize == 0 && index + kBlockSize <= head) {
+                    const Block& block = blocks_[(index / kBlockSize) & kBlockMask];
+                    stats.min = std::min(stats.min, block.min.load(std::memory_order_relaxed));
+                    stats.max = std::max(stats.max, block.max.load(std::memory_order_relaxed));
+                    sum += block.sum.load(std::memory_order_relaxed);
+                    index += kBlockSize;
+                } else {
+                    const float value = slots_[index & kMask].value.load(std::memory_order_relaxed);
+                    stats.min = std::min(stats.min, value);
+                    stats.max = std::max(stats.max, value);
+                    sum += value;
+                    ++index;
+                }
+            }
+
+            if (!stillValid(lowest)) {
+                continue;
+            }
+
+            stats.mean = static_cast<float>(sum / stats.count);
+            stats.latest = newest.value;
+            stats.oldest = oldest.timestamp;
+            stats.newest = newest.timestamp;
+            const double elapsed = std::chrono::duration<double>(newest.timestamp - oldest.timestamp).count();
+            if (elapsed > 0.0) {
+                stats.rate_per_second = static_cast<float>((newest.value - oldest.value) / elapsed);
+            }
+            return stats;
+        }
+    }
+
+    /**
+     * @brief Copy the newest samples, oldest first
+     * @param out Receives up to kHistoryLimit samples
+     * @return Number of samples copied
+     */
+    size_t copyRecent(TelemetrySample* out) const {
+        for (;;) {
+            const uint64_t head = head_.load(std::memory_order_acquire);
+            const uint64_t lowest = head > kWindowLimit ? head - kWindowLimit : 0;
+            for (uint64_t index = lowest; index < head; ++index) {
+                out[index - lowest] = readSample(index);
+            }
+            if (stillValid(lowest)) {
+                return static_cast<size_t>(head - lowest);
+            }
+        }
+    }
+
+    /**
+     * @brief Drop every sample; writer only, with no reader active
+     */
+    void reset() { head_.store(0, std::memory_order_release); }
+
+    /**
+     * @brief Number of samples pushed since construction or reset()
+     */
+    uint64_t totalPushed() const { return head_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Number of samples kept
+     */
+    static constexpr size_t capacity() { return Capacity; }
+
+private:
+    static constexpr size_t kMask = Capacity - 1;
+    static constexpr size_t kBlocks = Capacity / kBlockSize;
+    static constexpr size_t kBlockMask = kBlocks - 1;
+    static constexpr uint64_t kWindowLimit = Capacity - kBlockSize;
+
+    struct Slot {
+        std::atomic<std::chrono::system_clock::rep> time{0};
+        std::atomic<float> value{0.0f};
+    };
+
+    struct Block {
+        std::atomic<float> min{0.0f};
+        std::atomic<float> max{0.0f};
+        std::atomic<float> sum{0.0f};
+    };
+
+    TelemetrySample readSample(uint64_t index) const {
+        const Slot& slot = slots_[index & kMask];
+        TelemetrySample sample;
+        sample.timestamp = std::chrono::system_clock::time_point(
+            std::chrono::system_clock::duration(slot.time.load(std::memory_order_relaxed)));
+        sample.value = slot.value.load(std::memory_order_relaxed);
+        return sample;
+    }
+
+    // True if no sample at or after index has been overwritten since it was read
+    bool stillValid(uint64_t index) const {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint64_t head = head_.load(std::memory_order_relaxed);
+        if (index + Capacity > head) {
+            return true;
+        }
+        std::this_thread::yield();
+        return false;
+    }
+
+    std::array<Slot, Capacity> slots_;
+    std::array<Block, kBlocks> blocks_;
+    alignas(64) std::atomic<uint64_t> head_{0};
+};
+
+} // namespace core
+} // namespace skymesh
+
+#endif // SKYMESH_CORE_TELEMETRY_RING_H
@@ -0,0 +1,275 @@
+/**
+ * @file telemetry_stream.h
+ * @brief Streaming telemetry collection straight into downlink frames
+ *
+ * A TelemetryCollector takes fixed-size snapshots of the power, health and
+ * task subsystems when a sweep starts, then serializes them directly into
+ * frame buffers provided by a TelemetrySink, typically pool buffers of the
+ * RF transmit queue. Nothing is copied or allocated per frame.
+ *
+ * When the sink has no buffer to give, the downlink is behind: the sweep
+ * pauses where it is and the next emit() resumes it, so collection never
+ * runs ahead of the radio by more than the sink's buffers.
+ *
+ * Every frame is little endian:
+ *
+ *     u16 type, u16 sequence, u16 sweep, u16 payload length,
+ *     u64 sweep time (ms since epoch), payload, u32 CRC32C of all before it
+ *
+ * Payloads by type:
+ *
+ * | Type          | Payload                                                   |
+ * |---------------|-----------------------------------------------------------|
+ * | POWER_BUDGET  | 5 x f32 budget, u8 mode, u8 count, per subsystem u8 id,   |
+ * |               | u8 active, 3 x f32 current/average/peak power             |
+ * | HEALTH_REPORT | one binary health report, see health_report_codec.h       |
+ * | SENSOR_WINDOW | per source u8 source, u32 samples, 5 x f32 min/max/mean/  |
+ * |               | latest/rate; source 0 is dose rate, 1 + ComponentType a   |
+ * |               | temperature                                               |
+ * | TASK_METRICS  | 3 x u64 executed/failed/radiation, u32 per TaskStatus     |
+ */
+
+#ifndef SKYMESH_CORE_TELEMETRY_STREAM_H
+#define SKYMESH_CORE_TELEMETRY_STREAM_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "skymesh/core/health_monitor.h"
+#include "skymesh/core/metrics.h"
+#include "skymesh/core/orbital_task_manager.h"
+#include "skymesh/core/power_manager.h"
+#include "skymesh/core/rf_tx_queue.h"
+
+namespace skymesh {
+namespace core {
+
+/**
+ * @brief Kind of data a telemetry frame carries
+ */
+enum class TelemetryFrameType : uint16_t {
+    POWER_BUDGET = 1,    ///< Power budget snapshot
+    HEALTH_REPORT = 2,   ///< Full or delta binary health report
+    SENSOR_WINDOW = 3,   ///< Trailing-window statistics of the health telemetry rings
+    TASK_METRICS = 4     ///< Task execution counters
+};
+
+/// Bytes before the payload of every frame
+constexpr size_t kTelemetryFrameHeaderSize = 16;
+/// Bytes after the payload: the CRC32C
+constexpr size_t kTelemetryFrameTrailerSize = 4;
+/// Largest frame, one RF transmit buffer
+constexpr size_t kTelemetryMaxFrameSize = RF_TX_FRAME_SIZE;
+
+/**
+ * @brief A received frame, pointing into the frame bytes
+ */
+struct TelemetryFrameView {
+    TelemetryFrameType type;     ///< Payload kind
+    uint16_t sequence;           ///< Frame counter, wrapping; gaps show lost frames
+    uint16_t sweep;              ///< Sweep the frame belongs to
+    uint64_t timestampMs;        ///< Sweep time, ms since the epoch
+    const uint8_t* payload;      ///< Payload bytes
+    size_t payloadSize;          ///< Payload length
+};
+
+/**
+ * @brief Check a frame's length and CRC and locate its payload
+ * @return false if the frame is truncated or corrupt
+ */
+bool parseTelemetryFrame(const uint8_t* frame, size_t size, TelemetryFrameView& out);
+
+/**
+ * @brief Destination of telemetry frames
+ *
+ * The collector builds each frame in a buffer from acquireFrame() and then
+ * either commits or aborts it before asking for the next one.
+ */
+class TelemetrySink {
+public:
+    virtual ~TelemetrySink() = default;
+
+    /**
+     * @brief Provide a buffer for the next frame
+     * @param capacity Set to the buffer size, at most kTelemetryMaxFrameSize
+     * @return Buffer, or nullptr to pause the sweep until the downlink catches up
+     */
+    virtual uint8_t* acquireFrame(size_t& capacity) = 0;
+
+    /**
+     * @brief Send the frame built in the last acquired buffer
+     * @param length Frame length in bytes
+     * @param type Payload kind
+     * @param sequence Frame sequence number
+     * @return false if the frame was dropped
+     */
+    virtual bool commitFrame(size_t length, TelemetryFrameType type, uint16_t sequence) = 0;
+
+    /**
+     * @brief Give back the last acquired buffer unused
+     */
+    virtual void abortFrame() = 0;
+};
+
+/**
+ * @brief Counters of a TelemetryCollector
+ */
+struct TelemetryStreamStats {
+    uint64_t sweeps = 0;         ///< Sweeps started
+    uint64_t frames = 0;         ///< Frames committed to the sink
+    uint64_t bytes = 0;          ///< Bytes committed to the sink
+    uint64_t stalls = 0;         ///< emit() calls paused by a full sink
+    uint64_t dropped = 0;        ///< Frames the sink refused on commit
+    uint64_t skipped = 0;        ///< Health reports that did not fit a sink buffer
+};
+
+/**
+ * @class TelemetryCollector
+ * @brief Resumable telemetry sweep over the power, health and task subsystems
+ *
+ * Missing subsystems are skipped. Not thread-safe; drive a collector from
+ * one context, the same one that submits to the sink.
+ */
+class TelemetryCollector {
+public:
+    /// Trailing window of the sensor statistics
+    static constexpr std::chrono::seconds kDefaultSensorWindow{60};
+
+    /**
+     * @brief Constructor
+     * @param powerManager Source of power budget snapshots; may be empty
+     * @param healthMonitor Source of health reports and telemetry ring statistics; may be empty
+     * @param orbitalTaskManager Source of task metrics; may be empty
+     * @param sensorWindow Window of the SENSOR_WINDOW statistics
+     */
+    TelemetryCollector(std::shared_ptr<PowerManager> powerManager,
+                       std::shared_ptr<HealthMonitor> healthMonitor,
+                       std::shared_ptr<OrbitalTaskManager> orbitalTaskManager,
+                       std::chrono::milliseconds sensorWindow = kDefaultSensorWindow);
+
+    /**
+     * @brief Start a sweep, abandoning any unfinished one
+     *
+     * Snapshots the power budget, task metrics and, for a full sweep, the
+     * sensor statistics. The health report is encoded as its frame is built.
+     * @param fullTelemetry Send a full health report and the sensor statistics
+     */
+    void beginSweep(bool fullTelemetry = false);
+
+    /**
+     * @brief Emit frames of the current sweep until it ends or the sink pauses it
+     * @param sink Frame destination
+     * @return Number of frames committed
+     */
+    size_t emit(TelemetrySink& sink);
+
+    /**
+     * @brief Whether a sweep has frames left to emit
+     */
+    bool sweepInProgress() const { return section_ != Section::DONE; }
+
+    /**
+     * @brief Get the collector counters
+     */
+    const TelemetryStreamStats& stats() const { return stats_; }
+
+private:
+    enum class Section : uint8_t { POWER, HEALTH, SENSORS, TASKS, DONE };
+
+    // Dose rate plus one temperature source per ComponentType
+    static constexpr size_t kSensorSources = 1 + static_cast<size_t>(ComponentType::SENSOR) + 1;
+
+    struct SensorRecord {
+        uint8_t source;
+        TelemetryWindowStats stats;
+    };
+
+    size_t writePayload(uint8_t* payload, size_t capacity);
+    void advance();
+
+    std::shared_ptr<PowerManager> power_manager_;
+    std::shared_ptr<HealthMonitor> health_monitor_;
+    std::shared_ptr<OrbitalTaskManager> task_manager_;
+    std::chrono::milliseconds sensor_window_;
+
+    // Current sweep
+    Section section_ = Section::DONE;
+    bool full_ = false;
+    uint16_t sweep_ = 0;
+    uint64_t timestamp_ms_ = 0;
+    PowerBudgetSnapshot power_{};
+    TaskMetrics tasks_{};
+    std::array<SensorRecord, kSensorSources> sensors_{};
+    size_t sensor_count_ = 0;
+    size_t next_sensor_ = 0;
+
+    uint16_t next_sequence_ = 0;
+    TelemetryStreamStats stats_;
+};
+
+/**
+ * @class RfTxQueueSink
+ * @brief Telemetry sink that builds frames in place in RF transmit queue buffers
+ *
+ * Frames are pushed at one priority. Before pausing a sweep the sink polls
+ * the queue's completions to reclaim sent buffers, and it always leaves
+ * reserve buffers free for other traffic. Use it from the queue's
+ * submitter context; completions it polls are counted, not returned.
+ *
+ * The time from commit to completion of each of its frames goes to the
+ * "rf.tx_latency_ns" histogram of the metrics registry.
+ */
+class RfTxQueueSink : public TelemetrySink {
+public:
+    /**
+     * @brief Constructor
+     * @param queue Transmit queue to submit to
+     * @param priority Queue priority of telemetry frames
+     * @param reserve Pool buffers telemetry never takes
+     */
+    RfTxQueueSink(rf_txq_t& queue, uint8_t priority, size_t reserve = 0);
+
+    uint8_t* acquireFrame(size_t& capacity) override;
+    bool commitFrame(size_t length, TelemetryFrameType type, uint16_t sequence) override;
+    void abortFrame() override;
+
+    /**
+     * @brief Reclaim buffers of frames the radio has finished with
+     * @return Number of completions collected
+     */
+    size_t reclaim();
+
+    /**
+     * @brief Frames the radio reported sent
+     */
+    uint64_t sent() const { return sent_; }
+
+    /**
+     * @brief Frames the radio reported failed
+     */
+    uint64_t failed() const { return failed_; }
+
+private:
+    struct InFlight {
+        uint16_t sequence;
+        uint64_t committed_ns;
+    };
+
+    rf_txq_t& queue_;
+    uint8_t priority_;
+    size_t reserve_;
+    rf_packet_t* current_ = nullptr;
+    std::array<InFlight, RF_TX_POOL_SIZE> in_flight_{};
+    size_t in_flight_count_ = 0;
+    LatencyHistogram& tx_latency_;
+    uint64_t sent_ = 0;
+    uint64_t failed_ = 0;
+};
+
+} // namespace core
+} // namespace skymesh
+
+#endif // SKYMESH_CORE_TELEMETRY_STREAM_H
@@ -0,0 +1,196 @@
+/**
+ * @file tmr.h
+ * @brief Triple modular redundant storage with bitwise majority voting
+ *
+ * Tmr<T> keeps three physically separate copies of a value. Reads vote
+ * lazily (two agreeing copies short-circuit the vote), writes refresh all
+ * copies, and TmrScrubber repairs registered values incrementally so that
+ * single-event upsets do not accumulate into uncorrectable double faults.
+ */
+
+#ifndef SKYMESH_CORE_TMR_H
+#define SKYMESH_CORE_TMR_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace skymesh {
+namespace core {
+
+/**
+ * @brief Copy alignment that places each copy of a small value in its own cache line
+ */
+constexpr size_t kTmrCacheLine = 64;
+
+/**
+ * @brief Bitwise majority vote of three byte ranges
+ *
+ * Computes (a&b)|(b&c)|(a&c) over size bytes into out, which may alias any
+ * of the inputs. Whole blocks are voted with SIMD where available.
+ * @return True if the three inputs did not all agree
+ */
+bool tmrVote(const void* a, const void* b, const void* c, void* out, size_t size);
+
+/**
+ * @brief Repair three copies in place to their bitwise majority
+ * @return True if any copy had to be corrected
+ */
+bool tmrScrub(void* a, void* b, void* c, size_t size);
+
+/**
+ * @brief A value stored as three voted copies
+ *
+ * @tparam T Trivially copyable value type; voting works on its bit pattern,
+ *           so floats and aggregates recover exactly from a single upset
+ * @tparam Alignment Alignment of each copy; kTmrCacheLine keeps the copies
+ *                   in separate cache lines
+ *
+ * Not thread-safe; callers serialise access as they would for a plain T.
+ */
+template <typename T, size_t Alignment = alignof(T)>
+class Tmr {
+    static_assert(std::is_trivially_copyable<T>::value, "Tmr requires a trivially copyable type");
+
+public:
+    Tmr() : Tmr(T{}) {}
+
+    explicit Tmr(const T& value) {
+        store(value);
+    }
+
+    /**
+     * @brief Write the value to all three copies
+     */
+    void store(const T& value) {
+        for (auto& copy : copies_) {
+            std::memcpy(&copy.value, &value, sizeof(T));
+        }
+    }
+
+    /**
+     * @brief Read the majority value without repairing the copies
+     */
+    T load() const {
+        if (std::memcmp(&copies_[0].value, &copies_[1].value, sizeof(T)) == 0) {
+            return copies_[0].value;
+        }
+        T voted;
+        tmrVote(&copies_[0].value, &copies_[1].value, &copies_[2].value, &voted, sizeof(T));
+        return voted;
+    }
+
+    /**
+     * @brief Read-modify-write through the voted value
+     * @param mutate Callable taking T&; all copies are rewritten afterwards
+     */
+    template <typename F>
+    void update(F&& mutate) {
+        T value = load();
+        mutate(value);
+        store(value);
+    }
+
+    /**
+     * @brief Repair all copies to the majority value
+     * @return True if a disagreement was found and corrected
+     */
+    bool scrub() {
+        return tmrScrub(&copies_[0].value, &copies_[1].value, &copies_[2].value, sizeof(T));
+    }
+
+    /**
+     * @brief Check whether all three copies agree
+     */
+    bool consistent() const {
+        return std::memcmp(&copies_[0].value, &copies_[1].value, sizeof(T)) == 0 &&
+               std::memcmp(&copies_[0].value, &copies_[2].value, sizeof(T)) == 0;
+    }
+
+    /**
+     * @brief Raw access to one copy, for fault injection in tests
+     * @param index Copy index (0-2)
+     */
+    T* unsafeCopy(size_t index) {
+        return &copies_[index].value;
+    }
+
+private:
+    struct alignas(Alignment) Copy {
+        T value;
+    };
+
+    std::array<Copy, 3> copies_;
+};
+
+/**
+ * @brief Round-robin scrubber over a set of Tmr values
+ *
+ * Holds non-owning references: registered values must outlive the scrubber
+ * or be removed with clear(). Each step() repairs regions until a byte
+ * budget is spent, so large protected sets can be covered over several
+ * control ticks.
+ */
+class TmrScrubber {
+public:
+    /**
+     * @brief Register a value for periodic scrubbing
+     */
+    template <typename T, size_t Alignment>
+    void add(Tmr<T, Alignment>& value) {
+        regions_.push_back({&value, &scrubRegion<T, Alignment>, sizeof(T)});
+    }
+
+    /**
+     * @brief Scrub regions, continuing from the last position
+     * @param budgetBytes Protected bytes to cover in this step; at least one
+     *                    region is scrubbed per call
+     * @return Number of regions that needed correction
+     */
+    size_t step(size_t budgetBytes);
+
+    /**
+     * @brief Scrub every registered region once
+     * @return Number of regions that needed correction
+     */
+    size_t scrubAll();
+
+    /**
+     * @brief Total corrections made since construction
+     */
+    uint64_t totalCorrections() const { return totalCorrections_; }
+
+    /**
+     * @brief Total protected bytes across registered regions
+     */
+    size_t protectedBytes() const;
+
+    /**
+     * @brief Forget all registered regions
+     */
+    void clear();
+
+private:
+    struct Region {
+        void* tmr;
+        bool (*scrub)(void*);
+        size_t bytes;
+    };
+
+    template <typename T, size_t Alignment>
+    static bool scrubRegion(void* tmr) {
+        return static_cast<Tmr<T, Alignment>*>(tmr)->scrub();
+    }
+
+    std::vector<Region> regions_;
+    size_t cursor_ = 0;
+    uint64_t totalCorrections_ = 0;
+};
+
+} // namespace core
+} // namespace skymesh
+
+#endif // SKYMESH_CORE_TMR_H
@@ -0,0 +1,289 @@
+/**
+ * @file checkpoint_store.cpp
+ * @brief Implementation of the double-buffered checkpoint store
+ */
+
+#include "skymesh/core/checkpoint_store.h"
+#include "skymesh/core/crc32c.h"
+#include "skymesh/core/metrics.h"
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace skymesh {
+namespace core {
+
+namespace {
+    constexpr uint32_t kCheckpointMagic = 0x534B4350;   // "SKCP"
+    constexpr uint16_t kCheckpointVersion = 1;
+    constexpr size_t kHeaderCopies = 2;
+
+    size_t roundToPage(size_t bytes) {
+        return (std::max<size_t>(bytes, 1) + kCheckpointPageSize - 1) / kCheckpointPageSize * kCheckpointPageSize;
+    }
+} // anonymous namespace
+
+size_t CheckpointStore::requiredSize(const CheckpointLayout& layout) {
+    size_t size = kHeaderCopies * kCheckpointPageSize;
+    for (size_t capacity : layout.capacity) {
+        size += 2 * roundToPage(capacity);
+    }
+    return size;
+}
+
+std::unique_ptr<CheckpointStore> CheckpointStore::openFile(const std::string& path, const CheckpointLayout& layout) {
+#ifdef __linux__
+    const size_t size = requiredSize(layout);
+    const int fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat info {};
+    if (::fstat(fd, &info) != 0 ||
+        (static_cast<size_t>(info.st_size) != size && ::ftruncate(fd, static_cast<off_t>(size)) != 0)) {
+        ::close(fd);
+        return nullptr;
+    }
+    void* mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        return nullptr;
+    }
+
+    // msync() wants addresses aligned to the system page, which may be larger than ours
+    const uintptr_t systemPage = static_cast<uintptr_t>(::sysconf(_SC_PAGESIZE));
+    CheckpointFlush flush = [systemPage](const void* address, size_t length) {
+        const uintptr_t start = reinterpret_cast<uintptr_t>(address) & ~(systemPage - 1);
+        const uintptr_t end = reinterpret_cast<uintptr_t>(address) + length;
+        ::msync(reinterpret_cast<void*>(start), end - start, MS_SYNC);
+    };
+    return std::unique_ptr<CheckpointStore>(new CheckpointStore(
+        static_cast<uint8_t*>(mapping), size, layout, std::move(flush),
+        [mapping, size] { ::munmap(mapping, size); }));
+#else
+    (void)path;
+    (void)layout;
+    return nullptr;
+#endif
+}
+
+std::unique_ptr<CheckpointStore> CheckpointStore::openRegion(void* base, size_t size, const CheckpointLayout& layout,
+                                                             CheckpointFlush flush) {
+    if (base == nullptr || reinterpret_cast<uintptr_t>(base) % kCheckpointPageSize != 0 ||
+        size < requiredSize(layout)) {
+        return nullptr;
+    }
+    return std::unique_ptr<CheckpointStore>(
+        new CheckpointStore(static_cast<uint8_t*>(base), size, layout, std::move(flush), nullptr));
+}
+
+CheckpointStore::CheckpointStore(uint8_t* base, size_t size, const CheckpointLayout& layout,
+                                 CheckpointFlush flush, std::function<void()> unmap)
+    : base_(base), size_(size), flush_(std::move(flush)), unmap_(std::move(unmap)) {
+    size_t offset = kHeaderCopies * kCheckpointPageSize;
+    for (size_t i = 0; i < kCheckpointSectionCount; ++i) {
+        capacity_[i] = roundToPage(layout.capacity[i]);
+        offset_[i] = offset;
+        offset += 2 * capacity_[i];
+    }
+    open();
+}
+
+CheckpointStore::~CheckpointStore() {
+    if (unmap_) {
+        unmap_();
+    }
+}
+
+void CheckpointStore::open() {
+    // Take the newest intact header copy; a torn write leaves the other one
+    bool found = false;
+    for (size_t copy = 0; copy < kHeaderCopies; ++copy) {
+        Header header;
+        std::memcpy(&header, base_ + copy * kCheckpointPageSize, sizeof(header));
+        if (validHeader(header) && (!found || header.generation > current_.generation)) {
+            current_ = header;
+            current_copy_ = copy;
+            found = true;
+        }
+    }
+    recovered_ = found;
+    if (found) {
+        return;
+    }
+
+    // Nothing usable: format both copies empty
+    Header header{};
+    header.magic = kCheckpointMagic;
+    header.version = kCheckpointVersion;
+    header.sectionCount = static_cast<uint16_t>(kCheckpointSectionCount);
+    for (size_t i = 0; i < kCheckpointSectionCount; ++i) {
+        header.capacity[i] = capacity_[i];
+    }
+    header.crc = crc32c(&header, offsetof(Header, crc));
+    for (size_t copy = 0; copy < kHeaderCopies; ++copy) {
+        std::memcpy(base_ + copy * kCheckpointPageSize, &header, sizeof(header));
+        flushRange(base_ + copy * kCheckpointPageSize, sizeof(header));
+    }
+    current_ = header;
+    current_copy_ = 0;
+}
+
+bool CheckpointStore::validHeader(const Header& header) const {
+    if (header.magic != kCheckpointMagic || header.version != kCheckpointVersion ||
+        header.sectionCount != kCheckpointSectionCount ||
+        header.crc != crc32c(&header, offsetof(Header, crc))) {
+        return false;
+    }
+    for (size_t i = 0; i < kCheckpointSectionCount; ++i) {
+        const SectionDescriptor& section = header.sections[i];
+        if (header.capacity[i] != capacity_[i] || section.active > 1 ||
+            section.slots[0].size > capacity_[i] || section.slots[1].size > capacity_[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void CheckpointStore::publishHeader(const Header& header) {
+    // Overwrite the older copy, so the current one survives a torn write
+    const size_t copy = current_copy_ ^ 1;
+    std::memcpy(base_ + copy * kCheckpointPageSize, &header, sizeof(header));
+    flushRange(base_ + copy * kCheckpointPageSize, sizeof(header));
+    current_ = header;
+    current_copy_ = copy;
+}
+
+uint8_t* CheckpointStore::slotAddress(size_t section, size_t slot) const {
+    return base_ + offset_[section] + slot * capacity_[section];
+}
+
+bool CheckpointStore::intact(size_t section, size_t slot, const Header& header) const {
+    const SlotDescriptor& descriptor = header.sections[section].slots[slot];
+    return descriptor.generation != 0 &&
+           crc32c(slotAddress(section, slot), static_cast<size_t>(descriptor.size)) == descriptor.crc;
+}
+
+void CheckpointStore::flushRange(const uint8_t* address, size_t length) const {
+    if (flush_) {
+        flush_(address, length);
+    }
+}
+
+size_t CheckpointStore::capacity(CheckpointSection section) const {
+    return capacity_[static_cast<size_t>(section)];
+}
+
+CheckpointReadStatus CheckpointStore::read(CheckpointSection section, CheckpointView& out) const {
+    const size_t index = static_cast<size_t>(section);
+    std::lock_guard<std::mutex> lock(mutex_);
+    const SectionDescriptor& descriptor = current_.sections[index];
+    const size_t active = descriptor.active;
+    if (descriptor.slots[0].generation == 0 && descriptor.slots[1].generation == 0) {
+        return CheckpointReadStatus::EMPTY;
+    }
+
+    for (size_t slot : {active, active ^ 1}) {
+        if (intact(index, slot, current_)) {
+            out.data = slotAddress(index, slot);
+            out.size = static_cast<size_t>(descriptor.slots[slot].size);
+            out.generation = descriptor.slots[slot].generation;
+            if (slot == active) {
+                return CheckpointReadStatus::VALID;
+            }
+            ++stats_.fallbacks;
+            return CheckpointReadStatus::PREVIOUS;
+        }
+    }
+    ++stats_.corrupt;
+    return CheckpointReadStatus::CORRUPT;
+}
+
+uint8_t* CheckpointStore::stage(CheckpointSection section, size_t& capacity) {
+    const size_t index = static_cast<size_t>(section);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (staging_[index].size() != capacity_[index]) {
+        staging_[index].resize(capacity_[index]);
+    }
+    capacity = capacity_[index];
+    return staging_[index].data();
+}
+
+bool CheckpointStore::commit(CheckpointSection section, size_t size) {
+    SKYMESH_TRACE_SPAN("checkpoint.commit_ns");
+    const size_t index = static_cast<size_t>(section);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (size > capacity_[index] || staging_[index].size() != capacity_[index]) {
+        return false;
+    }
+    const uint8_t* staged = staging_[index].data();
+    const uint32_t crc = crc32c(staged, size);
+
+    // Nothing to do if the published copy already holds these bytes
+    const SectionDescriptor& descriptor = current_.sections[index];
+    const SlotDescriptor& published = descriptor.slots[descriptor.active];
+    if (published.generation != 0 && published.size == size && published.crc == crc &&
+        std::memcmp(slotAddress(index, descriptor.active), staged, size) == 0) {
+        ++stats_.unchanged;
+        return true;
+    }
+
+    // Write the pages of the other slot that differ, flushing each run of dirty pages
+    const size_t target = descriptor.active ^ 1;
+    uint8_t* slot = slotAddress(index, target);
+    size_t dirtyStart = 0;
+    size_t dirtyLength = 0;
+    for (size_t offset = 0; offset < size; offset += kCheckpointPageSize) {
+        const size_t length = std::min(kCheckpointPageSize, size - offset);
+        ++stats_.pagesCompared;
+        if (std::memcmp(slot + offset, staged + offset, length) == 0) {
+            if (dirtyLength != 0) {
+                flushRange(slot + dirtyStart, dirtyLength);
+                dirtyLength = 0;
+            }
+            continue;
+        }
+        std::memcpy(slot + offset, staged + offset, length);
+        ++stats_.pagesWritten;
+        if (dirtyLength == 0) {
+            dirtyStart = offset;
+        }
+        dirtyLength = offset + length - dirtyStart;
+    }
+    if (dirtyLength != 0) {
+        flushRange(slot + dirtyStart, dirtyLength);
+    }
+
+    Header next = current_;
+    ++next.generation;
+    next.sections[index].active = static_cast<uint8_t>(target);
+    next.sections[index].slots[target] = SlotDescriptor{next.generation, size, crc, 0};
+    next.crc = crc32c(&next, offsetof(Header, crc));
+    publishHeader(next);
+    ++stats_.commits;
+    return true;
+}
+
+void CheckpointStore::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Header next = current_;
+    ++next.generation;
+    std::memset(next.sections, 0, sizeof(next.sections));
+    next.crc = crc32c(&next, offsetof(Header, crc));
+    publishHeader(next);
+}
+
+CheckpointStats CheckpointStore::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+} // namespace core
+} // namespace skymesh
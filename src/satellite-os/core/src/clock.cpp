@@ -0,0 +1,130 @@
+/**
+ * @file clock.cpp
+ * @brief Wall clock and discrete-event simulation executor
+ */
+
+#include "skymesh/core/clock.h"
+
+#include <algorithm>
+
+namespace skymesh {
+namespace core {
+
+namespace {
+    class SystemClock : public Clock {
+    public:
+        std::chrono::system_clock::time_point now() const override {
+            return std::chrono::system_clock::now();
+        }
+    };
+
+    int64_t toNanoseconds(std::chrono::system_clock::time_point time) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+    }
+} // anonymous namespace
+
+std::shared_ptr<const Clock> systemClock() {
+    static const std::shared_ptr<const Clock> clock = std::make_shared<SystemClock>();
+    return clock;
+}
+
+constexpr std::chrono::seconds SimulationExecutor::kDefaultEpoch;
+
+SimulationExecutor::SimulationExecutor(std::chrono::system_clock::time_point epoch)
+    : now_ns_(toNanoseconds(epoch)) {
+}
+
+std::chrono::system_clock::time_point SimulationExecutor::now() const {
+    return std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+        std::chrono::nanoseconds(now_ns_.load(std::memory_order_acquire))));
+}
+
+TimerId SimulationExecutor::scheduleAt(std::chrono::system_clock::time_point when, std::function<void()> work) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const TimerId id = next_id_++;
+    work_.emplace(id, std::move(work));
+    events_.push_back({when, id});
+    std::push_heap(events_.begin(), events_.end(), std::greater<Event>());
+    return id;
+}
+
+bool SimulationExecutor::cancel(TimerId id) {
+    // The heap entry stays and is skipped when it comes up, unless dead
+    // entries start to outnumber live ones
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (work_.erase(id) == 0) {
+        return false;
+    }
+    if (events_.size() > 2 * work_.size() + 64) {
+        events_.erase(std::remove_if(events_.begin(), events_.end(),
+                                     [this](const Event& event) { return work_.count(event.id) == 0; }),
+                      events_.end());
+        std::make_heap(events_.begin(), events_.end(), std::greater<Event>());
+    }
+    return true;
+}
+
+bool SimulationExecutor::takeNext(std::chrono::system_clock::time_point until, std::function<void()>& work) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    while (!events_.empty()) {
+        const Event next = events_.front();
+        auto it = work_.find(next.id);
+        if (it != work_.end() && next.when > until) {
+            return false;
+        }
+        std::pop_heap(events_.begin(), events_.end(), std::greater<Event>());
+        events_.pop_back();
+        if (it == work_.end()) {
+            continue;   // Cancelled
+        }
+
+        // Work scheduled in the past runs now; time never goes backwards
+        const int64_t when = toNanoseconds(next.when);
+        if (when > now_ns_.load(std::memory_order_relaxed)) {
+            now_ns_.store(when, std::memory_order_release);
+        }
+        work = std::move(it->second);
+        work_.erase(it);
+        return true;
+    }
+    return false;
+}
+
+bool SimulationExecutor::runNext() {
+    std::function<void()> work;
+    if (!takeNext(std::chrono::system_clock::time_point::max(), work)) {
+        return false;
+    }
+    executed_.fetch_add(1, std::memory_order_relaxed);
+    work();
+    return true;
+}
+
+size_t SimulationExecutor::runUntil(std::chrono::system_clock::time_point until) {
+    size_t ran = 0;
+    std::function<void()> work;
+    while (takeNext(until, work)) {
+        executed_.fetch_add(1, std::memory_order_relaxed);
+        ++ran;
+        work();
+        work = nullptr;
+    }
+
+    const int64_t target = toNanoseconds(until);
+    if (target > now_ns_.load(std::memory_order_relaxed)) {
+        now_ns_.store(target, std::memory_order_release);
+    }
+    return ran;
+}
+
+size_t SimulationExecutor::runFor(std::chrono::nanoseconds duration) {
+    return runUntil(now() + std::chrono::duration_cast<std::chrono::system_clock::duration>(duration));
+}
+
+size_t SimulationExecutor::pending() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return work_.size();
+}
+
+} // namespace core
+} // namespace skymesh
@@ -0,0 +1,1074 @@
+/**
+ * @file command_control.cpp
+ * @brief Implementation of the command and control system and its dispatcher
+ */
+
+#include "skymesh/core/command_control.h"
+#include "skymesh/core/crc32c.h"
+#include "skymesh/core/logger.h"
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+// Four signature lanes per AVX2 register, picked at runtime on baseline builds
+#include <immintrin.h>
+#define SKYMESH_SIGNATURE_AVX2 1
+#define SKYMESH_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+namespace skymesh {
+namespace core {
+
+namespace {
+    constexpr const char* kLogComponent = "command_control";
+
+    // Lane serving EMERGENCY, and lane serving every other priority
+    constexpr size_t kEmergencyLane = 0;
+    constexpr size_t kQueuedLane = 1;
+
+    // Telemetry ECC blocks handed to the Reed-Solomon batch codec at once
+    constexpr size_t kTelemetryEccBatch = 16;
+
+    // Safe mode error code for a checkpoint that failed its integrity checks
+    constexpr uint32_t kCheckpointRestoreError = 0x0C01;
+
+    // Sink for collectTelemetry(): one heap-backed packet per frame, never full
+    class TelemetryPacketSink : public TelemetrySink {
+    public:
+        explicit TelemetryPacketSink(std::vector<TelemetryPacket>& packets) : m_packets(packets) {}
+
+        uint8_t* acquireFrame(size_t& capacity) override {
+            m_frame.resize(kTelemetryMaxFrameSize);
+            capacity = m_frame.size();
+            return m_frame.data();
+        }
+
+        bool commitFrame(size_t length, TelemetryFrameType type, uint16_t sequence) override {
+            TelemetryFrameView view;
+            if (!parseTelemetryFrame(m_frame.data(), length, view)) {
+                return false;
+            }
+            TelemetryPacket packet{};
+            packet.packetId = sequence;
+            packet.timestamp = view.timestampMs;
+            packet.packetType = static_cast<uint16_t>(type);
+            packet.data.assign(m_frame.begin(), m_frame.begin() + static_cast<std::ptrdiff_t>(length));
+            packet.generateChecksum();
+            m_packets.push_back(std::move(packet));
+            return true;
+        }
+
+        void abortFrame() override {}
+
+    private:
+        std::vector<TelemetryPacket>& m_packets;
+        std::vector<uint8_t> m_frame;
+    };
+
+    // SipHash-2-4 over Lanes independent messages at once. The lanes have no
+    // data dependencies on each other, so their rounds overlap in the
+    // pipeline. Lane loops are unrolled at compile time so the state words
+    // stay in registers.
+    template <size_t Lanes>
+    struct SipLanes {
+        uint64_t v0[Lanes], v1[Lanes], v2[Lanes], v3[Lanes];
+
+        template <typename F, size_t... L>
+        static void forEachLane(F&& f, std::index_sequence<L...>) {
+            (f(std::integral_constant<size_t, L>{}), ...);
+        }
+
+        template <typename F>
+        static void forEachLane(F&& f) {
+            forEachLane(f, std::make_index_sequence<Lanes>{});
+        }
+
+        void load(size_t lane, const CommandKeySchedule& schedule) {
+            v0[lane] = schedule.v[0];
+            v1[lane] = schedule.v[1];
+            v2[lane] = schedule.v[2];
+            v3[lane] = schedule.v[3];
+        }
+
+        static uint64_t rotl(uint64_t x, int b) {
+            return (x << b) | (x >> (64 - b));
+        }
+
+        void round(size_t l) {
+            v0[l] += v1[l]; v1[l] = rotl(v1[l], 13); v1[l] ^= v0[l]; v0[l] = rotl(v0[l], 32);
+            v2[l] += v3[l]; v3[l] = rotl(v3[l], 16); v3[l] ^= v2[l];
+            v0[l] += v3[l]; v3[l] = rotl(v3[l], 21); v3[l] ^= v0[l];
+            v2[l] += v1[l]; v1[l] = rotl(v1[l], 17); v1[l] ^= v2[l]; v2[l] = rotl(v2[l], 32);
+        }
+
+        void compress(size_t l, uint64_t m) {
+            v3[l] ^= m;
+            round(l);
+            round(l);
+            v0[l] ^= m;
+        }
+
+        void compressAll(const uint64_t (&m)[Lanes]) {
+            forEachLane([&](auto l) { v3[l] ^= m[l]; });
+            forEachLane([&](auto l) { round(l); });
+            forEachLane([&](auto l) { round(l); });
+            forEachLane([&](auto l) { v0[l] ^= m[l]; });
+        }
+
+        void finishAll(const uint64_t (&m)[Lanes], uint64_t (&tags)[Lanes]) {
+            compressAll(m);
+            forEachLane([&](auto l) { v2[l] ^= 0xFF; });
+            for (int r = 0; r < 4; ++r) {
+                forEachLane([&](auto l) { round(l); });
+            }
+            forEachLane([&](auto l) { tags[l] = v0[l] ^ v1[l] ^ v2[l] ^ v3[l]; });
+        }
+    };
+
+    constexpr size_t kSignatureLanes = 4;
+
+    uint64_t load64le(const uint8_t* p) {
+        uint64_t value;
+        std::memcpy(&value, p, sizeof(value));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        value = __builtin_bswap64(value);
+#endif
+        return value;
+    }
+
+    // The signed bytes of a command as SipHash blocks: ID, code, priority and
+    // source fill the first block, the timestamp the second, then the data
+    struct SignedMessage {
+        SignedMessage() = default;
+
+        explicit SignedMessage(const Command& command)
+            : header{static_cast<uint64_t>(command.commandId) |
+                         (static_cast<uint64_t>(command.getCommandCodeTMR()) << 32) |
+                         (static_cast<uint64_t>(command.priority) << 48) |
+                         (static_cast<uint64_t>(command.source) << 56),
+                     command.timestamp}
+            , data(command.data.data())
+            , size(command.data.size()) {}
+
+        size_t blocks() const { return 2 + size / 8; }
+
+        uint64_t block(size_t i) const {
+            return i < 2 ? header[i] : load64le(data + 8 * (i - 2));
+        }
+
+        uint64_t finalBlock() const {
+            uint64_t last = static_cast<uint64_t>((sizeof(header) + size) & 0xFF) << 56;
+            const size_t tail = size & ~size_t{7};
+            for (size_t i = tail; i < size; ++i) {
+                last |= static_cast<uint64_t>(data[i]) << (8 * (i - tail));
+            }
+            return last;
+        }
+
+        uint64_t header[2]{};
+        const uint8_t* data{nullptr};
+        size_t size{0};
+    };
+
+    // Hashes one group of lanes, ordered shortest first, from an initialized state
+    void hashGroup(SipLanes<kSignatureLanes>& hash, const SignedMessage* const (&lane)[kSignatureLanes],
+                   uint64_t (&tags)[kSignatureLanes]) {
+        const size_t shared = lane[0]->blocks();
+        uint64_t m[kSignatureLanes];
+        for (size_t i = 0; i < shared; ++i) {
+            SipLanes<kSignatureLanes>::forEachLane([&](auto l) { m[l] = lane[l]->block(i); });
+            hash.compressAll(m);
+        }
+        SipLanes<kSignatureLanes>::forEachLane([&](auto l) {
+            for (size_t i = shared; i < lane[l]->blocks(); ++i) {
+                hash.compress(l, lane[l]->block(i));
+            }
+            m[l] = lane[l]->finalBlock();
+        });
+        hash.finishAll(m, tags);
+    }
+
+#if defined(SKYMESH_SIGNATURE_AVX2)
+    template <int B>
+    SKYMESH_AVX2_TARGET inline __m256i rotlAvx2(__m256i x) {
+        return _mm256_or_si256(_mm256_slli_epi64(x, B), _mm256_srli_epi64(x, 64 - B));
+    }
+
+    SKYMESH_AVX2_TARGET inline __m256i rotl32Avx2(__m256i x) {
+        return _mm256_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+    }
+
+    SKYMESH_AVX2_TARGET inline void roundAvx2(__m256i (&v)[4]) {
+        v[0] = _mm256_add_epi64(v[0], v[1]); v[1] = rotlAvx2<13>(v[1]);
+        v[1] = _mm256_xor_si256(v[1], v[0]); v[0] = rotl32Avx2(v[0]);
+        v[2] = _mm256_add_epi64(v[2], v[3]); v[3] = rotlAvx2<16>(v[3]);
+        v[3] = _mm256_xor_si256(v[3], v[2]);
+        v[0] = _mm256_add_epi64(v[0], v[3]); v[3] = rotlAvx2<21>(v[3]);
+        v[3] = _mm256_xor_si256(v[3], v[0]);
+        v[2] = _mm256_add_epi64(v[2], v[1]); v[1] = rotlAvx2<17>(v[1]);
+        v[1] = _mm256_xor_si256(v[1], v[2]); v[2] = rotl32Avx2(v[2]);
+    }
+
+    SKYMESH_AVX2_TARGET inline void compressAvx2(__m256i (&v)[4], __m256i m) {
+        v[3] = _mm256_xor_si256(v[3], m);
+        roundAvx2(v);
+        roundAvx2(v);
+        v[0] = _mm256_xor_si256(v[0], m);
+    }
+
+    SKYMESH_AVX2_TARGET inline __m256i laneBlocksAvx2(const SignedMessage* const (&lane)[kSignatureLanes], size_t i) {
+        return _mm256_set_epi64x(static_cast<long long>(lane[3]->block(i)), static_cast<long long>(lane[2]->block(i)),
+                                 static_cast<long long>(lane[1]->block(i)), static_cast<long long>(lane[0]->block(i)));
+    }
+
+    // hashGroup() with the four lanes in the four 64-bit elements of each state register
+    SKYMESH_AVX2_TARGET
+    void hashGroupAvx2(SipLanes<kSignatureLanes>& hash, const SignedMessage* const (&lane)[kSignatureLanes],
+                       uint64_t (&tags)[kSignatureLanes]) {
+        static_assert(kSignatureLanes == 4, "one AVX2 register per state word");
+        __m256i v[4] = {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(hash.v0)),
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hash.v1)),
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hash.v2)),
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hash.v3))};
+        const size_t shared = lane[0]->blocks();
+        for (size_t i = 0; i < shared; ++i) {
+            compressAvx2(v, laneBlocksAvx2(lane, i));
+        }
+
+        // Longer lanes finish their extra blocks one at a time
+        if (lane[kSignatureLanes - 1]->blocks() > shared) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(hash.v0), v[0]);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(hash.v1), v[1]);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(hash.v2), v[2]);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(hash.v3), v[3]);
+            for (size_t l = 0; l < kSignatureLanes; ++l) {
+                for (size_t i = shared; i < lane[l]->blocks(); ++i) {
+                    hash.compress(l, lane[l]->block(i));
+                }
+            }
+            v[0] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hash.v0));
+            v[1] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hash.v1));
+            v[2] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hash.v2));
+            v[3] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hash.v3));
+        }
+
+        compressAvx2(v, _mm256_set_epi64x(
+            static_cast<long long>(lane[3]->finalBlock()), static_cast<long long>(lane[2]->finalBlock()),
+            static_cast<long long>(lane[1]->finalBlock()), static_cast<long long>(lane[0]->finalBlock())));
+        v[2] = _mm256_xor_si256(v[2], _mm256_set1_epi64x(0xFF));
+        for (int r = 0; r < 4; ++r) {
+            roundAvx2(v);
+        }
+        const __m256i tag = _mm256_xor_si256(_mm256_xor_si256(v[0], v[1]), _mm256_xor_si256(v[2], v[3]));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(tags), tag);
+    }
+#endif
+
+    using GroupHasher = void (*)(SipLanes<kSignatureLanes>&, const SignedMessage* const (&)[kSignatureLanes],
+                                 uint64_t (&)[kSignatureLanes]);
+
+    GroupHasher selectGroupHasher() {
+#if defined(SKYMESH_SIGNATURE_AVX2)
+        if (__builtin_cpu_supports("avx2")) {
+            return hashGroupAvx2;
+        }
+#endif
+        return hashGroup;
+    }
+
+    CommandSignature toSignature(uint64_t tag) {
+        CommandSignature signature{};
+        for (size_t i = 0; i < signature.size(); ++i) {
+            signature[i] = static_cast<uint8_t>(tag >> (8 * i));
+        }
+        return signature;
+    }
+
+    // Constant-time compare, so timing does not reveal a matching prefix
+    bool signatureMatches(const CommandSignature& expected, const std::vector<uint8_t>& signature) {
+        uint8_t diff = 0;
+        for (size_t i = 0; i < kCommandSignatureSize; ++i) {
+            diff |= static_cast<uint8_t>(expected[i] ^ signature[i]);
+        }
+        return diff == 0;
+    }
+
+    // a^b, b^c and c^a of the three code copies, one per 16-bit lane
+    uint64_t codeCopyDifferences(const Command& command) {
+        const uint64_t a = command.commandCode;
+        const uint64_t b = command.commandCode_copy1;
+        const uint64_t c = command.commandCode_copy2;
+        return (a | (b << 16) | (c << 32)) ^ (b | (c << 16) | (a << 32));
+    }
+
+    int64_t steadyNowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void atomicMax(std::atomic<int64_t>& target, int64_t value) {
+        int64_t current = target.load(std::memory_order_relaxed);
+        while (value > current &&
+               !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    void complete(const CommandCallback& callback, CommandStatus status, const std::string& details) {
+        if (!callback) {
+            return;
+        }
+        try {
+            callback(status, details);
+        } catch (const std::exception& e) {
+            SKYMESH_LOG_ERROR(kLogComponent, "Exception in command callback: ", e.what());
+        } catch (...) {
+            SKYMESH_LOG_ERROR(kLogComponent, "Unknown exception in command callback");
+        }
+    }
+}
+
+// ---- Command ----
+
+uint16_t Command::getCommandCodeTMR() const {
+    return static_cast<uint16_t>((commandCode & commandCode_copy1) |
+                                 (commandCode_copy1 & commandCode_copy2) |
+                                 (commandCode & commandCode_copy2));
+}
+
+bool Command::validateTMR() const {
+    return codeCopyDifferences(*this) == 0;
+}
+
+bool Command::validateChecksum() const {
+    return checksum == computeCommandChecksum(*this);
+}
+
+bool Command::validateSignature() const {
+    return signature.empty() || signature.size() == kCommandSignatureSize;
+}
+
+uint32_t computeCommandChecksum(const Command& command) {
+    const uint16_t code = command.getCommandCodeTMR();
+    const uint8_t header[2] = {static_cast<uint8_t>(code), static_cast<uint8_t>(code >> 8)};
+    return crc32cExtend(crc32c(header, sizeof(header)), command.data.data(), command.data.size());
+}
+
+CommandKeySchedule::CommandKeySchedule(const CommandKey& key) {
+    const uint64_t k0 = load64le(key.data());
+    const uint64_t k1 = load64le(key.data() + 8);
+    v[0] = 0x736f6d6570736575ull ^ k0;
+    v[1] = 0x646f72616e646f6dull ^ k1;
+    v[2] = 0x6c7967656e657261ull ^ k0;
+    v[3] = 0x7465646279746573ull ^ k1;
+}
+
+CommandSignature computeCommandSignature(const Command& command, const CommandKey& key) {
+    return computeCommandSignature(command, CommandKeySchedule(key));
+}
+
+CommandSignature computeCommandSignature(const Command& command, const CommandKeySchedule& schedule) {
+    const SignedMessage message(command);
+    SipLanes<1> hash;
+    hash.load(0, schedule);
+    for (size_t i = 0; i < message.blocks(); ++i) {
+        hash.compress(0, message.block(i));
+    }
+    uint64_t tag[1];
+    hash.finishAll({message.finalBlock()}, tag);
+    return toSignature(tag[0]);
+}
+
+void computeCommandSignatures(const Command* const* commands, const CommandKeySchedule* const* schedules,
+                              size_t count, CommandSignature* signatures) {
+    // Shortest first, so each group of lanes shares most of its blocks.
+    // Plans are usually uniform, so the sort is often skipped.
+    std::vector<size_t> order(count);
+    std::iota(order.begin(), order.end(), size_t{0});
+    const auto shorter = [commands](size_t a, size_t b) {
+        return commands[a]->data.size() / 8 < commands[b]->data.size() / 8;
+    };
+    if (!std::is_sorted(order.begin(), order.end(), shorter)) {
+        std::stable_sort(order.begin(), order.end(), shorter);
+    }
+
+    static const GroupHasher hashGroupLanes = selectGroupHasher();
+    for (size_t first = 0; first < count; first += kSignatureLanes) {
+        const size_t used = std::min(kSignatureLanes, count - first);
+        SignedMessage messages[kSignatureLanes];
+        const SignedMessage* lane[kSignatureLanes];
+        SipLanes<kSignatureLanes> hash;
+        SipLanes<kSignatureLanes>::forEachLane([&](auto l) {
+            // Spare lanes repeat the last message and are discarded
+            const size_t index = order[first + std::min<size_t>(l, used - 1)];
+            messages[l] = SignedMessage(*commands[index]);
+            lane[l] = &messages[l];
+            hash.load(l, *schedules[index]);
+        });
+
+        uint64_t tags[kSignatureLanes];
+        hashGroupLanes(hash, lane, tags);
+        for (size_t l = 0; l < used; ++l) {
+            signatures[order[first + l]] = toSignature(tags[l]);
+        }
+    }
+}
+
+// ---- TelemetryPacket ----
+
+void TelemetryPacket::generateChecksum() {
+    checksum = crc32c(data.data(), data.size());
+}
+
+bool TelemetryPacket::validateChecksum() const {
+    return checksum == crc32c(data.data(), data.size());
+}
+
+// Full blocks go through the interleaved batch codec, a shorter last block
+// is a shortened codeword
+void TelemetryPacket::generateECC() {
+    const size_t fullBlocks = data.size() / kRsMaxDataSize;
+    const size_t tail = data.size() % kRsMaxDataSize;
+    ecc.resize((fullBlocks + (tail ? 1 : 0)) * kRsParitySize);
+
+    const uint8_t* blockData[kTelemetryEccBatch];
+    uint8_t* blockParity[kTelemetryEccBatch];
+    for (size_t first = 0; first < fullBlocks; first += kTelemetryEccBatch) {
+        const size_t count = std::min(kTelemetryEccBatch, fullBlocks - first);
+        for (size_t i = 0; i < count; ++i) {
+            blockData[i] = data.data() + (first + i) * kRsMaxDataSize;
+            blockParity[i] = ecc.data() + (first + i) * kRsParitySize;
+        }
+        rsEncodeBatch(blockData, blockParity, kRsMaxDataSize, count);
+    }
+    if (tail) {
+        rsEncode(data.data() + fullBlocks * kRsMaxDataSize, tail, ecc.data() + fullBlocks * kRsParitySize);
+    }
+}
+
+bool TelemetryPacket::applyECCCorrection() {
+    const size_t fullBlocks = data.size() / kRsMaxDataSize;
+    const size_t tail = data.size() % kRsMaxDataSize;
+    if (ecc.size() != (fullBlocks + (tail ? 1 : 0)) * kRsParitySize) {
+        return false;
+    }
+
+    size_t failures = 0;
+    uint8_t* blockData[kTelemetryEccBatch];
+    uint8_t* blockParity[kTelemetryEccBatch];
+    for (size_t first = 0; first < fullBlocks; first += kTelemetryEccBatch) {
+        const size_t count = std::min(kTelemetryEccBatch, fullBlocks - first);
+        for (size_t i = 0; i < count; ++i) {
+            blockData[i] = data.data() + (first + i) * kRsMaxDataSize;
+            blockParity[i] = ecc.data() + (first + i) * kRsParitySize;
+        }
+        failures += rsDecodeBatch(blockData, blockParity, kRsMaxDataSize, count);
+    }
+    if (tail && rsDecode(data.data() + fullBlocks * kRsMaxDataSize, tail,
+                         ecc.data() + fullBlocks * kRsParitySize) < 0) {
+        ++failures;
+    }
+    return failures == 0;
+}
+
+// ---- CommandControl ----
+
+CommandControl::CommandControl(
+    std::shared_ptr<RFController> rfController,
+    std::shared_ptr<PowerManager> powerManager,
+    std::shared_ptr<OrbitalTaskManager> orbitalTaskManager,
+    std::shared_ptr<HealthMonitor> healthMonitor)
+    : m_rfController(std::move(rfController))
+    , m_powerManager(std::move(powerManager))
+    , m_orbitalTaskManager(std::move(orbitalTaskManager))
+    , m_healthMonitor(std::move(healthMonitor))
+    , m_handlers(std::make_shared<const HandlerTable>())
+    , m_keys(std::make_shared<const KeyTable>())
+    , m_telemetryCollector(m_powerManager, m_healthMonitor, m_orbitalTaskManager)
+    , m_isProcessingCommands(false)
+    , m_stopping(false)
+    , m_nextCommandId(1)
+    , m_pendingCommands(0)
+    , m_executedCount(0)
+    , m_rejectedCount(0)
+    , m_rateLimitedCount(0)
+    , m_queueFullCount(0)
+    , m_executionTime(MetricsRegistry::instance().histogram("command.execution_ns"))
+    , m_currentMode(SystemMode::NORMAL)
+    , m_inSafeMode(false)
+    , m_lastErrorCode(0) {
+    for (auto& queue : m_commandQueues) {
+        queue = std::make_unique<BoundedMpmcRing<QueuedCommand>>(kCommandQueueCapacity);
+    }
+    for (auto& latency : m_maxQueueLatencyNs) {
+        latency.store(0, std::memory_order_relaxed);
+    }
+    static constexpr const char* kDispatchLatencyNames[kCommandPriorityCount] = {
+        "command.dispatch_latency_ns.emergency", "command.dispatch_latency_ns.high",
+        "command.dispatch_latency_ns.normal", "command.dispatch_latency_ns.low",
+        "command.dispatch_latency_ns.deferred"};
+    for (size_t i = 0; i < kCommandPriorityCount; ++i) {
+        m_dispatchLatency[i] = &MetricsRegistry::instance().histogram(kDispatchLatencyNames[i]);
+    }
+    m_lanes[kEmergencyLane].firstPriority = static_cast<size_t>(CommandPriority::EMERGENCY);
+    m_lanes[kEmergencyLane].lastPriority = static_cast<size_t>(CommandPriority::EMERGENCY);
+    m_lanes[kQueuedLane].firstPriority = static_cast<size_t>(CommandPriority::HIGH);
+    m_lanes[kQueuedLane].lastPriority = static_cast<size_t>(CommandPriority::DEFERRED);
+}
+
+CommandControl::~CommandControl() {
+    stopDispatch();
+}
+
+bool CommandControl::initialize() {
+    if (m_isProcessingCommands.exchange(true)) {
+        return true;  // Already initialized
+    }
+    m_stopping.store(false);
+    if (!m_executor) {
+        for (auto& lane : m_lanes) {
+            lane.thread = std::thread(&CommandControl::dispatchLoop, this, std::ref(lane));
+        }
+    }
+    SKYMESH_LOG_INFO(kLogComponent, "Command dispatcher started");
+    return true;
+}
+
+void CommandControl::stopDispatch() {
+    if (!m_isProcessingCommands.exchange(false)) {
+        return;
+    }
+    m_stopping.store(true, std::memory_order_seq_cst);
+    for (auto& lane : m_lanes) {
+        {
+            std::lock_guard<std::mutex> lock(lane.wakeMutex);
+            if (lane.pass != 0) {
+                m_executor->cancel(lane.pass);
+                lane.pass = 0;
+            }
+        }
+        lane.wake.notify_one();
+        if (lane.thread.joinable()) {
+            lane.thread.join();
+        }
+    }
+
+    // Commands still queued will not run; tell their submitters
+    for (auto& queue : m_commandQueues) {
+        QueuedCommand queued;
+        while (queue->tryPop(queued)) {
+            complete(queued.callback, CommandStatus::RESOURCE_UNAVAILABLE, "Command control stopped");
+            m_pendingCommands.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
+    std::lock_guard<std::mutex> lock(m_idleMutex);
+    m_idle.notify_all();
+}
+
+CommandStatus CommandControl::processCommand(const Command& command, CommandCallback callback) {
+    if (!m_isProcessingCommands.load(std::memory_order_acquire)) {
+        return CommandStatus::RESOURCE_UNAVAILABLE;
+    }
+
+    CommandStatus status = checkCommand(command);
+    if (status == CommandStatus::PENDING && !authenticateCommand(command)) {
+        status = CommandStatus::UNAUTHORIZED;
+    }
+    if (status != CommandStatus::PENDING) {
+        return rejectCommand(command, status);
+    }
+
+    status = enqueueCommand(command, std::move(callback));
+    if (status == CommandStatus::PENDING) {
+        signalLane(command.priority == CommandPriority::EMERGENCY
+                       ? m_lanes[kEmergencyLane] : m_lanes[kQueuedLane]);
+    }
+    return status;
+}
+
+std::vector<CommandStatus> CommandControl::processCommandBatch(const std::vector<Command>& commands,
+                                                               CommandCallback callback) {
+    SKYMESH_TRACE_SPAN("command.batch_admission_ns");
+    std::vector<CommandStatus> statuses(commands.size(), CommandStatus::PENDING);
+    if (!m_isProcessingCommands.load(std::memory_order_acquire)) {
+        std::fill(statuses.begin(), statuses.end(), CommandStatus::RESOURCE_UNAVAILABLE);
+        return statuses;
+    }
+
+    // Cheap checks first; commands from keyed sources are collected for one
+    // multi-buffer signing pass
+    const auto keys = std::atomic_load(&m_keys);
+    std::vector<size_t> keyed;
+    std::vector<const Command*> keyedCommands;
+    std::vector<const CommandKeySchedule*> keyedSchedules;
+    for (size_t i = 0; i < commands.size(); ++i) {
+        const Command& command = commands[i];
+        CommandStatus status = checkCommand(command);
+        const auto* schedule = status == CommandStatus::PENDING
+            ? (*keys)[static_cast<size_t>(command.source)].get() : nullptr;
+        if (schedule && command.signature.size() != kCommandSignatureSize) {
+            status = CommandStatus::UNAUTHORIZED;
+        }
+        if (status != CommandStatus::PENDING) {
+            statuses[i] = rejectCommand(command, status);
+        } else if (schedule) {
+            keyed.push_back(i);
+            keyedCommands.push_back(&command);
+            keyedSchedules.push_back(schedule);
+        }
+    }
+
+    std::vector<CommandSignature> expected(keyed.size());
+    computeCommandSignatures(keyedCommands.data(), keyedSchedules.data(), keyed.size(), expected.data());
+    for (size_t j = 0; j < keyed.size(); ++j) {
+        if (!signatureMatches(expected[j], commands[keyed[j]].signature)) {
+            statuses[keyed[j]] = rejectCommand(commands[keyed[j]], CommandStatus::UNAUTHORIZED);
+        }
+    }
+
+    // Enqueue in uplink order, then wake each lane once
+    bool wakeLane[2] = {false, false};
+    for (size_t i = 0; i < commands.size(); ++i) {
+        if (statuses[i] != CommandStatus::PENDING) {
+            continue;
+        }
+        statuses[i] = enqueueCommand(commands[i], callback);
+        if (statuses[i] == CommandStatus::PENDING) {
+            wakeLane[commands[i].priority == CommandPriority::EMERGENCY ? kEmergencyLane : kQueuedLane] = true;
+        }
+    }
+    for (size_t lane = 0; lane < m_lanes.size(); ++lane) {
+        if (wakeLane[lane]) {
+            signalLane(m_lanes[lane]);
+        }
+    }
+    return statuses;
+}
+
+bool CommandControl::queueCommand(const Command& command, CommandCallback callback) {
+    return processCommand(command, std::move(callback)) == CommandStatus::PENDING;
+}
+
+Command CommandControl::createCommand(uint16_t commandCode, CommandPriority priority,
+                                      const std::vector<uint8_t>& data) {
+    Command command{};
+    command.commandId = m_nextCommandId.fetch_add(1, std::memory_order_relaxed);
+    command.commandCode = commandCode;
+    command.commandCode_copy1 = commandCode;
+    command.commandCode_copy2 = commandCode;
+    command.priority = priority;
+    command.source = CommandSource::ONBOARD_SCHEDULER;
+    const auto now = m_executor ? m_executor->now() : std::chrono::system_clock::now();
+    command.timestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        now.time_since_epoch()).count());
+    command.data = data;
+    command.checksum = computeCommandChecksum(command);
+
+    const auto keys = std::atomic_load(&m_keys);
+    if (const auto& schedule = (*keys)[static_cast<size_t>(command.source)]) {
+        const CommandSignature signature = computeCommandSignature(command, *schedule);
+        command.signature.assign(signature.begin(), signature.end());
+    }
+    return command;
+}
+
+bool CommandControl::setExecutor(std::shared_ptr<Executor> executor) {
+    if (m_isProcessingCommands.load(std::memory_order_acquire)) {
+        return false;
+    }
+    m_executor = std::move(executor);
+    return true;
+}
+
+bool CommandControl::registerCommandHandler(uint16_t commandCode, CommandHandler handler) {
+    std::lock_guard<std::mutex> lock(m_tableMutex);
+    auto updated = std::make_shared<HandlerTable>(*std::atomic_load(&m_handlers));
+    if (handler) {
+        (*updated)[commandCode] = std::move(handler);
+    } else {
+        updated->erase(commandCode);
+    }
+    std::atomic_store(&m_handlers, std::shared_ptr<const HandlerTable>(std::move(updated)));
+    return true;
+}
+
+void CommandControl::setRateLimit(CommandSource source, double commandsPerSecond, uint32_t burst) {
+    SourceRateLimit& limit = m_rateLimits[static_cast<size_t>(source)];
+    const int64_t interval = commandsPerSecond > 0.0
+        ? std::max<int64_t>(1, static_cast<int64_t>(1e9 / commandsPerSecond)) : 0;
+    limit.toleranceNs.store(interval * (std::max<uint32_t>(burst, 1) - 1), std::memory_order_relaxed);
+    limit.theoreticalArrivalNs.store(0, std::memory_order_relaxed);
+    limit.intervalNs.store(interval, std::memory_order_release);
+}
+
+void CommandControl::setSourceKey(CommandSource source, const CommandKey& key) {
+    std::lock_guard<std::mutex> lock(m_tableMutex);
+    auto updated = std::make_shared<KeyTable>(*std::atomic_load(&m_keys));
+    (*updated)[static_cast<size_t>(source)] = std::make_shared<const CommandKeySchedule>(key);
+    std::atomic_store(&m_keys, std::shared_ptr<const KeyTable>(std::move(updated)));
+}
+
+bool CommandControl::waitForIdle(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(m_idleMutex);
+    return m_idle.wait_for(lock, timeout, [this] {
+        return m_pendingCommands.load(std::memory_order_acquire) == 0;
+    });
+}
+
+CommandDispatchStats CommandControl::getDispatchStats() const {
+    CommandDispatchStats stats;
+    stats.executed = m_executedCount.load(std::memory_order_relaxed);
+    stats.rejected = m_rejectedCount.load(std::memory_order_relaxed);
+    stats.rateLimited = m_rateLimitedCount.load(std::memory_order_relaxed);
+    stats.queueFull = m_queueFullCount.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < kCommandPriorityCount; ++i) {
+        stats.maxQueueLatency[i] = std::chrono::nanoseconds(m_maxQueueLatencyNs[i].load(std::memory_order_relaxed));
+    }
+    return stats;
+}
+
+// ---- Telemetry ----
+
+std::vector<TelemetryPacket> CommandControl::collectTelemetry(bool fullTelemetry) {
+    std::vector<TelemetryPacket> packets;
+    TelemetryPacketSink sink(packets);
+    std::lock_guard<std::mutex> lock(m_telemetryQueueMutex);
+    m_telemetryCollector.beginSweep(fullTelemetry);
+    m_telemetryCollector.emit(sink);
+    return packets;
+}
+
+bool CommandControl::streamTelemetry(TelemetrySink& sink, bool fullTelemetry) {
+    std::lock_guard<std::mutex> lock(m_telemetryQueueMutex);
+    if (!m_telemetryCollector.sweepInProgress()) {
+        m_telemetryCollector.beginSweep(fullTelemetry);
+    }
+    m_telemetryCollector.emit(sink);
+    return !m_telemetryCollector.sweepInProgress();
+}
+
+bool CommandControl::changeSystemMode(SystemMode newMode) {
+    const SystemMode previous = m_currentMode.exchange(newMode);
+    m_inSafeMode.store(newMode == SystemMode::SAFE);
+    if (previous != newMode) {
+        SKYMESH_LOG_INFO(kLogComponent, "System mode changed from ", static_cast<int>(previous),
+                         " to ", static_cast<int>(newMode));
+    }
+
+    // Commands held back by the previous mode may be runnable now
+    signalLane(m_lanes[kQueuedLane]);
+    return true;
+}
+
+void CommandControl::enterSafeMode(uint32_t errorCode, const std::string& errorDetails) {
+    m_lastErrorCode.store(errorCode);
+    SKYMESH_LOG_ERROR(kLogComponent, "Entering safe mode, error ", errorCode,
+                      errorDetails.empty() ? "" : ": ", errorDetails);
+    changeSystemMode(SystemMode::SAFE);
+}
+
+void CommandControl::logError(uint8_t severity, uint16_t component,
+                              const std::string& message, const std::vector<uint8_t>& data) {
+    SKYMESH_LOG_ERROR(kLogComponent, "Error (severity ", static_cast<int>(severity),
+                      ", component ", component, ", ", data.size(), " data bytes): ", message);
+}
+
+bool CommandControl::isSystemSecure() const {
+    return !m_inSafeMode.load() && m_lastErrorCode.load() == 0;
+}
+
+// ---- State Checkpoints ----
+
+void CommandControl::setCheckpointStore(std::shared_ptr<CheckpointStore> store, TaskFunctionResolver resolver) {
+    std::lock_guard<std::mutex> lock(m_checkpointMutex);
+    m_checkpointStore = std::move(store);
+    m_taskResolver = std::move(resolver);
+}
+
+bool CommandControl::checkpointState() {
+    std::lock_guard<std::mutex> lock(m_checkpointMutex);
+    return m_checkpointStore && recordSubsystemState();
+}
+
+bool CommandControl::warmRestart() {
+    std::lock_guard<std::mutex> lock(m_checkpointMutex);
+    return m_checkpointStore && restoreLastKnownGoodState();
+}
+
+bool CommandControl::recordSubsystemState() {
+    static LatencyHistogram& saveTime = MetricsRegistry::instance().histogram("command.checkpoint_ns");
+    const ScopedTimer timer(saveTime);
+    CheckpointStore& store = *m_checkpointStore;
+    bool saved = true;
+    if (m_powerManager && !m_powerManager->saveCheckpoint(store)) {
+        saved = false;
+    }
+    if (m_healthMonitor && !m_healthMonitor->saveCheckpoint(store)) {
+        saved = false;
+    }
+    if (m_orbitalTaskManager && !m_orbitalTaskManager->saveCheckpoint(store)) {
+        saved = false;
+    }
+    if (!saved) {
+        SKYMESH_LOG_WARNING(kLogComponent, "State checkpoint incomplete");
+    }
+    return saved;
+}
+
+bool CommandControl::restoreLastKnownGoodState() {
+    static LatencyHistogram& restoreTime = MetricsRegistry::instance().histogram("command.warm_restart_ns");
+    const ScopedTimer timer(restoreTime);
+    const CheckpointStore& store = *m_checkpointStore;
+    if (!store.recovered()) {
+        SKYMESH_LOG_INFO(kLogComponent, "No state checkpoint found, cold start");
+        return false;
+    }
+    
+    // A section that was saved but cannot be applied leaves its subsystem at defaults
+    auto saved = [&store](CheckpointSection section) {
+        CheckpointView view;
+        return store.read(section, view) != CheckpointReadStatus::EMPTY;
+    };
+    std::string failed;
+    if (m_powerManager && saved(CheckpointSection::POWER) && !m_powerManager->restoreCheckpoint(store)) {
+        failed += " power";
+    }
+    if (m_healthMonitor && saved(CheckpointSection::HEALTH) && !m_healthMonitor->restoreCheckpoint(store)) {
+        failed += " health";
+    }
+    if (m_orbitalTaskManager) {
+        CheckpointView view;
+        const CheckpointReadStatus tasks = store.read(CheckpointSection::TASKS, view);
+        if (tasks == CheckpointReadStatus::CORRUPT) {
+            failed += " tasks";
+        } else if (tasks != CheckpointReadStatus::EMPTY) {
+            m_orbitalTaskManager->restoreCheckpoint(store, m_taskResolver);
+        }
+    }
+    
+    if (!failed.empty()) {
+        enterSafeMode(kCheckpointRestoreError, "state checkpoint rejected for" + failed);
+        return false;
+    }
+    SKYMESH_LOG_INFO(kLogComponent, "Warm restart from state checkpoint complete");
+    return true;
+}
+
+// ---- Validation ----
+
+bool CommandControl::validateCommandParameters(const Command& command) {
+    return static_cast<size_t>(command.priority) < kCommandPriorityCount &&
+           static_cast<size_t>(command.source) < kCommandSourceCount &&
+           command.validateSignature();
+}
+
+bool CommandControl::performTripleCommandValidation(const Command& command) {
+    // Two agreeing copies give a meaningful vote: some 16-bit lane of the
+    // pairwise differences is zero (the classic has-zero-lane test)
+    const uint64_t diff = codeCopyDifferences(command);
+    return ((diff - 0x0000000100010001ull) & ~diff & 0x0000800080008000ull) != 0;
+}
+
+bool CommandControl::authenticateCommand(const Command& command) {
+    const auto keys = std::atomic_load(&m_keys);
+    const auto& schedule = (*keys)[static_cast<size_t>(command.source)];
+    if (!schedule) {
+        return true;
+    }
+    return command.signature.size() == kCommandSignatureSize &&
+           signatureMatches(computeCommandSignature(command, *schedule), command.signature);
+}
+
+CommandStatus CommandControl::checkCommand(const Command& command) {
+    if (!validateCommandParameters(command) || !command.validateChecksum()) {
+        return CommandStatus::INVALID_COMMAND;
+    }
+    if (!performTripleCommandValidation(command)) {
+        return CommandStatus::REDUNDANCY_MISMATCH;
+    }
+    return CommandStatus::PENDING;
+}
+
+CommandStatus CommandControl::rejectCommand(const Command& command, CommandStatus status) {
+    m_rejectedCount.fetch_add(1, std::memory_order_relaxed);
+    SKYMESH_LOG_WARNING(kLogComponent, "Rejected command ", command.commandId,
+                        " (status ", static_cast<int>(status), ")");
+    return status;
+}
+
+CommandStatus CommandControl::enqueueCommand(const Command& command, CommandCallback callback) {
+    if (!acquireRateToken(command.source)) {
+        m_rateLimitedCount.fetch_add(1, std::memory_order_relaxed);
+        return CommandStatus::RESOURCE_UNAVAILABLE;
+    }
+
+    const size_t priority = static_cast<size_t>(command.priority);
+    const int64_t enqueued = dispatchNowNs();
+    m_pendingCommands.fetch_add(1, std::memory_order_acq_rel);
+    const bool queued = m_commandQueues[priority]->tryEmplace([&](QueuedCommand& slot) {
+        slot.command = command;
+        // Repair the redundant copies now that the vote has been accepted
+        const uint16_t code = command.getCommandCodeTMR();
+        slot.command.commandCode = code;
+        slot.command.commandCode_copy1 = code;
+        slot.command.commandCode_copy2 = code;
+        slot.callback = std::move(callback);
+        slot.enqueuedNs = enqueued;
+    });
+    if (!queued) {
+        m_pendingCommands.fetch_sub(1, std::memory_order_acq_rel);
+        m_queueFullCount.fetch_add(1, std::memory_order_relaxed);
+        return CommandStatus::RESOURCE_UNAVAILABLE;
+    }
+    return CommandStatus::PENDING;
+}
+
+bool CommandControl::acquireRateToken(CommandSource source) {
+    SourceRateLimit& limit = m_rateLimits[static_cast<size_t>(source)];
+    const int64_t interval = limit.intervalNs.load(std::memory_order_acquire);
+    if (interval == 0) {
+        return true;
+    }
+    const int64_t tolerance = limit.toleranceNs.load(std::memory_order_relaxed);
+    const int64_t now = dispatchNowNs();
+
+    int64_t arrival = limit.theoreticalArrivalNs.load(std::memory_order_relaxed);
+    for (;;) {
+        const int64_t next = std::max(arrival, now) + interval;
+        if (next - now > tolerance + interval) {
+            return false;
+        }
+        if (limit.theoreticalArrivalNs.compare_exchange_weak(arrival, next, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+}
+
+// ---- Dispatch ----
+
+bool CommandControl::isPriorityRunnable(size_t priority) const {
+    switch (m_currentMode.load(std::memory_order_relaxed)) {
+        case SystemMode::SAFE:
+        case SystemMode::EMERGENCY:
+        case SystemMode::RECOVERY:
+            // Only what is needed to get the spacecraft back
+            return priority <= static_cast<size_t>(CommandPriority::HIGH);
+        case SystemMode::LOW_POWER:
+            return priority < static_cast<size_t>(CommandPriority::DEFERRED);
+        default:
+            return true;
+    }
+}
+
+int64_t CommandControl::dispatchNowNs() const {
+    if (m_executor) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            m_executor->now().time_since_epoch()).count();
+    }
+    return steadyNowNs();
+}
+
+void CommandControl::signalLane(DispatchLane& lane) {
+    // On an executor, one pending pass drains whatever is queued by then
+    if (m_executor) {
+        std::lock_guard<std::mutex> lock(lane.wakeMutex);
+        if (lane.pass == 0 && !m_stopping.load(std::memory_order_relaxed)) {
+            lane.pass = m_executor->scheduleAt(m_executor->now(), [this, &lane] { dispatchPass(lane); });
+        }
+        return;
+    }
+
+    // Pairs with the waiting store in dispatchLoop, as in NotificationBus
+    lane.signals.fetch_add(1, std::memory_order_seq_cst);
+    if (lane.waiting.load(std::memory_order_seq_cst)) {
+        std::lock_guard<std::mutex> lock(lane.wakeMutex);
+        lane.wake.notify_one();
+    }
+}
+
+bool CommandControl::dispatchNext(DispatchLane& lane) {
+    // Rescanning from the top after every command lets new higher-priority
+    // work overtake anything already queued below it
+    for (size_t priority = lane.firstPriority; priority <= lane.lastPriority; ++priority) {
+        if (!isPriorityRunnable(priority)) {
+            continue;
+        }
+        QueuedCommand queued;
+        if (!m_commandQueues[priority]->tryPop(queued)) {
+            continue;
+        }
+
+        const int64_t waited = dispatchNowNs() - queued.enqueuedNs;
+        atomicMax(m_maxQueueLatencyNs[priority], waited);
+        m_dispatchLatency[priority]->record(static_cast<uint64_t>(std::max<int64_t>(waited, 0)));
+
+        {
+            ScopedTimer timer(m_executionTime);
+            executeCommand(queued.command, std::move(queued.callback));
+        }
+        m_executedCount.fetch_add(1, std::memory_order_relaxed);
+        if (m_pendingCommands.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            std::lock_guard<std::mutex> lock(m_idleMutex);
+            m_idle.notify_all();
+        }
+        return true;
+    }
+    return false;
+}
+
+void CommandControl::dispatchLoop(DispatchLane& lane) {
+    for (;;) {
+        const uint64_t seen = lane.signals.load(std::memory_order_seq_cst);
+        while (!m_stopping.load(std::memory_order_relaxed) && dispatchNext(lane)) {
+        }
+
+        std::unique_lock<std::mutex> lock(lane.wakeMutex);
+        if (m_stopping.load(std::memory_order_seq_cst)) {
+            break;
+        }
+        lane.waiting.store(true, std::memory_order_seq_cst);
+        lane.wake.wait(lock, [this, &lane, seen] {
+            return m_stopping.load(std::memory_order_seq_cst) ||
+                   lane.signals.load(std::memory_order_seq_cst) != seen;
+        });
+        lane.waiting.store(false, std::memory_order_relaxed);
+    }
+}
+
+void CommandControl::dispatchPass(DispatchLane& lane) {
+    {
+        std::lock_guard<std::mutex> lock(lane.wakeMutex);
+        lane.pass = 0;
+    }
+    while (!m_stopping.load(std::memory_order_relaxed) && dispatchNext(lane)) {
+    }
+}
+
+void CommandControl::executeCommand(const Command& command, CommandCallback callback) {
+    const auto handlers = std::atomic_load(&m_handlers);
+    const auto it = handlers->find(command.commandCode);
+    if (it == handlers->end()) {
+        complete(callback, CommandStatus::INVALID_COMMAND, "No handler for command code");
+        return;
+    }
+
+    std::string details;
+    CommandStatus status = CommandStatus::EXECUTION_ERROR;
+    try {
+        status = it->second(command, details);
+    } catch (const std::exception& e) {
+        details = e.what();
+        SKYMESH_LOG_ERROR(kLogComponent, "Exception in handler for command ", command.commandId, ": ", e.what());
+    } catch (...) {
+        details = "Unknown exception";
+        SKYMESH_LOG_ERROR(kLogComponent, "Unknown exception in handler for command ", command.commandId);
+    }
+    complete(callback, status, details);
+}
+
+} // namespace core
+} // namespace skymesh
@@ -0,0 +1,125 @@
+/**
+ * @file crc32c.cpp
+ * @brief CRC32C with SSE4.2/ARMv8 CRC instructions and a slicing-by-8 fallback
+ */
+
+#include "skymesh/core/crc32c.h"
+
+#include <cstring>
+
+#if defined(__SSE4_2__) && defined(__x86_64__)
+#include <nmmintrin.h>
+#define SKYMESH_CRC32C_X86 1
+#define SKYMESH_CRC32C_TARGET
+#elif defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+// Built for baseline x86-64: compile the SSE4.2 kernel anyway and pick it at runtime
+#include <nmmintrin.h>
+#define SKYMESH_CRC32C_X86 1
+#define SKYMESH_CRC32C_RUNTIME_CHECK 1
+#define SKYMESH_CRC32C_TARGET __attribute__((target("sse4.2")))
+#elif defined(__ARM_FEATURE_CRC32) && defined(__aarch64__)
+#include <arm_acle.h>
+#define SKYMESH_CRC32C_ARM 1
+#endif
+
+namespace skymesh {
+namespace core {
+
+namespace {
+
+// Reflected CRC32C tables; table k advances a byte through k further zero bytes
+struct SlicingTables {
+    uint32_t entries[8][256];
+
+    constexpr SlicingTables() : entries() {
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t crc = i;
+            for (int bit = 0; bit < 8; ++bit) {
+                crc = (crc >> 1) ^ ((crc & 1u) ? 0x82F63B78u : 0u);
+            }
+            entries[0][i] = crc;
+        }
+        for (int k = 1; k < 8; ++k) {
+            for (uint32_t i = 0; i < 256; ++i) {
+                const uint32_t previous = entries[k - 1][i];
+                entries[k][i] = (previous >> 8) ^ entries[0][previous & 0xFF];
+            }
+        }
+    }
+};
+constexpr SlicingTables kTables;
+
+uint32_t load32le(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+uint32_t extendTable(uint32_t crc, const uint8_t* p, size_t size) {
+    const auto& t = kTables.entries;
+    for (; size >= 8; p += 8, size -= 8) {
+        const uint32_t lo = crc ^ load32le(p);
+        const uint32_t hi = load32le(p + 4);
+        crc = t[7][lo & 0xFF] ^ t[6][(lo >> 8) & 0xFF] ^ t[5][(lo >> 16) & 0xFF] ^ t[4][lo >> 24] ^
+              t[3][hi & 0xFF] ^ t[2][(hi >> 8) & 0xFF] ^ t[1][(hi >> 16) & 0xFF] ^ t[0][hi >> 24];
+    }
+    for (; size > 0; ++p, --size) {
+        crc = (crc >> 8) ^ t[0][(crc ^ *p) & 0xFF];
+    }
+    return crc;
+}
+
+#if defined(SKYMESH_CRC32C_X86)
+SKYMESH_CRC32C_TARGET
+uint32_t extendHardware(uint32_t crc, const uint8_t* p, size_t size) {
+    uint64_t crc64 = crc;
+    for (; size >= 8; p += 8, size -= 8) {
+        uint64_t word;
+        std::memcpy(&word, p, sizeof(word));
+        crc64 = _mm_crc32_u64(crc64, word);
+    }
+    crc = static_cast<uint32_t>(crc64);
+    for (; size > 0; ++p, --size) {
+        crc = _mm_crc32_u8(crc, *p);
+    }
+    return crc;
+}
+#elif defined(SKYMESH_CRC32C_ARM)
+uint32_t extendHardware(uint32_t crc, const uint8_t* p, size_t size) {
+    for (; size >= 8; p += 8, size -= 8) {
+        uint64_t word;
+        std::memcpy(&word, p, sizeof(word));
+        crc = __crc32cd(crc, word);
+    }
+    for (; size > 0; ++p, --size) {
+        crc = __crc32cb(crc, *p);
+    }
+    return crc;
+}
+#endif
+
+} // anonymous namespace
+
+bool crc32cHardwareAccelerated() {
+#if defined(SKYMESH_CRC32C_RUNTIME_CHECK)
+    static const bool supported = __builtin_cpu_supports("sse4.2");
+    return supported;
+#elif defined(SKYMESH_CRC32C_X86) || defined(SKYMESH_CRC32C_ARM)
+    return true;
+#else
+    return false;
+#endif
+}
+
+uint32_t crc32cExtend(uint32_t crc, const void* data, size_t size) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    crc = ~crc;
+#if defined(SKYMESH_CRC32C_X86) || defined(SKYMESH_CRC32C_ARM)
+    if (crc32cHardwareAccelerated()) {
+        return ~extendHardware(crc, bytes, size);
+    }
+#endif
+    return ~extendTable(crc, bytes, size);
+}
+
+} // namespace core
+} // namespace skymesh
@@ -4,62 +4,232 @@
  */
 
 #include "skymesh/core/health_monitor.h"
-#include <iostream>
-#include <sstream>
+#include "skymesh/core/checkpoint_store.h"
+#include "skymesh/core/clock.h"
+#include "skymesh/core/health_report_codec.h"
+#include "skymesh/core/logger.h"
+#include "skymesh/core/notification_bus.h"
+#include "skymesh/core/sensor_backend.h"
+#include "skymesh/core/seqlock.h"
+#include "skymesh/core/telemetry_ring.h"
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <functional>
+#include <optional>
 
 namespace skymesh {
 namespace core {
 
 namespace {
-    // Helper functions for logging
-    void log_debug(const std::string& message) {
-        std::cout << "[DEBUG] " << message << std::endl;
+    constexpr const char* kLogComponent = "health_monitor";
+
+    // Samples kept per sensor; about 17 minutes at the default 1 s poll
+    constexpr size_t kTelemetryDepth = 1024;
+    constexpr size_t kMaxComponents = 64;
+    constexpr size_t kMaxTemperatureSensors = 64;
+
+    // Window health checks smooth temperature and dose rate over
+    constexpr std::chrono::seconds kTrendWindow{60};
+
+    // Excursion thresholds; sources showing one are sampled at their fast interval
+    constexpr float kHighDoseRate = 100.0f;         // rads/hour, where health starts to suffer
+    constexpr float kWarningTemperature = 60.0f;    // Celsius
+    constexpr float kCriticalTemperature = 80.0f;   // Celsius
+    constexpr float kThermalRateLimit = 0.1f;       // Celsius per second
+
+    // One schedule slot per component type, plus one for the radiation sensor
+    constexpr size_t kComponentTypeCount = static_cast<size_t>(ComponentType::SENSOR) + 1;
+    constexpr size_t kRadiationSlot = kComponentTypeCount;
+    constexpr size_t kScheduleSlots = kComponentTypeCount + 1;
+
+    using TelemetryBuffer = TelemetryRing<kTelemetryDepth>;
+
+    // Trivially copyable part of ComponentHealth, published through a seqlock.
+    // Diagnostics are static strings so the snapshot needs no allocation.
+    struct HealthState {
+        HealthStatus status;
+        float health_percentage;
+        const char* diagnostic;
+        std::chrono::system_clock::time_point last_updated;
+    };
+
+    // HEALTH checkpoint section: a header, then fixed-size component and
+    // ring records, so each record stays at the same offset between saves.
+    // Ring 0 is the dose rate history, then one ring per temperature sensor.
+    constexpr uint32_t kHealthCheckpointSchema = 1;
+    constexpr size_t kCheckpointIdLength = 64;     // IDs up to 63 bytes, NUL padded
+    constexpr size_t kCheckpointRingSamples = TelemetryBuffer::kHistoryLimit;
+    constexpr const char* kRestoredDiagnostic = "Restored from checkpoint";
+
+    struct HealthCheckpointHeader {
+        uint32_t schema;
+        uint32_t ring_samples;                     // kCheckpointRingSamples when written
+        uint32_t component_count;
+        uint32_t ring_count;
+        float total_dose;
+        float dose_rate;
+        int32_t single_event_upsets;
+        uint32_t reserved;
+    };
+
+    struct ComponentCheckpointRecord {
+        char component_id[kCheckpointIdLength];
+        uint8_t status;
+        uint8_t reserved[3];
+        float health_percentage;
+        int64_t last_updated_ns;
+    };
+
+    struct RingCheckpointSample {
+        int64_t timestamp_ns;
+        float value;
+        uint32_t reserved;
+    };
+
+    struct RingCheckpointRecord {
+        char sensor_id[kCheckpointIdLength];
+        uint32_t sample_count;
+        uint32_t reserved;
+        RingCheckpointSample samples[kCheckpointRingSamples];
+    };
+
+    int64_t toCheckpointTime(std::chrono::system_clock::time_point time) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
     }
-    
-    void log_info(const std::string& message) {
-        std::cout << "[INFO] " << message << std::endl;
+
+    std::chrono::system_clock::time_point fromCheckpointTime(int64_t nanoseconds) {
+        return std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::nanoseconds(nanoseconds)));
     }
-    
-    void log_warning(const std::string& message) {
-        std::cout << "[WARNING] " << message << std::endl;
+
+    // Copy an ID into a fixed field; false if it does not fit
+    bool putCheckpointId(char (&field)[kCheckpointIdLength], const std::string& id) {
+        std::memset(field, 0, sizeof(field));
+        if (id.size() >= kCheckpointIdLength) {
+            return false;
+        }
+        std::memcpy(field, id.data(), id.size());
+        return true;
     }
-    
-    void log_error(const std::string& message) {
-        std::cerr << "[ERROR] " << message << std::endl;
+
+    std::string checkpointId(const char (&field)[kCheckpointIdLength]) {
+        return std::string(field, strnlen(field, kCheckpointIdLength));
     }
 }
 
 class HealthMonitorImpl : public HealthMonitor {
 private:
-    // Thread synchronization
+    struct ComponentEntry {
+        ComponentEntry(const std::string& id, ComponentType type,
+                       std::chrono::system_clock::time_point now)
+            : component_id(id)
+            , type(type)
+            , in_service(now)
+            , health(HealthState{HealthStatus::NOMINAL, 100.0f, nullptr, now}) {
+        }
+
+        const std::string component_id;
+        const ComponentType type;
+        const std::chrono::system_clock::time_point in_service;
+        SeqLock<HealthState> health;
+
+        // Last status notified, so repeats are coalesced (writer only)
+        bool notified = false;
+        HealthStatus notified_status = HealthStatus::UNKNOWN;
+        const char* notified_diagnostic = nullptr;
+    };
+
+    struct TemperatureSensor {
+        TemperatureSensor(const std::string& id, ComponentType component, float initial_celsius)
+            : sensor_id(id)
+            , component(component)
+            , nominal_celsius(initial_celsius) {
+        }
+
+        const std::string sensor_id;
+        const ComponentType component;
+        const float nominal_celsius;
+        TelemetryBuffer samples;
+    };
+
+    struct ScheduleSlot {
+        SamplingPolicy policy;
+        std::chrono::steady_clock::time_point due;
+        std::chrono::steady_clock::time_point last_sample;
+        uint64_t generation = 0;        // Invalidates superseded heap entries
+        uint32_t nominal_samples = 0;   // Consecutive samples without an excursion
+        bool scheduled = false;
+        std::atomic<int64_t> interval_ms{1000};  // Current interval, for readers
+    };
+
+    struct DueEntry {
+        std::chrono::steady_clock::time_point due;
+        size_t slot;
+        uint64_t generation;
+
+        bool operator>(const DueEntry& other) const { return due > other.due; }
+    };
+
+    // Serializes writers: the monitoring loop, registration, recovery and
+    // configuration. Queries never take it.
     mutable std::mutex mutex_;
+    std::condition_variable wake_;
+
+    // Every reading comes from here, stamped with its clock
+    const std::shared_ptr<SensorBackend> sensors_;
+
     std::thread monitor_thread_;
-    bool running_;
-    uint32_t polling_interval_ms_;
+    std::atomic<bool> running_;
+
+    // Runs sampling passes instead of monitor_thread_ when set; the
+    // pending pass is guarded by mutex_
+    const std::shared_ptr<Executor> executor_;
+    TimerId sampling_timer_ = 0;
+    std::chrono::steady_clock::time_point sampling_due_;
+
+    // Min-heap of next-due sources, guarded by mutex_
+    std::array<ScheduleSlot, kScheduleSlots> schedule_;
+    std::vector<DueEntry> due_heap_;
+
+    // Append-only tables; an entry is immutable apart from its seqlock and
+    // ring once its count has been published
+    std::array<std::unique_ptr<ComponentEntry>, kMaxComponents> components_;
+    std::atomic<size_t> component_count_;
+    std::array<std::unique_ptr<TemperatureSensor>, kMaxTemperatureSensors> temperature_sensors_;
+    std::atomic<size_t> temperature_sensor_count_;
 
-    // Component health data
-    std::map<std::string, ComponentHealth> component_health_;
     std::map<ComponentType, std::vector<HealthAlertConfig>> alert_configs_;
-    
-    // Radiation and temperature monitoring
-    RadiationData current_radiation_;
-    std::map<std::string, TemperatureData> temperature_data_;
-    
-    // Callbacks
-    struct CallbackEntry {
-        int id;
-        HealthStatusCallback callback;
-        ComponentType filter_type;
-    };
-    std::vector<CallbackEntry> callbacks_;
-    int next_callback_id_;
+
+    // Radiation monitoring; radiation_state_ is the monitoring thread's copy
+    RadiationData radiation_state_;
+    SeqLock<RadiationData> radiation_;
+    TelemetryBuffer dose_rate_samples_;
+
+    // Downlink encoder and its delta history; taken after mutex_ when both are held
+    std::mutex report_mutex_;
+    HealthReportEncoder report_encoder_;
+
+    // Status callbacks, delivered on the bus thread
+    std::shared_ptr<NotificationBus> bus_;
+    NotificationTopic<ComponentHealth, ComponentType> status_topic_;
 
 public:
-    HealthMonitorImpl()
-        : running_(false)
-        , polling_interval_ms_(1000)
-        , next_callback_id_(0) {
+    HealthMonitorImpl(std::shared_ptr<NotificationBus> bus, std::shared_ptr<SensorBackend> sensors,
+                      std::shared_ptr<Executor> executor)
+        : sensors_(sensors ? std::move(sensors) : createSimulatedSensorBackend(SimulationProfile::steady()))
+        , running_(false)
+        , executor_(std::move(executor))
+        , component_count_(0)
+        , temperature_sensor_count_(0)
+        , radiation_state_{0.0f, 0.0f, 0, sensors_->now()}
+        , radiation_(radiation_state_)
+        , bus_(bus ? std::move(bus) : std::make_shared<NotificationBus>())
+        , status_topic_(kLogComponent, bus_) {
+        due_heap_.reserve(4 * kScheduleSlots);
     }
 
     ~HealthMonitorImpl() {
@@ -68,19 +238,46 @@ public:
 
     bool initialize(uint32_t polling_interval_ms) override {
         std::lock_guard<std::mutex> lock(mutex_);
-        polling_interval_ms_ = polling_interval_ms;
+        const std::chrono::milliseconds nominal(std::max<uint32_t>(polling_interval_ms, 1));
+
+        SamplingPolicy policy;
+        policy.nominal_interval = nominal;
+        policy.fast_interval = nominal / 4;
+        policy.quiet_interval = nominal * 4;
+        for (size_t i = 0; i < kScheduleSlots; ++i) {
+            setPolicyLocked(i, policy);
+        }
         return true;
     }
 
     bool start() override {
         std::lock_guard<std::mutex> lock(mutex_);
-        
+
         if (running_) {
             return false; // Already running
         }
-        
+
         running_ = true;
-        monitor_thread_ = std::thread(&HealthMonitorImpl::monitoringLoop, this);
+
+        // Dose accumulates from here, not from construction
+        radiation_state_.timestamp = sensors_->now();
+
+        // Everything with something to sample is due immediately
+        const auto now = scheduleNow();
+        due_heap_.clear();
+        for (size_t i = 0; i < kScheduleSlots; ++i) {
+            schedule_[i].scheduled = false;
+            schedule_[i].last_sample = now;
+            if (i == kRadiationSlot || hasSources(static_cast<ComponentType>(i))) {
+                scheduleLocked(i, now);
+            }
+        }
+
+        if (executor_) {
+            armSamplingLocked();
+        } else {
+            monitor_thread_ = std::thread(&HealthMonitorImpl::monitoringLoop, this);
+        }
         return true;
     }
 
@@ -91,58 +288,114 @@ public:
                 return;
             }
             running_ = false;
+            if (sampling_timer_ != 0) {
+                executor_->cancel(sampling_timer_);
+                sampling_timer_ = 0;
+            }
         }
+        wake_.notify_one();
 
         if (monitor_thread_.joinable()) {
             monitor_thread_.join();
         }
+
+        // No status callback runs once stop() has returned
+        status_topic_.flush();
     }
 
-    ComponentHealth getComponentHealth(const std::string& component_id) const override {
+    bool registerComponent(const std::string& component_id, ComponentType type) override {
         std::lock_guard<std::mutex> lock(mutex_);
-        auto it = component_health_.find(component_id);
-        if (it != component_health_.end()) {
-            return it->second;
+        const size_t count = component_count_.load(std::memory_order_relaxed);
+        if (count == kMaxComponents || findComponent(component_id)) {
+            return false;
+        }
+
+        components_[count] = std::make_unique<ComponentEntry>(
+            component_id, type, sensors_->now());
+        component_count_.store(count + 1, std::memory_order_release);
+        scheduleNewSourceLocked(type);
+        return true;
+    }
+
+    bool registerTemperatureSensor(const std::string& sensor_id, ComponentType component,
+                                   float initial_celsius) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const size_t count = temperature_sensor_count_.load(std::memory_order_relaxed);
+        if (count == kMaxTemperatureSensors || sensor_id.empty() ||
+            findTemperatureSensor(component, sensor_id)) {
+            return false;
         }
-        
+
+        // The first sample is written before the sensor is published, so
+        // the monitoring thread stays the ring's only writer
+        auto sensor = std::make_unique<TemperatureSensor>(sensor_id, component, initial_celsius);
+        sensor->samples.push(sensors_->now(), initial_celsius);
+        temperature_sensors_[count] = std::move(sensor);
+        temperature_sensor_count_.store(count + 1, std::memory_order_release);
+        scheduleNewSourceLocked(component);
+        return true;
+    }
+
+    void setSamplingPolicy(ComponentType component, const SamplingPolicy& policy) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        setPolicyLocked(static_cast<size_t>(component), policy);
+        wakeLocked();
+    }
+
+    void setRadiationSamplingPolicy(const SamplingPolicy& policy) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        setPolicyLocked(kRadiationSlot, policy);
+        wakeLocked();
+    }
+
+    std::chrono::milliseconds currentSamplingInterval(ComponentType component) const override {
+        return std::chrono::milliseconds(
+            schedule_[static_cast<size_t>(component)].interval_ms.load(std::memory_order_relaxed));
+    }
+
+    void requestImmediateCheck(ComponentType component) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        const auto now = scheduleNow();
+        scheduleLocked(kRadiationSlot, now);
+        scheduleLocked(static_cast<size_t>(component), now);
+        wakeLocked();
+    }
+
+    ComponentHealth getComponentHealth(const std::string& component_id) const override {
+        if (const ComponentEntry* entry = findComponent(component_id)) {
+            return makeHealthReport(*entry, entry->health.load());
+        }
+
         // Create default component health for unknown components
         ComponentHealth health;
         health.component_id = component_id;
         health.status = HealthStatus::UNKNOWN;
         health.health_percentage = 0.0f;
-        health.last_updated = std::chrono::system_clock::now();
+        health.last_updated = sensors_->now();
         return health;
     }
 
     std::vector<ComponentHealth> getAllComponentHealth() const override {
-        std::lock_guard<std::mutex> lock(mutex_);
+        const size_t count = component_count_.load(std::memory_order_acquire);
         std::vector<ComponentHealth> result;
-        result.reserve(component_health_.size());
-        
-        for (const auto& pair : component_health_) {
-            result.push_back(pair.second);
+        result.reserve(count);
+
+        for (size_t i = 0; i < count; ++i) {
+            result.push_back(makeHealthReport(*components_[i], components_[i]->health.load()));
         }
         return result;
     }
 
-    int registerStatusCallback(HealthStatusCallback callback, 
+    int registerStatusCallback(HealthStatusCallback callback,
                              ComponentType component_type) override {
-        std::lock_guard<std::mutex> lock(mutex_);
-        int id = next_callback_id_++;
-        callbacks_.push_back({id, callback, component_type});
-        return id;
+        return status_topic_.subscribe(std::move(callback), component_type);
     }
 
     void unregisterStatusCallback(int callback_id) override {
-        std::lock_guard<std::mutex> lock(mutex_);
-        auto it = std::find_if(callbacks_.begin(), callbacks_.end(),
-            [callback_id](const CallbackEntry& entry) {
-                return entry.id == callback_id;
-            });
-        
-        if (it != callbacks_.end()) {
-            callbacks_.erase(it);
-        }
+        status_topic_.unsubscribe(callback_id);
     }
 
     void configureAlert(const HealthAlertConfig& config) override {
@@ -151,196 +404,609 @@ public:
     }
 
     RadiationData getRadiationData() const override {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return current_radiation_;
+        return radiation_.load();
     }
 
     TemperatureData getTemperature(ComponentType component,
                                   const std::string& sensor_id) const override {
-        std::lock_guard<std::mutex> lock(mutex_);
-        auto key = sensor_id.empty() ? 
-            std::to_string(static_cast<int>(component)) : sensor_id;
-        
-        auto it = temperature_data_.find(key);
-        if (it != temperature_data_.end()) {
-            return it->second;
-        }
-        
-        // Return empty data if not found
         TemperatureData data;
         data.component = component;
         data.sensor_id = sensor_id;
+
+        TelemetrySample sample;
+        const TemperatureSensor* sensor = findTemperatureSensor(component, sensor_id);
+        if (sensor && sensor->samples.latest(sample)) {
+            data.sensor_id = sensor->sensor_id;
+            data.temperature_celsius = sample.value;
+            data.timestamp = sample.timestamp;
+            return data;
+        }
+
+        // Return empty data if not found
         data.temperature_celsius = 0.0f;
-        data.timestamp = std::chrono::system_clock::now();
+        data.timestamp = sensors_->now();
         return data;
     }
 
+    TelemetryWindowStats getDoseRateStats(std::chrono::milliseconds window) const override {
+        return dose_rate_samples_.window(window);
+    }
+
+    TelemetryWindowStats getTemperatureStats(ComponentType component,
+                                             std::chrono::milliseconds window,
+                                             const std::string& sensor_id) const override {
+        const TemperatureSensor* sensor = findTemperatureSensor(component, sensor_id);
+        return sensor ? sensor->samples.window(window) : TelemetryWindowStats{};
+    }
+
     bool initiateRecovery(const std::string& component_id) override {
         std::lock_guard<std::mutex> lock(mutex_);
-        auto it = component_health_.find(component_id);
-        if (it == component_health_.end()) {
+        ComponentEntry* entry = findComponent(component_id);
+        if (!entry) {
             return false;
         }
-
-        // Log recovery attempt
-        log_info("Initiating recovery for component: " + component_id);
-        
-        // Implement recovery logic here
-        // For now, just mark as degraded and requiring attention
-        it->second.status = HealthStatus::DEGRADED;
-        it->second.diagnostic_info = "Recovery procedure initiated";
-        it->second.last_updated = std::chrono::system_clock::now();
-        
-        notifyStatusChange(it->second);
+        initiateRecoveryLocked(*entry);
         return true;
     }
 
+    HealthSnapshot getHealthSnapshot() const override {
+        HealthSnapshot snapshot;
+        snapshot.timestamp = sensors_->now();
+        snapshot.radiation = radiation_.load();
+        snapshot.components = getAllComponentHealth();
+
+        const size_t count = temperature_sensor_count_.load(std::memory_order_acquire);
+        snapshot.temperatures.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            const TemperatureSensor& sensor = *temperature_sensors_[i];
+            TemperatureData data;
+            data.component = sensor.component;
+            data.sensor_id = sensor.sensor_id;
+            TelemetrySample sample{};
+            sensor.samples.latest(sample);   // Never empty, see registerTemperatureSensor()
+            data.temperature_celsius = sample.value;
+            data.timestamp = sample.timestamp;
+            snapshot.temperatures.push_back(std::move(data));
+        }
+        return snapshot;
+    }
+
+    size_t encodeHealthReport(uint8_t* buffer, size_t capacity, bool full_report) override {
+        const HealthSnapshot snapshot = getHealthSnapshot();
+        std::lock_guard<std::mutex> lock(report_mutex_);
+        return report_encoder_.encode(snapshot, buffer, capacity, full_report);
+    }
+
+    bool acknowledgeHealthReport(uint16_t sequence) override {
+        std::lock_guard<std::mutex> lock(report_mutex_);
+        return report_encoder_.acknowledge(sequence);
+    }
+
     bool reportToGround(bool full_report) override {
+        std::array<uint8_t, HealthReportEncoder::kMaxFrameBytes> frame;
+        const size_t size = encodeHealthReport(frame.data(), frame.size(), full_report);
+        uint16_t sequence = 0;
+        bool delta = false;
+        if (size == 0 || !HealthReportDecoder::readHeader(frame.data(), size, sequence, delta)) {
+            SKYMESH_LOG_ERROR(kLogComponent, "Failed to encode health report");
+            return false;
+        }
+
+        // In a real implementation, this would hand the frame to the RF link
+        SKYMESH_LOG_INFO(kLogComponent, "Sending ", delta ? "delta" : "full",
+                         " health report to ground: sequence ", sequence, ", ", size, " bytes");
+        return true;
+    }
+
+    bool saveCheckpoint(CheckpointStore& store) override {
+        size_t capacity = 0;
+        uint8_t* out = store.stage(CheckpointSection::HEALTH, capacity);
+
+        // Holding mutex_ keeps every ring's writer out while it is copied
+        std::lock_guard<std::mutex> lock(mutex_);
+        const size_t component_count = component_count_.load(std::memory_order_relaxed);
+        const size_t ring_count = 1 + temperature_sensor_count_.load(std::memory_order_relaxed);
+        const size_t size = sizeof(HealthCheckpointHeader) + component_count * sizeof(ComponentCheckpointRecord) +
+                            ring_count * sizeof(RingCheckpointRecord);
+        if (size > capacity) {
+            SKYMESH_LOG_ERROR(kLogComponent, "Cannot checkpoint health: ", size, " bytes exceed the ",
+                              capacity, " byte section");
+            return false;
+        }
+
+        HealthCheckpointHeader header{};
+        header.schema = kHealthCheckpointSchema;
+        header.ring_samples = static_cast<uint32_t>(kCheckpointRingSamples);
+        header.component_count = static_cast<uint32_t>(component_count);
+        header.ring_count = static_cast<uint32_t>(ring_count);
+        header.total_dose = radiation_state_.total_dose;
+        header.dose_rate = radiation_state_.dose_rate;
+        header.single_event_upsets = radiation_state_.single_event_upsets;
+        std::memcpy(out, &header, sizeof(header));
+
+        auto* components = reinterpret_cast<ComponentCheckpointRecord*>(out + sizeof(header));
+        for (size_t i = 0; i < component_count; ++i) {
+            const ComponentEntry& entry = *components_[i];
+            const HealthState state = entry.health.load();
+            ComponentCheckpointRecord& record = components[i];
+            std::memset(&record, 0, sizeof(record));
+            if (!putCheckpointId(record.component_id, entry.component_id)) {
+                SKYMESH_LOG_WARNING(kLogComponent, "Component ID too long to checkpoint: ", entry.component_id);
+            }
+            record.status = static_cast<uint8_t>(state.status);
+            record.health_percentage = state.health_percentage;
+            record.last_updated_ns = toCheckpointTime(state.last_updated);
+        }
+
+        auto* rings = reinterpret_cast<RingCheckpointRecord*>(components + component_count);
+        std::array<TelemetrySample, kCheckpointRingSamples> samples;
+        for (size_t r = 0; r < ring_count; ++r) {
+            const TelemetryBuffer& ring = r == 0 ? dose_rate_samples_ : temperature_sensors_[r - 1]->samples;
+            RingCheckpointRecord& record = rings[r];
+            std::memset(&record, 0, sizeof(record));
+            if (r > 0 && !putCheckpointId(record.sensor_id, temperature_sensors_[r - 1]->sensor_id)) {
+                SKYMESH_LOG_WARNING(kLogComponent, "Sensor ID too long to checkpoint: ",
+                                    temperature_sensors_[r - 1]->sensor_id);
+                continue;
+            }
+            const size_t count = ring.copyRecent(samples.data());
+            record.sample_count = static_cast<uint32_t>(count);
+            for (size_t i = 0; i < count; ++i) {
+                record.samples[i].timestamp_ns = toCheckpointTime(samples[i].timestamp);
+                record.samples[i].value = samples[i].value;
+            }
+        }
+
+        return store.commit(CheckpointSection::HEALTH, size);
+    }
+
+    bool restoreCheckpoint(const CheckpointStore& store) override {
+        CheckpointView view;
+        const CheckpointReadStatus status = store.read(CheckpointSection::HEALTH, view);
+        if (status == CheckpointReadStatus::EMPTY) {
+            return false;
+        }
+        if (status == CheckpointReadStatus::CORRUPT) {
+            SKYMESH_LOG_ERROR(kLogComponent, "Health checkpoint is corrupt; starting from defaults");
+            return false;
+        }
+
+        const auto& header = *reinterpret_cast<const HealthCheckpointHeader*>(view.data);
+        if (view.size < sizeof(HealthCheckpointHeader) || header.schema != kHealthCheckpointSchema ||
+            header.ring_samples != kCheckpointRingSamples || header.component_count > kMaxComponents ||
+            header.ring_count == 0 || header.ring_count > kMaxTemperatureSensors + 1 ||
+            view.size != sizeof(HealthCheckpointHeader) +
+                         header.component_count * sizeof(ComponentCheckpointRecord) +
+                         header.ring_count * sizeof(RingCheckpointRecord) ||
+            !std::isfinite(header.total_dose) || !std::isfinite(header.dose_rate)) {
+            SKYMESH_LOG_ERROR(kLogComponent, "Health checkpoint has an unknown layout; starting from defaults");
+            return false;
+        }
+
         std::lock_guard<std::mutex> lock(mutex_);
-        
-        // Prepare report
-        std::stringstream report;
-        report << "Health Status Report - " 
-               << (full_report ? "Full" : "Summary") << "\n";
-        
-        // Add radiation data
-        report << "Radiation - Total Dose: " << current_radiation_.total_dose
-               << " rads, Rate: " << current_radiation_.dose_rate << " rads/hour\n";
-        
-        // Add component health
-        for (const auto& pair : component_health_) {
-            const auto& health = pair.second;
-            report << "Component " << health.component_id 
-                   << " - Status: " << static_cast<int>(health.status)
-                   << ", Health: " << health.health_percentage << "%\n";
-            
-            if (full_report && !health.diagnostic_info.empty()) {
-                report << "  Info: " << health.diagnostic_info << "\n";
+        if (running_) {
+            SKYMESH_LOG_ERROR(kLogComponent, "Cannot restore health checkpoint while monitoring");
+            return false;
+        }
+
+        radiation_state_.total_dose = std::max(0.0f, header.total_dose);
+        radiation_state_.dose_rate = std::max(0.0f, header.dose_rate);
+        radiation_state_.single_event_upsets = std::max(0, header.single_event_upsets);
+        radiation_state_.timestamp = sensors_->now();
+        radiation_.store(radiation_state_);
+
+        const auto* components = reinterpret_cast<const ComponentCheckpointRecord*>(
+            view.data + sizeof(HealthCheckpointHeader));
+        size_t restored = 0;
+        for (uint32_t i = 0; i < header.component_count; ++i) {
+            const ComponentCheckpointRecord& record = components[i];
+            ComponentEntry* entry = findComponent(checkpointId(record.component_id));
+            if (!entry || record.status > static_cast<uint8_t>(HealthStatus::UNKNOWN) ||
+                !(record.health_percentage >= 0.0f && record.health_percentage <= 100.0f)) {
+                continue;
+            }
+            entry->health.store(HealthState{static_cast<HealthStatus>(record.status), record.health_percentage,
+                                            kRestoredDiagnostic, fromCheckpointTime(record.last_updated_ns)});
+            restored++;
+        }
+
+        // Rings are refilled by replaying their samples, which rebuilds the block summaries
+        const auto* rings = reinterpret_cast<const RingCheckpointRecord*>(components + header.component_count);
+        for (uint32_t r = 0; r < header.ring_count; ++r) {
+            const RingCheckpointRecord& record = rings[r];
+            TelemetryBuffer* ring = nullptr;
+            if (r == 0) {
+                ring = &dose_rate_samples_;
+            } else {
+                const std::string sensor_id = checkpointId(record.sensor_id);
+                const size_t count = temperature_sensor_count_.load(std::memory_order_relaxed);
+                for (size_t i = 0; i < count && !sensor_id.empty(); ++i) {
+                    if (temperature_sensors_[i]->sensor_id == sensor_id) {
+                        ring = &temperature_sensors_[i]->samples;
+                    }
+                }
+            }
+
+            // Skip rings that could not be kept in time order
+            bool ordered = record.sample_count > 0 && record.sample_count <= kCheckpointRingSamples;
+            for (uint32_t i = 1; ordered && i < record.sample_count; ++i) {
+                ordered = record.samples[i].timestamp_ns >= record.samples[i - 1].timestamp_ns;
+            }
+            if (!ring || !ordered) {
+                continue;
+            }
+            ring->reset();
+            for (uint32_t i = 0; i < record.sample_count; ++i) {
+                ring->push(fromCheckpointTime(record.samples[i].timestamp_ns), record.samples[i].value);
             }
         }
-        
-        // In a real implementation, this would send the report to ground
-        log_info("Sending health report to ground:\n" + report.str());
+
+        SKYMESH_LOG_INFO(kLogComponent, "Restored health of ", restored, " components from checkpoint generation ",
+                         view.generation);
         return true;
     }
 
 private:
     void monitoringLoop() {
-        log_info("Health monitoring loop started");
-        
+        SKYMESH_LOG_INFO(kLogComponent, "Health monitoring loop started");
+
+        std::unique_lock<std::mutex> lock(mutex_);
         while (running_) {
-            {
-                std::lock_guard<std::mutex> lock(mutex_);
-                updateRadiationData();
-                updateTemperatureData();
-                checkComponentHealth();
+            // Sleep until the deadline itself, so the period does not
+            // stretch by the time spent sampling
+            const auto next = sampleDueLocked(std::chrono::steady_clock::now());
+            if (!next) {
+                wake_.wait(lock);
+            } else {
+                wake_.wait_until(lock, *next);
             }
-            
-            std::this_thread::sleep_for(
-                std::chrono::milliseconds(polling_interval_ms_));
-        }
-        
-        log_info("Health monitoring loop stopped");
-    }
-
-    void updateRadiationData() {
-        // Simulate radiation monitoring
-        // In a real implementation, this would read from radiation sensors
-        current_radiation_.timestamp = std::chrono::system_clock::now();
-        // Add some random variation to simulate real measurements
-        current_radiation_.dose_rate += 
-            (static_cast<float>(rand()) / RAND_MAX - 0.5f) * 0.1f;
-        current_radiation_.total_dose += 
-            current_radiation_.dose_rate * 
-            (polling_interval_ms_ / 3600000.0f);  // Convert to hours
-    }
-
-    void updateTemperatureData() {
-        // Simulate temperature monitoring
-        // In a real implementation, this would read from temperature sensors
-        for (auto& pair : temperature_data_) {
-            pair.second.timestamp = std::chrono::system_clock::now();
-            // Add some random variation
-            pair.second.temperature_celsius += 
-                (static_cast<float>(rand()) / RAND_MAX - 0.5f) * 0.5f;
-        }
-    }
-
-    void checkComponentHealth() {
-        for (auto& pair : component_health_) {
-            auto& health = pair.second;
-            
-            // Check temperature thresholds
-            auto temp_data = getTemperature(health.type, "");
-            if (temp_data.temperature_celsius > 80.0f) {
-                health.status = HealthStatus::CRITICAL;
-                health.diagnostic_info = "Temperature critically high";
-                notifyStatusChange(health);
+        }
+
+        SKYMESH_LOG_INFO(kLogComponent, "Health monitoring loop stopped");
+    }
+
+    // One executor wake-up: sample what is due, then sleep until the next deadline
+    void samplingPass() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        sampling_timer_ = 0;
+        if (running_) {
+            sampleDueLocked(scheduleNow());
+            armSamplingLocked();
+        }
+    }
+
+    // Sample every source due by now; returns the next deadline, if any
+    std::optional<std::chrono::steady_clock::time_point> sampleDueLocked(std::chrono::steady_clock::time_point now) {
+        while (!due_heap_.empty()) {
+            const DueEntry next = due_heap_.front();
+            if (next.generation != schedule_[next.slot].generation) {
+                popDueLocked();
+                continue;
             }
-            else if (temp_data.temperature_celsius > 60.0f) {
-                health.status = HealthStatus::WARNING;
-                health.diagnostic_info = "Temperature elevated";
-                notifyStatusChange(health);
+            if (next.due > now) {
+                return next.due;
             }
-            
+            popDueLocked();
+            sampleSlotLocked(next.slot, now);
+        }
+        return std::nullopt;
+    }
+
+    // Post a sampling pass for the earliest deadline, unless one is due
+    // sooner. A superseded entry at the front only costs an early pass.
+    void armSamplingLocked() {
+        if (!running_ || due_heap_.empty()) {
+            return;
+        }
+        const auto due = due_heap_.front().due;
+        if (sampling_timer_ != 0) {
+            if (sampling_due_ <= due) {
+                return;
+            }
+            executor_->cancel(sampling_timer_);
+        }
+        sampling_due_ = due;
+        sampling_timer_ = executor_->scheduleAt(
+            std::chrono::system_clock::time_point(
+                std::chrono::duration_cast<std::chrono::system_clock::duration>(due.time_since_epoch())),
+            [this] { samplingPass(); });
+    }
+
+    // Tell whoever samples that the schedule changed
+    void wakeLocked() {
+        if (executor_) {
+            armSamplingLocked();
+        } else {
+            wake_.notify_one();
+        }
+    }
+
+    // Schedule time: the steady clock, or on an executor its clock, held in
+    // steady_clock time points so both share the same schedule code
+    std::chrono::steady_clock::time_point scheduleNow() const {
+        if (!executor_) {
+            return std::chrono::steady_clock::now();
+        }
+        return std::chrono::steady_clock::time_point(
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(executor_->now().time_since_epoch()));
+    }
+
+    void sampleSlotLocked(size_t index, std::chrono::steady_clock::time_point steady_now) {
+        ScheduleSlot& slot = schedule_[index];
+        const auto now = sensors_->now();
+
+        bool excursion = radiation_state_.dose_rate > kHighDoseRate;
+        if (index == kRadiationSlot) {
+            updateRadiationData(now);
+            excursion = radiation_state_.dose_rate > kHighDoseRate;
+        } else {
+            const auto type = static_cast<ComponentType>(index);
+            excursion = updateTemperatureData(type, now) || excursion;
+            checkComponentHealth(type, now);
+        }
+        slot.last_sample = steady_now;
+
+        std::chrono::milliseconds interval = slot.policy.nominal_interval;
+        if (excursion) {
+            slot.nominal_samples = 0;
+            interval = slot.policy.fast_interval;
+        } else {
+            if (slot.nominal_samples < slot.policy.quiet_after_samples) {
+                ++slot.nominal_samples;
+            }
+            if (slot.nominal_samples >= slot.policy.quiet_after_samples) {
+                interval = slot.policy.quiet_interval;
+            }
+        }
+        slot.interval_ms.store(interval.count(), std::memory_order_relaxed);
+
+        // Next deadline follows the previous one; after an overrun,
+        // restart from now rather than sampling a burst to catch up
+        auto due = slot.due + interval;
+        if (due <= steady_now) {
+            due = steady_now + interval;
+        }
+        scheduleLocked(index, due);
+    }
+
+    void scheduleLocked(size_t index, std::chrono::steady_clock::time_point due) {
+        ScheduleSlot& slot = schedule_[index];
+        slot.due = due;
+        slot.scheduled = true;
+        due_heap_.push_back({due, index, ++slot.generation});
+        std::push_heap(due_heap_.begin(), due_heap_.end(), std::greater<DueEntry>());
+    }
+
+    void popDueLocked() {
+        std::pop_heap(due_heap_.begin(), due_heap_.end(), std::greater<DueEntry>());
+        due_heap_.pop_back();
+    }
+
+    // Start sampling a component type once it has something to sample
+    void scheduleNewSourceLocked(ComponentType type) {
+        const size_t index = static_cast<size_t>(type);
+        if (running_ && !schedule_[index].scheduled) {
+            scheduleLocked(index, scheduleNow());
+            wakeLocked();
+        }
+    }
+
+    void setPolicyLocked(size_t index, SamplingPolicy policy) {
+        const std::chrono::milliseconds minimum(1);
+        policy.nominal_interval = std::max(policy.nominal_interval, minimum);
+        policy.fast_interval = std::max(policy.fast_interval, minimum);
+        policy.quiet_interval = std::max(policy.quiet_interval, minimum);
+
+        ScheduleSlot& slot = schedule_[index];
+        slot.policy = policy;
+        slot.nominal_samples = 0;
+        slot.interval_ms.store(policy.nominal_interval.count(), std::memory_order_relaxed);
+
+        // Pull a pending deadline in if the new rate wants it sooner
+        if (slot.scheduled) {
+            const auto due = scheduleNow() + policy.nominal_interval;
+            if (due < slot.due) {
+                scheduleLocked(index, due);
+            }
+        }
+    }
+
+    bool hasSources(ComponentType type) const {
+        const size_t components = component_count_.load(std::memory_order_acquire);
+        for (size_t i = 0; i < components; ++i) {
+            if (components_[i]->type == type) {
+                return true;
+            }
+        }
+        return findTemperatureSensor(type, "") != nullptr;
+    }
+
+    ComponentEntry* findComponent(const std::string& component_id) const {
+        const size_t count = component_count_.load(std::memory_order_acquire);
+        for (size_t i = 0; i < count; ++i) {
+            if (components_[i]->component_id == component_id) {
+                return components_[i].get();
+            }
+        }
+        return nullptr;
+    }
+
+    // A named sensor, or the first sensor on the component if no name is given
+    const TemperatureSensor* findTemperatureSensor(ComponentType component,
+                                                   const std::string& sensor_id) const {
+        const size_t count = temperature_sensor_count_.load(std::memory_order_acquire);
+        for (size_t i = 0; i < count; ++i) {
+            const TemperatureSensor& sensor = *temperature_sensors_[i];
+            if (sensor_id.empty() ? sensor.component == component : sensor.sensor_id == sensor_id) {
+                return &sensor;
+            }
+        }
+        return nullptr;
+    }
+
+    static ComponentHealth makeHealthReport(const ComponentEntry& entry, const HealthState& state) {
+        ComponentHealth health;
+        health.type = entry.type;
+        health.component_id = entry.component_id;
+        health.status = state.status;
+        health.health_percentage = state.health_percentage;
+        health.diagnostic_info = state.diagnostic ? state.diagnostic : "";
+        health.last_updated = state.last_updated;
+        return health;
+    }
+
+    void updateRadiationData(std::chrono::system_clock::time_point now) {
+        // Integrate over sensor time, which may run faster than real time
+        const auto elapsed = std::max(now - radiation_state_.timestamp, std::chrono::system_clock::duration::zero());
+        radiation_state_.timestamp = now;
+        float dose_rate = 0.0f;
+        if (sensors_->readDoseRate(now, dose_rate)) {
+            radiation_state_.dose_rate = std::max(0.0f, dose_rate);
+        }
+        radiation_state_.total_dose +=
+            radiation_state_.dose_rate *
+            std::chrono::duration<float, std::ratio<3600>>(elapsed).count();  // Convert to hours
+
+        dose_rate_samples_.push(now, radiation_state_.dose_rate);
+        radiation_.store(radiation_state_);
+    }
+
+    // Sample the temperature sensors of a component type; true on a thermal excursion
+    bool updateTemperatureData(ComponentType type, std::chrono::system_clock::time_point now) {
+        bool excursion = false;
+        const size_t count = temperature_sensor_count_.load(std::memory_order_acquire);
+        for (size_t i = 0; i < count; ++i) {
+            TemperatureSensor& sensor = *temperature_sensors_[i];
+            if (sensor.component != type) {
+                continue;
+            }
+            float celsius = 0.0f;
+            if (!sensors_->readTemperature({sensor.sensor_id, sensor.component, sensor.nominal_celsius},
+                                           now, celsius)) {
+                continue;
+            }
+            sensor.samples.push(now, celsius);
+
+            // The rate only counts once the window is long enough to
+            // average out sample noise
+            const TelemetryWindowStats trend = sensor.samples.window(kTrendWindow);
+            const bool settled_trend = trend.newest - trend.oldest >= kTrendWindow / 2;
+            excursion = excursion || trend.latest > kWarningTemperature ||
+                        (settled_trend && std::abs(trend.rate_per_second) > kThermalRateLimit);
+        }
+        return excursion;
+    }
+
+    void checkComponentHealth(ComponentType type, std::chrono::system_clock::time_point now) {
+        const TelemetryWindowStats dose_rate = dose_rate_samples_.window(kTrendWindow);
+        const size_t count = component_count_.load(std::memory_order_acquire);
+
+        for (size_t i = 0; i < count; ++i) {
+            ComponentEntry& entry = *components_[i];
+            if (entry.type != type) {
+                continue;
+            }
+            HealthState state = entry.health.load();
+
+            // Check temperature thresholds against the latest reading
+            TelemetryWindowStats temperature;
+            if (const TemperatureSensor* sensor = findTemperatureSensor(entry.type, "")) {
+                temperature = sensor->samples.window(kTrendWindow);
+            }
+            if (temperature.count > 0 && temperature.latest > kCriticalTemperature) {
+                setStatus(entry, state, HealthStatus::CRITICAL, "Temperature critically high", now);
+            }
+            else if (temperature.count > 0 && temperature.latest > kWarningTemperature) {
+                setStatus(entry, state, HealthStatus::WARNING, "Temperature elevated", now);
+            }
+
             // Check radiation effects
-            if (current_radiation_.dose_rate > 1000.0f) {
-                health.status = HealthStatus::WARNING;
-                health.diagnostic_info = "High radiation exposure";
-                notifyStatusChange(health);
+            if (dose_rate.mean > 1000.0f) {
+                setStatus(entry, state, HealthStatus::WARNING, "High radiation exposure", now);
             }
-            
+
             // Update health percentage based on various factors
-            updateHealthPercentage(health);
+            updateHealthPercentage(entry, state, temperature, dose_rate, now);
+            entry.health.store(state);
         }
     }
 
-    void updateHealthPercentage(ComponentHealth& health) {
-        // Calculate health percentage based on multiple factors
+    // Publish a status change and notify; state is reloaded afterwards in
+    // case an alert triggered recovery
+    void setStatus(ComponentEntry& entry, HealthState& state, HealthStatus status,
+                   const char* diagnostic, std::chrono::system_clock::time_point now) {
+        state.status = status;
+        state.diagnostic = diagnostic;
+        state.last_updated = now;
+        entry.health.store(state);
+        notifyStatusChange(entry, state, true);
+        state = entry.health.load();
+    }
+
+    void updateHealthPercentage(const ComponentEntry& entry, HealthState& state,
+                                const TelemetryWindowStats& temperature,
+                                const TelemetryWindowStats& dose_rate,
+                                std::chrono::system_clock::time_point now) {
+        // Calculate health percentage based on multiple factors, using the
+        // windowed trends so a single noisy sample does not move it
         float temp_factor = 1.0f;
         float radiation_factor = 1.0f;
         float time_factor = 1.0f;
-        
+
         // Temperature impact
-        auto temp_data = getTemperature(health.type, "");
-        if (temp_data.temperature_celsius > 60.0f) {
-            temp_factor = 1.0f - ((temp_data.temperature_celsius - 60.0f) / 40.0f);
+        if (temperature.count > 0 && temperature.mean > kWarningTemperature) {
+            temp_factor = 1.0f - ((temperature.mean - kWarningTemperature) / 40.0f);
         }
-        
+
         // Radiation impact
-        if (current_radiation_.dose_rate > 100.0f) {
-            radiation_factor = 1.0f - (current_radiation_.dose_rate / 2000.0f);
+        if (dose_rate.mean > kHighDoseRate) {
+            radiation_factor = 1.0f - (dose_rate.mean / 2000.0f);
         }
-        
+
         // Time-based degradation
-        auto age = std::chrono::duration_cast<std::chrono::hours>(
-            std::chrono::system_clock::now() - health.last_updated).count();
+        auto age = std::chrono::duration_cast<std::chrono::hours>(now - entry.in_service).count();
         time_factor = 1.0f - (age / 8760.0f);  // Approximate 1-year degradation
-        
+
         // Calculate overall health percentage
-        health.health_percentage = 100.0f * 
+        state.health_percentage = 100.0f *
             std::min({temp_factor, radiation_factor, time_factor});
-        health.health_percentage = std::max(0.0f, 
-            std::min(100.0f, health.health_percentage));
+        state.health_percentage = std::max(0.0f,
+            std::min(100.0f, state.health_percentage));
     }
 
-    void notifyStatusChange(const ComponentHealth& health) {
-        // Notify all registered callbacks that match the component type
-        for (const auto& entry : callbacks_) {
-            if (entry.filter_type == health.type) {
-                try {
-                    entry.callback(health);
-                }
-                catch (const std::exception& e) {
-                    log_error("Exception in health status callback: " + 
-                             std::string(e.what()));
-                }
-                catch (...) {
-                    log_error("Unknown exception in health status callback");
-                }
-            }
+    void initiateRecoveryLocked(ComponentEntry& entry) {
+        // Log recovery attempt
+        SKYMESH_LOG_INFO(kLogComponent, "Initiating recovery for component: ", entry.component_id);
+
+        // Implement recovery logic here
+        // For now, just mark as degraded and requiring attention
+        HealthState state = entry.health.load();
+        state.status = HealthStatus::DEGRADED;
+        state.diagnostic = "Recovery procedure initiated";
+        state.last_updated = sensors_->now();
+        entry.health.store(state);
+
+        // A recovery-triggered change never starts another recovery
+        notifyStatusChange(entry, state, false);
+    }
+
+    void notifyStatusChange(ComponentEntry& entry, const HealthState& state, bool allow_recovery) {
+        // A component that stays in the same state is reported once
+        if (entry.notified && entry.notified_status == state.status &&
+            entry.notified_diagnostic == state.diagnostic) {
+            return;
+        }
+        entry.notified = true;
+        entry.notified_status = state.status;
+        entry.notified_diagnostic = state.diagnostic;
+
+        // Callbacks run on the bus thread, outside mutex_
+        const ComponentHealth health = makeHealthReport(entry, state);
+        if (!status_topic_.publish(health, health.type)) {
+            SKYMESH_LOG_WARNING(kLogComponent, "Status notification queue full, dropped change for ",
+                                health.component_id);
         }
-        
+
         // Check alert configurations
         auto it = alert_configs_.find(health.type);
         if (it != alert_configs_.end()) {
@@ -349,8 +1015,8 @@ private:
                     if (config.notify_ground) {
                         reportToGround(true);
                     }
-                    if (config.auto_recovery) {
-                        initiateRecovery(health.component_id);
+                    if (config.auto_recovery && allow_recovery) {
+                        initiateRecoveryLocked(entry);
                     }
                 }
             }
@@ -359,24 +1025,27 @@ private:
 };
 
 // Factory function implementation
-std::unique_ptr<HealthMonitor> createHealthMonitor(const std::string& config_path) {
-    auto monitor = std::make_unique<HealthMonitorImpl>();
-    
+std::unique_ptr<HealthMonitor> createHealthMonitor(const std::string& config_path,
+                                                   std::shared_ptr<NotificationBus> notification_bus,
+                                                   std::shared_ptr<SensorBackend> sensors,
+                                                   std::shared_ptr<Executor> executor) {
+    auto monitor = std::make_unique<HealthMonitorImpl>(std::move(notification_bus), std::move(sensors),
+                                                       std::move(executor));
+
     // Initialize with default polling interval
     if (!monitor->initialize(1000)) {
         return nullptr;
     }
-    
+
     // Load configuration if path provided
     if (!config_path.empty()) {
         // TODO: Load configuration from file
         // For now, just log that we received a config path
-        log_info("Health monitor created with config path: " + config_path);
+        SKYMESH_LOG_INFO(kLogComponent, "Health monitor created with config path: ", config_path);
     }
-    
+
     return monitor;
 }
 
 } // namespace core
 } // namespace skymesh
-
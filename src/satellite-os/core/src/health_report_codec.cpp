@@ -0,0 +1,506 @@
+/**
+ * @file health_report_codec.cpp
+ * @brief Implementation of the binary health report encoder and decoder
+ */
+
+#include "skymesh/core/health_report_codec.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace skymesh {
+namespace core {
+
+namespace {
+    constexpr uint8_t kVersion = 1;
+    constexpr uint8_t kDeltaFlag = 0x01;
+
+    // Delta report sections
+    constexpr uint8_t kRadiationSection = 0x01;
+    constexpr uint8_t kComponentSection = 0x02;
+    constexpr uint8_t kTemperatureSection = 0x04;
+
+    constexpr unsigned kStatusBits = 3;
+
+    template <typename T>
+    T quantizeValue(double value, double scale) {
+        const double scaled = std::round(value * scale);
+        const double lo = static_cast<double>(std::numeric_limits<T>::min());
+        const double hi = static_cast<double>(std::numeric_limits<T>::max());
+        if (!(scaled >= lo)) {   // Also catches NaN
+            return std::numeric_limits<T>::min();
+        }
+        return scaled >= hi ? std::numeric_limits<T>::max() : static_cast<T>(scaled);
+    }
+
+    size_t packedBytes(size_t count) {
+        return (count * kStatusBits + 7) / 8;
+    }
+
+    size_t fullReportSize(size_t components, size_t sensors) {
+        return 7 + 8 + 1 + packedBytes(components) + components + 1 + 2 * sensors;
+    }
+
+    uint64_t zigzag(int64_t value) {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    int64_t unzigzag(uint64_t value) {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    // Bounds-checked little-endian writer; sticks at failure
+    class FrameWriter {
+    public:
+        FrameWriter(uint8_t* buffer, size_t capacity) : buffer_(buffer), capacity_(capacity) {}
+
+        void put8(uint8_t value) {
+            if (reserve(1)) {
+                buffer_[size_++] = value;
+            }
+        }
+
+        void put16(uint16_t value) {
+            put8(static_cast<uint8_t>(value));
+            put8(static_cast<uint8_t>(value >> 8));
+        }
+
+        void put32(uint32_t value) {
+            put16(static_cast<uint16_t>(value));
+            put16(static_cast<uint16_t>(value >> 16));
+        }
+
+        void putVarint(uint64_t value) {
+            while (value >= 0x80) {
+                put8(static_cast<uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            put8(static_cast<uint8_t>(value));
+        }
+
+        // Zeroed region for bit-level packing
+        uint8_t* putZeroed(size_t bytes) {
+            if (!reserve(bytes)) {
+                return nullptr;
+            }
+            uint8_t* region = buffer_ + size_;
+            std::fill(region, region + bytes, uint8_t{0});
+            size_ += bytes;
+            return region;
+        }
+
+        bool ok() const { return ok_; }
+        size_t size() const { return size_; }
+
+    private:
+        bool reserve(size_t bytes) {
+            ok_ = ok_ && capacity_ - size_ >= bytes;
+            return ok_;
+        }
+
+        uint8_t* buffer_;
+        size_t capacity_;
+        size_t size_ = 0;
+        bool ok_ = true;
+    };
+
+    class FrameReader {
+    public:
+        FrameReader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+        uint8_t get8() {
+            if (!take(1)) {
+                return 0;
+            }
+            return data_[pos_++];
+        }
+
+        uint16_t get16() {
+            const uint16_t lo = get8();
+            return static_cast<uint16_t>(lo | (get8() << 8));
+        }
+
+        uint32_t get32() {
+            const uint32_t lo = get16();
+            return lo | (static_cast<uint32_t>(get16()) << 16);
+        }
+
+        uint64_t getVarint() {
+            uint64_t value = 0;
+            for (unsigned shift = 0; shift < 64; shift += 7) {
+                const uint8_t byte = get8();
+                value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+                if (!(byte & 0x80)) {
+                    return value;
+                }
+            }
+            ok_ = false;
+            return 0;
+        }
+
+        const uint8_t* getBytes(size_t bytes) {
+            if (!take(bytes)) {
+                return nullptr;
+            }
+            const uint8_t* region = data_ + pos_;
+            pos_ += bytes;
+            return region;
+        }
+
+        bool ok() const { return ok_; }
+        bool atEnd() const { return pos_ == size_; }
+
+    private:
+        bool take(size_t bytes) {
+            ok_ = ok_ && size_ - pos_ >= bytes;
+            return ok_;
+        }
+
+        const uint8_t* data_;
+        size_t size_;
+        size_t pos_ = 0;
+        bool ok_ = true;
+    };
+
+    void packStatus(uint8_t* region, size_t index, uint8_t status) {
+        const size_t bit = index * kStatusBits;
+        const unsigned value = (status & 0x7u) << (bit % 8);
+        region[bit / 8] |= static_cast<uint8_t>(value);
+        if (bit % 8 > 8 - kStatusBits) {
+            region[bit / 8 + 1] |= static_cast<uint8_t>(value >> 8);
+        }
+    }
+
+    uint8_t unpackStatus(const uint8_t* region, size_t index) {
+        const size_t bit = index * kStatusBits;
+        unsigned value = region[bit / 8] >> (bit % 8);
+        if (bit % 8 > 8 - kStatusBits) {
+            value |= static_cast<unsigned>(region[bit / 8 + 1]) << (8 - bit % 8);
+        }
+        return static_cast<uint8_t>(value & 0x7u);
+    }
+
+    bool testBit(const uint8_t* bitmap, size_t index) {
+        return (bitmap[index / 8] >> (index % 8)) & 1u;
+    }
+
+    void writeHeader(FrameWriter& writer, const QuantizedHealthReport& report, uint8_t flags) {
+        writer.put8(static_cast<uint8_t>(kVersion << 4 | flags));
+        writer.put16(report.sequence);
+        writer.put32(report.time_s);
+    }
+
+    void writeFull(FrameWriter& writer, const QuantizedHealthReport& report) {
+        writeHeader(writer, report, 0);
+        writer.put32(report.total_dose);
+        writer.put16(report.dose_rate);
+        writer.put16(report.upsets);
+
+        writer.put8(report.component_count);
+        if (uint8_t* statuses = writer.putZeroed(packedBytes(report.component_count))) {
+            for (size_t i = 0; i < report.component_count; ++i) {
+                packStatus(statuses, i, report.status[i]);
+            }
+        }
+        for (size_t i = 0; i < report.component_count; ++i) {
+            writer.put8(report.health[i]);
+        }
+
+        writer.put8(report.sensor_count);
+        for (size_t i = 0; i < report.sensor_count; ++i) {
+            writer.put16(static_cast<uint16_t>(report.temperature[i]));
+        }
+    }
+
+    void writeDelta(FrameWriter& writer, const QuantizedHealthReport& report,
+                    const QuantizedHealthReport& base) {
+        writeHeader(writer, report, kDeltaFlag);
+        writer.put16(base.sequence);
+
+        const size_t components = report.component_count;
+        const size_t sensors = report.sensor_count;
+        size_t changed_components = 0;
+        bool temperatures_changed = false;
+        for (size_t i = 0; i < components; ++i) {
+            if (report.status[i] != base.status[i] || report.health[i] != base.health[i]) {
+                ++changed_components;
+            }
+        }
+        for (size_t i = 0; i < sensors; ++i) {
+            temperatures_changed = temperatures_changed || report.temperature[i] != base.temperature[i];
+        }
+
+        uint8_t sections = 0;
+        if (report.total_dose != base.total_dose || report.dose_rate != base.dose_rate ||
+            report.upsets != base.upsets) {
+            sections |= kRadiationSection;
+        }
+        if (changed_components > 0) {
+            sections |= kComponentSection;
+        }
+        if (temperatures_changed) {
+            sections |= kTemperatureSection;
+        }
+        writer.put8(sections);
+
+        if (sections & kRadiationSection) {
+            writer.putVarint(zigzag(static_cast<int64_t>(report.total_dose) - base.total_dose));
+            writer.putVarint(zigzag(static_cast<int64_t>(report.dose_rate) - base.dose_rate));
+            writer.putVarint(zigzag(static_cast<int64_t>(report.upsets) - base.upsets));
+        }
+
+        if (sections & kComponentSection) {
+            uint8_t* bitmap = writer.putZeroed((components + 7) / 8);
+            uint8_t* statuses = writer.putZeroed(packedBytes(changed_components));
+            if (!bitmap || !statuses) {
+                return;
+            }
+            size_t changed = 0;
+            for (size_t i = 0; i < components; ++i) {
+                if (report.status[i] != base.status[i] || report.health[i] != base.health[i]) {
+                    bitmap[i / 8] |= static_cast<uint8_t>(1u << (i % 8));
+                    packStatus(statuses, changed++, report.status[i]);
+                }
+            }
+            for (size_t i = 0; i < components; ++i) {
+                if (testBit(bitmap, i)) {
+                    writer.putVarint(zigzag(static_cast<int64_t>(report.health[i]) - base.health[i]));
+                }
+            }
+        }
+
+        if (sections & kTemperatureSection) {
+            uint8_t* bitmap = writer.putZeroed((sensors + 7) / 8);
+            if (!bitmap) {
+                return;
+            }
+            for (size_t i = 0; i < sensors; ++i) {
+                if (report.temperature[i] != base.temperature[i]) {
+                    bitmap[i / 8] |= static_cast<uint8_t>(1u << (i % 8));
+                }
+            }
+            for (size_t i = 0; i < sensors; ++i) {
+                if (testBit(bitmap, i)) {
+                    writer.putVarint(zigzag(static_cast<int64_t>(report.temperature[i]) - base.temperature[i]));
+                }
+            }
+        }
+    }
+
+    bool readFull(FrameReader& reader, QuantizedHealthReport& report) {
+        report.total_dose = reader.get32();
+        report.dose_rate = reader.get16();
+        report.upsets = reader.get16();
+
+        report.component_count = reader.get8();
+        if (report.component_count > QuantizedHealthReport::kMaxComponents) {
+            return false;
+        }
+        const uint8_t* statuses = reader.getBytes(packedBytes(report.component_count));
+        if (!statuses) {
+            return false;
+        }
+        for (size_t i = 0; i < report.component_count; ++i) {
+            report.status[i] = unpackStatus(statuses, i);
+            report.health[i] = reader.get8();
+        }
+
+        report.sensor_count = reader.get8();
+        if (report.sensor_count > QuantizedHealthReport::kMaxSensors) {
+            return false;
+        }
+        for (size_t i = 0; i < report.sensor_count; ++i) {
+            report.temperature[i] = static_cast<int16_t>(reader.get16());
+        }
+        return reader.ok();
+    }
+
+    // Applies a delta on top of report, which holds the base on entry
+    bool readDelta(FrameReader& reader, QuantizedHealthReport& report) {
+        const uint8_t sections = reader.get8();
+
+        if (sections & kRadiationSection) {
+            report.total_dose = static_cast<uint32_t>(report.total_dose + unzigzag(reader.getVarint()));
+            report.dose_rate = static_cast<uint16_t>(report.dose_rate + unzigzag(reader.getVarint()));
+            report.upsets = static_cast<uint16_t>(report.upsets + unzigzag(reader.getVarint()));
+        }
+
+        if (sections & kComponentSection) {
+            const size_t components = report.component_count;
+            const uint8_t* bitmap = reader.getBytes((components + 7) / 8);
+            if (!bitmap) {
+                return false;
+            }
+            size_t changed_components = 0;
+            for (size_t i = 0; i < components; ++i) {
+                changed_components += testBit(bitmap, i);
+            }
+            const uint8_t* statuses = reader.getBytes(packedBytes(changed_components));
+            if (!statuses) {
+                return false;
+            }
+            size_t changed = 0;
+            for (size_t i = 0; i < components; ++i) {
+                if (testBit(bitmap, i)) {
+                    report.status[i] = unpackStatus(statuses, changed++);
+                    report.health[i] = static_cast<uint8_t>(report.health[i] + unzigzag(reader.getVarint()));
+                }
+            }
+        }
+
+        if (sections & kTemperatureSection) {
+            const size_t sensors = report.sensor_count;
+            const uint8_t* bitmap = reader.getBytes((sensors + 7) / 8);
+            if (!bitmap) {
+                return false;
+            }
+            for (size_t i = 0; i < sensors; ++i) {
+                if (testBit(bitmap, i)) {
+                    report.temperature[i] = static_cast<int16_t>(report.temperature[i] + unzigzag(reader.getVarint()));
+                }
+            }
+        }
+        return reader.ok();
+    }
+}
+
+bool HealthReportEncoder::quantize(const HealthSnapshot& snapshot, QuantizedHealthReport& out) {
+    if (snapshot.components.size() > QuantizedHealthReport::kMaxComponents ||
+        snapshot.temperatures.size() > QuantizedHealthReport::kMaxSensors) {
+        return false;
+    }
+
+    out.time_s = quantizeValue<uint32_t>(
+        std::chrono::duration<double>(snapshot.timestamp.time_since_epoch()).count(), 1.0);
+    out.total_dose = quantizeValue<uint32_t>(snapshot.radiation.total_dose, 100.0);
+    out.dose_rate = quantizeValue<uint16_t>(snapshot.radiation.dose_rate, 10.0);
+    out.upsets = quantizeValue<uint16_t>(snapshot.radiation.single_event_upsets, 1.0);
+
+    out.component_count = static_cast<uint8_t>(snapshot.components.size());
+    for (size_t i = 0; i < snapshot.components.size(); ++i) {
+        out.status[i] = static_cast<uint8_t>(snapshot.components[i].status);
+        out.health[i] = std::min<uint8_t>(
+            quantizeValue<uint8_t>(snapshot.components[i].health_percentage, 2.0), 200);
+    }
+
+    out.sensor_count = static_cast<uint8_t>(snapshot.temperatures.size());
+    for (size_t i = 0; i < snapshot.temperatures.size(); ++i) {
+        out.temperature[i] = quantizeValue<int16_t>(snapshot.temperatures[i].temperature_celsius, 100.0);
+    }
+    return true;
+}
+
+size_t HealthReportEncoder::encode(const HealthSnapshot& snapshot, uint8_t* buffer,
+                                   size_t capacity, bool full) {
+    if (!quantize(snapshot, current_)) {
+        return 0;
+    }
+    current_.sequence = next_sequence_;
+
+    // A delta is only worth sending if it beats the full report
+    const size_t full_size = fullReportSize(current_.component_count, current_.sensor_count);
+    size_t written = 0;
+    if (!full && has_base_ && base_.component_count == current_.component_count &&
+        base_.sensor_count == current_.sensor_count) {
+        FrameWriter writer(buffer, std::min(capacity, full_size - 1));
+        writeDelta(writer, current_, base_);
+        if (writer.ok()) {
+            written = writer.size();
+        }
+    }
+    if (written == 0) {
+        FrameWriter writer(buffer, capacity);
+        writeFull(writer, current_);
+        if (!writer.ok()) {
+            return 0;
+        }
+        written = writer.size();
+    }
+
+    history_[current_.sequence % kHistory] = current_;
+    history_count_ = std::min(history_count_ + 1, kHistory);
+    ++next_sequence_;
+    return written;
+}
+
+bool HealthReportEncoder::acknowledge(uint16_t sequence) {
+    // Sequences are assigned consecutively from zero, so slots fill in order
+    const size_t slot = sequence % kHistory;
+    if (slot >= history_count_ || history_[slot].sequence != sequence) {
+        return false;
+    }
+    base_ = history_[slot];
+    has_base_ = true;
+    return true;
+}
+
+bool HealthReportDecoder::readHeader(const uint8_t* data, size_t size,
+                                     uint16_t& sequence, bool& delta) {
+    FrameReader reader(data, size);
+    const uint8_t flags = reader.get8();
+    sequence = reader.get16();
+    delta = (flags & kDeltaFlag) != 0;
+    return reader.ok() && (flags >> 4) == kVersion;
+}
+
+bool HealthReportDecoder::decode(const uint8_t* data, size_t size, DecodedHealthReport& out) {
+    FrameReader reader(data, size);
+    const uint8_t flags = reader.get8();
+    if (!reader.ok() || (flags >> 4) != kVersion) {
+        return false;
+    }
+    const uint16_t sequence = reader.get16();
+    const uint32_t time_s = reader.get32();
+    const bool delta = (flags & kDeltaFlag) != 0;
+
+    QuantizedHealthReport report;
+    if (delta) {
+        const uint16_t base_sequence = reader.get16();
+        const QuantizedHealthReport* base = nullptr;
+        for (size_t i = 0; i < history_count_; ++i) {
+            if (history_[i].sequence == base_sequence) {
+                base = &history_[i];
+            }
+        }
+        if (!base) {
+            return false;
+        }
+        report = *base;
+        if (!readDelta(reader, report)) {
+            return false;
+        }
+    } else if (!readFull(reader, report)) {
+        return false;
+    }
+    if (!reader.atEnd()) {
+        return false;
+    }
+    report.sequence = sequence;
+    report.time_s = time_s;
+
+    history_[history_next_] = report;
+    history_next_ = (history_next_ + 1) % history_.size();
+    history_count_ = std::min(history_count_ + 1, history_.size());
+
+    out.sequence = sequence;
+    out.delta = delta;
+    out.timestamp = std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::seconds(time_s)));
+    out.total_dose = report.total_dose / 100.0f;
+    out.dose_rate = report.dose_rate / 10.0f;
+    out.single_event_upsets = report.upsets;
+    out.status.resize(report.component_count);
+    out.health_percentage.resize(report.component_count);
+    for (size_t i = 0; i < report.component_count; ++i) {
+        out.status[i] = static_cast<HealthStatus>(report.status[i]);
+        out.health_percentage[i] = report.health[i] / 2.0f;
+    }
+    out.temperature_celsius.resize(report.sensor_count);
+    for (size_t i = 0; i < report.sensor_count; ++i) {
+        out.temperature_celsius[i] = report.temperature[i] / 100.0f;
+    }
+    return true;
+}
+
+} // namespace core
+} // namespace skymesh
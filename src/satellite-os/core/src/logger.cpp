@@ -0,0 +1,186 @@
+/**
+ * @file logger.cpp
+ * @brief Implementation of the asynchronous core logger
+ */
+
+#include "skymesh/core/logger.h"
+
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+
+namespace skymesh {
+namespace core {
+
+namespace {
+
+// How long the drain thread sleeps when the ring is empty
+constexpr auto kIdlePollInterval = std::chrono::milliseconds(2);
+
+const char* level_name(LogLevel level) {
+    switch (level) {
+        case LogLevel::DEBUG:   return "DEBUG";
+        case LogLevel::INFO:    return "INFO";
+        case LogLevel::WARNING: return "WARNING";
+        case LogLevel::ERROR:   return "ERROR";
+    }
+    return "UNKNOWN";
+}
+
+void write_timestamp(std::ostream& out, std::chrono::system_clock::time_point time) {
+    auto time_t = std::chrono::system_clock::to_time_t(time);
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        time.time_since_epoch() % std::chrono::seconds(1));
+
+    std::tm utc{};
+    gmtime_r(&time_t, &utc);
+    out << std::put_time(&utc, "%Y-%m-%dT%H:%M:%S")
+        << '.' << std::setfill('0') << std::setw(3) << ms.count() << std::setfill(' ')
+        << 'Z';
+}
+
+} // anonymous namespace
+
+Logger& Logger::instance() {
+    // Never destroyed, so components logging during static destruction stay safe;
+    // queued messages are written out at exit instead
+    static Logger* logger = [] {
+        auto* created = new Logger();
+        created->start();
+        std::atexit([] { Logger::instance().stop(); });
+        return created;
+    }();
+    return *logger;
+}
+
+Logger::Logger(size_t capacity)
+    : ring_(capacity), out_(&std::cout), err_(&std::cerr) {
+}
+
+Logger::~Logger() {
+    stop();
+}
+
+void Logger::start() {
+    std::lock_guard<std::mutex> lock(drain_mutex_);
+    if (running_) {
+        return;
+    }
+
+    running_ = true;
+    drain_thread_ = std::thread(&Logger::drainThread, this);
+}
+
+void Logger::stop() {
+    {
+        std::lock_guard<std::mutex> lock(drain_mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+    }
+    drain_condition_.notify_all();
+
+    if (drain_thread_.joinable()) {
+        drain_thread_.join();
+    }
+}
+
+void Logger::flush() {
+    uint64_t target = accepted_.load(std::memory_order_relaxed);
+
+    std::unique_lock<std::mutex> lock(drain_mutex_);
+    if (!running_) {
+        // No drain thread: write out what is queued on the caller's thread
+        lock.unlock();
+        while (drainBatch() > 0) {
+        }
+        return;
+    }
+
+    drain_condition_.notify_all();
+    flushed_condition_.wait(lock, [this, target] {
+        return written_ >= target || !running_;
+    });
+}
+
+void Logger::setStreams(std::ostream& out, std::ostream& err) {
+    std::lock_guard<std::mutex> lock(drain_mutex_);
+    out_ = &out;
+    err_ = &err;
+}
+
+void Logger::drainThread() {
+    std::unique_lock<std::mutex> lock(drain_mutex_);
+
+    while (running_) {
+        lock.unlock();
+        size_t drained = drainBatch();
+        lock.lock();
+
+        if (drained == 0 && running_) {
+            drain_condition_.wait_for(lock, kIdlePollInterval);
+        }
+    }
+
+    // Write whatever is left before exiting
+    lock.unlock();
+    while (drainBatch() > 0) {
+    }
+    lock.lock();
+    flushed_condition_.notify_all();
+}
+
+size_t Logger::drainBatch() {
+    std::lock_guard<std::mutex> lock(drain_mutex_);
+
+    size_t drained = 0;
+    bool wrote_out = false;
+    bool wrote_err = false;
+
+    // Bound each batch so flush() waiters and stream changes are not starved
+    while (drained < ring_.capacity() && ring_.tryConsume([&](LogRecord& record) {
+        std::ostream& stream = record.level == LogLevel::ERROR ? *err_ : *out_;
+        (record.level == LogLevel::ERROR ? wrote_err : wrote_out) = true;
+
+        write_timestamp(stream, record.timestamp);
+        stream << " [" << level_name(record.level) << "] " << record.component << ": ";
+        if (record.format) {
+            record.format(stream, record.payload, record.size);
+        }
+        if (record.truncated) {
+            stream << " [truncated]";
+        }
+        stream << '\n';
+    })) {
+        drained++;
+    }
+
+    uint64_t dropped = dropped_.load(std::memory_order_relaxed);
+    if (dropped != reported_drops_) {
+        write_timestamp(*err_, std::chrono::system_clock::now());
+        *err_ << " [WARNING] logger: " << (dropped - reported_drops_)
+              << " messages dropped, ring full\n";
+        reported_drops_ = dropped;
+        wrote_err = true;
+    }
+
+    // One flush per batch instead of one per line
+    if (wrote_out) {
+        out_->flush();
+    }
+    if (wrote_err) {
+        err_->flush();
+    }
+
+    written_ += drained;
+    if (drained > 0) {
+        flushed_condition_.notify_all();
+    }
+
+    return drained;
+}
+
+} // namespace core
+} // namespace skymesh
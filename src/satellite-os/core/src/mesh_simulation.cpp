@@ -0,0 +1,628 @@
+/**
+ * @file mesh_simulation.cpp
+ * @brief Satellites, simulated RF links and broadcast flooding on one executor
+ */
+
+#include "skymesh/core/mesh_simulation.h"
+
+#include "skymesh/core/health_monitor.h"
+#include "skymesh/core/notification_bus.h"
+#include "skymesh/core/orbital_task_manager.h"
+#include "skymesh/core/power_manager.h"
+#include "skymesh/core/sensor_backend.h"
+#include "skymesh/core/telemetry_stream.h"
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace skymesh {
+namespace core {
+
+namespace {
+    // First byte of every link frame
+    enum class FrameKind : uint8_t { COMMAND = 1, TELEMETRY = 2 };
+
+    constexpr size_t kNoRoute = std::numeric_limits<size_t>::max();
+
+    // Command frame: u8 kind, u32 id, u16 code, u8 priority, u8 source,
+    // u64 timestamp, u32 checksum, u16 data length, data, u8 signature
+    // length, signature
+    constexpr size_t kCommandFrameFixedSize = 1 + 4 + 2 + 1 + 1 + 8 + 4 + 2 + 1;
+
+    // Link streams of the loss and corruption draws, one counter per frame
+    constexpr uint64_t kLinkStreamBase = 0x4c494e4b00000000ull;
+    constexpr uint64_t kDrawsPerFrame = 3;
+
+    double unitValue(uint64_t bits) {
+        return static_cast<double>(bits >> 11) * 0x1.0p-53;
+    }
+
+    template <typename T>
+    void putLittleEndian(std::vector<uint8_t>& out, T value) {
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            out.push_back(static_cast<uint8_t>(static_cast<uint64_t>(value) >> (8 * i)));
+        }
+    }
+
+    template <typename T>
+    T getLittleEndian(const uint8_t*& in) {
+        uint64_t value = 0;
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            value |= static_cast<uint64_t>(in[i]) << (8 * i);
+        }
+        in += sizeof(T);
+        return static_cast<T>(value);
+    }
+
+    std::vector<uint8_t> encodeCommandFrame(const Command& command) {
+        std::vector<uint8_t> frame;
+        frame.reserve(kCommandFrameFixedSize + command.data.size() + command.signature.size());
+        frame.push_back(static_cast<uint8_t>(FrameKind::COMMAND));
+        putLittleEndian<uint32_t>(frame, command.commandId);
+        putLittleEndian<uint16_t>(frame, command.getCommandCodeTMR());
+        frame.push_back(static_cast<uint8_t>(command.priority));
+        frame.push_back(static_cast<uint8_t>(command.source));
+        putLittleEndian<uint64_t>(frame, command.timestamp);
+        putLittleEndian<uint32_t>(frame, command.checksum);
+        putLittleEndian<uint16_t>(frame, static_cast<uint16_t>(command.data.size()));
+        frame.insert(frame.end(), command.data.begin(), command.data.end());
+        frame.push_back(static_cast<uint8_t>(command.signature.size()));
+        frame.insert(frame.end(), command.signature.begin(), command.signature.end());
+        return frame;
+    }
+
+    bool decodeCommandFrame(const std::vector<uint8_t>& frame, Command& command) {
+        if (frame.size() < kCommandFrameFixedSize) {
+            return false;
+        }
+        const uint8_t* in = frame.data() + 1;
+        command.commandId = getLittleEndian<uint32_t>(in);
+        command.commandCode = getLittleEndian<uint16_t>(in);
+        command.commandCode_copy1 = command.commandCode;
+        command.commandCode_copy2 = command.commandCode;
+        const uint8_t priority = *in++;
+        const uint8_t source = *in++;
+        if (priority >= kCommandPriorityCount || source >= kCommandSourceCount) {
+            return false;
+        }
+        command.priority = static_cast<CommandPriority>(priority);
+        command.source = static_cast<CommandSource>(source);
+        command.timestamp = getLittleEndian<uint64_t>(in);
+        command.checksum = getLittleEndian<uint32_t>(in);
+        const size_t data_size = getLittleEndian<uint16_t>(in);
+        if (frame.size() < kCommandFrameFixedSize + data_size) {
+            return false;
+        }
+        command.data.assign(in, in + data_size);
+        in += data_size;
+        const size_t signature_size = *in++;
+        if (frame.size() != kCommandFrameFixedSize + data_size + signature_size) {
+            return false;
+        }
+        command.signature.assign(in, in + signature_size);
+        return true;
+    }
+
+    int64_t toNanoseconds(std::chrono::system_clock::time_point time) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+    }
+
+    std::chrono::system_clock::time_point fromNanoseconds(int64_t ns) {
+        return std::chrono::system_clock::time_point(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(ns)));
+    }
+} // anonymous namespace
+
+class MeshSimulation::Impl {
+public:
+    explicit Impl(const MeshSimulationConfig& config);
+    ~Impl();
+
+    bool link(size_t a, size_t b);
+    bool start();
+    void stop();
+    uint32_t broadcastCommand(const std::vector<uint8_t>& payload, CommandPriority priority);
+    BroadcastCoverage coverage(uint32_t broadcast_id) const;
+    size_t hopsToRoot(size_t satellite) const;
+    MeshSimulationStats stats() const;
+
+    // Declared first so it outlives the subsystems that cancel timers on it
+    std::shared_ptr<SimulationExecutor> executor_;
+    std::shared_ptr<NotificationBus> bus_;
+
+    struct Satellite;
+    std::vector<std::unique_ptr<Satellite>> satellites_;
+
+private:
+    // One direction of a link
+    struct DirectedLink {
+        size_t from;
+        size_t to;
+        int64_t busy_until_ns = 0;    // Transmitter free from this time
+        size_t queued = 0;            // Frames sent and not yet arrived or lost
+        uint64_t frames = 0;          // Frames accepted, the counter of the link draws
+        CounterRng rng;
+
+        DirectedLink(size_t from_satellite, size_t to_satellite, uint64_t seed, uint64_t stream)
+            : from(from_satellite), to(to_satellite), rng(seed, stream) {}
+    };
+
+    struct Broadcast {
+        int64_t uplink_ns = 0;
+        BroadcastCoverage coverage;
+    };
+
+    bool send(size_t link_index, std::vector<uint8_t> frame);
+    void arrive(size_t link_index, std::vector<uint8_t>& frame);
+    void receiveCommand(Satellite& satellite, const std::vector<uint8_t>& frame);
+    void receiveTelemetry(Satellite& satellite, std::vector<uint8_t> frame);
+    void countTelemetry(const uint8_t* frame, size_t size);
+    CommandStatus runBroadcast(Satellite& satellite, const Command& command);
+    void submit(Satellite& satellite, const Command& command);
+    void route();
+    bool scheduleHousekeeping(Satellite& satellite);
+
+    MeshSimulationConfig config_;
+    std::vector<DirectedLink> links_;
+    std::unordered_map<uint32_t, Broadcast> broadcasts_;
+    std::optional<CommandKeySchedule> mesh_schedule_;
+    uint32_t next_broadcast_id_ = 1;
+    int64_t start_ns_ = 0;
+    bool running_ = false;
+    MeshSimulationStats stats_;
+};
+
+struct MeshSimulation::Impl::Satellite : public TelemetrySink {
+    Impl* mesh = nullptr;
+    size_t index = 0;
+    std::shared_ptr<SensorBackend> sensors;
+    std::shared_ptr<PowerManager> power;
+    std::shared_ptr<HealthMonitor> health;
+    std::shared_ptr<OrbitalTaskManager> tasks;
+    std::unique_ptr<CommandControl> control;
+    std::unique_ptr<TelemetryCollector> telemetry;
+
+    std::vector<size_t> links;                 // Outgoing directed links
+    size_t uplink = kNoRoute;                  // Link toward satellite 0
+    size_t hops = kNoRoute;                    // Hops from satellite 0
+    std::unordered_set<uint32_t> seen;         // Broadcasts already run
+    std::array<uint8_t, kTelemetryMaxFrameSize> frame{};
+
+    uint8_t* acquireFrame(size_t& capacity) override {
+        if (index != 0 && (uplink == kNoRoute ||
+                           mesh->links_[uplink].queued >= mesh->config_.link.queue_limit)) {
+            return nullptr;
+        }
+        capacity = frame.size();
+        return frame.data();
+    }
+
+    bool commitFrame(size_t length, TelemetryFrameType, uint16_t) override {
+        if (index == 0) {
+            mesh->countTelemetry(frame.data(), length);
+            return true;
+        }
+        std::vector<uint8_t> bytes;
+        bytes.reserve(length + 1);
+        bytes.push_back(static_cast<uint8_t>(FrameKind::TELEMETRY));
+        bytes.insert(bytes.end(), frame.begin(), frame.begin() + length);
+        return mesh->send(uplink, std::move(bytes));
+    }
+
+    void abortFrame() override {}
+};
+
+MeshSimulation::Impl::Impl(const MeshSimulationConfig& config)
+    : executor_(std::make_shared<SimulationExecutor>(config.epoch))
+    , bus_(std::make_shared<NotificationBus>())
+    , config_(config) {
+    if (config_.mesh_key) {
+        mesh_schedule_.emplace(*config_.mesh_key);
+    }
+
+    satellites_.reserve(config_.satellites);
+    for (size_t i = 0; i < config_.satellites; ++i) {
+        auto satellite = std::make_unique<Satellite>();
+        satellite->mesh = this;
+        satellite->index = i;
+
+        SimulationProfile profile;
+        profile.seed = config_.seed + i;
+        profile.clock = executor_;
+        satellite->sensors = createSimulatedSensorBackend(profile);
+        satellite->power = std::make_shared<PowerManager>(satellite->sensors);
+        satellite->power->initialize({SubsystemID::RF_SYSTEM, SubsystemID::OBC, SubsystemID::ADCS,
+                                      SubsystemID::THERMAL, SubsystemID::PAYLOAD, SubsystemID::SENSORS});
+        satellite->health = createHealthMonitor("", bus_, satellite->sensors, executor_);
+        satellite->health->initialize(config_.health_polling_ms);
+
+        satellite->tasks = createOrbitalTaskManager("", bus_);
+        ExecutionPoolConfig pool;
+        pool.executor = executor_;
+        satellite->tasks->configureExecutionPool(pool);
+        // Recurring housekeeping would otherwise keep results for hours of simulated time
+        ResultRetentionPolicy retention;
+        retention.max_results = 64;
+        satellite->tasks->configureResultRetention(retention);
+
+        satellite->control = std::make_unique<CommandControl>(nullptr, satellite->power,
+                                                              satellite->tasks, satellite->health);
+        satellite->control->setExecutor(executor_);
+        if (config_.mesh_key) {
+            satellite->control->setSourceKey(CommandSource::GROUND_STATION, *config_.mesh_key);
+            satellite->control->setSourceKey(CommandSource::MESH_PEER, *config_.mesh_key);
+        }
+        Satellite* self = satellite.get();
+        satellite->control->registerCommandHandler(kBroadcastCommandCode,
+            [this, self](const Command& command, std::string&) { return runBroadcast(*self, command); });
+
+        satellite->telemetry = std::make_unique<TelemetryCollector>(satellite->power, satellite->health,
+                                                                    satellite->tasks);
+        satellites_.push_back(std::move(satellite));
+    }
+}
+
+MeshSimulation::Impl::~Impl() {
+    stop();
+    satellites_.clear();
+}
+
+bool MeshSimulation::Impl::link(size_t a, size_t b) {
+    if (a >= satellites_.size() || b >= satellites_.size() || a == b) {
+        return false;
+    }
+    for (size_t index : satellites_[a]->links) {
+        if (links_[index].to == b) {
+            return false;
+        }
+    }
+
+    const uint64_t stream = kLinkStreamBase + links_.size();
+    satellites_[a]->links.push_back(links_.size());
+    links_.emplace_back(a, b, config_.seed, stream);
+    satellites_[b]->links.push_back(links_.size());
+    links_.emplace_back(b, a, config_.seed, stream + 1);
+    route();
+    return true;
+}
+
+void MeshSimulation::Impl::route() {
+    // Breadth-first from satellite 0; ties go to the earliest link, so the
+    // tree depends only on the order links were added
+    for (auto& satellite : satellites_) {
+        satellite->uplink = kNoRoute;
+        satellite->hops = kNoRoute;
+    }
+    if (satellites_.empty()) {
+        return;
+    }
+    std::deque<size_t> frontier{0};
+    satellites_[0]->hops = 0;
+    while (!frontier.empty()) {
+        const size_t current = frontier.front();
+        frontier.pop_front();
+        for (size_t index : satellites_[current]->links) {
+            Satellite& next = *satellites_[links_[index].to];
+            if (next.hops != kNoRoute) {
+                continue;
+            }
+            next.hops = satellites_[current]->hops + 1;
+            next.uplink = index ^ 1;   // The reverse direction was added alongside
+            frontier.push_back(next.index);
+        }
+    }
+}
+
+bool MeshSimulation::Impl::scheduleHousekeeping(Satellite& satellite) {
+    OrbitalTask task;
+    task.scheduled_time = executor_->now();
+    task.timeout = std::chrono::milliseconds(1000);
+    task.priority = TaskPriority::NORMAL;
+    task.recovery_strategy = RecoveryStrategy::RETRY;
+    task.retry_count = 0;
+    task.radiation_protected = false;
+
+    task.name = "PowerUpdate";
+    task.type = TaskType::POWER_MANAGEMENT;
+    const auto update_ms = static_cast<uint32_t>(config_.power_update_interval.count());
+    PowerManager* power = satellite.power.get();
+    task.task_function = [power, update_ms](const TaskContext&) {
+        power->update(update_ms);
+        return true;
+    };
+    if (satellite.tasks->scheduleRecurringTask(task, config_.power_update_interval).empty()) {
+        return false;
+    }
+
+    if (config_.telemetry_interval.count() <= 0) {
+        return true;
+    }
+    task.name = "TelemetryStream";
+    task.type = TaskType::TELEMETRY;
+    Satellite* self = &satellite;
+    task.task_function = [self](const TaskContext&) {
+        if (!self->telemetry->sweepInProgress()) {
+            self->telemetry->beginSweep();
+        }
+        self->telemetry->emit(*self);
+        return true;
+    };
+    return !satellite.tasks->scheduleRecurringTask(task, config_.telemetry_interval).empty();
+}
+
+bool MeshSimulation::Impl::start() {
+    if (running_) {
+        return true;
+    }
+    start_ns_ = toNanoseconds(executor_->now());
+    for (auto& satellite : satellites_) {
+        if (!satellite->control->initialize() || !satellite->health->start() ||
+            !satellite->tasks->start() || !scheduleHousekeeping(*satellite)) {
+            return false;
+        }
+    }
+    running_ = true;
+    return true;
+}
+
+void MeshSimulation::Impl::stop() {
+    if (!running_) {
+        return;
+    }
+    running_ = false;
+    for (auto& satellite : satellites_) {
+        satellite->tasks->stop();
+        satellite->health->stop();
+    }
+}
+
+bool MeshSimulation::Impl::send(size_t link_index, std::vector<uint8_t> frame) {
+    DirectedLink& link = links_[link_index];
+    const RfLinkProfile& profile = config_.link;
+    if (!running_ || link.queued >= profile.queue_limit) {
+        ++stats_.queue_drops;
+        return false;
+    }
+
+    // Frames leave one after another at the bit rate, then fly for the latency
+    const int64_t now = toNanoseconds(executor_->now());
+    const int64_t serialization = static_cast<int64_t>(static_cast<double>(frame.size()) * 8.0e9 /
+                                                       profile.bit_rate);
+    link.busy_until_ns = std::max(link.busy_until_ns, now) + serialization;
+    const int64_t arrival = link.busy_until_ns +
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(profile.latency).count();
+
+    const uint64_t draw = link.frames++ * kDrawsPerFrame;
+    ++link.queued;
+    ++stats_.frames_sent;
+    if (unitValue(link.rng.at(draw)) < profile.loss_probability) {
+        // Still occupies the queue until it would have arrived
+        executor_->scheduleAt(fromNanoseconds(arrival), [this, link_index] {
+            --links_[link_index].queued;
+            ++stats_.frames_lost;
+        });
+        return true;
+    }
+    if (unitValue(link.rng.at(draw + 1)) < profile.corruption_probability) {
+        const uint64_t bits = link.rng.at(draw + 2);
+        frame[bits % frame.size()] ^= static_cast<uint8_t>(1u << ((bits >> 32) % 8));
+        ++stats_.frames_corrupted;
+    }
+    executor_->scheduleAt(fromNanoseconds(arrival), [this, link_index, frame = std::move(frame)]() mutable {
+        arrive(link_index, frame);
+    });
+    return true;
+}
+
+void MeshSimulation::Impl::arrive(size_t link_index, std::vector<uint8_t>& frame) {
+    DirectedLink& link = links_[link_index];
+    --link.queued;
+    if (!running_) {
+        return;
+    }
+    ++stats_.frames_delivered;
+
+    Satellite& satellite = *satellites_[link.to];
+    switch (static_cast<FrameKind>(frame[0])) {
+        case FrameKind::COMMAND:
+            receiveCommand(satellite, frame);
+            break;
+        case FrameKind::TELEMETRY:
+            receiveTelemetry(satellite, std::move(frame));
+            break;
+        default:
+            ++stats_.commands_rejected;   // Kind byte corrupted; nothing can use it
+            break;
+    }
+}
+
+void MeshSimulation::Impl::receiveCommand(Satellite& satellite, const std::vector<uint8_t>& frame) {
+    Command command{};
+    if (!decodeCommandFrame(frame, command)) {
+        ++stats_.commands_rejected;
+        return;
+    }
+    submit(satellite, command);
+}
+
+void MeshSimulation::Impl::submit(Satellite& satellite, const Command& command) {
+    if (satellite.control->processCommand(command) == CommandStatus::PENDING) {
+        ++stats_.commands_accepted;
+    } else {
+        ++stats_.commands_rejected;
+    }
+}
+
+void MeshSimulation::Impl::receiveTelemetry(Satellite& satellite, std::vector<uint8_t> frame) {
+    if (satellite.index == 0) {
+        countTelemetry(frame.data() + 1, frame.size() - 1);
+    } else if (satellite.uplink != kNoRoute) {
+        send(satellite.uplink, std::move(frame));
+    }
+}
+
+void MeshSimulation::Impl::countTelemetry(const uint8_t* frame, size_t size) {
+    TelemetryFrameView view;
+    if (parseTelemetryFrame(frame, size, view)) {
+        ++stats_.telemetry_frames;
+        stats_.telemetry_bytes += size;
+    }
+}
+
+CommandStatus MeshSimulation::Impl::runBroadcast(Satellite& satellite, const Command& command) {
+    if (command.data.size() < sizeof(uint32_t)) {
+        return CommandStatus::INVALID_COMMAND;
+    }
+    const uint8_t* in = command.data.data();
+    const uint32_t broadcast_id = getLittleEndian<uint32_t>(in);
+    if (!satellite.seen.insert(broadcast_id).second) {
+        return CommandStatus::SUCCESS;   // Another neighbour got here first
+    }
+
+    ++stats_.broadcasts_executed;
+    auto found = broadcasts_.find(broadcast_id);
+    if (found != broadcasts_.end()) {
+        BroadcastCoverage& coverage = found->second.coverage;
+        ++coverage.reached;
+        coverage.max_latency = std::max(coverage.max_latency, std::chrono::nanoseconds(
+            toNanoseconds(executor_->now()) - found->second.uplink_ns));
+    }
+
+    // Forward to every neighbour as a peer command, signed by this satellite
+    Command forward = command;
+    forward.source = CommandSource::MESH_PEER;
+    forward.signature.clear();
+    if (mesh_schedule_) {
+        const CommandSignature signature = computeCommandSignature(forward, *mesh_schedule_);
+        forward.signature.assign(signature.begin(), signature.end());
+    }
+    const std::vector<uint8_t> frame = encodeCommandFrame(forward);
+    for (size_t index : satellite.links) {
+        send(index, frame);
+    }
+    return CommandStatus::SUCCESS;
+}
+
+uint32_t MeshSimulation::Impl::broadcastCommand(const std::vector<uint8_t>& payload, CommandPriority priority) {
+    if (!running_ || satellites_.empty()) {
+        return 0;
+    }
+    const uint32_t broadcast_id = next_broadcast_id_++;
+
+    Command command{};
+    command.commandId = broadcast_id;
+    command.commandCode = kBroadcastCommandCode;
+    command.commandCode_copy1 = kBroadcastCommandCode;
+    command.commandCode_copy2 = kBroadcastCommandCode;
+    command.priority = priority;
+    command.source = CommandSource::GROUND_STATION;
+    command.timestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        executor_->now().time_since_epoch()).count());
+    putLittleEndian<uint32_t>(command.data, broadcast_id);
+    command.data.insert(command.data.end(), payload.begin(), payload.end());
+    command.checksum = computeCommandChecksum(command);
+    if (mesh_schedule_) {
+        const CommandSignature signature = computeCommandSignature(command, *mesh_schedule_);
+        command.signature.assign(signature.begin(), signature.end());
+    }
+
+    broadcasts_[broadcast_id].uplink_ns = toNanoseconds(executor_->now());
+    if (satellites_[0]->control->processCommand(command) != CommandStatus::PENDING) {
+        ++stats_.commands_rejected;
+        broadcasts_.erase(broadcast_id);
+        return 0;
+    }
+    ++stats_.commands_accepted;
+    return broadcast_id;
+}
+
+BroadcastCoverage MeshSimulation::Impl::coverage(uint32_t broadcast_id) const {
+    auto found = broadcasts_.find(broadcast_id);
+    return found != broadcasts_.end() ? found->second.coverage : BroadcastCoverage{};
+}
+
+size_t MeshSimulation::Impl::hopsToRoot(size_t satellite) const {
+    return satellite < satellites_.size() ? satellites_[satellite]->hops : kNoRoute;
+}
+
+MeshSimulationStats MeshSimulation::Impl::stats() const {
+    MeshSimulationStats stats = stats_;
+    if (start_ns_ != 0) {
+        stats.simulated_time = std::chrono::nanoseconds(toNanoseconds(executor_->now()) - start_ns_);
+    }
+    return stats;
+}
+
+MeshSimulation::MeshSimulation(const MeshSimulationConfig& config)
+    : impl_(std::make_unique<Impl>(config)) {
+}
+
+MeshSimulation::~MeshSimulation() = default;
+
+bool MeshSimulation::link(size_t a, size_t b) {
+    return impl_->link(a, b);
+}
+
+void MeshSimulation::connectTree(size_t fanout) {
+    fanout = std::max<size_t>(fanout, 1);
+    for (size_t child = 1; child < impl_->satellites_.size(); ++child) {
+        impl_->link((child - 1) / fanout, child);
+    }
+}
+
+void MeshSimulation::connectRing() {
+    const size_t count = impl_->satellites_.size();
+    for (size_t i = 0; i + 1 < count; ++i) {
+        impl_->link(i, i + 1);
+    }
+    if (count > 2) {
+        impl_->link(count - 1, 0);
+    }
+}
+
+bool MeshSimulation::start() {
+    return impl_->start();
+}
+
+void MeshSimulation::stop() {
+    impl_->stop();
+}
+
+size_t MeshSimulation::run(std::chrono::nanoseconds duration) {
+    return impl_->executor_->runFor(duration);
+}
+
+uint32_t MeshSimulation::broadcastCommand(const std::vector<uint8_t>& payload, CommandPriority priority) {
+    return impl_->broadcastCommand(payload, priority);
+}
+
+BroadcastCoverage MeshSimulation::coverage(uint32_t broadcast_id) const {
+    return impl_->coverage(broadcast_id);
+}
+
+size_t MeshSimulation::hopsToRoot(size_t satellite) const {
+    return impl_->hopsToRoot(satellite);
+}
+
+MeshSimulationStats MeshSimulation::stats() const {
+    return impl_->stats();
+}
+
+size_t MeshSimulation::size() const {
+    return impl_->satellites_.size();
+}
+
+SimulationExecutor& MeshSimulation::executor() {
+    return *impl_->executor_;
+}
+
+CommandControl& MeshSimulation::commandControl(size_t satellite) {
+    return *impl_->satellites_.at(satellite)->control;
+}
+
+} // namespace core
+} // namespace skymesh
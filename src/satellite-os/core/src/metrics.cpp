@@ -0,0 +1,369 @@
+/**
+ * @file metrics.cpp
+ * @brief Implementation of the metrics registry and its binary snapshot codec
+ */
+
+#include "skymesh/core/metrics.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace skymesh {
+namespace core {
+
+namespace {
+    constexpr uint8_t kSnapshotVersion = 1;
+
+    // Bounds-checked little-endian writer; sticks at failure
+    class SnapshotWriter {
+    public:
+        SnapshotWriter(uint8_t* buffer, size_t capacity) : buffer_(buffer), capacity_(capacity) {}
+
+        void put8(uint8_t value) {
+            if (size_ < capacity_) {
+                buffer_[size_++] = value;
+            } else {
+                failed_ = true;
+            }
+        }
+
+        void put16(uint16_t value) {
+            put8(static_cast<uint8_t>(value));
+            put8(static_cast<uint8_t>(value >> 8));
+        }
+
+        void put64(uint64_t value) {
+            for (int shift = 0; shift < 64; shift += 8) {
+                put8(static_cast<uint8_t>(value >> shift));
+            }
+        }
+
+        void putVarint(uint64_t value) {
+            while (value >= 0x80) {
+                put8(static_cast<uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            put8(static_cast<uint8_t>(value));
+        }
+
+        void putName(const std::string& name) {
+            const size_t length = std::min<size_t>(name.size(), std::numeric_limits<uint8_t>::max());
+            put8(static_cast<uint8_t>(length));
+            for (size_t i = 0; i < length; ++i) {
+                put8(static_cast<uint8_t>(name[i]));
+            }
+        }
+
+        size_t size() const { return failed_ ? 0 : size_; }
+
+    private:
+        uint8_t* buffer_;
+        size_t capacity_;
+        size_t size_ = 0;
+        bool failed_ = false;
+    };
+
+    // Bounds-checked reader matching SnapshotWriter
+    class SnapshotReader {
+    public:
+        SnapshotReader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+        bool get8(uint8_t& value) {
+            if (offset_ >= size_) {
+                return false;
+            }
+            value = data_[offset_++];
+            return true;
+        }
+
+        bool get16(uint16_t& value) {
+            uint8_t lo = 0;
+            uint8_t hi = 0;
+            if (!get8(lo) || !get8(hi)) {
+                return false;
+            }
+            value = static_cast<uint16_t>(lo | (hi << 8));
+            return true;
+        }
+
+        bool get64(uint64_t& value) {
+            value = 0;
+            for (int shift = 0; shift < 64; shift += 8) {
+                uint8_t byte = 0;
+                if (!get8(byte)) {
+                    return false;
+                }
+                value |= static_cast<uint64_t>(byte) << shift;
+            }
+            return true;
+        }
+
+        bool getVarint(uint64_t& value) {
+            value = 0;
+            for (int shift = 0; shift < 64; shift += 7) {
+                uint8_t byte = 0;
+                if (!get8(byte)) {
+                    return false;
+                }
+                value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool getName(std::string& name) {
+            uint8_t length = 0;
+            if (!get8(length) || size_ - offset_ < length) {
+                return false;
+            }
+            name.assign(reinterpret_cast<const char*>(data_ + offset_), length);
+            offset_ += length;
+            return true;
+        }
+
+    private:
+        const uint8_t* data_;
+        size_t size_;
+        size_t offset_ = 0;
+    };
+
+    void encodeMetrics(const MetricsSnapshot& snapshot, SnapshotWriter& out) {
+        out.put8(kSnapshotVersion);
+        out.put64(snapshot.timestampNs);
+        out.put16(static_cast<uint16_t>(snapshot.counters.size()));
+        for (const auto& counter : snapshot.counters) {
+            out.putName(counter.name);
+            out.putVarint(counter.value);
+        }
+        out.put16(static_cast<uint16_t>(snapshot.histograms.size()));
+        for (const auto& histogram : snapshot.histograms) {
+            out.putName(histogram.name);
+            out.putVarint(histogram.data.count);
+            out.putVarint(histogram.data.sum);
+            out.putVarint(histogram.data.max);
+            out.put16(static_cast<uint16_t>(histogram.data.buckets.size()));
+            for (const auto& bucket : histogram.data.buckets) {
+                out.put16(bucket.first);
+                out.putVarint(bucket.second);
+            }
+        }
+    }
+} // anonymous namespace
+
+// ---- MetricCounter ----
+
+uint64_t MetricCounter::value() const {
+    uint64_t total = 0;
+    for (const Shard& shard : shards_) {
+        total += shard.value.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void MetricCounter::reset() {
+    for (Shard& shard : shards_) {
+        shard.value.store(0, std::memory_order_relaxed);
+    }
+}
+
+// ---- LatencyHistogram ----
+
+uint64_t HistogramSnapshot::quantile(double q) const {
+    if (count == 0) {
+        return 0;
+    }
+    const double clamped = std::min(std::max(q, 0.0), 1.0);
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(clamped * static_cast<double>(count) + 0.5));
+    uint64_t seen = 0;
+    for (const auto& bucket : buckets) {
+        seen += bucket.second;
+        if (seen >= rank) {
+            return std::min(LatencyHistogram::bucketUpperBound(bucket.first), max);
+        }
+    }
+    return max;
+}
+
+HistogramSnapshot LatencyHistogram::snapshot() const {
+    HistogramSnapshot merged;
+    std::array<uint64_t, kBucketCount> counts{};
+    for (const Shard& shard : shards_) {
+        merged.count += shard.count.load(std::memory_order_relaxed);
+        merged.sum += shard.sum.load(std::memory_order_relaxed);
+        merged.max = std::max(merged.max, shard.max.load(std::memory_order_relaxed));
+        for (size_t i = 0; i < kBucketCount; ++i) {
+            counts[i] += shard.buckets[i].load(std::memory_order_relaxed);
+        }
+    }
+    for (size_t i = 0; i < kBucketCount; ++i) {
+        if (counts[i] != 0) {
+            merged.buckets.emplace_back(static_cast<uint16_t>(i), counts[i]);
+        }
+    }
+    return merged;
+}
+
+void LatencyHistogram::reset() {
+    for (Shard& shard : shards_) {
+        shard.count.store(0, std::memory_order_relaxed);
+        shard.sum.store(0, std::memory_order_relaxed);
+        shard.max.store(0, std::memory_order_relaxed);
+        for (auto& bucket : shard.buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+uint64_t LatencyHistogram::bucketLowerBound(size_t index) {
+    constexpr size_t kSubBuckets = size_t{1} << kSubBucketBits;
+    if (index < kSubBuckets) {
+        return index;
+    }
+    const unsigned exponent = static_cast<unsigned>(index >> kSubBucketBits) + kSubBucketBits - 1;
+    const uint64_t sub = index & (kSubBuckets - 1);
+    return (kSubBuckets + sub) << (exponent - kSubBucketBits);
+}
+
+uint64_t LatencyHistogram::bucketUpperBound(size_t index) {
+    return index + 1 >= kBucketCount ? std::numeric_limits<uint64_t>::max() : bucketLowerBound(index + 1) - 1;
+}
+
+// ---- MetricsSnapshot ----
+
+uint64_t MetricsSnapshot::counter(std::string_view name) const {
+    for (const auto& entry : counters) {
+        if (entry.name == name) {
+            return entry.value;
+        }
+    }
+    return 0;
+}
+
+const HistogramSnapshot* MetricsSnapshot::histogram(std::string_view name) const {
+    for (const auto& entry : histograms) {
+        if (entry.name == name) {
+            return &entry.data;
+        }
+    }
+    return nullptr;
+}
+
+bool decodeMetricsSnapshot(const uint8_t* data, size_t size, MetricsSnapshot& out) {
+    SnapshotReader in(data, size);
+    uint8_t version = 0;
+    uint16_t counterCount = 0;
+    if (data == nullptr || !in.get8(version) || version != kSnapshotVersion ||
+        !in.get64(out.timestampNs) || !in.get16(counterCount)) {
+        return false;
+    }
+    out.counters.assign(counterCount, MetricsSnapshot::Counter{});
+    for (auto& counter : out.counters) {
+        if (!in.getName(counter.name) || !in.getVarint(counter.value)) {
+            return false;
+        }
+    }
+
+    uint16_t histogramCount = 0;
+    if (!in.get16(histogramCount)) {
+        return false;
+    }
+    out.histograms.assign(histogramCount, MetricsSnapshot::Histogram{});
+    for (auto& histogram : out.histograms) {
+        uint16_t bucketCount = 0;
+        if (!in.getName(histogram.name) || !in.getVarint(histogram.data.count) ||
+            !in.getVarint(histogram.data.sum) || !in.getVarint(histogram.data.max) || !in.get16(bucketCount)) {
+            return false;
+        }
+        histogram.data.buckets.resize(bucketCount);
+        for (auto& bucket : histogram.data.buckets) {
+            if (!in.get16(bucket.first) || bucket.first >= LatencyHistogram::kBucketCount ||
+                !in.getVarint(bucket.second)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// ---- MetricsRegistry ----
+
+MetricsRegistry& MetricsRegistry::instance() {
+    static MetricsRegistry registry;
+    return registry;
+}
+
+template <typename Metric>
+Metric& MetricsRegistry::findOrAdd(std::vector<Entry<Metric>>& entries,
+                                   std::unordered_map<std::string, size_t>& index, std::string_view name) {
+    std::string key(name);
+    auto it = index.find(key);
+    if (it != index.end()) {
+        return *entries[it->second].metric;
+    }
+    index.emplace(key, entries.size());
+    entries.push_back(Entry<Metric>{std::move(key), std::make_unique<Metric>()});
+    return *entries.back().metric;
+}
+
+MetricCounter& MetricsRegistry::counter(std::string_view name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return findOrAdd(counters_, counter_index_, name);
+}
+
+LatencyHistogram& MetricsRegistry::histogram(std::string_view name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return findOrAdd(histograms_, histogram_index_, name);
+}
+
+MetricsSnapshot MetricsRegistry::snapshot() const {
+    MetricsSnapshot snapshot;
+    snapshot.timestampNs = monotonicNanoseconds();
+    std::lock_guard<std::mutex> lock(mutex_);
+    snapshot.counters.reserve(counters_.size());
+    for (const auto& entry : counters_) {
+        snapshot.counters.push_back({entry.name, entry.metric->value()});
+    }
+    snapshot.histograms.reserve(histograms_.size());
+    for (const auto& entry : histograms_) {
+        snapshot.histograms.push_back({entry.name, entry.metric->snapshot()});
+    }
+    return snapshot;
+}
+
+size_t MetricsRegistry::encodeSnapshot(uint8_t* buffer, size_t capacity) const {
+    SnapshotWriter out(buffer, capacity);
+    encodeMetrics(snapshot(), out);
+    return out.size();
+}
+
+std::vector<uint8_t> MetricsRegistry::encodeSnapshot() const {
+    // Worst case of every varint, trimmed after encoding
+    const MetricsSnapshot captured = snapshot();
+    size_t bound = 1 + 8 + 2 + 2;
+    for (const auto& counter : captured.counters) {
+        bound += 1 + counter.name.size() + 10;
+    }
+    for (const auto& histogram : captured.histograms) {
+        bound += 1 + histogram.name.size() + 3 * 10 + 2 + histogram.data.buckets.size() * (2 + 10);
+    }
+    std::vector<uint8_t> encoded(bound);
+    SnapshotWriter out(encoded.data(), encoded.size());
+    encodeMetrics(captured, out);
+    encoded.resize(out.size());
+    return encoded;
+}
+
+void MetricsRegistry::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& entry : counters_) {
+        entry.metric->reset();
+    }
+    for (auto& entry : histograms_) {
+        entry.metric->reset();
+    }
+}
+
+} // namespace core
+} // namespace skymesh
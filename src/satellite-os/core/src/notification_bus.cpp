@@ -0,0 +1,97 @@
+/**
+ * @file notification_bus.cpp
+ * @brief Implementation of the notification bus delivery thread
+ */
+
+#include "skymesh/core/notification_bus.h"
+#include <algorithm>
+
+namespace skymesh {
+namespace core {
+
+NotificationBus::NotificationBus()
+    : thread_(&NotificationBus::deliveryLoop, this) {
+}
+
+NotificationBus::~NotificationBus() {
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_one();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void NotificationBus::attach(NotificationTopicBase* topic) {
+    std::lock_guard<std::mutex> lock(delivery_mutex_);
+    topics_.push_back(topic);
+}
+
+void NotificationBus::detach(NotificationTopicBase* topic) {
+    std::lock_guard<std::mutex> lock(delivery_mutex_);
+    topics_.erase(std::remove(topics_.begin(), topics_.end(), topic), topics_.end());
+}
+
+void NotificationBus::signal() {
+    // Pairs with the waiting_ store in deliveryLoop: either this sees the
+    // thread waiting, or the thread sees the new signal before it waits
+    signals_.fetch_add(1, std::memory_order_seq_cst);
+    if (waiting_.load(std::memory_order_seq_cst)) {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        wake_.notify_one();
+    }
+}
+
+bool NotificationBus::flush(std::chrono::milliseconds timeout) {
+    if (onDeliveryThread()) {
+        return true;
+    }
+    const uint64_t target = signals_.load(std::memory_order_seq_cst);
+    std::unique_lock<std::mutex> lock(wake_mutex_);
+    return flushed_.wait_for(lock, timeout, [this, target] {
+        return completed_signals_ >= target;
+    });
+}
+
+void NotificationBus::waitForDelivery() {
+    if (!onDeliveryThread()) {
+        std::lock_guard<std::mutex> lock(delivery_mutex_);
+    }
+}
+
+bool NotificationBus::onDeliveryThread() const {
+    return std::this_thread::get_id() == thread_.get_id();
+}
+
+void NotificationBus::deliveryLoop() {
+    for (;;) {
+        // Everything signalled up to here is queued, so this round delivers it
+        const uint64_t seen = signals_.load(std::memory_order_seq_cst);
+        size_t delivered = 0;
+        {
+            std::lock_guard<std::mutex> lock(delivery_mutex_);
+            for (NotificationTopicBase* topic : topics_) {
+                delivered += topic->deliverPending();
+            }
+        }
+        delivered_.fetch_add(delivered, std::memory_order_relaxed);
+
+        std::unique_lock<std::mutex> lock(wake_mutex_);
+        completed_signals_ = seen;
+        flushed_.notify_all();
+
+        if (stopping_ && signals_.load(std::memory_order_seq_cst) == seen) {
+            break;
+        }
+        waiting_.store(true, std::memory_order_seq_cst);
+        wake_.wait(lock, [this, seen] {
+            return stopping_ || signals_.load(std::memory_order_seq_cst) != seen;
+        });
+        waiting_.store(false, std::memory_order_relaxed);
+    }
+}
+
+} // namespace core
+} // namespace skymesh
@@ -0,0 +1,361 @@
+/**
+ * @file orbit_power_planner.cpp
+ * @brief Implementation of the forward-looking orbit power planner
+ */
+
+#include "skymesh/core/orbit_power_planner.h"
+#include <algorithm>
+#include <cmath>
+
+namespace skymesh {
+namespace core {
+
+namespace {
+
+// Seconds as a double, for step arithmetic
+double toSeconds(std::chrono::system_clock::duration duration) {
+    return std::chrono::duration<double>(duration).count();
+}
+
+// Length of count steps, keeping the duration's signed representation
+std::chrono::seconds stepSpan(std::chrono::seconds step, size_t count) {
+    return step * static_cast<int64_t>(count);
+}
+
+} // anonymous namespace
+
+OrbitPowerPlanner::OrbitPowerPlanner(const PowerManager& powerManager, OrbitPlannerConfig config)
+    : powerManager(powerManager),
+      config(config) {
+}
+
+void OrbitPowerPlanner::addTask(const OrbitalTask& task) {
+    QueuedLoad load{task.task_id, task.scheduled_time, estimateDemand(task)};
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = std::find_if(loads.begin(), loads.end(),
+                           [&](const QueuedLoad& queued) { return queued.taskId == task.task_id; });
+    if (it != loads.end()) {
+        *it = std::move(load);
+    } else {
+        loads.push_back(std::move(load));
+    }
+}
+
+bool OrbitPowerPlanner::removeTask(const std::string& taskId) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = std::find_if(loads.begin(), loads.end(),
+                           [&](const QueuedLoad& queued) { return queued.taskId == taskId; });
+    if (it == loads.end()) {
+        return false;
+    }
+    loads.erase(it);
+    return true;
+}
+
+size_t OrbitPowerPlanner::syncPendingTasks(const OrbitalTaskManager& taskManager) {
+    // Copy the tasks out before taking the planner lock
+    std::vector<OrbitalTask> pending = taskManager.getTasksByStatus(TaskStatus::PENDING);
+    std::vector<QueuedLoad> pendingLoads;
+    pendingLoads.reserve(pending.size());
+    for (const OrbitalTask& task : pending) {
+        pendingLoads.push_back({task.task_id, task.scheduled_time, estimateDemand(task)});
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    loads = std::move(pendingLoads);
+    return loads.size();
+}
+
+bool OrbitPowerPlanner::plan(std::chrono::system_clock::time_point now) {
+    const PowerBudgetSnapshot snapshot = powerManager.getPowerBudgetSnapshot();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    decisions.clear();
+    const uint32_t period = snapshot.orbitSunlightSeconds + snapshot.orbitEclipseSeconds;
+    if (period == 0 || config.step.count() <= 0) {
+        planned = false;
+        return false;
+    }
+
+    updateGenerationTable(snapshot);
+    const size_t stepsPerOrbit = orbitGeneration.size();
+    const size_t horizonSteps = stepsPerOrbit * std::max<uint32_t>(config.horizon_orbits, 1);
+
+    // Where in the orbit the horizon starts
+    const double stepSeconds = static_cast<double>(config.step.count());
+    double phase = std::fmod(toSeconds(now - snapshot.orbitEpoch), static_cast<double>(period));
+    if (phase < 0.0) {
+        phase += period;
+    }
+    const size_t offset = static_cast<size_t>(phase / stepSeconds) % stepsPerOrbit;
+
+    // Lay the rotated orbit table along the horizon with plain copies, then
+    // take off the steady subsystem draw in one vectorizable pass
+    netPower.resize(horizonSteps);
+    size_t filled = 0;
+    size_t from = offset;
+    while (filled < horizonSteps) {
+        size_t count = std::min(stepsPerOrbit - from, horizonSteps - filled);
+        std::copy_n(orbitGeneration.begin() + from, count, netPower.begin() + filled);
+        filled += count;
+        from = 0;
+    }
+    const float baseline = snapshot.totalConsumption;
+    for (size_t i = 0; i < horizonSteps; ++i) {
+        netPower[i] -= baseline;
+    }
+
+    stateOfCharge.resize(horizonSteps);
+    suffixMinCharge.resize(horizonSteps);
+    modes.resize(horizonSteps);
+    horizonStart = now;
+    initialCharge = std::max(0.0f, std::min(1.0f, snapshot.batteryReserve / config.battery_capacity_wh));
+    initialMode = snapshot.currentMode;
+    integrateFrom(0);
+    planned = true;
+
+    // Admit queued loads in start order; each admitted load is drawn from
+    // the trajectory the following ones are checked against
+    std::vector<const QueuedLoad*> ordered;
+    ordered.reserve(loads.size());
+    for (const QueuedLoad& load : loads) {
+        ordered.push_back(&load);
+    }
+    std::stable_sort(ordered.begin(), ordered.end(),
+                     [](const QueuedLoad* a, const QueuedLoad* b) { return a->start < b->start; });
+
+    decisions.reserve(ordered.size());
+    for (const QueuedLoad* load : ordered) {
+        const size_t step = stepAt(load->start);
+        const bool inHorizon = load->start < horizonStart + stepSpan(config.step, horizonSteps);
+        const bool admitted = inHorizon && affordableAt(step, chargeFraction(load->demand));
+
+        if (admitted) {
+            double remaining = std::chrono::duration<double>(load->demand.duration).count();
+            for (size_t i = step; i < horizonSteps && remaining > 0.0; ++i) {
+                netPower[i] -= load->demand.average_power_w *
+                    static_cast<float>(std::min(remaining, stepSeconds) / stepSeconds);
+                remaining -= stepSeconds;
+            }
+            integrateFrom(step);
+        }
+
+        decisions.push_back({load->taskId, std::max(load->start, horizonStart), admitted,
+                             suffixMinCharge[step]});
+    }
+
+    return true;
+}
+
+std::vector<PowerModeSegment> OrbitPowerPlanner::modeTimeline() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<PowerModeSegment> timeline;
+    if (!planned) {
+        return timeline;
+    }
+
+    for (size_t i = 0; i < modes.size(); ++i) {
+        const auto stepStart = horizonStart + stepSpan(config.step, i);
+        if (timeline.empty() || timeline.back().mode != modes[i]) {
+            timeline.push_back({stepStart, stepStart + config.step, modes[i], stateOfCharge[i]});
+        } else {
+            timeline.back().end = stepStart + config.step;
+            timeline.back().min_state_of_charge = std::min(timeline.back().min_state_of_charge,
+                                                           stateOfCharge[i]);
+        }
+    }
+    return timeline;
+}
+
+PowerMode OrbitPowerPlanner::predictedModeAt(std::chrono::system_clock::time_point time) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!planned) {
+        return powerManager.getPowerBudgetSnapshot().currentMode;
+    }
+    return modes[stepAt(time)];
+}
+
+float OrbitPowerPlanner::predictedStateOfCharge(std::chrono::system_clock::time_point time) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!planned) {
+        return std::max(0.0f, std::min(1.0f, powerManager.getPowerBudgetSnapshot().batteryReserve /
+                                                 config.battery_capacity_wh));
+    }
+    return stateOfCharge[stepAt(time)];
+}
+
+std::optional<AdmissionDecision> OrbitPowerPlanner::decisionFor(const std::string& taskId) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const AdmissionDecision& decision : decisions) {
+        if (decision.task_id == taskId) {
+            return decision;
+        }
+    }
+    return std::nullopt;
+}
+
+bool OrbitPowerPlanner::canAfford(const OrbitalTask& task, const PlanningWindow& window) const {
+    return findAffordableStart(task, window).has_value();
+}
+
+std::optional<std::chrono::system_clock::time_point> OrbitPowerPlanner::findAffordableStart(
+    const OrbitalTask& task, const PlanningWindow& window) const {
+    if (window.end < window.start) {
+        return std::nullopt;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!planned) {
+        return window.start;
+    }
+
+    // A queued task already admitted inside the window keeps its slot
+    for (const AdmissionDecision& decision : decisions) {
+        if (decision.task_id == task.task_id && decision.admitted &&
+            decision.start >= window.start && decision.start <= window.end) {
+            return decision.start;
+        }
+    }
+
+    std::optional<size_t> step = findAffordableStep(task, window);
+    if (!step) {
+        return std::nullopt;
+    }
+    return std::max(window.start, horizonStart + stepSpan(config.step, *step));
+}
+
+TaskPowerDemand OrbitPowerPlanner::estimateDemand(const OrbitalTask& task) {
+    SubsystemID subsystem = SubsystemID::OBC;
+    switch (task.type) {
+        case TaskType::COMMUNICATION:
+            subsystem = SubsystemID::RF_SYSTEM;
+            break;
+        case TaskType::PAYLOAD_OPERATION:
+            subsystem = SubsystemID::PAYLOAD;
+            break;
+        case TaskType::ATTITUDE_CONTROL:
+        case TaskType::ORBITAL_MANEUVER:
+            subsystem = SubsystemID::ADCS;
+            break;
+        case TaskType::TELEMETRY:
+            subsystem = SubsystemID::SENSORS;
+            break;
+        case TaskType::POWER_MANAGEMENT:
+        case TaskType::HEALTH_CHECK:
+        case TaskType::MAINTENANCE:
+        case TaskType::FIRMWARE_UPDATE:
+            subsystem = SubsystemID::OBC;
+            break;
+    }
+
+    TaskPowerDemand demand{subsystem, subsystemPowerDraw(subsystem, 1.0f), subsystemPeakPower(subsystem),
+                           std::max(task.timeout, std::chrono::milliseconds(0))};
+
+    // Declared costs take precedence; a declared energy is spread over the
+    // timeout, or drawn within one second if the task has none
+    if (task.energy_cost_wh > 0.0f) {
+        demand.duration = std::max(demand.duration, std::chrono::milliseconds(1000));
+        const double hours = std::chrono::duration<double, std::ratio<3600>>(demand.duration).count();
+        demand.average_power_w = static_cast<float>(task.energy_cost_wh / hours);
+    }
+    if (task.peak_power_w > 0.0f) {
+        demand.peak_power_w = task.peak_power_w;
+    }
+    return demand;
+}
+
+void OrbitPowerPlanner::updateGenerationTable(const PowerBudgetSnapshot& snapshot) {
+    if (!orbitGeneration.empty() &&
+        tableSunlightSeconds == snapshot.orbitSunlightSeconds &&
+        tableEclipseSeconds == snapshot.orbitEclipseSeconds &&
+        tableSolarInput == snapshot.solarInputRate) {
+        return;
+    }
+
+    // Generation per step of one orbit, starting at sunrise; a step that
+    // straddles the terminator gets its sunlit fraction
+    const double stepSeconds = static_cast<double>(config.step.count());
+    const double sunlight = snapshot.orbitSunlightSeconds;
+    const double period = sunlight + snapshot.orbitEclipseSeconds;
+    const size_t steps = std::max<size_t>(1, static_cast<size_t>(std::ceil(period / stepSeconds)));
+
+    orbitGeneration.resize(steps);
+    for (size_t i = 0; i < steps; ++i) {
+        const double begin = i * stepSeconds;
+        const double sunlit = std::max(0.0, std::min(begin + stepSeconds, sunlight) - begin);
+        orbitGeneration[i] = snapshot.solarInputRate * static_cast<float>(sunlit / stepSeconds);
+    }
+
+    tableSunlightSeconds = snapshot.orbitSunlightSeconds;
+    tableEclipseSeconds = snapshot.orbitEclipseSeconds;
+    tableSolarInput = snapshot.solarInputRate;
+}
+
+void OrbitPowerPlanner::integrateFrom(size_t step) {
+    // Charge is clamped to the battery's range, which makes this a scan;
+    // the per-step inputs are prepared in flat arrays beforehand
+    const float chargePerWattStep = (static_cast<float>(config.step.count()) / 3600.0f) /
+                                    config.battery_capacity_wh;
+    const size_t count = stateOfCharge.size();
+
+    float charge = step == 0 ? initialCharge : stateOfCharge[step - 1];
+    PowerMode mode = modeBefore(step);
+    for (size_t i = step; i < count; ++i) {
+        charge = std::max(0.0f, std::min(1.0f, charge + netPower[i] * chargePerWattStep));
+        mode = automaticPowerMode(mode, charge);
+        stateOfCharge[i] = charge;
+        modes[i] = mode;
+    }
+
+    float lowest = 1.0f;
+    for (size_t i = count; i-- > 0;) {
+        lowest = std::min(lowest, stateOfCharge[i]);
+        suffixMinCharge[i] = lowest;
+    }
+}
+
+size_t OrbitPowerPlanner::stepAt(std::chrono::system_clock::time_point time) const {
+    if (time <= horizonStart || modes.empty()) {
+        return 0;
+    }
+    const auto step = static_cast<size_t>((time - horizonStart) / config.step);
+    return std::min(step, modes.size() - 1);
+}
+
+float OrbitPowerPlanner::chargeFraction(const TaskPowerDemand& demand) const {
+    const double hours = std::chrono::duration<double, std::ratio<3600>>(demand.duration).count();
+    return static_cast<float>(demand.average_power_w * hours) / config.battery_capacity_wh;
+}
+
+PowerMode OrbitPowerPlanner::modeBefore(size_t step) const {
+    return step == 0 ? initialMode : modes[step - 1];
+}
+
+bool OrbitPowerPlanner::affordableAt(size_t step, float charge) const {
+    // Conservative: the whole task energy is taken from the lowest point
+    // ahead, ignoring any of it that charging at full would have absorbed
+    return modeBefore(step) == PowerMode::NORMAL &&
+           suffixMinCharge[step] - charge >= config.reserve_state_of_charge;
+}
+
+std::optional<size_t> OrbitPowerPlanner::findAffordableStep(const OrbitalTask& task,
+                                                            const PlanningWindow& window) const {
+    const auto horizonEnd = horizonStart + stepSpan(config.step, modes.size());
+    if (window.start >= horizonEnd || window.end < horizonStart) {
+        return std::nullopt;
+    }
+
+    const float charge = chargeFraction(estimateDemand(task));
+    const size_t first = stepAt(window.start);
+    const size_t last = stepAt(window.end);
+    for (size_t step = first; step <= last; ++step) {
+        if (affordableAt(step, charge)) {
+            return step;
+        }
+    }
+    return std::nullopt;
+}
+
+} // namespace core
+} // namespace skymesh
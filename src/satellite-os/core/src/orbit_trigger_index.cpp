@@ -0,0 +1,185 @@
+/**
+ * @file orbit_trigger_index.cpp
+ * @brief Implementation of the orbit-position trigger grid
+ */
+
+#include "skymesh/core/orbit_trigger_index.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace skymesh {
+namespace core {
+
+namespace {
+
+// Wrap an angle difference into [-180, 180)
+double wrap_degrees(double degrees) {
+    double wrapped = std::fmod(degrees + 180.0, 360.0);
+    if (wrapped < 0.0) {
+        wrapped += 360.0;
+    }
+    return wrapped - 180.0;
+}
+
+// Clip the parametric range [t_min, t_max] of p0 + t * d to [lo, hi]
+bool clip_axis(double p0, double d, double lo, double hi, double& t_min, double& t_max) {
+    if (d == 0.0) {
+        return p0 >= lo && p0 <= hi;
+    }
+
+    double t1 = (lo - p0) / d;
+    double t2 = (hi - p0) / d;
+    if (t1 > t2) {
+        std::swap(t1, t2);
+    }
+
+    t_min = std::max(t_min, t1);
+    t_max = std::min(t_max, t2);
+    return t_min <= t_max;
+}
+
+} // anonymous namespace
+
+OrbitTriggerIndex::OrbitTriggerIndex(double cell_size_deg)
+    : cell_size_deg_(cell_size_deg > 0.0 ? cell_size_deg : 2.0) {
+    lat_cells_ = static_cast<int>(std::ceil(180.0 / cell_size_deg_));
+    lon_cells_ = static_cast<int>(std::ceil(360.0 / cell_size_deg_));
+}
+
+void OrbitTriggerIndex::insert(uint64_t id, const OrbitPosition& target,
+                               double position_tolerance_deg, double altitude_tolerance_km) {
+    remove(id);
+
+    Trigger trigger;
+    trigger.latitude = target.latitude;
+    trigger.longitude = wrap_degrees(target.longitude);
+    trigger.altitude_km = target.altitude_km;
+    trigger.position_tolerance_deg = std::abs(position_tolerance_deg);
+    trigger.altitude_tolerance_km = std::abs(altitude_tolerance_km);
+
+    collectCells(trigger.latitude - trigger.position_tolerance_deg,
+                 trigger.latitude + trigger.position_tolerance_deg,
+                 trigger.longitude - trigger.position_tolerance_deg,
+                 trigger.longitude + trigger.position_tolerance_deg,
+                 trigger.cells);
+
+    for (uint64_t cell : trigger.cells) {
+        cells_[cell].push_back(id);
+    }
+
+    triggers_.emplace(id, std::move(trigger));
+}
+
+bool OrbitTriggerIndex::remove(uint64_t id) {
+    auto it = triggers_.find(id);
+    if (it == triggers_.end()) {
+        return false;
+    }
+
+    for (uint64_t cell : it->second.cells) {
+        auto cell_it = cells_.find(cell);
+        if (cell_it == cells_.end()) {
+            continue;
+        }
+
+        auto& ids = cell_it->second;
+        auto pos = std::find(ids.begin(), ids.end(), id);
+        if (pos != ids.end()) {
+            *pos = ids.back();
+            ids.pop_back();
+        }
+        if (ids.empty()) {
+            cells_.erase(cell_it);
+        }
+    }
+
+    triggers_.erase(it);
+    return true;
+}
+
+void OrbitTriggerIndex::querySegment(const OrbitPosition& previous, const OrbitPosition& current,
+                                     std::vector<uint64_t>& hits) const {
+    if (triggers_.empty()) {
+        return;
+    }
+
+    // Travel the shorter way around in longitude
+    double lat0 = previous.latitude;
+    double lon0 = wrap_degrees(previous.longitude);
+    double alt0 = previous.altitude_km;
+    double dlat = current.latitude - previous.latitude;
+    double dlon = wrap_degrees(current.longitude - previous.longitude);
+    double dalt = current.altitude_km - previous.altitude_km;
+
+    std::vector<uint64_t> cells;
+    collectCells(std::min(lat0, lat0 + dlat), std::max(lat0, lat0 + dlat),
+                 std::min(lon0, lon0 + dlon), std::max(lon0, lon0 + dlon),
+                 cells);
+
+    // A trigger spanning several swept cells is tested once
+    std::vector<uint64_t> candidates;
+    for (uint64_t cell : cells) {
+        auto it = cells_.find(cell);
+        if (it != cells_.end()) {
+            candidates.insert(candidates.end(), it->second.begin(), it->second.end());
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    for (uint64_t id : candidates) {
+        const Trigger& trigger = triggers_.at(id);
+        if (segmentHitsTrigger(trigger, lat0, lon0, alt0, dlat, dlon, dalt)) {
+            hits.push_back(id);
+        }
+    }
+}
+
+void OrbitTriggerIndex::collectCells(double lat_lo, double lat_hi, double lon_lo, double lon_hi,
+                                     std::vector<uint64_t>& cells) const {
+    int lat_first = static_cast<int>(std::floor((std::max(lat_lo, -90.0) + 90.0) / cell_size_deg_));
+    int lat_last = static_cast<int>(std::floor((std::min(lat_hi, 90.0) + 90.0) / cell_size_deg_));
+    lat_first = std::max(0, std::min(lat_first, lat_cells_ - 1));
+    lat_last = std::max(0, std::min(lat_last, lat_cells_ - 1));
+
+    // Longitude cells are counted unwrapped, then folded back onto the grid
+    long lon_first = static_cast<long>(std::floor((lon_lo + 180.0) / cell_size_deg_));
+    long lon_last = static_cast<long>(std::floor((lon_hi + 180.0) / cell_size_deg_));
+    lon_last = std::min(lon_last, lon_first + lon_cells_ - 1);
+
+    for (int lat_cell = lat_first; lat_cell <= lat_last; ++lat_cell) {
+        for (long k = lon_first; k <= lon_last; ++k) {
+            long lon_cell = ((k % lon_cells_) + lon_cells_) % lon_cells_;
+            cells.push_back((static_cast<uint64_t>(lat_cell) << 32) | static_cast<uint64_t>(lon_cell));
+        }
+    }
+}
+
+bool OrbitTriggerIndex::segmentHitsTrigger(const Trigger& trigger,
+                                           double lat0, double lon0, double alt0,
+                                           double dlat, double dlon, double dalt) {
+    // Place the trigger on the same side of the antimeridian as the segment,
+    // also trying its neighbours for boxes that straddle the wrap
+    double nearest_lon = lon0 + wrap_degrees(trigger.longitude - lon0);
+
+    for (double shift : {0.0, -360.0, 360.0}) {
+        double lon = nearest_lon + shift;
+        double t_min = 0.0;
+        double t_max = 1.0;
+
+        if (clip_axis(lat0, dlat, trigger.latitude - trigger.position_tolerance_deg,
+                      trigger.latitude + trigger.position_tolerance_deg, t_min, t_max) &&
+            clip_axis(lon0, dlon, lon - trigger.position_tolerance_deg,
+                      lon + trigger.position_tolerance_deg, t_min, t_max) &&
+            clip_axis(alt0, dalt, trigger.altitude_km - trigger.altitude_tolerance_km,
+                      trigger.altitude_km + trigger.altitude_tolerance_km, t_min, t_max)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace core
+} // namespace skymesh
@@ -8,13 +8,23 @@
  */
 
 #include "skymesh/core/orbital_task_manager.h"
+#include "skymesh/core/checkpoint_store.h"
+#include "skymesh/core/notification_bus.h"
+#include "skymesh/core/orbit_trigger_index.h"
+#include "skymesh/core/task_result_store.h"
+#include "skymesh/core/logger.h"
+#include "skymesh/core/metrics.h"
 
+#include <algorithm>
+#include <atomic>
+#include <array>
 #include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <fstream>
 #include <functional>
 #include <iomanip>
-#include <iostream>
 #include <mutex>
-#include <queue>
 #include <random>
 #include <sstream>
 #include <thread>
@@ -26,19 +36,134 @@
 #include <sstream>
 #include <iomanip>
 
-// Forward declarations for internal logging
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// Forward declarations for internal helpers
 namespace {
-    void log_debug(const std::string& message);
-    void log_info(const std::string& message);
-    void log_warning(const std::string& message);
-    void log_error(const std::string& message);
-    std::string generate_task_id();
+    constexpr const char* kLogComponent = "orbital_task_manager";
+    
+    std::string generate_task_id(uint64_t handle);
     std::string timestamp_to_string(const std::chrono::system_clock::time_point& time);
+    bool parse_task_priority(const std::string& name, skymesh::core::TaskPriority& priority);
+    bool parse_task_type(const std::string& name, skymesh::core::TaskType& type);
+    std::map<skymesh::core::TaskType, uint32_t> default_type_limits();
 }
 
 namespace skymesh {
 namespace core {
 
+/**
+ * @brief Worker threads for concurrent TMR replicas.
+ *
+ * Replica i of a task is always submitted to slot i, and each slot has its
+ * own threads, optionally pinned to a dedicated core. Queued replicas are
+ * still run when the pool stops.
+ */
+class TmrReplicaPool {
+public:
+    static constexpr size_t kSlotCount = 3;
+
+    ~TmrReplicaPool() {
+        stop();
+    }
+
+    void start(uint32_t threads_per_slot, bool pin_slots) {
+        unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+        
+        for (size_t i = 0; i < kSlotCount; ++i) {
+            Slot& slot = slots_[i];
+            {
+                std::lock_guard<std::mutex> lock(slot.mutex);
+                slot.running = true;
+            }
+            for (uint32_t t = 0; t < std::max(1u, threads_per_slot); ++t) {
+                slot.threads.emplace_back(&TmrReplicaPool::slotThread, this, std::ref(slot));
+                if (pin_slots) {
+                    pinThread(slot.threads.back(), static_cast<unsigned>(i % cores));
+                }
+            }
+        }
+    }
+
+    void stop() {
+        for (Slot& slot : slots_) {
+            {
+                std::lock_guard<std::mutex> lock(slot.mutex);
+                slot.running = false;
+            }
+            slot.condition.notify_all();
+            for (auto& thread : slot.threads) {
+                if (thread.joinable()) {
+                    thread.join();
+                }
+            }
+            slot.threads.clear();
+        }
+    }
+
+    // Run a replica on the given slot; falls back to the caller if stopped
+    void submit(size_t slot_index, std::function<void()> job) {
+        Slot& slot = slots_[slot_index % kSlotCount];
+        {
+            std::lock_guard<std::mutex> lock(slot.mutex);
+            if (slot.running) {
+                slot.jobs.push_back(std::move(job));
+                job = nullptr;
+            }
+        }
+        
+        if (job) {
+            job();
+        } else {
+            slot.condition.notify_one();
+        }
+    }
+
+private:
+    struct Slot {
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::deque<std::function<void()>> jobs;
+        std::vector<std::thread> threads;
+        bool running = false;
+    };
+
+    void slotThread(Slot& slot) {
+        std::unique_lock<std::mutex> lock(slot.mutex);
+        for (;;) {
+            slot.condition.wait(lock, [&slot] { return !slot.jobs.empty() || !slot.running; });
+            if (slot.jobs.empty()) {
+                return;
+            }
+            
+            std::function<void()> job = std::move(slot.jobs.front());
+            slot.jobs.pop_front();
+            lock.unlock();
+            job();
+            lock.lock();
+        }
+    }
+
+    static void pinThread(std::thread& thread, unsigned core) {
+#ifdef __linux__
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(core, &cpus);
+        if (pthread_setaffinity_np(thread.native_handle(), sizeof(cpus), &cpus) != 0) {
+            SKYMESH_LOG_WARNING(kLogComponent, "Could not pin TMR replica thread to core ", core);
+        }
+#else
+        (void)thread;
+        (void)core;
+#endif
+    }
+
+    std::array<Slot, kSlotCount> slots_;
+};
+
 /**
  * @brief Implementation of the OrbitalTaskManager interface.
  * 
@@ -47,35 +172,49 @@ namespace core {
  */
 class OrbitalTaskManagerImpl : public OrbitalTaskManager {
 public:
-    OrbitalTaskManagerImpl();
+    explicit OrbitalTaskManagerImpl(std::shared_ptr<NotificationBus> notification_bus);
     ~OrbitalTaskManagerImpl() override;
 
     // Interface implementation
     bool initialize(const std::string& config_path) override;
+    bool configureExecutionPool(const ExecutionPoolConfig& config) override;
+    void setAdmissionPolicy(std::shared_ptr<TaskAdmissionPolicy> policy) override;
     bool start() override;
     void stop() override;
     std::string scheduleTask(const OrbitalTask& task) override;
+    std::string scheduleTask(OrbitalTask&& task) override;
+    std::vector<std::string> scheduleTasks(std::vector<OrbitalTask>&& tasks) override;
     std::string scheduleConditionalTask(const OrbitalTask& task, const TriggerCondition& trigger) override;
     std::string scheduleRecurringTask(const OrbitalTask& task, std::chrono::milliseconds interval) override;
     bool cancelTask(const std::string& task_id) override;
+    size_t cancelTasks(const std::vector<std::string>& task_ids) override;
     bool suspendTask(const std::string& task_id) override;
     bool resumeTask(const std::string& task_id) override;
     TaskStatus getTaskStatus(const std::string& task_id) const override;
     std::optional<TaskResult> getTaskResult(const std::string& task_id) const override;
     std::vector<OrbitalTask> getAllScheduledTasks() const override;
     std::vector<OrbitalTask> getTasksByStatus(TaskStatus status) const override;
+    size_t visitTasks(std::optional<TaskStatus> status,
+                      const std::function<bool(const TaskSummary&)>& visitor) const override;
+    size_t visitTaskResults(const std::function<bool(const TaskResult&)>& visitor) const override;
+    void configureResultRetention(const ResultRetentionPolicy& policy) override;
     int registerCompletionCallback(TaskCompletionCallback callback, TaskType task_type) override;
     void unregisterCompletionCallback(int callback_id) override;
     void updateOrbitalPosition(const OrbitPosition& position) override;
     OrbitPosition getCurrentOrbitalPosition() const override;
+    size_t publishEvent(const std::string& event_name) override;
     bool recoverTask(const std::string& task_id, RecoveryStrategy strategy) override;
+    TaskMetrics getTaskMetrics() const override;
     bool reportTaskMetrics() override;
+    bool saveCheckpoint(CheckpointStore& store) override;
+    size_t restoreCheckpoint(const CheckpointStore& store, const TaskFunctionResolver& resolver) override;
 
 private:
     // Internal task structure with additional metadata
     struct TaskEntry {
-        OrbitalTask task;
+        OrbitalTask task;                  // Fixed once scheduled, except metadata (tasks_mutex_)
         TaskStatus status;
+        std::chrono::system_clock::time_point deadline;  // Guarded by queue_mutex_; next dispatch time
         std::chrono::system_clock::time_point actual_start_time;
         std::chrono::system_clock::time_point actual_end_time;
         std::string error_message;
@@ -85,103 +224,270 @@ private:
         std::chrono::milliseconds recurring_interval;
         TriggerCondition trigger_condition;
         bool radiation_event_detected;
-        
-        // Comparison operator for priority queue
-        bool operator<(const TaskEntry& other) const {
-            // If priorities differ, higher priority tasks come first
-            if (task.priority != other.task.priority) {
-                return task.priority > other.task.priority;
+        uint64_t handle = 0;               // Compact 64-bit identity, used by internal indices
+        TaskContext context;               // Limits parsed from metadata at schedule time
+        TaskResult result;                 // Last run, filled in place by the worker running it
+        bool queued = false;               // Guarded by queue_mutex_; true while in a queue or coalesced group
+        bool admitted = false;             // Guarded by queue_mutex_; passed admission, dispatch without asking again
+        bool trigger_fired = false;        // Guarded by trigger_mutex_; conditional task released
+        bool in_orbit_index = false;       // Guarded by trigger_mutex_; indexed under handle
+        size_t status_slot = kNotIndexed;  // Guarded by tasks_mutex_; position in status_index_
+    };
+
+    // Heap order for the ready queue: the front is the task to dispatch next.
+    // Higher priority (lower enum value) first, then earliest deadline.
+    struct ReadyOrder {
+        bool operator()(const std::shared_ptr<TaskEntry>& a, const std::shared_ptr<TaskEntry>& b) const {
+            if (a->task.priority != b->task.priority) {
+                return a->task.priority > b->task.priority;
             }
-            
-            // Otherwise, earlier scheduled tasks come first
-            return task.scheduled_time < other.task.scheduled_time;
+            return a->deadline > b->deadline;
         }
     };
 
-    // Task comparison for priority queue
-    struct TaskComparator {
+    // Heap order for the timer queue: the front is the earliest deadline.
+    struct DeadlineOrder {
         bool operator()(const std::shared_ptr<TaskEntry>& a, const std::shared_ptr<TaskEntry>& b) const {
-            return *b < *a; // Reverse comparison for min-heap (we want max priority at top)
+            return a->deadline > b->deadline;
         }
     };
 
-    // Callback entry structure
-    struct CallbackEntry {
-        int id;
-        TaskCompletionCallback callback;
-        TaskType filter_type;
+    // Shared state of one TMR execution. Replicas that outlive an early
+    // return keep it, and the task entry, alive until they finish.
+    struct TmrVote {
+        std::shared_ptr<TaskEntry> task_entry;
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::array<int8_t, TmrReplicaPool::kSlotCount> outcomes{{-1, -1, -1}};  // -1 = still running
+        uint32_t launched = 0;
+        uint32_t finished = 0;
+        bool fault_seen = false;       // A replica threw
+        bool decided = false;          // The caller has returned with `decision`
+        bool decision = false;
     };
 
-    // Thread for task execution
-    void taskExecutionThread();
+    // Tasks of one type held by the admission stage for a joint release
+    struct CoalesceGroup {
+        std::vector<std::shared_ptr<TaskEntry>> members;
+        std::chrono::system_clock::time_point release_at;
+        uint32_t batch_size = 0;
+    };
+    
+    // Number of TaskPriority and TaskType values, for lane and limit tables
+    static constexpr size_t kPriorityCount = static_cast<size_t>(TaskPriority::IDLE) + 1;
+    static constexpr size_t kTaskTypeCount = static_cast<size_t>(TaskType::FIRMWARE_UPDATE) + 1;
+    static constexpr size_t kStatusCount = kTaskStatusCount;
+    
+    // Status slot of an entry that is not (or no longer) in task_map_
+    static constexpr size_t kNotIndexed = static_cast<size_t>(-1);
+    
+    // Registry histogram of run times for each task type
+    static std::array<LatencyHistogram*, kTaskTypeCount> runtimeHistograms();
+    
+    // Worker thread for task execution
+    void workerThread();
+    
+    // Run a dispatched task to completion and give back its worker slot
+    void runTask(const std::shared_ptr<TaskEntry>& task_entry);
+    
+    // Run every dispatchable task inline on the executor, then re-arm for the next deadline
+    void dispatchOnExecutor();
+    
+    // Post a dispatch pass for the earliest pending work, unless one is due sooner (queue_mutex_ must be held)
+    void scheduleDispatchLocked(bool ready_now);
+    
+    // Wake a worker, or all of them; on an executor, post a dispatch pass instead
+    void notifyWorkers(bool all = false);
+    
+    // Time on the executor's clock, or the wall clock
+    std::chrono::system_clock::time_point currentTime() const;
+    
+    // Pop the next dispatchable task honoring admission, reservations and type limits (queue_mutex_ must be held)
+    std::shared_ptr<TaskEntry> takeNextReadyLocked(std::chrono::system_clock::time_point now);
+    
+    // Apply the admission policy to a due task; false if it was deferred or coalesced (queue_mutex_ must be held)
+    bool admitTaskLocked(std::shared_ptr<TaskEntry>& task_entry, std::chrono::system_clock::time_point now);
+    
+    // Move a coalesced group to the ready lanes (queue_mutex_ must be held)
+    void releaseGroupLocked(size_t type);
     
-    // Thread for task scheduling and condition evaluation
-    void taskSchedulingThread();
+    // Earliest timer deadline or group release, if any (queue_mutex_ must be held)
+    std::optional<std::chrono::system_clock::time_point> nextWakeLocked() const;
     
-    // Execute a single task with radiation protection if needed
-    TaskResult executeTask(const std::shared_ptr<TaskEntry>& task_entry);
+    // Release the worker slot held by a dispatched task (queue_mutex_ must be held)
+    void releaseWorkerSlotLocked(const std::shared_ptr<TaskEntry>& task_entry);
     
-    // Evaluate if a task with trigger conditions should be executed
-    bool shouldExecuteConditionalTask(const TriggerCondition& condition) const;
+    // Load worker pool settings from a key=value configuration file
+    bool loadConfigFile(const std::string& config_path);
     
-    // Execute a function with Triple Modular Redundancy
-    bool executeWithTMR(const std::function<bool(const TaskContext&)>& func, const TaskContext& context);
+    // Build a pending task entry; fails if the metadata limits cannot be parsed
+    std::shared_ptr<TaskEntry> createTaskEntry(OrbitalTask&& task);
+    
+    // Add a task to the map and status index, replacing any entry with its ID (tasks_mutex_ must be held)
+    void insertTaskLocked(const std::shared_ptr<TaskEntry>& task_entry);
+    
+    // Change a task's status and move it between status indices (tasks_mutex_ must be held)
+    void setStatusLocked(TaskEntry& task_entry, TaskStatus status);
+    
+    // Remove a task from the status index (tasks_mutex_ must be held)
+    void unindexStatusLocked(TaskEntry& task_entry);
+    
+    // Forget completed and canceled one-shot tasks whose results were evicted,
+    // leaving a tombstone (tasks_mutex_ must be held)
+    void forgetEvictedTasksLocked(const std::vector<std::string>& task_ids);
+    
+    // Final status of a forgotten task (tasks_mutex_ must be held)
+    std::optional<TaskStatus> tombstoneLocked(const std::string& task_id) const;
+    
+    // Copy tasks out with their current deadlines (tasks_mutex_ must be held)
+    std::vector<OrbitalTask> copyTasksLocked(const std::vector<const TaskEntry*>& entries) const;
+    
+    // Cancel one task (tasks_mutex_ and trigger_mutex_ must be held)
+    bool cancelTaskLocked(const std::string& task_id);
+    
+    // Execute a single task with radiation protection if needed, filling task_entry->result
+    void executeTask(const std::shared_ptr<TaskEntry>& task_entry);
+    
+    // Index a conditional task under each of its triggers (tasks_mutex_ and trigger_mutex_ must be held)
+    void armTriggersLocked(const std::shared_ptr<TaskEntry>& task_entry);
+    
+    // Release a conditional task whose trigger was satisfied (trigger_mutex_ must be held)
+    bool fireTriggerLocked(const std::shared_ptr<TaskEntry>& task_entry,
+                           std::chrono::system_clock::time_point now);
+    
+    // Release conditional tasks waiting on a task that just completed
+    void fireDependentTasks(const std::string& task_id);
+    
+    // Execute a task's function with Triple Modular Redundancy in its configured mode
+    bool executeWithTMR(const std::shared_ptr<TaskEntry>& task_entry, bool& radiation_detected);
+    
+    // Start one TMR replica, inline or on its replica slot
+    void launchTmrReplica(const std::shared_ptr<TmrVote>& vote, size_t replica, bool inline_run);
+    
+    // Run one TMR replica and record its outcome in the vote
+    void runTmrReplica(const std::shared_ptr<TmrVote>& vote, size_t replica);
     
     // Create a task result structure from a task entry
     TaskResult createTaskResult(const std::shared_ptr<TaskEntry>& task_entry) const;
     
     // Notify all registered callbacks about task completion
-    void notifyTaskCompletion(const TaskResult& result);
+    void notifyTaskCompletion(const TaskResult& result, TaskType task_type);
     
-    // Check if a position matches the orbit trigger condition
-    bool matchesOrbitPosition(const OrbitPosition& current, const OrbitPosition& trigger) const;
+    // Drop a conditional task from the orbit trigger index (trigger_mutex_ must be held)
+    void removeOrbitTriggerLocked(const std::shared_ptr<TaskEntry>& task_entry);
     
-    // Thread-safe task storage
-    mutable std::mutex tasks_mutex_;
-    std::unordered_map<std::string, std::shared_ptr<TaskEntry>> task_map_;
+    // Route a task to the ready queue or the timer queue (queue_mutex_ must be held)
+    void enqueueTaskLocked(const std::shared_ptr<TaskEntry>& task_entry,
+                           std::chrono::system_clock::time_point now);
+    
+    // Route a batch of tasks, rebuilding each touched heap once (queue_mutex_ must be held)
+    void enqueueTasksLocked(const std::vector<std::shared_ptr<TaskEntry>>& task_entries,
+                            std::chrono::system_clock::time_point now);
     
-    // Priority queue for scheduled tasks
-    std::mutex queue_mutex_;
-    std::priority_queue<std::shared_ptr<TaskEntry>, 
-                        std::vector<std::shared_ptr<TaskEntry>>, 
-                        TaskComparator> task_queue_;
+    // Move due timers and coalesced groups into the ready queue (queue_mutex_ must be held)
+    void promoteDueTasksLocked(std::chrono::system_clock::time_point now);
     
-    // Conditional tasks waiting for trigger conditions
-    std::vector<std::shared_ptr<TaskEntry>> conditional_tasks_;
+    // Append a task's checkpoint record; 0 if it does not fit (tasks_mutex_, trigger_mutex_, queue_mutex_ held)
+    static size_t writeCheckpointRecordLocked(const TaskEntry& task_entry, uint8_t* out, size_t room);
     
-    // Completed task results
+    // Thread-safe task storage
+    std::atomic<uint64_t> next_task_handle_{1};
+    mutable std::mutex tasks_mutex_;
+    std::unordered_map<std::string, std::shared_ptr<TaskEntry>> task_map_;
+    std::array<std::vector<TaskEntry*>, kStatusCount> status_index_;  // Entries of task_map_ by status
+    
+    // Final status of forgotten tasks, for status queries and dependents
+    // scheduled later; the oldest are dropped past kMaxTombstones
+    static constexpr size_t kMaxTombstones = 4096;
+    std::unordered_map<std::string, TaskStatus> tombstones_;
+    std::deque<std::string> tombstone_order_;
+    
+    // Bumped by every change a checkpoint records, so unchanged saves are skipped
+    std::atomic<uint64_t> state_version_{0};
+    std::mutex checkpoint_mutex_;                           // Serializes saves
+    const CheckpointStore* checkpointed_store_ = nullptr;   // Guarded by checkpoint_mutex_
+    uint64_t checkpointed_version_ = 0;                     // Guarded by checkpoint_mutex_
+    
+    // Two-level dispatch queue: tasks that are due wait in per-priority ready
+    // lanes, tasks scheduled for the future wait in a deadline-ordered timer
+    // heap. A future task can never block a ready one.
+    mutable std::mutex queue_mutex_;
+    std::array<std::vector<std::shared_ptr<TaskEntry>>, kPriorityCount> ready_lanes_;  // Heaps ordered by ReadyOrder
+    std::vector<std::shared_ptr<TaskEntry>> timer_queue_;  // Heap ordered by DeadlineOrder
+    
+    // Ready tasks parked because their type is at its concurrency limit
+    std::array<std::vector<std::shared_ptr<TaskEntry>>, kTaskTypeCount> type_blocked_;
+    
+    // Admission stage and the groups it is holding (guarded by queue_mutex_)
+    std::shared_ptr<TaskAdmissionPolicy> admission_policy_;
+    std::array<CoalesceGroup, kTaskTypeCount> coalesce_groups_;
+    
+    // Worker pool accounting (guarded by queue_mutex_)
+    ExecutionPoolConfig pool_config_;
+    std::array<uint32_t, kPriorityCount> lane_capacity_{};     // Max busy workers when taking from a lane
+    std::array<uint32_t, kTaskTypeCount> type_limit_{};        // 0 = unlimited
+    std::array<uint32_t, kTaskTypeCount> running_by_type_{};
+    uint32_t busy_workers_{0};
+    
+    // Conditional tasks indexed by trigger kind; time triggers wait in timer_queue_
+    std::mutex trigger_mutex_;
+    std::unordered_map<std::string, std::vector<std::shared_ptr<TaskEntry>>> dependency_triggers_;
+    std::unordered_map<std::string, std::vector<std::shared_ptr<TaskEntry>>> event_triggers_;
+    OrbitTriggerIndex orbit_index_;
+    std::unordered_map<uint64_t, std::shared_ptr<TaskEntry>> orbit_triggers_;
+    
+    // Last position seen by the trigger engine, for crossings between samples
+    OrbitPosition last_trigger_sample_;
+    bool has_trigger_sample_{false};
+    
+    // Completed task results, bounded by the retention policy
     mutable std::mutex results_mutex_;
-    std::unordered_map<std::string, TaskResult> task_results_;
+    TaskResultStore result_store_;
     
     // Thread synchronization
     std::condition_variable queue_condition_;
     std::mutex execution_mutex_;
-    std::condition_variable execution_condition_;
     
-    // Execution thread
-    std::thread execution_thread_;
-    std::thread scheduling_thread_;
+    // Worker pool
+    std::vector<std::thread> workers_;
+    TmrReplicaPool tmr_pool_;
     std::atomic<bool> running_{false};
     
+    // Executor replacing the workers, set while stopped; the pending pass is guarded by queue_mutex_
+    std::shared_ptr<Executor> executor_;
+    TimerId dispatch_timer_ = 0;
+    std::chrono::system_clock::time_point dispatch_due_;
+    bool dispatching_ = false;
+    
     // Current orbital position
     mutable std::mutex position_mutex_;
     OrbitPosition current_position_;
     
-    // Task completion callbacks
-    mutable std::mutex callback_mutex_;
-    std::vector<CallbackEntry> callbacks_;
-    int next_callback_id_{0};
+    // Task completion callbacks, delivered on the bus thread
+    std::shared_ptr<NotificationBus> notification_bus_;
+    NotificationTopic<TaskResult, TaskType> completion_topic_;
     
     // Task execution metrics
     std::atomic<uint64_t> tasks_executed_{0};
     std::atomic<uint64_t> tasks_failed_{0};
     std::atomic<uint64_t> radiation_events_{0};
     
+    // Registry metrics, shared by every task manager in the process
+    LatencyHistogram& tasks_lock_wait_ = MetricsRegistry::instance().histogram("task.tasks_mutex_wait_ns");
+    LatencyHistogram& queue_lock_wait_ = MetricsRegistry::instance().histogram("task.queue_mutex_wait_ns");
+    LatencyHistogram& dispatch_latency_ = MetricsRegistry::instance().histogram("task.dispatch_latency_ns");
+    std::array<LatencyHistogram*, kTaskTypeCount> runtime_by_type_ = runtimeHistograms();
+    MetricCounter& executed_counter_ = MetricsRegistry::instance().counter("task.executed");
+    MetricCounter& failed_counter_ = MetricsRegistry::instance().counter("task.failed");
+    MetricCounter& radiation_counter_ = MetricsRegistry::instance().counter("task.radiation_events");
+    
     // Default task context when none provided
     TaskContext default_context_;
 };
 
-OrbitalTaskManagerImpl::OrbitalTaskManagerImpl() {
+OrbitalTaskManagerImpl::OrbitalTaskManagerImpl(std::shared_ptr<NotificationBus> notification_bus)
+    : notification_bus_(notification_bus ? std::move(notification_bus) : std::make_shared<NotificationBus>()),
+      completion_topic_(kLogComponent, notification_bus_) {
     // Initialize default task context
     default_context_.memory_limit_bytes = 1024 * 1024; // 1MB
     default_context_.cpu_time_limit_ms = 5000; // 5 seconds
@@ -193,7 +499,9 @@ OrbitalTaskManagerImpl::OrbitalTaskManagerImpl() {
     current_position_.latitude = 0.0;
     current_position_.longitude = 0.0;
     current_position_.velocity_kmps = 7.6; // Typical LEO velocity
-    current_position_.timestamp = std::chrono::system_clock::now();
+    current_position_.timestamp = currentTime();
+    
+    pool_config_.max_concurrent_by_type = default_type_limits();
 }
 
 OrbitalTaskManagerImpl::~OrbitalTaskManagerImpl() {
@@ -201,34 +509,183 @@ OrbitalTaskManagerImpl::~OrbitalTaskManagerImpl() {
 }
 
 bool OrbitalTaskManagerImpl::initialize(const std::string& config_path) {
-    log_info("Initializing OrbitalTaskManager" + 
-             (config_path.empty() ? "" : " with config: " + config_path));
+    SKYMESH_LOG_INFO(kLogComponent, "Initializing OrbitalTaskManager",
+                     config_path.empty() ? "" : " with config: ", config_path);
     
     // Load configuration if provided
-    if (!config_path.empty()) {
-        // Config file processing would go here
-        // For now, we'll just use default settings
+    if (!config_path.empty() && !loadConfigFile(config_path)) {
+        SKYMESH_LOG_WARNING(kLogComponent, "Could not load config file, using default settings: ", config_path);
+    }
+    
+    return true;
+}
+
+bool OrbitalTaskManagerImpl::configureExecutionPool(const ExecutionPoolConfig& config) {
+    std::lock_guard<std::mutex> lock(execution_mutex_);
+    
+    if (running_) {
+        SKYMESH_LOG_ERROR(kLogComponent, "Cannot configure execution pool: OrbitalTaskManager already running");
+        return false;
+    }
+    
+    uint32_t workers = config.worker_count;
+    if (workers == 0) {
+        workers = std::max(1u, std::thread::hardware_concurrency());
+    }
+    
+    uint32_t total_reserved = 0;
+    for (const auto& reservation : config.reserved_workers) {
+        total_reserved += reservation.second;
+    }
+    
+    if (total_reserved >= workers) {
+        SKYMESH_LOG_ERROR(kLogComponent, "Invalid execution pool: ", total_reserved,
+                          " reserved workers leave none for lower priorities (pool size ",
+                          workers, ")");
+        return false;
     }
     
+    // Type limits the caller leaves out keep their defaults
+    std::map<TaskType, uint32_t> type_limits = default_type_limits();
+    for (const auto& limit : config.max_concurrent_by_type) {
+        type_limits[limit.first] = limit.second;
+    }
+    
+    pool_config_ = config;
+    pool_config_.worker_count = workers;
+    pool_config_.max_concurrent_by_type = std::move(type_limits);
+    executor_ = config.executor;
+    
+    SKYMESH_LOG_INFO(kLogComponent, "Execution pool configured with ", workers, " workers (",
+                     total_reserved, " reserved)");
+    
     return true;
 }
 
+void OrbitalTaskManagerImpl::setAdmissionPolicy(std::shared_ptr<TaskAdmissionPolicy> policy) {
+    {
+        auto lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
+        
+        // Groups held by the old policy are released rather than stranded
+        for (size_t type = 0; type < kTaskTypeCount; ++type) {
+            if (!coalesce_groups_[type].members.empty()) {
+                releaseGroupLocked(type);
+            }
+        }
+        admission_policy_ = std::move(policy);
+    }
+    notifyWorkers(true);
+}
+
+bool OrbitalTaskManagerImpl::loadConfigFile(const std::string& config_path) {
+    std::ifstream file(config_path);
+    if (!file) {
+        return false;
+    }
+    
+    // Keys: worker_count, reserved_workers.<PRIORITY>, max_concurrent.<TASK_TYPE>
+    ExecutionPoolConfig config = pool_config_;
+    std::string line;
+    
+    while (std::getline(file, line)) {
+        auto comment = line.find('#');
+        if (comment != std::string::npos) {
+            line.erase(comment);
+        }
+        
+        auto separator = line.find('=');
+        if (separator == std::string::npos) {
+            continue;
+        }
+        
+        auto trim = [](std::string value) {
+            value.erase(0, value.find_first_not_of(" \t\r"));
+            value.erase(value.find_last_not_of(" \t\r") + 1);
+            return value;
+        };
+        std::string key = trim(line.substr(0, separator));
+        std::string value = trim(line.substr(separator + 1));
+        
+        uint32_t number = 0;
+        try {
+            number = static_cast<uint32_t>(std::stoul(value));
+        } catch (const std::exception&) {
+            SKYMESH_LOG_WARNING(kLogComponent, "Ignoring non-numeric config value for ", key, ": ", value);
+            continue;
+        }
+        
+        TaskPriority priority;
+        TaskType type;
+        
+        if (key == "worker_count") {
+            config.worker_count = number;
+        } else if (key.rfind("reserved_workers.", 0) == 0 && 
+                   parse_task_priority(key.substr(17), priority)) {
+            config.reserved_workers[priority] = number;
+        } else if (key.rfind("max_concurrent.", 0) == 0 && 
+                   parse_task_type(key.substr(15), type)) {
+            config.max_concurrent_by_type[type] = number;
+        } else {
+            SKYMESH_LOG_WARNING(kLogComponent, "Ignoring unknown config key: ", key);
+        }
+    }
+    
+    return configureExecutionPool(config);
+}
+
 bool OrbitalTaskManagerImpl::start() {
     std::lock_guard<std::mutex> lock(execution_mutex_);
     
     if (running_) {
-        log_warning("OrbitalTaskManager already running");
+        SKYMESH_LOG_WARNING(kLogComponent, "OrbitalTaskManager already running");
         return false;
     }
     
-    log_info("Starting OrbitalTaskManager");
+    SKYMESH_LOG_INFO(kLogComponent, "Starting OrbitalTaskManager");
+    
+    // Derive lane capacities: a lane may only use the workers not reserved
+    // for strictly more urgent priorities
+    {
+        auto queue_lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
+        
+        uint32_t reserved_above = 0;
+        for (size_t p = 0; p < kPriorityCount; ++p) {
+            lane_capacity_[p] = pool_config_.worker_count - reserved_above;
+            
+            auto it = pool_config_.reserved_workers.find(static_cast<TaskPriority>(p));
+            if (it != pool_config_.reserved_workers.end()) {
+                reserved_above += it->second;
+            }
+        }
+        
+        type_limit_.fill(0);
+        for (const auto& limit : pool_config_.max_concurrent_by_type) {
+            type_limit_[static_cast<size_t>(limit.first)] = limit.second;
+        }
+        
+        busy_workers_ = 0;
+        running_by_type_.fill(0);
+    }
+    
     running_ = true;
     
-    // Start execution thread
-    execution_thread_ = std::thread(&OrbitalTaskManagerImpl::taskExecutionThread, this);
+    // On an executor, dispatch passes stand in for the workers, and
+    // replicas submitted to the stopped pool run inline
+    if (executor_) {
+        auto queue_lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
+        dispatching_ = false;
+        scheduleDispatchLocked(true);
+        return true;
+    }
+    
+    // Replica slots first, so no worker can submit to a stopped pool
+    tmr_pool_.start(pool_config_.tmr_threads_per_replica, pool_config_.pin_tmr_replicas);
     
-    // Start scheduling thread
-    scheduling_thread_ = std::thread(&OrbitalTaskManagerImpl::taskSchedulingThread, this);
+    // Start worker pool
+    workers_.reserve(pool_config_.worker_count);
+    for (uint32_t i = 0; i < pool_config_.worker_count; ++i) {
+        workers_.emplace_back(&OrbitalTaskManagerImpl::workerThread, this);
+    }
     
     return true;
 }
@@ -241,101 +698,203 @@ void OrbitalTaskManagerImpl::stop() {
             return;
         }
         
-        log_info("Stopping OrbitalTaskManager");
+        SKYMESH_LOG_INFO(kLogComponent, "Stopping OrbitalTaskManager");
         running_ = false;
     }
     
-    // Notify all waiting threads
+    // Notify all waiting threads. Taking queue_mutex_ first guarantees each
+    // worker is either waiting or will observe running_ == false.
+    {
+        auto queue_lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
+        if (dispatch_timer_ != 0) {
+            executor_->cancel(dispatch_timer_);
+            dispatch_timer_ = 0;
+        }
+    }
     queue_condition_.notify_all();
-    execution_condition_.notify_all();
     
     // Join threads if they are joinable
-    if (execution_thread_.joinable()) {
-        execution_thread_.join();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
     }
+    workers_.clear();
     
-    if (scheduling_thread_.joinable()) {
-        scheduling_thread_.join();
-    }
+    // Late replicas of early-returned votes finish before the pool exits
+    tmr_pool_.stop();
     
-    log_info("OrbitalTaskManager stopped");
+    // No completion callback runs once stop() has returned
+    completion_topic_.flush();
+    
+    SKYMESH_LOG_INFO(kLogComponent, "OrbitalTaskManager stopped");
 }
 
-std::string OrbitalTaskManagerImpl::scheduleTask(const OrbitalTask& task) {
-    if (!running_) {
-        log_error("Cannot schedule task: OrbitalTaskManager not running");
-        return "";
-    }
+std::shared_ptr<OrbitalTaskManagerImpl::TaskEntry> OrbitalTaskManagerImpl::createTaskEntry(
+    OrbitalTask&& task) {
     
     auto task_entry = std::make_shared<TaskEntry>();
-    task_entry->task = task;
+    task_entry->task = std::move(task);
+    task_entry->handle = next_task_handle_++;
     
     // Generate task ID if not provided
     if (task_entry->task.task_id.empty()) {
-        task_entry->task.task_id = generate_task_id();
+        task_entry->task.task_id = generate_task_id(task_entry->handle);
     }
     
     task_entry->status = TaskStatus::PENDING;
+    task_entry->deadline = task_entry->task.scheduled_time;
     task_entry->actual_retry_count = 0;
     task_entry->is_recurring = false;
+    task_entry->recurring_interval = std::chrono::milliseconds(0);
     task_entry->radiation_event_detected = false;
     
-    log_info("Scheduling task: " + task_entry->task.name + " (ID: " + task_entry->task.task_id + ")");
+    // Configure task context once, so dispatch never touches the metadata map
+    const auto& metadata = task_entry->task.metadata;
+    TaskContext& context = task_entry->context;
+    context = default_context_;
+    try {
+        auto it = metadata.find("memory_limit_bytes");
+        if (it != metadata.end()) {
+            context.memory_limit_bytes = std::stoull(it->second);
+        }
+        it = metadata.find("cpu_time_limit_ms");
+        if (it != metadata.end()) {
+            context.cpu_time_limit_ms = static_cast<uint32_t>(std::stoul(it->second));
+        }
+    } catch (const std::exception& e) {
+        SKYMESH_LOG_ERROR(kLogComponent, "Cannot schedule task ", task_entry->task.task_id,
+                          ": invalid resource limit in metadata (", e.what(), ")");
+        return nullptr;
+    }
+    
+    auto it = metadata.find("allow_io_operations");
+    if (it != metadata.end()) {
+        context.allow_io_operations = it->second == "true";
+    }
+    it = metadata.find("allow_critical_subsystems");
+    if (it != metadata.end()) {
+        context.allow_critical_subsystems = it->second == "true";
+    }
+    
+    // Results are filled in place; only the ID needs setting up front
+    task_entry->result.task_id = task_entry->task.task_id;
+    task_entry->result.retry_attempts = 0;
+    task_entry->result.radiation_event_detected = false;
+    
+    return task_entry;
+}
+
+std::string OrbitalTaskManagerImpl::scheduleTask(const OrbitalTask& task) {
+    return scheduleTask(OrbitalTask(task));
+}
+
+std::string OrbitalTaskManagerImpl::scheduleTask(OrbitalTask&& task) {
+    if (!running_) {
+        SKYMESH_LOG_ERROR(kLogComponent, "Cannot schedule task: OrbitalTaskManager not running");
+        return "";
+    }
+    
+    auto task_entry = createTaskEntry(std::move(task));
+    if (!task_entry) {
+        return "";
+    }
+    
+    SKYMESH_LOG_INFO(kLogComponent, "Scheduling task: ", task_entry->task.name, " (ID: ", task_entry->task.task_id, ")");
     
     // Add to task map and priority queue
     {
-        std::lock_guard<std::mutex> map_lock(tasks_mutex_);
-        task_map_[task_entry->task.task_id] = task_entry;
+        auto map_lock = lockInstrumented(tasks_mutex_, tasks_lock_wait_);
+        insertTaskLocked(task_entry);
     }
     
     {
-        std::lock_guard<std::mutex> queue_lock(queue_mutex_);
-        task_queue_.push(task_entry);
+        auto queue_lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
+        enqueueTaskLocked(task_entry, currentTime());
     }
     
     // Notify execution thread
-    queue_condition_.notify_one();
+    notifyWorkers();
     
     return task_entry->task.task_id;
 }
 
-std::string OrbitalTaskManagerImpl::scheduleConditionalTask(
-    const OrbitalTask& task, const TriggerCondition& trigger) {
+std::vector<std::string> OrbitalTaskManagerImpl::scheduleTasks(std::vector<OrbitalTask>&& tasks) {
+    std::vector<std::string> task_ids(tasks.size());
     
     if (!running_) {
-        log_error("Cannot schedule conditional task: OrbitalTaskManager not running");
-        return "";
+        SKYMESH_LOG_ERROR(kLogComponent, "Cannot schedule task batch: OrbitalTaskManager not running");
+        return task_ids;
     }
     
-    auto task_entry = std::make_shared<TaskEntry>();
-    task_entry->task = task;
+    // Build entries outside the locks; rejected tasks keep an empty ID
+    std::vector<std::shared_ptr<TaskEntry>> task_entries;
+    task_entries.reserve(tasks.size());
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        auto task_entry = createTaskEntry(std::move(tasks[i]));
+        if (task_entry) {
+            task_ids[i] = task_entry->task.task_id;
+            task_entries.push_back(std::move(task_entry));
+        }
+    }
+    tasks.clear();
     
-    // Generate task ID if not provided
-    if (task_entry->task.task_id.empty()) {
-        task_entry->task.task_id = generate_task_id();
+    if (task_entries.empty()) {
+        return task_ids;
     }
     
-    task_entry->status = TaskStatus::PENDING;
-    task_entry->actual_retry_count = 0;
-    task_entry->is_recurring = false;
-    task_entry->trigger_condition = trigger;
-    task_entry->radiation_event_detected = false;
+    SKYMESH_LOG_INFO(kLogComponent, "Scheduling batch of ", task_entries.size(), " tasks (",
+                     task_ids.size() - task_entries.size(), " rejected)");
     
-    log_info("Scheduling conditional task: " + task_entry->task.name + 
-             " (ID: " + task_entry->task.task_id + ")");
+    {
+        auto map_lock = lockInstrumented(tasks_mutex_, tasks_lock_wait_);
+        task_map_.reserve(task_map_.size() + task_entries.size());
+        for (const auto& task_entry : task_entries) {
+            insertTaskLocked(task_entry);
+        }
+    }
     
-    // Add to task map
     {
-        std::lock_guard<std::mutex> map_lock(tasks_mutex_);
-        task_map_[task_entry->task.task_id] = task_entry;
+        auto queue_lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
+        enqueueTasksLocked(task_entries, currentTime());
+    }
+    
+    // One wake-up for the whole batch
+    notifyWorkers(true);
+    
+    return task_ids;
+}
+
+std::string OrbitalTaskManagerImpl::scheduleConditionalTask(
+    const OrbitalTask& task, const TriggerCondition& trigger) {
+    
+    if (!running_) {
+        SKYMESH_LOG_ERROR(kLogComponent, "Cannot schedule conditional task: OrbitalTaskManager not running");
+        return "";
+    }
+    
+    auto task_entry = createTaskEntry(OrbitalTask(task));
+    if (!task_entry) {
+        return "";
     }
+    task_entry->trigger_condition = trigger;
+    
+    SKYMESH_LOG_INFO(kLogComponent, "Scheduling conditional task: ", task_entry->task.name,
+                     " (ID: ", task_entry->task.task_id, ")");
     
-    // Add to conditional tasks list
+    // Add to task map and trigger indices together so a dependency
+    // completing concurrently is either seen here or fires the task
     {
-        std::lock_guard<std::mutex> queue_lock(queue_mutex_);
-        conditional_tasks_.push_back(task_entry);
+        auto map_lock = lockInstrumented(tasks_mutex_, tasks_lock_wait_);
+        insertTaskLocked(task_entry);
+        
+        std::lock_guard<std::mutex> trigger_lock(trigger_mutex_);
+        armTriggersLocked(task_entry);
     }
     
+    // Notify workers; a time trigger may be the new earliest deadline
+    notifyWorkers();
+    
     return task_entry->task.task_id;
 }
 
@@ -343,73 +902,100 @@ std::string OrbitalTaskManagerImpl::scheduleRecurringTask(
     const OrbitalTask& task, std::chrono::milliseconds interval) {
     
     if (!running_) {
-        log_error("Cannot schedule recurring task: OrbitalTaskManager not running");
+        SKYMESH_LOG_ERROR(kLogComponent, "Cannot schedule recurring task: OrbitalTaskManager not running");
         return "";
     }
     
-    auto task_entry = std::make_shared<TaskEntry>();
-    task_entry->task = task;
-    
-    // Generate task ID if not provided
-    if (task_entry->task.task_id.empty()) {
-        task_entry->task.task_id = generate_task_id();
+    auto task_entry = createTaskEntry(OrbitalTask(task));
+    if (!task_entry) {
+        return "";
     }
-    
-    task_entry->status = TaskStatus::PENDING;
-    task_entry->actual_retry_count = 0;
     task_entry->is_recurring = true;
     task_entry->recurring_interval = interval;
-    task_entry->radiation_event_detected = false;
     
-    log_info("Scheduling recurring task: " + task_entry->task.name + 
-             " (ID: " + task_entry->task.task_id + ") with interval " + 
-             std::to_string(interval.count()) + "ms");
+    SKYMESH_LOG_INFO(kLogComponent, "Scheduling recurring task: ", task_entry->task.name,
+                     " (ID: ", task_entry->task.task_id, ") with interval ",
+                     interval.count(), "ms");
     
     // Add to task map and priority queue
     {
-        std::lock_guard<std::mutex> map_lock(tasks_mutex_);
-        task_map_[task_entry->task.task_id] = task_entry;
+        auto map_lock = lockInstrumented(tasks_mutex_, tasks_lock_wait_);
+        insertTaskLocked(task_entry);
     }
     
     {
-        std::lock_guard<std::mutex> queue_lock(queue_mutex_);
-        task_queue_.push(task_entry);
+        auto queue_lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
+        enqueueTaskLocked(task_entry, currentTime());
     }
     
     // Notify execution thread
-    queue_condition_.notify_one();
+    notifyWorkers();
     
     return task_entry->task.task_id;
 }
 
 bool OrbitalTaskManagerImpl::cancelTask(const std::string& task_id) {
-    std::lock_guard<std::mutex> map_lock(tasks_mutex_);
+    auto map_lock = lockInstrumented(tasks_mutex_, tasks_lock_wait_);
+    std::lock_guard<std::mutex> trigger_lock(trigger_mutex_);
+    
+    return cancelTaskLocked(task_id);
+}
+
+size_t OrbitalTaskManagerImpl::cancelTasks(const std::vector<std::string>& task_ids) {
+    auto map_lock = lockInstrumented(tasks_mutex_, tasks_lock_wait_);
+    std::lock_guard<std::mutex> trigger_lock(trigger_mutex_);
+    
+    size_t canceled = 0;
+    for (const auto& task_id : task_ids) {
+        if (cancelTaskLocked(task_id)) {
+            canceled++;
+        }
+    }
     
+    return canceled;
+}
+
+bool OrbitalTaskManagerImpl::cancelTaskLocked(const std::string& task_id) {
     auto it = task_map_.find(task_id);
     if (it == task_map_.end()) {
-        log_warning("Cannot cancel task: Task ID not found: " + task_id);
+        SKYMESH_LOG_WARNING(kLogComponent, "Cannot cancel task: Task ID not found: ", task_id);
         return false;
     }
     
     auto task_entry = it->second;
     
     if (task_entry->status == TaskStatus::RUNNING) {
-        log_warning("Cannot cancel running task: " + task_id);
+        SKYMESH_LOG_WARNING(kLogComponent, "Cannot cancel running task: ", task_id);
         return false;
     }
     
-    task_entry->status = TaskStatus::CANCELED;
-    log_info("Task canceled: " + task_id);
+    setStatusLocked(*task_entry, TaskStatus::CANCELED);
+    
+    // Canceled tasks no longer occupy the orbit trigger index
+    removeOrbitTriggerLocked(task_entry);
+    
+    // Retain the cancellation like a finished run, so the entry ages out
+    // with it; a recurring task keeps its last real result instead
+    std::vector<std::string> evicted;
+    {
+        std::lock_guard<std::mutex> results_lock(results_mutex_);
+        if (!result_store_.contains(task_id)) {
+            result_store_.put(createTaskResult(task_entry), &evicted);
+        }
+    }
+    forgetEvictedTasksLocked(evicted);
+    
+    SKYMESH_LOG_INFO(kLogComponent, "Task canceled: ", task_id);
     
     return true;
 }
 
 bool OrbitalTaskManagerImpl::suspendTask(const std::string& task_id) {
-    std::lock_guard<std::mutex> map_lock(tasks_mutex_);
+    auto map_lock = lockInstrumented(tasks_mutex_, tasks_lock_wait_);
     
     auto it = task_map_.find(task_id);
     if (it == task_map_.end()) {
-        log_warning("Cannot suspend task: Task ID not found: " + task_id);
+        SKYMESH_LOG_WARNING(kLogComponent, "Cannot suspend task: Task ID not found: ", task_id);
         return false;
     }
     
@@ -417,55 +1003,58 @@ bool OrbitalTaskManagerImpl::suspendTask(const std::string& task_id) {
     
     if (task_entry->status != TaskStatus::RUNNING && 
         task_entry->status != TaskStatus::PENDING) {
-        log_warning("Cannot suspend task with status: " + 
-                   std::to_string(static_cast<int>(task_entry->status)));
+        SKYMESH_LOG_WARNING(kLogComponent, "Cannot suspend task with status: ",
+                            static_cast<int>(task_entry->status));
         return false;
     }
     
-    task_entry->status = TaskStatus::SUSPENDED;
-    log_info("Task suspended: " + task_id);
+    setStatusLocked(*task_entry, TaskStatus::SUSPENDED);
+    SKYMESH_LOG_INFO(kLogComponent, "Task suspended: ", task_id);
     
     return true;
 }
 
 bool OrbitalTaskManagerImpl::resumeTask(const std::string& task_id) {
-    std::lock_guard<std::mutex> map_lock(tasks_mutex_);
+    auto map_lock = lockInstrumented(tasks_mutex_, tasks_lock_wait_);
     
     auto it = task_map_.find(task_id);
     if (it == task_map_.end()) {
-        log_warning("Cannot resume task: Task ID not found: " + task_id);
+        SKYMESH_LOG_WARNING(kLogComponent, "Cannot resume task: Task ID not found: ", task_id);
         return false;
     }
     
     auto task_entry = it->second;
     
     if (task_entry->status != TaskStatus::SUSPENDED) {
-        log_warning("Cannot resume task with status: " + 
-                   std::to_string(static_cast<int>(task_entry->status)));
+        SKYMESH_LOG_WARNING(kLogComponent, "Cannot resume task with status: ",
+                            static_cast<int>(task_entry->status));
         return false;
     }
     
-    task_entry->status = TaskStatus::PENDING;
-    log_info("Task resumed: " + task_id);
+    setStatusLocked(*task_entry, TaskStatus::PENDING);
+    SKYMESH_LOG_INFO(kLogComponent, "Task resumed: ", task_id);
     
     // Re-add to priority queue
     {
-        std::lock_guard<std::mutex> queue_lock(queue_mutex_);
-        task_queue_.push(task_entry);
+        auto queue_lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
+        enqueueTaskLocked(task_entry, currentTime());
     }
     
     // Notify execution thread
-    queue_condition_.notify_one();
+    notifyWorkers();
     
     return true;
 }
 
 TaskStatus OrbitalTaskManagerImpl::getTaskStatus(const std::string& task_id) const {
-    std::lock_guard<std::mutex> map_lock(tasks_mutex_);
+    auto map_lock = lockInstrumented(tasks_mutex_, tasks_lock_wait_);
     
     auto it = task_map_.find(task_id);
     if (it == task_map_.end()) {
-        log_warning("Task not found for status check: " + task_id);
+        if (auto status = tombstoneLocked(task_id)) {
+            return status.value();
+        }
+        SKYMESH_LOG_WARNING(kLogComponent, "Task not found for status check: ", task_id);
         return TaskStatus::FAILED; // Default to failed if not found
     }
     
@@ -475,15 +1064,17 @@ TaskStatus OrbitalTaskManagerImpl::getTaskStatus(const std::string& task_id) con
 std::optional<TaskResult> OrbitalTaskManagerImpl::getTaskResult(const std::string& task_id) const {
     // First check if the task exists
     {
-        std::lock_guard<std::mutex> map_lock(tasks_mutex_);
+        auto map_lock = lockInstrumented(tasks_mutex_, tasks_lock_wait_);
         auto it = task_map_.find(task_id);
         if (it == task_map_.end()) {
-            log_warning("Task not found for result retrieval: " + task_id);
+            SKYMESH_LOG_WARNING(kLogComponent, "Task not found for result retrieval: ", task_id);
             return std::nullopt;
         }
         
-        // If task exists but is not completed, return nullopt
-        if (it->second->status != TaskStatus::COMPLETED && 
+        // If task exists but is not completed, return nullopt. Recurring
+        // tasks report their latest run between ticks.
+        if (!it->second->is_recurring &&
+            it->second->status != TaskStatus::COMPLETED && 
             it->second->status != TaskStatus::FAILED) {
             return std::nullopt;
         }
@@ -491,84 +1082,298 @@ std::optional<TaskResult> OrbitalTaskManagerImpl::getTaskResult(const std::strin
     
     // Then check for results
     std::lock_guard<std::mutex> results_lock(results_mutex_);
-    auto it = task_results_.find(task_id);
-    if (it == task_results_.end()) {
-        return std::nullopt;
-    }
-    
-    return it->second;
+    return result_store_.get(task_id);
 }
 
 std::vector<OrbitalTask> OrbitalTaskManagerImpl::getAllScheduledTasks() const {
-    std::lock_guard<std::mutex> map_lock(tasks_mutex_);
-    
-    std::vector<OrbitalTask> tasks;
-    tasks.reserve(task_map_.size());
+    auto map_lock = lockInstrumented(tasks_mutex_, tasks_lock_wait_);
     
+    std::vector<const TaskEntry*> entries;
+    entries.reserve(task_map_.size());
     for (const auto& pair : task_map_) {
-        tasks.push_back(pair.second->task);
+        entries.push_back(pair.second.get());
     }
     
-    return tasks;
+    return copyTasksLocked(entries);
 }
 
 std::vector<OrbitalTask> OrbitalTaskManagerImpl::getTasksByStatus(TaskStatus status) const {
-    std::lock_guard<std::mutex> map_lock(tasks_mutex_);
+    auto map_lock = lockInstrumented(tasks_mutex_, tasks_lock_wait_);
+    
+    const auto& entries = status_index_[static_cast<size_t>(status)];
+    return copyTasksLocked(std::vector<const TaskEntry*>(entries.begin(), entries.end()));
+}
+
+std::vector<OrbitalTask> OrbitalTaskManagerImpl::copyTasksLocked(
+    const std::vector<const TaskEntry*>& entries) const {
     
+    // The copies need only the map lock, which keeps metadata still; the
+    // dispatcher is held up just for the pass reading the deadlines
     std::vector<OrbitalTask> tasks;
+    tasks.reserve(entries.size());
+    for (const TaskEntry* entry : entries) {
+        tasks.push_back(entry->task);
+    }
     
-    for (const auto& pair : task_map_) {
-        if (pair.second->status == status) {
-            tasks.push_back(pair.second->task);
-        }
+    auto queue_lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
+    for (size_t i = 0; i < entries.size(); ++i) {
+        tasks[i].scheduled_time = entries[i]->deadline;
     }
     
     return tasks;
 }
 
-int OrbitalTaskManagerImpl::registerCompletionCallback(
-    TaskCompletionCallback callback, TaskType task_type) {
-    
-    std::lock_guard<std::mutex> callback_lock(callback_mutex_);
+size_t OrbitalTaskManagerImpl::visitTasks(
+    std::optional<TaskStatus> status, const std::function<bool(const TaskSummary&)>& visitor) const {
     
-    int id = next_callback_id_++;
-    callbacks_.push_back({id, callback, task_type});
+    // Snapshot references only; IDs, names, types and priorities never change
+    // after scheduling. Deadlines do, under the queue lock.
+    struct Snapshot {
+        std::shared_ptr<TaskEntry> entry;
+        TaskStatus status;
+        std::chrono::system_clock::time_point scheduled_time;
+    };
+    std::vector<Snapshot> snapshot;
     
-    log_info("Registered completion callback with ID: " + std::to_string(id) + 
-             " for task type: " + std::to_string(static_cast<int>(task_type)));
+    {
+        auto map_lock = lockInstrumented(tasks_mutex_, tasks_lock_wait_);
+        auto queue_lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
+        
+        auto collect = [this, &snapshot](size_t s) {
+            for (TaskEntry* entry : status_index_[s]) {
+                snapshot.push_back({task_map_.at(entry->task.task_id), entry->status,
+                                    entry->deadline});
+            }
+        };
+        
+        if (status.has_value()) {
+            snapshot.reserve(status_index_[static_cast<size_t>(status.value())].size());
+            collect(static_cast<size_t>(status.value()));
+        } else {
+            snapshot.reserve(task_map_.size());
+            for (size_t s = 0; s < kStatusCount; ++s) {
+                collect(s);
+            }
+        }
+    }
     
-    return id;
+    size_t visited = 0;
+    for (const Snapshot& item : snapshot) {
+        const OrbitalTask& task = item.entry->task;
+        TaskSummary summary{task.task_id, task.name, task.type, task.priority,
+                            item.status, item.scheduled_time};
+        visited++;
+        if (!visitor(summary)) {
+            break;
+        }
+    }
+    
+    return visited;
 }
 
-void OrbitalTaskManagerImpl::unregisterCompletionCallback(int callback_id) {
-    std::lock_guard<std::mutex> callback_lock(callback_mutex_);
+size_t OrbitalTaskManagerImpl::visitTaskResults(
+    const std::function<bool(const TaskResult&)>& visitor) const {
+    
+    std::lock_guard<std::mutex> results_lock(results_mutex_);
+    return result_store_.visit(visitor);
+}
+
+void OrbitalTaskManagerImpl::configureResultRetention(const ResultRetentionPolicy& policy) {
+    std::vector<std::string> evicted;
+    {
+        std::lock_guard<std::mutex> results_lock(results_mutex_);
+        result_store_.setPolicy(policy, &evicted);
+    }
+    
+    if (!evicted.empty()) {
+        auto map_lock = lockInstrumented(tasks_mutex_, tasks_lock_wait_);
+        forgetEvictedTasksLocked(evicted);
+    }
+    
+    SKYMESH_LOG_INFO(kLogComponent, "Result retention set to ", policy.max_results, " results, ",
+                     policy.max_age.count(), " s, ", policy.max_bytes, " bytes (",
+                     evicted.size(), " evicted)");
+}
+
+void OrbitalTaskManagerImpl::insertTaskLocked(const std::shared_ptr<TaskEntry>& task_entry) {
+    state_version_.fetch_add(1, std::memory_order_relaxed);
+    tombstones_.erase(task_entry->task.task_id);
+    auto& slot = task_map_[task_entry->task.task_id];
+    if (slot) {
+        unindexStatusLocked(*slot);
+    }
+    slot = task_entry;
+    
+    auto& entries = status_index_[static_cast<size_t>(task_entry->status)];
+    task_entry->status_slot = entries.size();
+    entries.push_back(task_entry.get());
+}
+
+void OrbitalTaskManagerImpl::setStatusLocked(TaskEntry& task_entry, TaskStatus status) {
+    if (task_entry.status == status) {
+        return;
+    }
+    state_version_.fetch_add(1, std::memory_order_relaxed);
+    
+    // An entry replaced under its ID by a newer task keeps running unindexed
+    if (task_entry.status_slot == kNotIndexed) {
+        task_entry.status = status;
+        return;
+    }
+    
+    unindexStatusLocked(task_entry);
+    task_entry.status = status;
+    
+    auto& entries = status_index_[static_cast<size_t>(status)];
+    task_entry.status_slot = entries.size();
+    entries.push_back(&task_entry);
+}
+
+void OrbitalTaskManagerImpl::unindexStatusLocked(TaskEntry& task_entry) {
+    if (task_entry.status_slot == kNotIndexed) {
+        return;
+    }
+    state_version_.fetch_add(1, std::memory_order_relaxed);
+    
+    // Swap-remove keeps every status change O(1)
+    auto& entries = status_index_[static_cast<size_t>(task_entry.status)];
+    TaskEntry* last = entries.back();
+    entries[task_entry.status_slot] = last;
+    last->status_slot = task_entry.status_slot;
+    entries.pop_back();
+    task_entry.status_slot = kNotIndexed;
+}
+
+void OrbitalTaskManagerImpl::forgetEvictedTasksLocked(const std::vector<std::string>& task_ids) {
+    for (const auto& task_id : task_ids) {
+        auto it = task_map_.find(task_id);
+        if (it == task_map_.end()) {
+            continue;
+        }
+        
+        // Pending, running and suspended tasks keep their entries, as do
+        // recurring tasks until canceled and failed tasks, which
+        // recoverTask() may still run again
+        TaskEntry& entry = *it->second;
+        bool finished = entry.is_recurring ?
+            entry.status == TaskStatus::CANCELED :
+            (entry.status == TaskStatus::COMPLETED ||
+             entry.status == TaskStatus::CANCELED);
+        if (!finished) {
+            continue;
+        }
+        
+        if (tombstones_.emplace(task_id, entry.status).second) {
+            tombstone_order_.push_back(task_id);
+        }
+        unindexStatusLocked(entry);
+        task_map_.erase(it);
+    }
+    
+    // An ID forgotten again after rescheduling is listed twice and simply
+    // ages out with its older listing
+    while (tombstone_order_.size() > kMaxTombstones) {
+        tombstones_.erase(tombstone_order_.front());
+        tombstone_order_.pop_front();
+    }
+}
+
+std::optional<TaskStatus> OrbitalTaskManagerImpl::tombstoneLocked(const std::string& task_id) const {
+    auto it = tombstones_.find(task_id);
+    if (it == tombstones_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+int OrbitalTaskManagerImpl::registerCompletionCallback(
+    TaskCompletionCallback callback, TaskType task_type) {
+    
+    int id = completion_topic_.subscribe(std::move(callback), task_type);
     
-    auto it = std::find_if(callbacks_.begin(), callbacks_.end(),
-                          [callback_id](const CallbackEntry& entry) {
-                              return entry.id == callback_id;
-                          });
+    SKYMESH_LOG_INFO(kLogComponent, "Registered completion callback with ID: ", id,
+                     " for task type: ", static_cast<int>(task_type));
     
-    if (it != callbacks_.end()) {
-        callbacks_.erase(it);
-        log_info("Unregistered completion callback with ID: " + std::to_string(callback_id));
+    return id;
+}
+
+void OrbitalTaskManagerImpl::unregisterCompletionCallback(int callback_id) {
+    if (completion_topic_.unsubscribe(callback_id)) {
+        SKYMESH_LOG_INFO(kLogComponent, "Unregistered completion callback with ID: ", callback_id);
     } else {
-        log_warning("Callback ID not found for unregistration: " + std::to_string(callback_id));
+        SKYMESH_LOG_WARNING(kLogComponent, "Callback ID not found for unregistration: ", callback_id);
     }
 }
 
 void OrbitalTaskManagerImpl::updateOrbitalPosition(const OrbitPosition& position) {
-    std::lock_guard<std::mutex> position_lock(position_mutex_);
-    
-    current_position_ = position;
+    {
+        std::lock_guard<std::mutex> position_lock(position_mutex_);
+        current_position_ = position;
+    }
     
     // Log position update at debug level
-    log_debug("Updated orbital position: (" + 
-             std::to_string(position.latitude) + ", " + 
-             std::to_string(position.longitude) + ") at " + 
-             std::to_string(position.altitude_km) + " km");
+    SKYMESH_LOG_DEBUG(kLogComponent, "Updated orbital position: (",
+                      position.latitude, ", ",
+                      position.longitude, ") at ",
+                      position.altitude_km, " km");
+    
+    // Only orbit triggers depend on position, so only they are matched here,
+    // including any whose box was crossed since the previous sample
+    size_t fired = 0;
+    {
+        std::lock_guard<std::mutex> trigger_lock(trigger_mutex_);
+        
+        std::vector<uint64_t> hits;
+        if (has_trigger_sample_) {
+            orbit_index_.querySegment(last_trigger_sample_, position, hits);
+        } else {
+            orbit_index_.queryPoint(position, hits);
+        }
+        last_trigger_sample_ = position;
+        has_trigger_sample_ = true;
+        
+        auto now = currentTime();
+        for (uint64_t id : hits) {
+            std::shared_ptr<TaskEntry> task_entry = orbit_triggers_.at(id);
+            removeOrbitTriggerLocked(task_entry);
+            if (fireTriggerLocked(task_entry, now)) {
+                fired++;
+            }
+        }
+    }
+    
+    if (fired > 0) {
+        notifyWorkers(true);
+        SKYMESH_LOG_DEBUG(kLogComponent, "Triggered ", fired, " conditional tasks at new position");
+    }
+}
+
+size_t OrbitalTaskManagerImpl::publishEvent(const std::string& event_name) {
+    size_t fired = 0;
+    {
+        std::lock_guard<std::mutex> trigger_lock(trigger_mutex_);
+        
+        auto it = event_triggers_.find(event_name);
+        if (it == event_triggers_.end()) {
+            return 0;
+        }
+        
+        auto now = currentTime();
+        for (const auto& task_entry : it->second) {
+            if (fireTriggerLocked(task_entry, now)) {
+                fired++;
+            }
+        }
+        event_triggers_.erase(it);
+    }
+    
+    if (fired > 0) {
+        notifyWorkers(true);
+    }
+    
+    SKYMESH_LOG_INFO(kLogComponent, "Event published: ", event_name, " (", fired, " tasks triggered)");
     
-    // Notify scheduling thread to check for position-triggered tasks
-    execution_condition_.notify_one();
+    return fired;
 }
 
 OrbitPosition OrbitalTaskManagerImpl::getCurrentOrbitalPosition() const {
@@ -577,45 +1382,45 @@ OrbitPosition OrbitalTaskManagerImpl::getCurrentOrbitalPosition() const {
 }
 
 bool OrbitalTaskManagerImpl::recoverTask(const std::string& task_id, RecoveryStrategy strategy) {
-    std::lock_guard<std::mutex> map_lock(tasks_mutex_);
+    auto map_lock = lockInstrumented(tasks_mutex_, tasks_lock_wait_);
     
     auto it = task_map_.find(task_id);
     if (it == task_map_.end()) {
-        log_warning("Cannot recover task: Task ID not found: " + task_id);
+        SKYMESH_LOG_WARNING(kLogComponent, "Cannot recover task: Task ID not found: ", task_id);
         return false;
     }
     
     auto task_entry = it->second;
     
     if (task_entry->status != TaskStatus::FAILED) {
-        log_warning("Cannot recover task with status: " + 
-                   std::to_string(static_cast<int>(task_entry->status)));
+        SKYMESH_LOG_WARNING(kLogComponent, "Cannot recover task with status: ",
+                            static_cast<int>(task_entry->status));
         return false;
     }
     
-    log_info("Recovering task: " + task_id + " with strategy: " + 
-            std::to_string(static_cast<int>(strategy)));
+    SKYMESH_LOG_INFO(kLogComponent, "Recovering task: ", task_id, " with strategy: ",
+                     static_cast<int>(strategy));
     
     // Apply the recovery strategy
     switch (strategy) {
         case RecoveryStrategy::RETRY:
             // Simply retry the task
-            task_entry->status = TaskStatus::PENDING;
+            setStatusLocked(*task_entry, TaskStatus::PENDING);
             task_entry->actual_retry_count = 0; // Reset retry count
             
             // Re-add to priority queue
             {
-                std::lock_guard<std::mutex> queue_lock(queue_mutex_);
-                task_queue_.push(task_entry);
+                auto queue_lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
+                enqueueTaskLocked(task_entry, currentTime());
             }
             
             // Notify execution thread
-            queue_condition_.notify_one();
+            notifyWorkers();
             break;
             
         case RecoveryStrategy::CHECKPOINT_RESTORE:
             // Restore from last checkpoint, if available
-            task_entry->status = TaskStatus::PENDING;
+            setStatusLocked(*task_entry, TaskStatus::PENDING);
             task_entry->actual_retry_count = 0;
             
             // Set task metadata to indicate checkpoint restore
@@ -623,16 +1428,16 @@ bool OrbitalTaskManagerImpl::recoverTask(const std::string& task_id, RecoveryStr
             
             // Re-add to priority queue
             {
-                std::lock_guard<std::mutex> queue_lock(queue_mutex_);
-                task_queue_.push(task_entry);
+                auto queue_lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
+                enqueueTaskLocked(task_entry, currentTime());
             }
             
-            queue_condition_.notify_one();
+            notifyWorkers();
             break;
             
         case RecoveryStrategy::ALTERNATE_ROUTINE:
             // Use an alternative implementation
-            task_entry->status = TaskStatus::PENDING;
+            setStatusLocked(*task_entry, TaskStatus::PENDING);
             task_entry->actual_retry_count = 0;
             
             // Set task metadata to indicate alternate routine
@@ -640,335 +1445,931 @@ bool OrbitalTaskManagerImpl::recoverTask(const std::string& task_id, RecoveryStr
             
             // Re-add to priority queue
             {
-                std::lock_guard<std::mutex> queue_lock(queue_mutex_);
-                task_queue_.push(task_entry);
+                auto queue_lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
+                enqueueTaskLocked(task_entry, currentTime());
             }
             
-            queue_condition_.notify_one();
+            notifyWorkers();
             break;
             
         case RecoveryStrategy::GROUND_ASSISTANCE:
             // Request assistance from ground control
             // In a real system, this would queue a message to ground
-            task_entry->status = TaskStatus::SUSPENDED;
+            setStatusLocked(*task_entry, TaskStatus::SUSPENDED);
             task_entry->task.metadata["recovery_type"] = "ground_assist";
             task_entry->task.metadata["ground_assist_requested"] = timestamp_to_string(
-                std::chrono::system_clock::now());
+                currentTime());
             
-            log_info("Ground assistance requested for task: " + task_id);
+            SKYMESH_LOG_INFO(kLogComponent, "Ground assistance requested for task: ", task_id);
             break;
             
         case RecoveryStrategy::SAFE_MODE:
             // Enter safe mode and await instructions
-            task_entry->status = TaskStatus::SUSPENDED;
+            setStatusLocked(*task_entry, TaskStatus::SUSPENDED);
             task_entry->task.metadata["recovery_type"] = "safe_mode";
             
-            log_warning("Task " + task_id + " triggered SAFE_MODE recovery strategy");
+            SKYMESH_LOG_WARNING(kLogComponent, "Task ", task_id, " triggered SAFE_MODE recovery strategy");
             // In a real system, this would trigger satellite-wide safe mode
             break;
             
         default:
-            log_error("Unknown recovery strategy: " + 
-                     std::to_string(static_cast<int>(strategy)));
+            SKYMESH_LOG_ERROR(kLogComponent, "Unknown recovery strategy: ",
+                              static_cast<int>(strategy));
             return false;
     }
     
     return true;
 }
 
-bool OrbitalTaskManagerImpl::reportTaskMetrics() {
-    // Collect metrics
-    uint64_t executed = tasks_executed_.load();
-    uint64_t failed = tasks_failed_.load();
-    uint64_t radiation = radiation_events_.load();
-    
-    // Get task counts by status
-    std::unordered_map<TaskStatus, int> status_counts;
-    
-    {
-        std::lock_guard<std::mutex> map_lock(tasks_mutex_);
-        for (const auto& pair : task_map_) {
-            status_counts[pair.second->status]++;
-        }
+TaskMetrics OrbitalTaskManagerImpl::getTaskMetrics() const {
+    TaskMetrics metrics;
+    metrics.tasks_executed = tasks_executed_.load();
+    metrics.tasks_failed = tasks_failed_.load();
+    metrics.radiation_events = radiation_events_.load();
+    
+    auto map_lock = lockInstrumented(tasks_mutex_, tasks_lock_wait_);
+    for (size_t s = 0; s < kStatusCount; ++s) {
+        metrics.tasks_by_status[s] = static_cast<uint32_t>(status_index_[s].size());
     }
+    return metrics;
+}
+
+bool OrbitalTaskManagerImpl::reportTaskMetrics() {
+    const TaskMetrics metrics = getTaskMetrics();
+    auto count = [&metrics](TaskStatus status) {
+        return metrics.tasks_by_status[static_cast<size_t>(status)];
+    };
     
     // Log metrics
     std::stringstream ss;
     ss << "Task Metrics Report:" << std::endl
-       << "  Tasks Executed: " << executed << std::endl
-       << "  Tasks Failed: " << failed << std::endl
-       << "  Radiation Events: " << radiation << std::endl
+       << "  Tasks Executed: " << metrics.tasks_executed << std::endl
+       << "  Tasks Failed: " << metrics.tasks_failed << std::endl
+       << "  Radiation Events: " << metrics.radiation_events << std::endl
        << "  Tasks by Status:" << std::endl
-       << "    Pending: " << status_counts[TaskStatus::PENDING] << std::endl
-       << "    Running: " << status_counts[TaskStatus::RUNNING] << std::endl
-       << "    Completed: " << status_counts[TaskStatus::COMPLETED] << std::endl
-       << "    Failed: " << status_counts[TaskStatus::FAILED] << std::endl
-       << "    Canceled: " << status_counts[TaskStatus::CANCELED] << std::endl
-       << "    Suspended: " << status_counts[TaskStatus::SUSPENDED] << std::endl;
+       << "    Pending: " << count(TaskStatus::PENDING) << std::endl
+       << "    Running: " << count(TaskStatus::RUNNING) << std::endl
+       << "    Completed: " << count(TaskStatus::COMPLETED) << std::endl
+       << "    Failed: " << count(TaskStatus::FAILED) << std::endl
+       << "    Canceled: " << count(TaskStatus::CANCELED) << std::endl
+       << "    Suspended: " << count(TaskStatus::SUSPENDED) << std::endl;
     
-    log_info(ss.str());
+    SKYMESH_LOG_INFO(kLogComponent, ss.str());
     
     // In a real implementation, this would also send the metrics to ground control
     return true;
 }
 
+namespace {
+    // TASKS section: a header, then one record per task in handle order.
+    // Records are 8-byte aligned and read in place; their strings follow
+    // the fixed part: ID, name, event name, dependency ID, then per
+    // metadata entry u32 key length, u32 value length, key, value.
+    constexpr uint32_t kTaskCheckpointSchema = 1;
+    
+    constexpr uint8_t kTaskFlagRadiationProtected = 1 << 0;
+    constexpr uint8_t kTaskFlagRecurring = 1 << 1;
+    constexpr uint8_t kTaskFlagArmed = 1 << 2;           // Conditional task whose trigger has not fired
+    constexpr uint8_t kTaskFlagOrbitTrigger = 1 << 3;
+    constexpr uint8_t kTaskFlagEventTrigger = 1 << 4;
+    constexpr uint8_t kTaskFlagTimeTrigger = 1 << 5;
+    constexpr uint8_t kTaskFlagDependencyTrigger = 1 << 6;
+    
+    struct TaskCheckpointHeader {
+        uint32_t schema;
+        uint32_t count;
+        uint64_t bytes;                // Section length, this header included
+    };
+    
+    struct TaskCheckpointRecord {
+        uint32_t size;                 // Record length with its strings, a multiple of 8
+        uint8_t type;
+        uint8_t priority;
+        uint8_t status;
+        uint8_t recovery_strategy;
+        uint8_t tmr_mode;
+        uint8_t flags;
+        uint16_t metadata_count;
+        uint32_t retry_count;
+        uint32_t id_length;
+        uint32_t name_length;
+        uint32_t event_length;
+        uint32_t dependency_length;
+        float energy_cost_wh;
+        float peak_power_w;
+        int64_t scheduled_ns;          // system_clock since the epoch
+        int64_t timeout_ms;
+        int64_t interval_ms;
+        int64_t trigger_time_ns;
+        int64_t orbit_timestamp_ns;
+        double orbit_altitude_km;
+        double orbit_latitude;
+        double orbit_longitude;
+        double orbit_velocity_kmps;
+        double position_tolerance_deg;
+        double altitude_tolerance_km;
+    };
+    static_assert(sizeof(TaskCheckpointRecord) % 8 == 0, "task records must stay 8-byte aligned");
+    
+    int64_t toCheckpointTime(std::chrono::system_clock::time_point time) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+    }
+    
+    std::chrono::system_clock::time_point fromCheckpointTime(int64_t nanoseconds) {
+        return std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::nanoseconds(nanoseconds)));
+    }
+    
+    bool hasTrigger(const TriggerCondition& condition) {
+        return condition.orbit_position.has_value() || condition.event_name.has_value() ||
+               condition.time_point.has_value() || condition.dependency_task_id.has_value();
+    }
+} // anonymous namespace
+
+size_t OrbitalTaskManagerImpl::writeCheckpointRecordLocked(const TaskEntry& task_entry, uint8_t* out, size_t room) {
+    const OrbitalTask& task = task_entry.task;
+    const TriggerCondition& condition = task_entry.trigger_condition;
+    const std::string none;
+    const std::string& event = condition.event_name ? condition.event_name.value() : none;
+    const std::string& dependency = condition.dependency_task_id ? condition.dependency_task_id.value() : none;
+    
+    size_t size = sizeof(TaskCheckpointRecord) + task.task_id.size() + task.name.size() +
+                  event.size() + dependency.size();
+    for (const auto& entry : task.metadata) {
+        size += 2 * sizeof(uint32_t) + entry.first.size() + entry.second.size();
+    }
+    size = (size + 7) & ~size_t{7};
+    if (size > room || task.metadata.size() > UINT16_MAX) {
+        return 0;
+    }
+    
+    TaskCheckpointRecord record{};
+    record.size = static_cast<uint32_t>(size);
+    record.type = static_cast<uint8_t>(task.type);
+    record.priority = static_cast<uint8_t>(task.priority);
+    // A run cut short by the reset starts over
+    record.status = static_cast<uint8_t>(task_entry.status == TaskStatus::SUSPENDED
+        ? TaskStatus::SUSPENDED : TaskStatus::PENDING);
+    record.recovery_strategy = static_cast<uint8_t>(task.recovery_strategy);
+    record.tmr_mode = static_cast<uint8_t>(task.tmr_mode);
+    record.flags = (task.radiation_protected ? kTaskFlagRadiationProtected : 0) |
+                   (task_entry.is_recurring ? kTaskFlagRecurring : 0) |
+                   (hasTrigger(condition) && !task_entry.trigger_fired ? kTaskFlagArmed : 0) |
+                   (condition.orbit_position ? kTaskFlagOrbitTrigger : 0) |
+                   (condition.event_name ? kTaskFlagEventTrigger : 0) |
+                   (condition.time_point ? kTaskFlagTimeTrigger : 0) |
+                   (condition.dependency_task_id ? kTaskFlagDependencyTrigger : 0);
+    record.metadata_count = static_cast<uint16_t>(task.metadata.size());
+    record.retry_count = task.retry_count;
+    record.id_length = static_cast<uint32_t>(task.task_id.size());
+    record.name_length = static_cast<uint32_t>(task.name.size());
+    record.event_length = static_cast<uint32_t>(event.size());
+    record.dependency_length = static_cast<uint32_t>(dependency.size());
+    record.energy_cost_wh = task.energy_cost_wh;
+    record.peak_power_w = task.peak_power_w;
+    record.scheduled_ns = toCheckpointTime(task_entry.deadline);
+    record.timeout_ms = task.timeout.count();
+    record.interval_ms = task_entry.recurring_interval.count();
+    if (condition.time_point) {
+        record.trigger_time_ns = toCheckpointTime(condition.time_point.value());
+    }
+    if (condition.orbit_position) {
+        const OrbitPosition& position = condition.orbit_position.value();
+        record.orbit_altitude_km = position.altitude_km;
+        record.orbit_latitude = position.latitude;
+        record.orbit_longitude = position.longitude;
+        record.orbit_velocity_kmps = position.velocity_kmps;
+        record.orbit_timestamp_ns = toCheckpointTime(position.timestamp);
+    }
+    record.position_tolerance_deg = condition.position_tolerance_deg;
+    record.altitude_tolerance_km = condition.altitude_tolerance_km;
+    std::memcpy(out, &record, sizeof(record));
+    
+    uint8_t* cursor = out + sizeof(record);
+    auto put = [&cursor](const void* data, size_t length) {
+        std::memcpy(cursor, data, length);
+        cursor += length;
+    };
+    put(task.task_id.data(), task.task_id.size());
+    put(task.name.data(), task.name.size());
+    put(event.data(), event.size());
+    put(dependency.data(), dependency.size());
+    for (const auto& entry : task.metadata) {
+        const uint32_t lengths[2] = {static_cast<uint32_t>(entry.first.size()),
+                                     static_cast<uint32_t>(entry.second.size())};
+        put(lengths, sizeof(lengths));
+        put(entry.first.data(), entry.first.size());
+        put(entry.second.data(), entry.second.size());
+    }
+    
+    // Zero the padding, so an unchanged task stages the same bytes every time
+    std::memset(cursor, 0, static_cast<size_t>(out + size - cursor));
+    return size;
+}
+
+bool OrbitalTaskManagerImpl::saveCheckpoint(CheckpointStore& store) {
+    SKYMESH_TRACE_SPAN("task.checkpoint_save_ns");
+    std::lock_guard<std::mutex> checkpoint_lock(checkpoint_mutex_);
+    
+    size_t capacity = 0;
+    uint8_t* out = store.stage(CheckpointSection::TASKS, capacity);
+    size_t offset = sizeof(TaskCheckpointHeader);
+    uint32_t count = 0;
+    uint64_t version = 0;
+    
+    // All three locks, so statuses, deadlines and trigger states are one consistent cut
+    {
+        auto map_lock = lockInstrumented(tasks_mutex_, tasks_lock_wait_);
+        std::lock_guard<std::mutex> trigger_lock(trigger_mutex_);
+        auto queue_lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
+        
+        version = state_version_.load(std::memory_order_relaxed);
+        if (checkpointed_store_ == &store && checkpointed_version_ == version) {
+            return true;
+        }
+        
+        // Handle order keeps unchanged tasks at the same offsets from save to save
+        std::vector<const TaskEntry*> entries;
+        for (TaskStatus status : {TaskStatus::PENDING, TaskStatus::RUNNING, TaskStatus::SUSPENDED}) {
+            const auto& index = status_index_[static_cast<size_t>(status)];
+            entries.insert(entries.end(), index.begin(), index.end());
+        }
+        std::sort(entries.begin(), entries.end(), [](const TaskEntry* a, const TaskEntry* b) {
+            return a->handle < b->handle;
+        });
+        
+        for (const TaskEntry* entry : entries) {
+            const size_t written = writeCheckpointRecordLocked(*entry, out + offset, capacity - offset);
+            if (written == 0) {
+                SKYMESH_LOG_ERROR(kLogComponent, "Cannot checkpoint tasks: ", entries.size(),
+                                  " tasks exceed the ", capacity, " byte section");
+                return false;
+            }
+            offset += written;
+            count++;
+        }
+    }
+    
+    const TaskCheckpointHeader header{kTaskCheckpointSchema, count, static_cast<uint64_t>(offset)};
+    std::memcpy(out, &header, sizeof(header));
+    if (!store.commit(CheckpointSection::TASKS, offset)) {
+        return false;
+    }
+    
+    checkpointed_store_ = &store;
+    checkpointed_version_ = version;
+    return true;
+}
+
+size_t OrbitalTaskManagerImpl::restoreCheckpoint(const CheckpointStore& store, const TaskFunctionResolver& resolver) {
+    SKYMESH_TRACE_SPAN("task.checkpoint_restore_ns");
+    
+    CheckpointView view;
+    const CheckpointReadStatus read_status = store.read(CheckpointSection::TASKS, view);
+    if (read_status == CheckpointReadStatus::EMPTY) {
+        return 0;
+    }
+    if (read_status == CheckpointReadStatus::CORRUPT) {
+        SKYMESH_LOG_ERROR(kLogComponent, "Task checkpoint is corrupt; starting with an empty schedule");
+        return 0;
+    }
+    if (read_status == CheckpointReadStatus::PREVIOUS) {
+        SKYMESH_LOG_WARNING(kLogComponent, "Latest task checkpoint is corrupt; restoring the one before it");
+    }
+    
+    const auto* header = reinterpret_cast<const TaskCheckpointHeader*>(view.data);
+    if (view.size < sizeof(TaskCheckpointHeader) || header->schema != kTaskCheckpointSchema ||
+        header->bytes != view.size) {
+        SKYMESH_LOG_ERROR(kLogComponent, "Task checkpoint has an unknown layout; starting with an empty schedule");
+        return 0;
+    }
+    
+    std::vector<std::shared_ptr<TaskEntry>> restored;
+    std::vector<std::shared_ptr<TaskEntry>> armed;
+    std::vector<std::shared_ptr<TaskEntry>> queued;
+    restored.reserve(header->count);
+    size_t dropped = 0;
+    size_t offset = sizeof(TaskCheckpointHeader);
+    
+    for (uint32_t i = 0; i < header->count; ++i) {
+        const auto* record = reinterpret_cast<const TaskCheckpointRecord*>(view.data + offset);
+        if (view.size - offset < sizeof(TaskCheckpointRecord) || record->size < sizeof(TaskCheckpointRecord) ||
+            record->size > view.size - offset) {
+            SKYMESH_LOG_ERROR(kLogComponent, "Task checkpoint is truncated after ", i, " tasks");
+            break;
+        }
+        const char* cursor = reinterpret_cast<const char*>(record + 1);
+        const char* end = reinterpret_cast<const char*>(record) + record->size;
+        offset += record->size;
+        
+        auto take = [&cursor, end](std::string& value, size_t length) {
+            if (static_cast<size_t>(end - cursor) < length) {
+                return false;
+            }
+            value.assign(cursor, length);
+            cursor += length;
+            return true;
+        };
+        
+        OrbitalTask task;
+        TriggerCondition condition;
+        std::string event;
+        std::string dependency;
+        bool valid = record->type <= static_cast<uint8_t>(TaskType::FIRMWARE_UPDATE) &&
+                     record->priority <= static_cast<uint8_t>(TaskPriority::IDLE) &&
+                     record->recovery_strategy <= static_cast<uint8_t>(RecoveryStrategy::SAFE_MODE) &&
+                     record->tmr_mode <= static_cast<uint8_t>(TmrMode::DUAL_TIE_BREAK) &&
+                     take(task.task_id, record->id_length) && take(task.name, record->name_length) &&
+                     take(event, record->event_length) && take(dependency, record->dependency_length);
+        for (uint16_t m = 0; valid && m < record->metadata_count; ++m) {
+            uint32_t lengths[2];
+            std::string key;
+            std::string value;
+            if (static_cast<size_t>(end - cursor) < sizeof(lengths)) {
+                valid = false;
+                break;
+            }
+            std::memcpy(lengths, cursor, sizeof(lengths));
+            cursor += sizeof(lengths);
+            valid = take(key, lengths[0]) && take(value, lengths[1]);
+            task.metadata.emplace(std::move(key), std::move(value));
+        }
+        if (!valid || task.task_id.empty()) {
+            dropped++;
+            continue;
+        }
+        
+        task.type = static_cast<TaskType>(record->type);
+        task.priority = static_cast<TaskPriority>(record->priority);
+        task.scheduled_time = fromCheckpointTime(record->scheduled_ns);
+        task.timeout = std::chrono::milliseconds(record->timeout_ms);
+        task.recovery_strategy = static_cast<RecoveryStrategy>(record->recovery_strategy);
+        task.radiation_protected = (record->flags & kTaskFlagRadiationProtected) != 0;
+        task.tmr_mode = static_cast<TmrMode>(record->tmr_mode);
+        task.retry_count = record->retry_count;
+        task.energy_cost_wh = record->energy_cost_wh;
+        task.peak_power_w = record->peak_power_w;
+        
+        if (record->flags & kTaskFlagOrbitTrigger) {
+            condition.orbit_position = OrbitPosition{record->orbit_altitude_km, record->orbit_latitude,
+                                                     record->orbit_longitude, record->orbit_velocity_kmps,
+                                                     fromCheckpointTime(record->orbit_timestamp_ns)};
+        }
+        if (record->flags & kTaskFlagEventTrigger) {
+            condition.event_name = std::move(event);
+        }
+        if (record->flags & kTaskFlagTimeTrigger) {
+            condition.time_point = fromCheckpointTime(record->trigger_time_ns);
+        }
+        if (record->flags & kTaskFlagDependencyTrigger) {
+            condition.dependency_task_id = std::move(dependency);
+        }
+        condition.position_tolerance_deg = record->position_tolerance_deg;
+        condition.altitude_tolerance_km = record->altitude_tolerance_km;
+        
+        task.task_function = resolver ? resolver(task) : nullptr;
+        if (!task.task_function) {
+            dropped++;
+            continue;
+        }
+        auto task_entry = createTaskEntry(std::move(task));
+        if (!task_entry) {
+            dropped++;
+            continue;
+        }
+        
+        const bool is_armed = (record->flags & kTaskFlagArmed) != 0;
+        task_entry->status = record->status == static_cast<uint8_t>(TaskStatus::SUSPENDED)
+            ? TaskStatus::SUSPENDED : TaskStatus::PENDING;
+        task_entry->is_recurring = (record->flags & kTaskFlagRecurring) != 0;
+        task_entry->recurring_interval = std::chrono::milliseconds(record->interval_ms);
+        task_entry->trigger_condition = std::move(condition);
+        task_entry->trigger_fired = hasTrigger(task_entry->trigger_condition) && !is_armed;
+        
+        if (is_armed) {
+            armed.push_back(task_entry);
+        } else if (task_entry->status == TaskStatus::PENDING) {
+            queued.push_back(task_entry);
+        }
+        restored.push_back(std::move(task_entry));
+    }
+    
+    // Insert everything before arming, so dependencies on restored tasks resolve
+    {
+        auto map_lock = lockInstrumented(tasks_mutex_, tasks_lock_wait_);
+        task_map_.reserve(task_map_.size() + restored.size());
+        for (const auto& task_entry : restored) {
+            insertTaskLocked(task_entry);
+        }
+        
+        std::lock_guard<std::mutex> trigger_lock(trigger_mutex_);
+        for (const auto& task_entry : armed) {
+            armTriggersLocked(task_entry);
+        }
+    }
+    
+    {
+        auto queue_lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
+        enqueueTasksLocked(queued, currentTime());
+    }
+    notifyWorkers(true);
+    
+    SKYMESH_LOG_INFO(kLogComponent, "Restored ", restored.size(), " tasks from checkpoint generation ",
+                     view.generation, " (", dropped, " dropped)");
+    return restored.size();
+}
+
 // Implementation of thread methods
 
-void OrbitalTaskManagerImpl::taskExecutionThread() {
-    log_info("Task execution thread started");
+std::array<LatencyHistogram*, OrbitalTaskManagerImpl::kTaskTypeCount> OrbitalTaskManagerImpl::runtimeHistograms() {
+    static constexpr const char* kNames[kTaskTypeCount] = {
+        "task.runtime_ns.communication", "task.runtime_ns.power_management", "task.runtime_ns.telemetry",
+        "task.runtime_ns.attitude_control", "task.runtime_ns.orbital_maneuver",
+        "task.runtime_ns.payload_operation", "task.runtime_ns.health_check", "task.runtime_ns.maintenance",
+        "task.runtime_ns.firmware_update"};
+    std::array<LatencyHistogram*, kTaskTypeCount> histograms{};
+    for (size_t type = 0; type < kTaskTypeCount; ++type) {
+        histograms[type] = &MetricsRegistry::instance().histogram(kNames[type]);
+    }
+    return histograms;
+}
+
+void OrbitalTaskManagerImpl::workerThread() {
+    SKYMESH_LOG_INFO(kLogComponent, "Task worker thread started");
     
     while (running_) {
         std::shared_ptr<TaskEntry> task_entry;
         
-        // Wait for a task to be available in the queue
+        // Wait until a task is ready, sleeping no longer than the next deadline
         {
-            std::unique_lock<std::mutex> lock(queue_mutex_);
-            queue_condition_.wait(lock, [this] {
-                return !running_ || !task_queue_.empty();
-            });
+            auto lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
+            while (running_) {
+                auto now = currentTime();
+                promoteDueTasksLocked(now);
+                
+                // Get the highest priority task this worker may run
+                task_entry = takeNextReadyLocked(now);
+                if (task_entry) {
+                    break;
+                }
+                
+                auto wake = nextWakeLocked();
+                if (!wake) {
+                    queue_condition_.wait(lock);
+                } else {
+                    queue_condition_.wait_until(lock, *wake);
+                }
+            }
             
             // Check if we should exit
             if (!running_) {
                 break;
             }
-            
-            // Get the highest priority task
-            if (!task_queue_.empty()) {
-                task_entry = task_queue_.top();
-                task_queue_.pop();
-            }
         }
         
         // Process the task if we got one
         if (task_entry) {
-            // Check if scheduled time has arrived
-            auto now = std::chrono::system_clock::now();
-            if (task_entry->task.scheduled_time > now) {
-                // Task scheduled for the future, put it back in the queue
-                std::lock_guard<std::mutex> lock(queue_mutex_);
-                task_queue_.push(task_entry);
-                
-                // Sleep for a short time to avoid busy waiting
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
-                continue;
-            }
-            
-            // Check if task is still valid (not canceled or suspended)
-            {
-                std::lock_guard<std::mutex> lock(tasks_mutex_);
-                if (task_entry->status != TaskStatus::PENDING) {
-                    // Skip this task
-                    continue;
-                }
-                
-                // Mark task as running
-                task_entry->status = TaskStatus::RUNNING;
-                task_entry->actual_start_time = now;
-            }
-            
-            log_info("Executing task: " + task_entry->task.name + 
-                     " (ID: " + task_entry->task.task_id + 
-                     ", Type: " + std::to_string(static_cast<int>(task_entry->task.type)) + ")");
-            
-            // Execute the task
-            TaskResult result;
-            try {
-                result = executeTask(task_entry);
-                
-                // Update task status
-                {
-                    std::lock_guard<std::mutex> lock(tasks_mutex_);
-                    task_entry->status = result.status;
-                    task_entry->actual_end_time = result.end_time;
-                    task_entry->error_message = result.error_message;
-                    task_entry->result_data = result.output_data;
-                    task_entry->radiation_event_detected = result.radiation_event_detected;
-                }
-                
-                // Store result
-                {
-                    std::lock_guard<std::mutex> lock(results_mutex_);
-                    task_results_[task_entry->task.task_id] = result;
-                }
-                
-                // Update metrics
-                tasks_executed_++;
-                if (result.status == TaskStatus::FAILED) {
-                    tasks_failed_++;
-                }
-                if (result.radiation_event_detected) {
-                    radiation_events_++;
-                }
-                
-                // Notify completion callbacks
-                notifyTaskCompletion(result);
-                
-                // Handle recurring tasks
-                if (task_entry->is_recurring && result.status == TaskStatus::COMPLETED) {
-                    auto next_task = std::make_shared<TaskEntry>(*task_entry);
-                    next_task->status = TaskStatus::PENDING;
-                    next_task->task.scheduled_time = std::chrono::system_clock::now() + 
-                                                     next_task->recurring_interval;
-                    
-                    // Add to queue
-                    {
-                        std::lock_guard<std::mutex> lock(queue_mutex_);
-                        task_queue_.push(next_task);
-                    }
-                }
-            } 
-            catch (const std::exception& e) {
-                // Log the error
-                log_error("Exception occurred while executing task " + 
-                         task_entry->task.task_id + ": " + e.what());
-                
-                // Update task status
-                {
-                    std::lock_guard<std::mutex> lock(tasks_mutex_);
-                    task_entry->status = TaskStatus::FAILED;
-                    task_entry->error_message = "Exception: " + std::string(e.what());
-                }
-                
-                // Update metrics
-                tasks_executed_++;
-                tasks_failed_++;
-            }
-            catch (...) {
-                // Log the error
-                log_error("Unknown exception occurred while executing task " + 
-                         task_entry->task.task_id);
-                
-                // Update task status
-                {
-                    std::lock_guard<std::mutex> lock(tasks_mutex_);
-                    task_entry->status = TaskStatus::FAILED;
-                    task_entry->error_message = "Unknown exception";
-                }
-                
-                // Update metrics
-                tasks_executed_++;
-                tasks_failed_++;
-            }
+            runTask(task_entry);
         }
     }
     
-    log_info("Task execution thread stopped");
+    SKYMESH_LOG_INFO(kLogComponent, "Task worker thread stopped");
 }
 
-void OrbitalTaskManagerImpl::taskSchedulingThread() {
-    log_info("Task scheduling thread started");
+void OrbitalTaskManagerImpl::runTask(const std::shared_ptr<TaskEntry>& task_entry) {
+    auto now = currentTime();
     
-    // How often to check conditional tasks (in milliseconds)
-    const auto check_interval = std::chrono::milliseconds(1000);
+    // Give the worker slot back however this task ends
+    auto release_slot = [this, &task_entry] {
+        {
+            auto lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
+            releaseWorkerSlotLocked(task_entry);
+        }
+        notifyWorkers(true);
+    };
     
-    while (running_) {
-        // Sleep for a bit to avoid busy waiting
+    // Check if task is still valid (not canceled or suspended)
+    {
+        auto lock = lockInstrumented(tasks_mutex_, tasks_lock_wait_);
+        if (task_entry->status != TaskStatus::PENDING) {
+            // Skip this task
+            release_slot();
+            return;
+        }
+        
+        // Mark task as running
+        setStatusLocked(*task_entry, TaskStatus::RUNNING);
+        task_entry->actual_start_time = now;
+    }
+    const auto late = now - task_entry->deadline;
+    dispatch_latency_.record(late > std::chrono::system_clock::duration::zero()
+        ? static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(late).count()) : 0);
+    
+    SKYMESH_LOG_DEBUG(kLogComponent, "Executing task: ", task_entry->task.name,
+                      " (ID: ", task_entry->task.task_id,
+                      ", Type: ", static_cast<int>(task_entry->task.type), ")");
+    
+    // Execute the task; the result is built in place on the entry
+    const TaskResult& result = task_entry->result;
+    LatencyHistogram& runtime = *runtime_by_type_[static_cast<size_t>(task_entry->task.type)];
+    const uint64_t started_ns = monotonicNanoseconds();
+    try {
+        executeTask(task_entry);
+        runtime.record(monotonicNanoseconds() - started_ns);
+        
+        // Update task status. Recurring tasks re-arm the same entry,
+        // so a steady-state tick allocates nothing.
+        bool rearm = task_entry->is_recurring && result.status == TaskStatus::COMPLETED;
         {
-            std::unique_lock<std::mutex> lock(execution_mutex_);
-            execution_condition_.wait_for(lock, check_interval, [this] {
-                return !running_;
-            });
-            
-            // Check if we should exit
-            if (!running_) {
-                break;
+            auto lock = lockInstrumented(tasks_mutex_, tasks_lock_wait_);
+            setStatusLocked(*task_entry, rearm ? TaskStatus::PENDING : result.status);
+            task_entry->actual_end_time = result.end_time;
+            task_entry->error_message = result.error_message;
+            task_entry->result_data = result.output_data;
+            task_entry->radiation_event_detected = result.radiation_event_detected;
+        }
+        
+        // Store result; evicting old results also forgets their tasks
+        std::vector<std::string> evicted;
+        {
+            std::lock_guard<std::mutex> lock(results_mutex_);
+            result_store_.put(result, &evicted);
+        }
+        if (!evicted.empty()) {
+            auto lock = lockInstrumented(tasks_mutex_, tasks_lock_wait_);
+            forgetEvictedTasksLocked(evicted);
+        }
+        
+        // Release tasks that were waiting on this one
+        if (result.status == TaskStatus::COMPLETED) {
+            fireDependentTasks(task_entry->task.task_id);
+        }
+        
+        // Update metrics
+        tasks_executed_++;
+        executed_counter_.add();
+        if (result.status == TaskStatus::FAILED) {
+            tasks_failed_++;
+            failed_counter_.add();
+        }
+        if (result.radiation_event_detected) {
+            radiation_events_++;
+            radiation_counter_.add();
+        }
+        
+        // Notify completion callbacks
+        notifyTaskCompletion(result, task_entry->task.type);
+        
+        // Queue the next run: a retry now, or the next recurring tick.
+        // This happens only once the status is settled, so no other
+        // worker can pick the entry up while it is still marked running.
+        if (rearm || result.status == TaskStatus::PENDING) {
+            auto requeue_time = currentTime();
+            {
+                auto lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
+                if (rearm) {
+                    task_entry->deadline = requeue_time + task_entry->recurring_interval;
+                    state_version_.fetch_add(1, std::memory_order_relaxed);
+                }
+                enqueueTaskLocked(task_entry, requeue_time);
             }
+            notifyWorkers();
         }
+    } 
+    catch (const std::exception& e) {
+        // Log the error
+        SKYMESH_LOG_ERROR(kLogComponent, "Exception occurred while executing task ",
+                          task_entry->task.task_id, ": ", e.what());
         
-        // Get current time and position
-        auto now = std::chrono::system_clock::now();
-        OrbitPosition current_pos;
+        // Update task status
         {
-            std::lock_guard<std::mutex> lock(position_mutex_);
-            current_pos = current_position_;
+            auto lock = lockInstrumented(tasks_mutex_, tasks_lock_wait_);
+            setStatusLocked(*task_entry, TaskStatus::FAILED);
+            task_entry->error_message = "Exception: " + std::string(e.what());
         }
         
-        // Check all conditional tasks
-        std::vector<std::shared_ptr<TaskEntry>> triggered_tasks;
+        // Update metrics
+        runtime.record(monotonicNanoseconds() - started_ns);
+        tasks_executed_++;
+        tasks_failed_++;
+        executed_counter_.add();
+        failed_counter_.add();
+    }
+    catch (...) {
+        // Log the error
+        SKYMESH_LOG_ERROR(kLogComponent, "Unknown exception occurred while executing task ",
+                          task_entry->task.task_id);
         
+        // Update task status
         {
-            std::lock_guard<std::mutex> lock(queue_mutex_);
+            auto lock = lockInstrumented(tasks_mutex_, tasks_lock_wait_);
+            setStatusLocked(*task_entry, TaskStatus::FAILED);
+            task_entry->error_message = "Unknown exception";
+        }
+        
+        // Update metrics
+        runtime.record(monotonicNanoseconds() - started_ns);
+        tasks_executed_++;
+        tasks_failed_++;
+        executed_counter_.add();
+        failed_counter_.add();
+    }
+    
+    release_slot();
+}
+
+void OrbitalTaskManagerImpl::dispatchOnExecutor() {
+    {
+        auto lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
+        dispatch_timer_ = 0;
+        dispatching_ = true;
+    }
+    
+    // Same order as the workers: promote what is due, then run the most
+    // urgent ready task, until nothing can run at this instant
+    while (running_) {
+        std::shared_ptr<TaskEntry> task_entry;
+        {
+            auto lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
+            auto now = currentTime();
+            promoteDueTasksLocked(now);
+            task_entry = takeNextReadyLocked(now);
+            if (!task_entry) {
+                dispatching_ = false;
+                scheduleDispatchLocked(false);
+                return;
+            }
+        }
+        runTask(task_entry);
+    }
+    
+    auto lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
+    dispatching_ = false;
+}
+
+void OrbitalTaskManagerImpl::scheduleDispatchLocked(bool ready_now) {
+    // A running pass picks new work up itself
+    if (!running_ || dispatching_) {
+        return;
+    }
+    
+    std::optional<std::chrono::system_clock::time_point> wake;
+    const bool ready = ready_now && std::any_of(ready_lanes_.begin(), ready_lanes_.end(),
+                                                [](const auto& lane) { return !lane.empty(); });
+    if (ready) {
+        wake = currentTime();
+    } else {
+        wake = nextWakeLocked();
+    }
+    if (!wake || (dispatch_timer_ != 0 && dispatch_due_ <= *wake)) {
+        return;
+    }
+    
+    if (dispatch_timer_ != 0) {
+        executor_->cancel(dispatch_timer_);
+    }
+    dispatch_due_ = *wake;
+    dispatch_timer_ = executor_->scheduleAt(*wake, [this] { dispatchOnExecutor(); });
+}
+
+void OrbitalTaskManagerImpl::notifyWorkers(bool all) {
+    if (executor_) {
+        auto lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
+        scheduleDispatchLocked(true);
+    } else if (all) {
+        queue_condition_.notify_all();
+    } else {
+        queue_condition_.notify_one();
+    }
+}
+
+std::chrono::system_clock::time_point OrbitalTaskManagerImpl::currentTime() const {
+    return executor_ ? executor_->now() : std::chrono::system_clock::now();
+}
+
+void OrbitalTaskManagerImpl::enqueueTaskLocked(
+    const std::shared_ptr<TaskEntry>& task_entry, std::chrono::system_clock::time_point now) {
+    
+    // A task already waiting in a queue is picked up from there
+    if (task_entry->queued) {
+        return;
+    }
+    task_entry->queued = true;
+    
+    if (task_entry->deadline <= now) {
+        auto& lane = ready_lanes_[static_cast<size_t>(task_entry->task.priority)];
+        lane.push_back(task_entry);
+        std::push_heap(lane.begin(), lane.end(), ReadyOrder());
+    } else {
+        timer_queue_.push_back(task_entry);
+        std::push_heap(timer_queue_.begin(), timer_queue_.end(), DeadlineOrder());
+    }
+}
+
+void OrbitalTaskManagerImpl::enqueueTasksLocked(
+    const std::vector<std::shared_ptr<TaskEntry>>& task_entries,
+    std::chrono::system_clock::time_point now) {
+    
+    // Append unsorted and remember where each heap's old contents end
+    std::array<size_t, kPriorityCount> lane_sizes;
+    for (size_t p = 0; p < kPriorityCount; ++p) {
+        lane_sizes[p] = ready_lanes_[p].size();
+    }
+    size_t timer_size = timer_queue_.size();
+    
+    for (const auto& task_entry : task_entries) {
+        if (task_entry->queued) {
+            continue;
+        }
+        task_entry->queued = true;
+        
+        if (task_entry->deadline <= now) {
+            ready_lanes_[static_cast<size_t>(task_entry->task.priority)].push_back(task_entry);
+        } else {
+            timer_queue_.push_back(task_entry);
+        }
+    }
+    
+    // Heapify in bulk when the batch dominates, otherwise sift each new element
+    auto restore_heap = [](auto& heap, size_t old_size, auto order) {
+        if (heap.size() - old_size > old_size) {
+            std::make_heap(heap.begin(), heap.end(), order);
+        } else {
+            for (size_t i = old_size + 1; i <= heap.size(); ++i) {
+                std::push_heap(heap.begin(), heap.begin() + i, order);
+            }
+        }
+    };
+    for (size_t p = 0; p < kPriorityCount; ++p) {
+        restore_heap(ready_lanes_[p], lane_sizes[p], ReadyOrder());
+    }
+    restore_heap(timer_queue_, timer_size, DeadlineOrder());
+}
+
+void OrbitalTaskManagerImpl::promoteDueTasksLocked(std::chrono::system_clock::time_point now) {
+    while (!timer_queue_.empty() && timer_queue_.front()->deadline <= now) {
+        std::pop_heap(timer_queue_.begin(), timer_queue_.end(), DeadlineOrder());
+        auto& lane = ready_lanes_[static_cast<size_t>(timer_queue_.back()->task.priority)];
+        lane.push_back(std::move(timer_queue_.back()));
+        timer_queue_.pop_back();
+        std::push_heap(lane.begin(), lane.end(), ReadyOrder());
+    }
+    
+    for (size_t type = 0; type < kTaskTypeCount; ++type) {
+        const CoalesceGroup& group = coalesce_groups_[type];
+        if (!group.members.empty() && group.release_at <= now) {
+            releaseGroupLocked(type);
+        }
+    }
+}
+
+std::optional<std::chrono::system_clock::time_point> OrbitalTaskManagerImpl::nextWakeLocked() const {
+    std::optional<std::chrono::system_clock::time_point> wake;
+    if (!timer_queue_.empty()) {
+        wake = timer_queue_.front()->deadline;
+    }
+    for (const CoalesceGroup& group : coalesce_groups_) {
+        if (!group.members.empty() && (!wake || group.release_at < *wake)) {
+            wake = group.release_at;
+        }
+    }
+    return wake;
+}
+
+bool OrbitalTaskManagerImpl::admitTaskLocked(std::shared_ptr<TaskEntry>& task_entry,
+                                             std::chrono::system_clock::time_point now) {
+    if (!admission_policy_ || task_entry->admitted) {
+        return true;
+    }
+    
+    TaskAdmission admission = admission_policy_->admit(task_entry->task, now);
+    switch (admission.action) {
+        case AdmissionAction::ADMIT:
+            break;
             
-            // Identify triggered tasks
-            auto it = conditional_tasks_.begin();
-            while (it != conditional_tasks_.end()) {
-                auto task_entry = *it;
-                
-                // Skip if not pending
-                if (task_entry->status != TaskStatus::PENDING) {
-                    ++it;
-                    continue;
-                }
-                
-                // Check if task should be triggered
-                bool should_trigger = shouldExecuteConditionalTask(task_entry->trigger_condition);
-                
-                if (should_trigger) {
-                    // Set scheduled time to now
-                    task_entry->task.scheduled_time = now;
-                    
-                    // Add to triggered tasks
-                    triggered_tasks.push_back(task_entry);
-                    
-                    // Remove from conditional tasks if non-recurring
-                    if (!task_entry->is_recurring) {
-                        it = conditional_tasks_.erase(it);
-                    } else {
-                        ++it;
-                    }
-                } else {
-                    ++it;
+        case AdmissionAction::DEFER: {
+            // Back to the timer heap; the task stays queued and is asked again when due
+            task_entry->deadline = std::max(admission.not_before, now + std::chrono::milliseconds(1));
+            timer_queue_.push_back(std::move(task_entry));
+            std::push_heap(timer_queue_.begin(), timer_queue_.end(), DeadlineOrder());
+            return false;
+        }
+        
+        case AdmissionAction::COALESCE: {
+            size_t type = static_cast<size_t>(task_entry->task.type);
+            CoalesceGroup& group = coalesce_groups_[type];
+            if (group.members.empty()) {
+                group.release_at = admission.not_before;
+                group.batch_size = admission.batch_size;
+            } else {
+                // The group goes as soon as its most urgent member needs it to
+                group.release_at = std::min(group.release_at, admission.not_before);
+                if (admission.batch_size != 0 &&
+                    (group.batch_size == 0 || admission.batch_size < group.batch_size)) {
+                    group.batch_size = admission.batch_size;
                 }
             }
-            
-            // Add triggered tasks to task queue
-            for (const auto& task : triggered_tasks) {
-                task_queue_.push(task);
+            group.members.push_back(std::move(task_entry));
+            if ((group.batch_size != 0 && group.members.size() >= group.batch_size) ||
+                group.release_at <= now) {
+                releaseGroupLocked(type);
             }
+            return false;
+        }
+    }
+    
+    task_entry->admitted = true;
+    return true;
+}
+
+void OrbitalTaskManagerImpl::releaseGroupLocked(size_t type) {
+    CoalesceGroup& group = coalesce_groups_[type];
+    std::vector<const OrbitalTask*> released;
+    released.reserve(group.members.size());
+    
+    for (auto& member : group.members) {
+        member->admitted = true;
+        released.push_back(&member->task);
+        auto& lane = ready_lanes_[static_cast<size_t>(member->task.priority)];
+        lane.push_back(member);
+        std::push_heap(lane.begin(), lane.end(), ReadyOrder());
+    }
+    
+    if (admission_policy_) {
+        admission_policy_->onBatchReleased(static_cast<TaskType>(type), released);
+    }
+    group.members.clear();
+    group.batch_size = 0;
+}
+
+std::shared_ptr<OrbitalTaskManagerImpl::TaskEntry> OrbitalTaskManagerImpl::takeNextReadyLocked(
+    std::chrono::system_clock::time_point now) {
+    for (size_t p = 0; p < kPriorityCount; ++p) {
+        // Capacities only shrink with priority, so nothing below can run either
+        if (busy_workers_ >= lane_capacity_[p]) {
+            break;
         }
         
-        // Notify execution thread if we triggered any tasks
-        if (!triggered_tasks.empty()) {
-            queue_condition_.notify_one();
-            log_debug("Triggered " + std::to_string(triggered_tasks.size()) + " conditional tasks");
+        auto& lane = ready_lanes_[p];
+        while (!lane.empty()) {
+            std::pop_heap(lane.begin(), lane.end(), ReadyOrder());
+            std::shared_ptr<TaskEntry> task_entry = std::move(lane.back());
+            lane.pop_back();
+            
+            // Deferred and coalesced tasks leave the lane here
+            if (!admitTaskLocked(task_entry, now)) {
+                continue;
+            }
+            
+            size_t type = static_cast<size_t>(task_entry->task.type);
+            if (type_limit_[type] != 0 && running_by_type_[type] >= type_limit_[type]) {
+                // Park until a task of this type finishes
+                type_blocked_[type].push_back(std::move(task_entry));
+                continue;
+            }
+            
+            task_entry->queued = false;
+            task_entry->admitted = false;
+            busy_workers_++;
+            running_by_type_[type]++;
+            return task_entry;
         }
     }
     
-    log_info("Task scheduling thread stopped");
+    return nullptr;
 }
 
-TaskResult OrbitalTaskManagerImpl::executeTask(const std::shared_ptr<TaskEntry>& task_entry) {
-    TaskResult result;
-    result.task_id = task_entry->task.task_id;
-    result.start_time = std::chrono::system_clock::now();
+void OrbitalTaskManagerImpl::releaseWorkerSlotLocked(const std::shared_ptr<TaskEntry>& task_entry) {
+    size_t type = static_cast<size_t>(task_entry->task.type);
+    busy_workers_--;
+    running_by_type_[type]--;
+    
+    // Return parked tasks of this type to their lanes
+    for (auto& parked : type_blocked_[type]) {
+        auto& lane = ready_lanes_[static_cast<size_t>(parked->task.priority)];
+        lane.push_back(std::move(parked));
+        std::push_heap(lane.begin(), lane.end(), ReadyOrder());
+    }
+    type_blocked_[type].clear();
+}
+
+void OrbitalTaskManagerImpl::executeTask(const std::shared_ptr<TaskEntry>& task_entry) {
+    TaskResult& result = task_entry->result;
+    result.start_time = currentTime();
     result.radiation_event_detected = false;
     result.retry_attempts = task_entry->actual_retry_count;
+    result.error_message.clear();
+    result.output_data.clear();
     
-    // Configure task context
-    TaskContext context = default_context_;
-    if (task_entry->task.metadata.count("memory_limit_bytes")) {
-        context.memory_limit_bytes = 
-            std::stoul(task_entry->task.metadata.at("memory_limit_bytes"));
-    }
-    if (task_entry->task.metadata.count("cpu_time_limit_ms")) {
-        context.cpu_time_limit_ms = 
-            std::stoul(task_entry->task.metadata.at("cpu_time_limit_ms"));
-    }
-    if (task_entry->task.metadata.count("allow_io_operations")) {
-        context.allow_io_operations = 
-            task_entry->task.metadata.at("allow_io_operations") == "true";
-    }
-    if (task_entry->task.metadata.count("allow_critical_subsystems")) {
-        context.allow_critical_subsystems = 
-            task_entry->task.metadata.at("allow_critical_subsystems") == "true";
-    }
+    // Task context was configured at schedule time
+    const TaskContext& context = task_entry->context;
     
     // Execute the task, with radiation protection if needed
     bool success = false;
     try {
         if (task_entry->task.radiation_protected) {
             // Use triple modular redundancy for critical tasks
-            success = executeWithTMR(task_entry->task.task_function, context);
+            success = executeWithTMR(task_entry, result.radiation_event_detected);
         } else {
             // For non-critical tasks, execute without TMR
             success = task_entry->task.task_function(context);
@@ -977,17 +2378,17 @@ TaskResult OrbitalTaskManagerImpl::executeTask(const std::shared_ptr<TaskEntry>&
     catch (const std::exception& e) {
         result.status = TaskStatus::FAILED;
         result.error_message = "Exception during execution: " + std::string(e.what());
-        result.end_time = std::chrono::system_clock::now();
-        return result;
+        result.end_time = currentTime();
+        return;
     }
     catch (...) {
         result.status = TaskStatus::FAILED;
         result.error_message = "Unknown exception during execution";
-        result.end_time = std::chrono::system_clock::now();
-        return result;
+        result.end_time = currentTime();
+        return;
     }
     
-    result.end_time = std::chrono::system_clock::now();
+    result.end_time = currentTime();
     
     // Check for timeout
     auto execution_time = std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -998,7 +2399,7 @@ TaskResult OrbitalTaskManagerImpl::executeTask(const std::shared_ptr<TaskEntry>&
         result.error_message = "Task timed out (took " + std::to_string(execution_time) + 
                               " ms, limit: " + 
                               std::to_string(task_entry->task.timeout.count()) + " ms)";
-        return result;
+        return;
     }
     
     // Handle task success or failure
@@ -1011,17 +2412,11 @@ TaskResult OrbitalTaskManagerImpl::executeTask(const std::shared_ptr<TaskEntry>&
             task_entry->actual_retry_count++;
             
             // Log the retry
-            log_info("Retrying task: " + task_entry->task.task_id + 
-                     " (Attempt " + std::to_string(task_entry->actual_retry_count) + 
-                     " of " + std::to_string(task_entry->task.retry_count) + ")");
+            SKYMESH_LOG_INFO(kLogComponent, "Retrying task: ", task_entry->task.task_id,
+                             " (Attempt ", task_entry->actual_retry_count,
+                             " of ", task_entry->task.retry_count, ")");
             
-            // Re-add to priority queue
-            {
-                std::lock_guard<std::mutex> lock(queue_mutex_);
-                task_queue_.push(task_entry);
-            }
-            
-            // Mark as pending for next execution
+            // Mark as pending; the worker requeues it once the status is updated
             result.status = TaskStatus::PENDING;
         } else {
             result.status = TaskStatus::FAILED;
@@ -1029,176 +2424,260 @@ TaskResult OrbitalTaskManagerImpl::executeTask(const std::shared_ptr<TaskEntry>&
                                   std::to_string(task_entry->actual_retry_count) + " retries";
         }
     }
-    
-    return result;
 }
 
 bool OrbitalTaskManagerImpl::executeWithTMR(
-    const std::function<bool(const TaskContext&)>& func, const TaskContext& context) {
+    const std::shared_ptr<TaskEntry>& task_entry, bool& radiation_detected) {
+    
+    const TmrMode mode = task_entry->task.tmr_mode;
+    SKYMESH_LOG_DEBUG(kLogComponent, "Executing task with Triple Modular Redundancy (mode ",
+                      static_cast<int>(mode), ")");
+    
+    auto vote = std::make_shared<TmrVote>();
+    vote->task_entry = task_entry;
+    
+    // Without pinning the dispatching worker runs replica 0 itself; with
+    // pinning every replica runs on its own core's slot
+    const bool concurrent = mode != TmrMode::SEQUENTIAL;
+    const bool pinned = pool_config_.pin_tmr_replicas;
+    
+    auto majority_reached = [&vote] {
+        uint32_t agree_true = 0;
+        uint32_t agree_false = 0;
+        for (int8_t outcome : vote->outcomes) {
+            agree_true += outcome == 1;
+            agree_false += outcome == 0;
+        }
+        return agree_true >= 2 || agree_false >= 2;
+    };
+    
+    auto wait_for = [&](auto predicate) {
+        std::unique_lock<std::mutex> lock(vote->mutex);
+        vote->condition.wait(lock, predicate);
+    };
     
-    log_debug("Executing task with Triple Modular Redundancy");
+    size_t first_round = mode == TmrMode::DUAL_TIE_BREAK ? 2 : TmrReplicaPool::kSlotCount;
+    if (!concurrent) {
+        for (size_t replica = 0; replica < first_round; ++replica) {
+            launchTmrReplica(vote, replica, true);
+        }
+    } else {
+        // Hand the pooled replicas to their slots before running replica 0
+        // here, so all of them overlap
+        for (size_t replica = 1; replica < first_round; ++replica) {
+            launchTmrReplica(vote, replica, false);
+        }
+        launchTmrReplica(vote, 0, !pinned);
+    }
     
-    // Execute function three times independently
-    bool result1 = false;
-    bool result2 = false;
-    bool result3 = false;
-    bool radiation_detected = false;
+    // Vote as soon as two replicas agree or every launched replica is done
+    wait_for([&] { return majority_reached() || vote->finished == vote->launched; });
     
-    try {
-        result1 = func(context);
-    } catch (const std::exception& e) {
-        log_warning("TMR execution 1 failed with exception: " + std::string(e.what()));
-        radiation_detected = true;
-    } catch (...) {
-        log_warning("TMR execution 1 failed with unknown exception");
-        radiation_detected = true;
+    if (mode == TmrMode::DUAL_TIE_BREAK) {
+        bool need_tie_break = false;
+        {
+            std::lock_guard<std::mutex> lock(vote->mutex);
+            need_tie_break = !majority_reached();
+        }
+        if (need_tie_break) {
+            SKYMESH_LOG_WARNING(kLogComponent, "TMR dual replicas disagree, running tie-break replica");
+            launchTmrReplica(vote, 2, !pinned);
+            wait_for([&] { return majority_reached(); });
+        }
     }
     
-    try {
-        result2 = func(context);
-    } catch (const std::exception& e) {
-        log_warning("TMR execution 2 failed with exception: " + std::string(e.what()));
-        radiation_detected = true;
-    } catch (...) {
-        log_warning("TMR execution 2 failed with unknown exception");
-        radiation_detected = true;
+    std::lock_guard<std::mutex> lock(vote->mutex);
+    uint32_t agree_true = 0;
+    for (int8_t outcome : vote->outcomes) {
+        agree_true += outcome == 1;
     }
+    vote->decision = agree_true >= 2;
+    vote->decided = true;
     
+    // Any finished replica outside the majority, or any fault, is an upset
+    radiation_detected = vote->fault_seen;
+    for (int8_t outcome : vote->outcomes) {
+        if (outcome != -1 && (outcome == 1) != vote->decision) {
+            radiation_detected = true;
+        }
+    }
+    
+    if (radiation_detected) {
+        SKYMESH_LOG_WARNING(kLogComponent, "TMR detected potential radiation event in task ",
+                            task_entry->task.task_id);
+    }
+    
+    return vote->decision;
+}
+
+void OrbitalTaskManagerImpl::launchTmrReplica(
+    const std::shared_ptr<TmrVote>& vote, size_t replica, bool inline_run) {
+    
+    {
+        std::lock_guard<std::mutex> lock(vote->mutex);
+        vote->launched++;
+    }
+    
+    if (inline_run) {
+        runTmrReplica(vote, replica);
+    } else {
+        tmr_pool_.submit(replica, [this, vote, replica] { runTmrReplica(vote, replica); });
+    }
+}
+
+void OrbitalTaskManagerImpl::runTmrReplica(const std::shared_ptr<TmrVote>& vote, size_t replica) {
+    const TaskEntry& task_entry = *vote->task_entry;
+    
+    bool outcome = false;
+    bool fault = false;
     try {
-        result3 = func(context);
+        outcome = task_entry.task.task_function(task_entry.context);
     } catch (const std::exception& e) {
-        log_warning("TMR execution 3 failed with exception: " + std::string(e.what()));
-        radiation_detected = true;
+        SKYMESH_LOG_WARNING(kLogComponent, "TMR execution ", replica + 1, " failed with exception: ", e.what());
+        fault = true;
     } catch (...) {
-        log_warning("TMR execution 3 failed with unknown exception");
-        radiation_detected = true;
+        SKYMESH_LOG_WARNING(kLogComponent, "TMR execution ", replica + 1, " failed with unknown exception");
+        fault = true;
     }
     
-    // Majority voting
-    if (result1 == result2) {
-        // Results 1 and 2 agree
-        if (result1 != result3) {
-            // Result 3 disagrees - potential radiation event
-            log_warning("TMR detected potential radiation event (vote: 2-1)");
-            radiation_detected = true;
-        }
-        return result1;
-    } else if (result1 == result3) {
-        // Results 1 and 3 agree, result 2 disagrees
-        log_warning("TMR detected potential radiation event (vote: 2-1)");
-        radiation_detected = true;
-        return result1;
-    } else if (result2 == result3) {
-        // Results 2 and 3 agree, result 1 disagrees
-        log_warning("TMR detected potential radiation event (vote: 2-1)");
-        radiation_detected = true;
-        return result2;
-    } else {
-        // All three results disagree - critical radiation event
-        log_error("TMR critical radiation event detected (all results disagree)");
-        radiation_detected = true;
+    {
+        std::lock_guard<std::mutex> lock(vote->mutex);
+        vote->outcomes[replica] = outcome ? 1 : 0;
+        vote->fault_seen = vote->fault_seen || fault;
+        vote->finished++;
         
-        // In this case, we default to the "safer" false result
-        // In a real implementation, this might trigger a system-level recovery
-        return false;
+        // The result is already reported; an upset seen now still counts
+        if (vote->decided && (fault || outcome != vote->decision)) {
+            SKYMESH_LOG_WARNING(kLogComponent, "TMR late replica of task ", task_entry.task.task_id,
+                                " disagreed with the returned vote");
+            radiation_events_++;
+            radiation_counter_.add();
+        }
     }
+    vote->condition.notify_all();
 }
 
-bool OrbitalTaskManagerImpl::shouldExecuteConditionalTask(const TriggerCondition& condition) const {
-    // Check time-based trigger
+void OrbitalTaskManagerImpl::armTriggersLocked(const std::shared_ptr<TaskEntry>& task_entry) {
+    const TriggerCondition& condition = task_entry->trigger_condition;
+    auto now = currentTime();
+    
+    // Time trigger: the task waits in the timer queue like any future task
     if (condition.time_point.has_value()) {
-        auto now = std::chrono::system_clock::now();
-        if (now >= condition.time_point.value()) {
-            return true;
-        }
+        auto queue_lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
+        task_entry->deadline = condition.time_point.value();
+        enqueueTaskLocked(task_entry, now);
     }
     
-    // Check orbital position trigger
-    if (condition.orbit_position.has_value()) {
-        OrbitPosition current_pos;
-        {
-            std::lock_guard<std::mutex> lock(position_mutex_);
-            current_pos = current_position_;
-        }
+    // Dependency trigger: fired from the completion path of the dependency
+    if (condition.dependency_task_id.has_value()) {
+        const std::string& dependency_id = condition.dependency_task_id.value();
         
-        if (matchesOrbitPosition(current_pos, condition.orbit_position.value())) {
-            return true;
+        auto it = task_map_.find(dependency_id);
+        bool completed = it != task_map_.end() ?
+            it->second->status == TaskStatus::COMPLETED :
+            tombstoneLocked(dependency_id) == TaskStatus::COMPLETED;
+        if (completed) {
+            fireTriggerLocked(task_entry, now);
+        } else {
+            dependency_triggers_[dependency_id].push_back(task_entry);
         }
     }
     
-    // Check event-based trigger
+    // Event trigger: fired by publishEvent()
     if (condition.event_name.has_value()) {
-        // In a real implementation, this would check an event registry
-        // For now, we'll just log that we would check it
-        log_debug("Checking for event trigger: " + condition.event_name.value());
-        // Always return false since we don't have an event system
-        return false;
+        event_triggers_[condition.event_name.value()].push_back(task_entry);
     }
     
-    // Check dependency task trigger
-    if (condition.dependency_task_id.has_value()) {
-        std::lock_guard<std::mutex> map_lock(tasks_mutex_);
+    // Orbit trigger: matched on each position update, starting with the current one
+    if (condition.orbit_position.has_value() && !task_entry->trigger_fired) {
+        uint64_t id = task_entry->handle;
+        orbit_index_.insert(id, condition.orbit_position.value(),
+                            condition.position_tolerance_deg, condition.altitude_tolerance_km);
         
-        auto it = task_map_.find(condition.dependency_task_id.value());
-        if (it != task_map_.end() && it->second->status == TaskStatus::COMPLETED) {
-            return true;
+        std::vector<uint64_t> hits;
+        orbit_index_.queryPoint(getCurrentOrbitalPosition(), hits);
+        
+        if (std::find(hits.begin(), hits.end(), id) != hits.end()) {
+            orbit_index_.remove(id);
+            fireTriggerLocked(task_entry, now);
+        } else {
+            task_entry->in_orbit_index = true;
+            orbit_triggers_[id] = task_entry;
         }
     }
-    
-    // No triggers were satisfied
-    return false;
 }
 
-bool OrbitalTaskManagerImpl::matchesOrbitPosition(
-    const OrbitPosition& current, const OrbitPosition& trigger) const {
+void OrbitalTaskManagerImpl::removeOrbitTriggerLocked(const std::shared_ptr<TaskEntry>& task_entry) {
+    if (!task_entry->in_orbit_index) {
+        return;
+    }
     
-    // Parameters for matching
-    constexpr double ALTITUDE_TOLERANCE_KM = 10.0;  // km
-    constexpr double POSITION_TOLERANCE_DEG = 5.0;  // degrees
+    orbit_index_.remove(task_entry->handle);
+    orbit_triggers_.erase(task_entry->handle);
+    task_entry->in_orbit_index = false;
+}
+
+bool OrbitalTaskManagerImpl::fireTriggerLocked(
+    const std::shared_ptr<TaskEntry>& task_entry, std::chrono::system_clock::time_point now) {
     
-    // Check altitude
-    bool altitude_match = std::abs(current.altitude_km - trigger.altitude_km) <= ALTITUDE_TOLERANCE_KM;
+    // Each conditional task is released once; a passed deadline already released it
+    const auto& time_point = task_entry->trigger_condition.time_point;
+    if (task_entry->trigger_fired || (time_point.has_value() && time_point.value() <= now)) {
+        return false;
+    }
+    task_entry->trigger_fired = true;
+    state_version_.fetch_add(1, std::memory_order_relaxed);
+    removeOrbitTriggerLocked(task_entry);
     
-    // Check latitude and longitude
-    bool latitude_match = std::abs(current.latitude - trigger.latitude) <= POSITION_TOLERANCE_DEG;
-    bool longitude_match = std::abs(current.longitude - trigger.longitude) <= POSITION_TOLERANCE_DEG;
+    auto queue_lock = lockInstrumented(queue_mutex_, queue_lock_wait_);
     
-    // Special case for longitude wrap-around at 180/-180
-    if (!longitude_match) {
-        double alt_diff = std::abs((current.longitude + 360.0) - trigger.longitude);
-        alt_diff = std::min(alt_diff, std::abs(current.longitude - (trigger.longitude + 360.0)));
-        longitude_match = alt_diff <= POSITION_TOLERANCE_DEG;
+    // Pull a task still waiting on its time trigger out of the timer queue
+    if (task_entry->queued) {
+        auto it = std::find(timer_queue_.begin(), timer_queue_.end(), task_entry);
+        if (it == timer_queue_.end()) {
+            return true;
+        }
+        timer_queue_.erase(it);
+        std::make_heap(timer_queue_.begin(), timer_queue_.end(), DeadlineOrder());
+        task_entry->queued = false;
     }
     
-    return altitude_match && latitude_match && longitude_match;
+    task_entry->deadline = now;
+    enqueueTaskLocked(task_entry, now);
+    
+    return true;
 }
 
-void OrbitalTaskManagerImpl::notifyTaskCompletion(const TaskResult& result) {
-    std::lock_guard<std::mutex> callback_lock(callback_mutex_);
-    
-    // Get the task type from the task map
-    TaskType task_type = TaskType::COMMUNICATION; // Default
+void OrbitalTaskManagerImpl::fireDependentTasks(const std::string& task_id) {
+    size_t fired = 0;
     {
-        std::lock_guard<std::mutex> map_lock(tasks_mutex_);
-        auto it = task_map_.find(result.task_id);
-        if (it != task_map_.end()) {
-            task_type = it->second->task.type;
-        }
-    }
-    
-    // Call all registered callbacks that match the task type
-    for (const auto& entry : callbacks_) {
-        if (entry.filter_type == task_type) {
-            try {
-                entry.callback(result);
-            } catch (const std::exception& e) {
-                log_error("Exception in task completion callback (ID: " + 
-                         std::to_string(entry.id) + "): " + e.what());
-            } catch (...) {
-                log_error("Unknown exception in task completion callback (ID: " + 
-                         std::to_string(entry.id) + ")");
+        std::lock_guard<std::mutex> trigger_lock(trigger_mutex_);
+        
+        auto it = dependency_triggers_.find(task_id);
+        if (it == dependency_triggers_.end()) {
+            return;
+        }
+        
+        auto now = currentTime();
+        for (const auto& task_entry : it->second) {
+            if (fireTriggerLocked(task_entry, now)) {
+                fired++;
             }
         }
+        dependency_triggers_.erase(it);
+    }
+    
+    if (fired > 0) {
+        notifyWorkers(true);
+        SKYMESH_LOG_DEBUG(kLogComponent, "Triggered ", fired, " tasks depending on ", task_id);
+    }
+}
+
+void OrbitalTaskManagerImpl::notifyTaskCompletion(const TaskResult& result, TaskType task_type) {
+    // Callbacks run on the bus thread, so a slow one cannot hold up a worker
+    if (!completion_topic_.publish(result, task_type)) {
+        SKYMESH_LOG_WARNING(kLogComponent, "Completion notification queue full, dropped result for ",
+                            result.task_id);
     }
 }
 
@@ -1219,8 +2698,9 @@ TaskResult OrbitalTaskManagerImpl::createTaskResult(
 }
 
 // Factory function implementation
-std::unique_ptr<OrbitalTaskManager> createOrbitalTaskManager(const std::string& config_path) {
-    auto manager = std::make_unique<OrbitalTaskManagerImpl>();
+std::unique_ptr<OrbitalTaskManager> createOrbitalTaskManager(const std::string& config_path,
+                                                             std::shared_ptr<NotificationBus> notification_bus) {
+    auto manager = std::make_unique<OrbitalTaskManagerImpl>(std::move(notification_bus));
     
     if (!manager->initialize(config_path)) {
         return nullptr;
@@ -1235,46 +2715,25 @@ std::unique_ptr<OrbitalTaskManager> createOrbitalTaskManager(const std::string&
 // Helper function implementations
 namespace {
 
-void log_debug(const std::string& message) {
-    // In a real implementation, this would use a proper logging system
-    std::cout << "[DEBUG] " << message << std::endl;
-}
-
-void log_info(const std::string& message) {
-    // In a real implementation, this would use a proper logging system
-    std::cout << "[INFO] " << message << std::endl;
-}
-
-void log_warning(const std::string& message) {
-    // In a real implementation, this would use a proper logging system
-    std::cout << "[WARNING] " << message << std::endl;
-}
-
-void log_error(const std::string& message) {
-    // In a real implementation, this would use a proper logging system
-    std::cerr << "[ERROR] " << message << std::endl;
-}
-
-std::string generate_task_id() {
-    // Generate a random ID with timestamp
-    auto now = std::chrono::system_clock::now();
-    auto now_ms = std::chrono::time_point_cast<std::chrono::milliseconds>(now);
-    auto epoch = now_ms.time_since_epoch();
-    uint64_t timestamp = static_cast<uint64_t>(epoch.count());
-    
-    // Add some randomness
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<uint32_t> dist(0, UINT32_MAX);
-    uint32_t random = dist(gen);
-    
-    // Format as hexadecimal string
-    std::stringstream ss;
-    ss << std::hex << std::setfill('0')
-       << std::setw(16) << timestamp
-       << std::setw(8) << random;
+std::string generate_task_id(uint64_t handle) {
+    // A per-boot salt keeps IDs distinct across restarts; the handle keeps them
+    // unique within one run
+    static const uint32_t boot_salt = [] {
+        std::random_device rd;
+        return static_cast<uint32_t>(rd());
+    }();
+    static const char digits[] = "0123456789abcdef";
+    
+    // Format as hexadecimal string: 8 salt digits followed by 16 handle digits
+    char buffer[24];
+    for (int i = 0; i < 8; ++i) {
+        buffer[i] = digits[(boot_salt >> (28 - 4 * i)) & 0xF];
+    }
+    for (int i = 0; i < 16; ++i) {
+        buffer[8 + i] = digits[(handle >> (60 - 4 * i)) & 0xF];
+    }
     
-    return ss.str();
+    return std::string(buffer, sizeof(buffer));
 }
 
 std::string timestamp_to_string(const std::chrono::system_clock::time_point& time) {
@@ -1290,4 +2749,52 @@ std::string timestamp_to_string(const std::chrono::system_clock::time_point& tim
     return ss.str();
 }
 
+std::map<skymesh::core::TaskType, uint32_t> default_type_limits() {
+    using skymesh::core::TaskType;
+    
+    // Actuator tasks must never overlap
+    return {
+        {TaskType::ATTITUDE_CONTROL, 1},
+        {TaskType::ORBITAL_MANEUVER, 1},
+    };
+}
+
+bool parse_task_priority(const std::string& name, skymesh::core::TaskPriority& priority) {
+    using skymesh::core::TaskPriority;
+    static const std::map<std::string, TaskPriority> names = {
+        {"CRITICAL", TaskPriority::CRITICAL}, {"HIGH", TaskPriority::HIGH},
+        {"NORMAL", TaskPriority::NORMAL}, {"LOW", TaskPriority::LOW},
+        {"IDLE", TaskPriority::IDLE}
+    };
+    
+    auto it = names.find(name);
+    if (it == names.end()) {
+        return false;
+    }
+    priority = it->second;
+    return true;
+}
+
+bool parse_task_type(const std::string& name, skymesh::core::TaskType& type) {
+    using skymesh::core::TaskType;
+    static const std::map<std::string, TaskType> names = {
+        {"COMMUNICATION", TaskType::COMMUNICATION},
+        {"POWER_MANAGEMENT", TaskType::POWER_MANAGEMENT},
+        {"TELEMETRY", TaskType::TELEMETRY},
+        {"ATTITUDE_CONTROL", TaskType::ATTITUDE_CONTROL},
+        {"ORBITAL_MANEUVER", TaskType::ORBITAL_MANEUVER},
+        {"PAYLOAD_OPERATION", TaskType::PAYLOAD_OPERATION},
+        {"HEALTH_CHECK", TaskType::HEALTH_CHECK},
+        {"MAINTENANCE", TaskType::MAINTENANCE},
+        {"FIRMWARE_UPDATE", TaskType::FIRMWARE_UPDATE}
+    };
+    
+    auto it = names.find(name);
+    if (it == names.end()) {
+        return false;
+    }
+    type = it->second;
+    return true;
+}
+
 } // anonymous namespace
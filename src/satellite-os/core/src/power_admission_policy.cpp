@@ -0,0 +1,118 @@
+/**
+ * @file power_admission_policy.cpp
+ * @brief Implementation of the power-aware task admission policy
+ */
+
+#include "skymesh/core/power_admission_policy.h"
+#include <algorithm>
+#include <utility>
+
+namespace skymesh {
+namespace core {
+
+PowerAwareAdmissionPolicy::PowerAwareAdmissionPolicy(const PowerManager& powerManager,
+                                                     const OrbitPowerPlanner* planner,
+                                                     PowerAdmissionConfig config)
+    : powerManager(powerManager),
+      planner(planner),
+      config(std::move(config)) {
+}
+
+TaskAdmission PowerAwareAdmissionPolicy::admit(const OrbitalTask& task,
+                                               std::chrono::system_clock::time_point now) {
+    if (task.priority == TaskPriority::CRITICAL) {
+        return {};
+    }
+
+    const PowerMode mode = powerManager.getPowerBudgetSnapshot().currentMode;
+    switch (mode) {
+        case PowerMode::NORMAL: {
+            // Energy-heavy work waits for a start the battery can carry
+            if (planner && (task.energy_cost_wh > 0.0f || task.type == TaskType::PAYLOAD_OPERATION)) {
+                auto start = planner->findAffordableStart(task, {now, now + config.plan_lookahead});
+                if (!start) {
+                    return defer(now + config.deferral);
+                }
+                if (*start > now) {
+                    return defer(*start);
+                }
+            }
+            return {};
+        }
+
+        case PowerMode::LOW_POWER:
+        case PowerMode::CRITICAL:
+            if (task.type == TaskType::COMMUNICATION) {
+                TaskAdmission admission;
+                admission.action = AdmissionAction::COALESCE;
+                admission.not_before = now + config.burst_hold;
+                admission.batch_size = config.burst_batch_size;
+                return admission;
+            }
+            break;
+
+        case PowerMode::EMERGENCY:
+        case PowerMode::HIBERNATION:
+            break;
+    }
+
+    if (!allowedInMode(task.type, mode)) {
+        return defer(now + config.deferral);
+    }
+    return {};
+}
+
+void PowerAwareAdmissionPolicy::onBatchReleased(TaskType type, const std::vector<const OrbitalTask*>& tasks) {
+    if (type != TaskType::COMMUNICATION || tasks.empty()) {
+        return;
+    }
+    bursts.fetch_add(1, std::memory_order_relaxed);
+
+    // One window long enough for every task, at the level the most
+    // demanding one declared; undeclared tasks get a full-power burst
+    const float rfPeak = subsystemPeakPower(SubsystemID::RF_SYSTEM);
+    RfBurstWindow window{std::chrono::milliseconds(0), 0.0f, static_cast<uint32_t>(tasks.size())};
+    for (const OrbitalTask* task : tasks) {
+        window.duration += task->timeout;
+        float level = task->peak_power_w > 0.0f ? task->peak_power_w / rfPeak : 1.0f;
+        window.power_level = std::max(window.power_level, level);
+    }
+    window.power_level = std::max(0.1f, std::min(1.0f, window.power_level));
+
+    if (config.on_rf_burst) {
+        config.on_rf_burst(window);
+    }
+}
+
+bool PowerAwareAdmissionPolicy::allowedInMode(TaskType type, PowerMode mode) {
+    switch (mode) {
+        case PowerMode::NORMAL:
+            return true;
+        case PowerMode::LOW_POWER:
+            return type != TaskType::PAYLOAD_OPERATION &&
+                   type != TaskType::FIRMWARE_UPDATE &&
+                   type != TaskType::MAINTENANCE;
+        case PowerMode::CRITICAL:
+            return type == TaskType::POWER_MANAGEMENT ||
+                   type == TaskType::HEALTH_CHECK ||
+                   type == TaskType::ATTITUDE_CONTROL ||
+                   type == TaskType::TELEMETRY ||
+                   type == TaskType::COMMUNICATION;
+        case PowerMode::EMERGENCY:
+        case PowerMode::HIBERNATION:
+            return type == TaskType::POWER_MANAGEMENT ||
+                   type == TaskType::HEALTH_CHECK;
+    }
+    return false;
+}
+
+TaskAdmission PowerAwareAdmissionPolicy::defer(std::chrono::system_clock::time_point until) {
+    deferred.fetch_add(1, std::memory_order_relaxed);
+    TaskAdmission admission;
+    admission.action = AdmissionAction::DEFER;
+    admission.not_before = until;
+    return admission;
+}
+
+} // namespace core
+} // namespace skymesh
@@ -4,16 +4,24 @@
  */
 
 #include "skymesh/core/power_manager.h"
+#include "skymesh/core/checkpoint_store.h"
+#include "skymesh/core/logger.h"
+#include "skymesh/core/metrics.h"
+#include "skymesh/core/sensor_backend.h"
 #include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <stdexcept>
 #include <chrono>
-#include <unordered_map>
+#include <cstring>
 
 namespace skymesh {
 namespace core {
 
+namespace {
+    constexpr const char* kLogComponent = "power_manager";
+}
+
 // Constants for power management
 constexpr float MINIMUM_BATTERY_THRESHOLD = 0.15f;  // 15% minimum battery level
 constexpr float LOW_POWER_THRESHOLD = 0.30f;        // 30% battery triggers low power mode
@@ -31,26 +39,114 @@ constexpr float POWER_REQ_THERMAL = 0.5f;
 constexpr float POWER_REQ_PAYLOAD = 1.5f;
 constexpr float POWER_REQ_SENSORS = 0.3f;
 
-PowerManager::PowerManager() 
+// Per-subsystem power figures, indexed by subsystemIndex()
+constexpr std::array<float, kSubsystemCount> SUBSYSTEM_RATED_POWER = {
+    POWER_REQ_RF_STANDARD, POWER_REQ_OBC, POWER_REQ_ADCS,
+    POWER_REQ_THERMAL, POWER_REQ_PAYLOAD, POWER_REQ_SENSORS
+};
+constexpr std::array<float, kSubsystemCount> SUBSYSTEM_AVERAGE_FACTOR = {
+    0.7f, 0.9f, 0.8f, 0.6f, 0.5f, 0.7f
+};
+constexpr std::array<float, kSubsystemCount> SUBSYSTEM_PEAK_POWER = {
+    POWER_REQ_RF_BURST, POWER_REQ_OBC, POWER_REQ_ADCS * 1.2f,
+    POWER_REQ_THERMAL * 1.5f, POWER_REQ_PAYLOAD * 1.8f, POWER_REQ_SENSORS * 1.1f
+};
+// Full-power draw used for consumption accounting (watts)
+constexpr std::array<float, kSubsystemCount> SUBSYSTEM_BASE_CONSUMPTION = {
+    5.0f, 3.0f, 4.0f, 2.0f, 8.0f, 1.5f
+};
+
+constexpr uint32_t ALL_SUBSYSTEMS_MASK = (1u << kSubsystemCount) - 1;
+
+// Protected bytes scrubbed per update() tick
+constexpr size_t SCRUB_BYTES_PER_UPDATE = 256;
+
+// Age after which update() takes new power source readings
+constexpr std::chrono::milliseconds SOURCE_READING_MAX_AGE(500);
+
+constexpr uint32_t subsystemBit(SubsystemID subsystem) {
+    return 1u << subsystemIndex(subsystem);
+}
+
+// Number of set bits in mask below bit index
+constexpr uint32_t countBitsBelow(uint32_t mask, size_t index) {
+    uint32_t count = 0;
+    for (uint32_t bits = mask & ((1u << index) - 1); bits != 0; bits &= bits - 1) {
+        ++count;
+    }
+    return count;
+}
+
+PowerConsumption makeConsumption(size_t index, float powerLevel) {
+    PowerConsumption consumption;
+    consumption.subsystem = static_cast<SubsystemID>(index);
+    consumption.isActive = true;
+    consumption.currentPower = SUBSYSTEM_RATED_POWER[index] * powerLevel;
+    consumption.averagePower = SUBSYSTEM_RATED_POWER[index] * SUBSYSTEM_AVERAGE_FACTOR[index];
+    consumption.peakPower = SUBSYSTEM_PEAK_POWER[index];
+    return consumption;
+}
+
+PowerMode automaticPowerMode(PowerMode current, float stateOfCharge) {
+    if (stateOfCharge <= EMERGENCY_THRESHOLD && current != PowerMode::EMERGENCY) {
+        // Battery critically low, enter emergency mode
+        return PowerMode::EMERGENCY;
+    }
+    if (stateOfCharge <= CRITICAL_THRESHOLD &&
+        current != PowerMode::CRITICAL &&
+        current != PowerMode::EMERGENCY) {
+        // Battery very low, enter critical mode
+        return PowerMode::CRITICAL;
+    }
+    if (stateOfCharge <= LOW_POWER_THRESHOLD && current == PowerMode::NORMAL) {
+        // Battery getting low, enter low power mode
+        return PowerMode::LOW_POWER;
+    }
+    if (stateOfCharge >= NORMAL_RECOVERY_THRESHOLD &&
+        (current == PowerMode::LOW_POWER || current == PowerMode::CRITICAL)) {
+        // Battery recovered, return to normal mode
+        return PowerMode::NORMAL;
+    }
+    return current;
+}
+
+float subsystemPowerDraw(SubsystemID subsystem, float powerLevel) {
+    return SUBSYSTEM_BASE_CONSUMPTION[subsystemIndex(subsystem)] * powerLevel;
+}
+
+float subsystemPeakPower(SubsystemID subsystem) {
+    return SUBSYSTEM_PEAK_POWER[subsystemIndex(subsystem)];
+}
+
+PowerManager::PowerManager(std::shared_ptr<SensorBackend> sensors)
     : currentMode(PowerMode::NORMAL),
       nextCallbackId(1),
       mainBatteryHealth(1.0f),
       backupBatteryHealth(1.0f),
-      rfStandardPowerAllocation(0.8f),
-      rfBurstPowerAllocation(1.0f),
-      rfEmergencyPowerAllocation(0.9f) {
+      rfAllocations(RfPowerAllocations{0.8f, 1.0f, 0.9f}),
+      sensorBackend(std::move(sensors)),
+      sourceReadings{},
+      budgetState{} {
     
     // Initialize solar panel efficiencies (one for each face of the CubeSat)
     for (size_t i = 0; i < solarPanelEfficiencies.size(); ++i) {
         solarPanelEfficiencies[i] = 0.95f;  // Start with 95% efficiency
     }
+    
+    scrubber.add(currentMode);
+    scrubber.add(subsystems);
+    scrubber.add(rfAllocations);
+    
+    refreshSourceReadings();
+    rebuildBudget();
 }
 
 PowerManager::~PowerManager() {
     // Safely shutdown all subsystems to prevent damage
-    for (const auto& subsystem : subsystemStates) {
-        if (subsystem.second) {
-            disableSubsystem(subsystem.first);
+    const uint32_t enabled = subsystems.load().enabledMask;
+    for (size_t i = 0; i < kSubsystemCount; ++i) {
+        if (enabled & (1u << i)) {
+            disableSubsystem(static_cast<SubsystemID>(i));
         }
     }
     
@@ -58,14 +154,10 @@ PowerManager::~PowerManager() {
     powerWarningCallbacks.clear();
 }
 
-bool PowerManager::initialize(const std::vector<SubsystemID>& subsystems) {
+bool PowerManager::initialize(const std::vector<SubsystemID>& managedSubsystems) {
     // Initialize subsystem states and power levels
-    for (const auto& subsystem : subsystems) {
-        // Triple redundant initialization for radiation hardening
-        for (int i = 0; i < 3; ++i) {
-            subsystemStates[subsystem] = false;
-            subsystemPowerLevels[subsystem] = 0.0f;
-        }
+    for (const auto& subsystem : managedSubsystems) {
+        setSubsystemState(subsystem, false, 0.0f);
     }
     
     // Apply scrubbing to ensure consistent initialization
@@ -90,248 +182,179 @@ bool PowerManager::setPowerMode(PowerMode mode) {
         return true;
     }
     
-    // Apply the mode change with TMR pattern for radiation hardening
-    std::array<bool, 3> success = {false, false, false};
-    
-    for (int i = 0; i < 3; ++i) {
-        try {
-            // Handle transition between modes
-            handleModeTransition(previousMode, mode);
-            
-            // Set the new mode
-            currentMode.store(mode);
-            success[i] = true;
-        }
-        catch (const std::exception& e) {
-            // Log the error
-            std::cerr << "Error setting power mode: " << e.what() << std::endl;
-            success[i] = false;
-        }
+    try {
+        // Handle transition between modes
+        handleModeTransition(previousMode, mode);
+        
+        // Set the new mode in all redundant copies
+        currentMode.store(mode);
+        budgetState.currentMode = mode;
+        publishBudget();
+    }
+    catch (const std::exception& e) {
+        // Log the error
+        std::cerr << "Error setting power mode: " << e.what() << std::endl;
+        return false;
     }
-    
-    // Use majority voting to determine overall success
-    bool overallSuccess = (success[0] && success[1]) || 
-                         (success[0] && success[2]) || 
-                         (success[1] && success[2]);
     
     // Notify registered callbacks about the power mode change
-    if (overallSuccess) {
-        for (const auto& callback : powerWarningCallbacks) {
-            callback.second(mode);
-        }
+    for (const auto& callback : powerWarningCallbacks) {
+        callback.second(mode);
     }
     
-    return overallSuccess;
+    return true;
 }
 
 PowerMode PowerManager::getCurrentPowerMode() const {
-    // Read the current mode with redundancy for radiation hardening
-    std::array<PowerMode, 3> redundantReads = {
-        currentMode.load(),
-        currentMode.load(),
-        currentMode.load()
-    };
-    
-    // Apply TMR to the readings
-    return applyTMR<PowerMode>(redundantReads);
+    // Majority vote across the redundant copies
+    return currentMode.load();
 }
 
 bool PowerManager::enableSubsystem(SubsystemID subsystem, float powerLevel) {
     // Validate power level
     powerLevel = std::max(0.0f, std::min(1.0f, powerLevel));
     
-    // Get current power budget
-    PowerBudget budget = getPowerBudget();
-    
     // Check if we have enough power
-    float requiredPower = 0.0f;
-    
-    switch (subsystem) {
-        case SubsystemID::RF_SYSTEM:
-            requiredPower = POWER_REQ_RF_STANDARD * powerLevel;
-            break;
-        case SubsystemID::OBC:
-            requiredPower = POWER_REQ_OBC * powerLevel;
-            break;
-        case SubsystemID::ADCS:
-            requiredPower = POWER_REQ_ADCS * powerLevel;
-            break;
-        case SubsystemID::THERMAL:
-            requiredPower = POWER_REQ_THERMAL * powerLevel;
-            break;
-        case SubsystemID::PAYLOAD:
-            requiredPower = POWER_REQ_PAYLOAD * powerLevel;
-            break;
-        case SubsystemID::SENSORS:
-            requiredPower = POWER_REQ_SENSORS * powerLevel;
-            break;
-    }
+    float requiredPower = SUBSYSTEM_RATED_POWER[subsystemIndex(subsystem)] * powerLevel;
     
     // Check if enabling would exceed available power
-    if (budget.totalConsumption + requiredPower > budget.totalAvailable) {
+    if (budgetState.totalConsumption + requiredPower > budgetState.totalAvailable) {
         // Not enough power available
         return false;
     }
     
-    // Triple redundant state update for radiation hardening
-    for (int i = 0; i < 3; ++i) {
-        subsystemStates[subsystem] = true;
-        subsystemPowerLevels[subsystem] = powerLevel;
-    }
-    
-    // Apply error correction
-    applyScrubbing();
+    setSubsystemState(subsystem, true, powerLevel);
     
     return true;
 }
 
 bool PowerManager::disableSubsystem(SubsystemID subsystem) {
-    // Triple redundant state update for radiation hardening
-    for (int i = 0; i < 3; ++i) {
-        subsystemStates[subsystem] = false;
-        subsystemPowerLevels[subsystem] = 0.0f;
-    }
-    
-    // Apply error correction
-    applyScrubbing();
+    setSubsystemState(subsystem, false, 0.0f);
     
     return true;
 }
 
 bool PowerManager::isSubsystemEnabled(SubsystemID subsystem) const {
-    // Check if the subsystem is in our map
-    if (subsystemStates.find(subsystem) == subsystemStates.end()) {
-        return false;
-    }
-    
-    // Perform redundant reads for radiation hardening
-    std::array<bool, 3> redundantReads = {
-        subsystemStates.at(subsystem),
-        subsystemStates.at(subsystem),
-        subsystemStates.at(subsystem)
-    };
-    
-    // Apply TMR to the readings
-    return applyTMR<bool>(redundantReads);
+    // Unregistered subsystems are never enabled
+    const SubsystemTable table = subsystems.load();
+    return (table.enabledMask & table.registeredMask & subsystemBit(subsystem)) != 0;
 }
 
 PowerBudget PowerManager::getPowerBudget() const {
-    PowerBudget budget;
-    
-    // Calculate total available power
-    budget.totalAvailable = calculateAvailablePower();
-    
-    // Calculate total consumption
-    budget.totalConsumption = calculateCurrentConsumption();
-    
-    // Determine projected available power based on orbital parameters
-    // This is a simplified calculation
-    PowerSourceStatus solarStatus = getPowerSourceStatus(PowerSource::SOLAR_PANEL);
-    budget.projectedAvailable = solarStatus.currentVoltage * solarStatus.currentCurrent;
-    
-    // Get battery reserve
-    PowerSourceStatus batteryStatus = getPowerSourceStatus(PowerSource::BATTERY);
-    budget.batteryReserve = batteryStatus.stateOfCharge * 10.0f; // Assuming 10 Wh total capacity
-    
-    // Solar input rate
-    budget.solarInputRate = solarStatus.currentVoltage * solarStatus.currentCurrent;
-    
-    // Current power mode
-    budget.currentMode = getCurrentPowerMode();
+    const PowerBudgetSnapshot snapshot = publishedBudget.load();
+    
+    PowerBudget result;
+    result.totalAvailable = snapshot.totalAvailable;
+    result.totalConsumption = snapshot.totalConsumption;
+    result.projectedAvailable = snapshot.projectedAvailable;
+    result.batteryReserve = snapshot.batteryReserve;
+    result.solarInputRate = snapshot.solarInputRate;
+    result.currentMode = snapshot.currentMode;
+    result.subsystems.assign(snapshot.subsystems.begin(),
+                             snapshot.subsystems.begin() + snapshot.subsystemCount);
+    return result;
+}
+
+PowerBudgetSnapshot PowerManager::getPowerBudgetSnapshot() const {
+    return publishedBudget.load();
+}
+
+PowerSourceStatus PowerManager::getPowerSourceStatus(PowerSource source) const {
+    return sourceReadings[static_cast<size_t>(source)];
+}
+
+std::chrono::system_clock::time_point PowerManager::readingTime() const {
+    return sensorBackend ? sensorBackend->now() : std::chrono::system_clock::now();
+}
+
+void PowerManager::refreshSourceReadings() {
+    const auto now = readingTime();
     
-    // Populate subsystem power consumption
-    budget.subsystems.clear();
-    for (const auto& subsystem : subsystemStates) {
-        if (subsystem.second) { // If enabled
-            PowerConsumption consumption;
-            consumption.subsystem = subsystem.first;
-            consumption.isActive = true;
-            
-            // Calculate power based on subsystem and level
-            float powerLevel = subsystemPowerLevels.at(subsystem.first);
-            
-            switch (subsystem.first) {
-                case SubsystemID::RF_SYSTEM:
-                    consumption.currentPower = POWER_REQ_RF_STANDARD * powerLevel;
-                    consumption.averagePower = POWER_REQ_RF_STANDARD * 0.7f;
-                    consumption.peakPower = POWER_REQ_RF_BURST;
-                    break;
-                case SubsystemID::OBC:
-                    consumption.currentPower = POWER_REQ_OBC * powerLevel;
-                    consumption.averagePower = POWER_REQ_OBC * 0.9f;
-                    consumption.peakPower = POWER_REQ_OBC;
-                    break;
-                case SubsystemID::ADCS:
-                    consumption.currentPower = POWER_REQ_ADCS * powerLevel;
-                    consumption.averagePower = POWER_REQ_ADCS * 0.8f;
-                    consumption.peakPower = POWER_REQ_ADCS * 1.2f;
-                    break;
-                case SubsystemID::THERMAL:
-                    consumption.currentPower = POWER_REQ_THERMAL * powerLevel;
-                    consumption.averagePower = POWER_REQ_THERMAL * 0.6f;
-                    consumption.peakPower = POWER_REQ_THERMAL * 1.5f;
-                    break;
-                case SubsystemID::PAYLOAD:
-                    consumption.currentPower = POWER_REQ_PAYLOAD * powerLevel;
-                    consumption.averagePower = POWER_REQ_PAYLOAD * 0.5f;
-                    consumption.peakPower = POWER_REQ_PAYLOAD * 1.8f;
-                    break;
-                case SubsystemID::SENSORS:
-                    consumption.currentPower = POWER_REQ_SENSORS * powerLevel;
-                    consumption.averagePower = POWER_REQ_SENSORS * 0.7f;
-                    consumption.peakPower = POWER_REQ_SENSORS * 1.1f;
-                    break;
+    for (PowerSource source : {PowerSource::SOLAR_PANEL, PowerSource::BATTERY, PowerSource::BACKUP_BATTERY}) {
+        PowerSourceStatus& status = sourceReadings[static_cast<size_t>(source)];
+        
+        // A source that cannot be read keeps its previous reading
+        if (sensorBackend) {
+            PowerSourceStatus reading = status;
+            if (sensorBackend->readPowerSource(source, now, reading)) {
+                status = reading;
+                status.source = source;
+                status.lastUpdated = now;
             }
+            continue;
+        }
+        
+        status.source = source;
+        status.lastUpdated = now;
+        
+        // Without a sensor backend, model the readings from component health
+        switch (source) {
+            case PowerSource::SOLAR_PANEL: {
+                // Simulate solar panel readings based on efficiency
+                float avgEfficiency = 0.0f;
+                for (float eff : solarPanelEfficiencies) {
+                    avgEfficiency += eff;
+                }
+                avgEfficiency /= solarPanelEfficiencies.size();
             
-            budget.subsystems.push_back(consumption);
+                status.currentVoltage = 5.0f * avgEfficiency;
+                status.currentCurrent = 0.2f * avgEfficiency;
+                status.temperature = 25.0f; // Celsius
+                status.stateOfCharge = 1.0f; // Not applicable for solar panels
+                break;
+            }
+            case PowerSource::BATTERY: {
+                // Simulate battery readings based on battery health
+                status.currentVoltage = 3.7f * mainBatteryHealth;
+                status.currentCurrent = 0.5f;
+                status.temperature = 20.0f; // Celsius
+                status.stateOfCharge = 0.75f * mainBatteryHealth; // 75% charged * health factor
+                break;
+            }
+            case PowerSource::BACKUP_BATTERY: {
+                // Simulate backup battery readings
+                status.currentVoltage = 3.7f * backupBatteryHealth;
+                status.currentCurrent = 0.1f;
+                status.temperature = 18.0f; // Celsius
+                status.stateOfCharge = 0.95f * backupBatteryHealth; // 95% charged * health factor
+                break;
+            }
         }
     }
     
-    return budget;
+    // Derived budget fields depend only on the readings
+    const PowerSourceStatus& solarStatus = sourceReadings[static_cast<size_t>(PowerSource::SOLAR_PANEL)];
+    const PowerSourceStatus& batteryStatus = sourceReadings[static_cast<size_t>(PowerSource::BATTERY)];
+    budgetState.totalAvailable = calculateAvailablePower();
+    budgetState.projectedAvailable = solarStatus.currentVoltage * solarStatus.currentCurrent;
+    budgetState.solarInputRate = solarStatus.currentVoltage * solarStatus.currentCurrent;
+    budgetState.batteryReserve = batteryStatus.stateOfCharge * 10.0f; // Assuming 10 Wh total capacity
+    budgetState.sourcesUpdated = now;
 }
 
-PowerSourceStatus PowerManager::getPowerSourceStatus(PowerSource source) const {
-    PowerSourceStatus status;
-    status.source = source;
-    status.lastUpdated = std::chrono::system_clock::now();
-    
-    // Simulate getting actual hardware readings
-    // In a real implementation, this would involve reading from sensors
-    
-    switch (source) {
-        case PowerSource::SOLAR_PANEL: {
-            // Simulate solar panel readings based on efficiency
-            float avgEfficiency = 0.0f;
-            for (float eff : solarPanelEfficiencies) {
-                avgEfficiency += eff;
-            }
-            avgEfficiency /= solarPanelEfficiencies.size();
-            
-            status.currentVoltage = 5.0f * avgEfficiency;
-            status.currentCurrent = 0.2f * avgEfficiency;
-            status.temperature = 25.0f; // Celsius
-            status.stateOfCharge = 1.0f; // Not applicable for solar panels
-            break;
-        }
-        case PowerSource::BATTERY: {
-            // Simulate battery readings based on battery health
-            status.currentVoltage = 3.7f * mainBatteryHealth;
-            status.currentCurrent = 0.5f;
-            status.temperature = 20.0f; // Celsius
-            status.stateOfCharge = 0.75f * mainBatteryHealth; // 75% charged * health factor
-            break;
-        }
-        case PowerSource::BACKUP_BATTERY: {
-            // Simulate backup battery readings
-            status.currentVoltage = 3.7f * backupBatteryHealth;
-            status.currentCurrent = 0.1f;
-            status.temperature = 18.0f; // Celsius
-            status.stateOfCharge = 0.95f * backupBatteryHealth; // 95% charged * health factor
-            break;
+void PowerManager::rebuildBudget() {
+    const SubsystemTable table = subsystems.load();
+    const uint32_t enabled = table.enabledMask & table.registeredMask;
+    
+    // Disabled subsystems contribute through a zero mask factor, not a branch
+    float consumption = 0.0f;
+    uint32_t count = 0;
+    for (size_t i = 0; i < kSubsystemCount; ++i) {
+        float active = static_cast<float>((enabled >> i) & 1u);
+        consumption += SUBSYSTEM_BASE_CONSUMPTION[i] * table.powerLevels[i] * active;
+        if (enabled & (1u << i)) {
+            budgetState.subsystems[count++] = makeConsumption(i, table.powerLevels[i]);
         }
     }
     
-    return status;
+    budgetState.totalConsumption = consumption;
+    budgetState.subsystemCount = count;
+    budgetState.currentMode = currentMode.load();
+    publishBudget();
+}
+
+void PowerManager::publishBudget() {
+    publishedBudget.store(budgetState);
 }
 
 bool PowerManager::setSubsystemPowerLevel(SubsystemID subsystem, float level) {
@@ -343,13 +366,7 @@ bool PowerManager::setSubsystemPowerLevel(SubsystemID subsystem, float level) {
         return false;
     }
     
-    // Update power level with triple redundancy
-    for (int i = 0; i < 3; ++i) {
-        subsystemPowerLevels[subsystem] = level;
-    }
-    
-    // Apply error correction
-    applyScrubbing();
+    setSubsystemState(subsystem, true, level);
     
     return true;
 }
@@ -358,22 +375,27 @@ uint32_t PowerManager::registerPowerWarningCallback(std::function<void(PowerMode
     // Assign a unique ID to this callback
     uint32_t callbackId = nextCallbackId++;
     
-    // Store the callback with redundancy for radiation hardening
-    for (int i = 0; i < 3; ++i) {
-        powerWarningCallbacks[callbackId] = callback;
-    }
+    // IDs only grow, so appending keeps the list sorted by ID
+    powerWarningCallbacks.emplace_back(callbackId, std::move(callback));
     
     return callbackId;
 }
 
 void PowerManager::unregisterPowerWarningCallback(uint32_t callbackId) {
-    // Remove the callback with redundancy for radiation hardening
-    for (int i = 0; i < 3; ++i) {
-        powerWarningCallbacks.erase(callbackId);
+    auto it = std::lower_bound(powerWarningCallbacks.begin(), powerWarningCallbacks.end(), callbackId,
+                               [](const auto& entry, uint32_t id) { return entry.first < id; });
+    if (it != powerWarningCallbacks.end() && it->first == callbackId) {
+        powerWarningCallbacks.erase(it);
     }
 }
 
 void PowerManager::updateOrbitPowerProfile(uint32_t timeInSunlight, uint32_t timeInEclipse) {
+    // Publish the profile for forward planning
+    budgetState.orbitSunlightSeconds = timeInSunlight;
+    budgetState.orbitEclipseSeconds = timeInEclipse;
+    budgetState.orbitEpoch = readingTime();
+    publishBudget();
+    
     // Calculate expected power generation during sunlight period
     float avgSolarPanelEfficiency = 0.0f;
     for (float eff : solarPanelEfficiencies) {
@@ -423,27 +445,18 @@ bool PowerManager::performHealthCheck() {
         std::cerr << "Backup battery health degraded: " << backupBatteryHealth * 100.0f << "%" << std::endl;
     }
     
-    // Check for inconsistencies in subsystem states (radiation effect detection)
-    for (const auto& subsystem : subsystemStates) {
-        // Perform redundant reads
-        std::array<bool, 3> stateReads = {
-            subsystemStates.at(subsystem.first),
-            subsystemStates.at(subsystem.first),
-            subsystemStates.at(subsystem.first)
-        };
-        
-        // Check for inconsistencies (indicating possible radiation effects)
-        if (stateReads[0] != stateReads[1] || stateReads[0] != stateReads[2] || stateReads[1] != stateReads[2]) {
-            allHealthy = false;
-            std::cerr << "Inconsistent subsystem state detected for subsystem ID: " 
-                      << static_cast<int>(subsystem.first) << std::endl;
-            
-            // Attempt to correct using TMR
-            bool correctedState = applyTMR<bool>(stateReads);
-            for (int i = 0; i < 3; ++i) {
-                subsystemStates[subsystem.first] = correctedState;
-            }
-        }
+    // Check for disagreeing redundant copies (radiation effect detection)
+    size_t correctedRegions = scrubber.scrubAll();
+    if (correctedRegions > 0) {
+        allHealthy = false;
+        std::cerr << "Inconsistent redundant state detected in " << correctedRegions
+                  << " protected regions" << std::endl;
+    }
+    
+    // Check for invalid subsystem states
+    if (scrubSubsystemTable()) {
+        allHealthy = false;
+        std::cerr << "Inconsistent subsystem state detected and corrected" << std::endl;
     }
     
     return allHealthy;
@@ -452,27 +465,20 @@ bool PowerManager::performHealthCheck() {
 bool PowerManager::reset(bool hardReset) {
     // For soft reset, restore default power mode and settings
     try {
-        // Set power mode to normal with TMR pattern
-        for (int i = 0; i < 3; ++i) {
-            currentMode.store(PowerMode::NORMAL);
-        }
+        // Set power mode to normal
+        currentMode.store(PowerMode::NORMAL);
+        budgetState.currentMode = PowerMode::NORMAL;
         
-        // Reset all subsystem power levels to zero
-        for (auto& subsystem : subsystemPowerLevels) {
-            for (int i = 0; i < 3; ++i) {
-                subsystemPowerLevels[subsystem.first] = 0.0f;
+        // Disable all subsystems and reset their power levels to zero
+        const uint32_t registered = subsystems.load().registeredMask;
+        for (size_t i = 0; i < kSubsystemCount; ++i) {
+            if (registered & (1u << i)) {
+                disableSubsystem(static_cast<SubsystemID>(i));
             }
         }
         
-        // Disable all subsystems
-        for (auto& subsystem : subsystemStates) {
-            disableSubsystem(subsystem.first);
-        }
-        
         // Reset RF power allocations to defaults
-        rfStandardPowerAllocation = 0.8f;
-        rfBurstPowerAllocation = 1.0f;
-        rfEmergencyPowerAllocation = 0.9f;
+        rfAllocations.store(RfPowerAllocations{0.8f, 1.0f, 0.9f});
         
         if (hardReset) {
             // In a real implementation, this would involve hardware resets
@@ -490,8 +496,14 @@ bool PowerManager::reset(bool hardReset) {
             // Clear all callbacks
             powerWarningCallbacks.clear();
             nextCallbackId = 1;
+            
+            // Take fresh readings with the restored health factors
+            refreshSourceReadings();
         }
         
+        // Rebuild from the table, which also publishes the reset state
+        rebuildBudget();
+        
         return true;
     }
     catch (const std::exception& e) {
@@ -502,124 +514,28 @@ bool PowerManager::reset(bool hardReset) {
 
 bool PowerManager::handleRadiationErrors() {
     bool errorsDetected = false;
-    bool allErrorsCorrected = true;
-    
-    // Check for errors in power mode (critical state)
-    std::array<PowerMode, 3> modeReads = {
-        currentMode.load(),
-        currentMode.load(),
-        currentMode.load()
-    };
     
-    // Check for inconsistencies
-    if (modeReads[0] != modeReads[1] || modeReads[0] != modeReads[2] || modeReads[1] != modeReads[2]) {
+    // Vote every protected region back into agreement
+    size_t correctedRegions = scrubber.scrubAll();
+    if (correctedRegions > 0) {
         errorsDetected = true;
-        
-        // Attempt to correct using TMR
-        PowerMode correctedMode = applyTMR<PowerMode>(modeReads);
-        currentMode.store(correctedMode);
-        
-        std::cerr << "Corrected radiation-induced error in power mode" << std::endl;
+        std::cerr << "Corrected radiation-induced errors in " << correctedRegions
+                  << " protected regions" << std::endl;
     }
     
-    // Check for errors in subsystem states
-    for (auto& subsystem : subsystemStates) {
-        // Create temporary storage for redundant reads
-        std::array<bool, 3> stateReads;
-        std::array<float, 3> levelReads;
-        
-        // Perform redundant reads
-        for (int i = 0; i < 3; ++i) {
-            stateReads[i] = subsystemStates.at(subsystem.first);
-            levelReads[i] = subsystemPowerLevels.at(subsystem.first);
-        }
-        
-        // Check for inconsistencies in states
-        if (stateReads[0] != stateReads[1] || stateReads[0] != stateReads[2] || stateReads[1] != stateReads[2]) {
-            errorsDetected = true;
-            
-            // Attempt to correct using TMR
-            bool correctedState = applyTMR<bool>(stateReads);
-            for (int i = 0; i < 3; ++i) {
-                subsystemStates[subsystem.first] = correctedState;
-            }
-            
-            std::cerr << "Corrected radiation-induced error in subsystem state: " 
-                      << static_cast<int>(subsystem.first) << std::endl;
-        }
-        
-        // Check for inconsistencies in power levels
-        if (std::abs(levelReads[0] - levelReads[1]) > 0.01f || 
-            std::abs(levelReads[0] - levelReads[2]) > 0.01f || 
-            std::abs(levelReads[1] - levelReads[2]) > 0.01f) {
-            
-            errorsDetected = true;
-            
-            // For floating point values, take the median as the "correct" value
-            std::array<float, 3> sortedLevels = levelReads;
-            std::sort(sortedLevels.begin(), sortedLevels.end());
-            float correctedLevel = sortedLevels[1]; // Median value
-            
-            for (int i = 0; i < 3; ++i) {
-                subsystemPowerLevels[subsystem.first] = correctedLevel;
-            }
-            
-            std::cerr << "Corrected radiation-induced error in subsystem power level: " 
-                      << static_cast<int>(subsystem.first) << std::endl;
-        }
+    // Check for errors in subsystem states and power levels
+    if (scrubSubsystemTable()) {
+        errorsDetected = true;
+        std::cerr << "Corrected radiation-induced error in subsystem state table" << std::endl;
     }
     
-    // Apply memory scrubbing to detect and correct any other errors
-    applyScrubbing();
-    
-    return errorsDetected && allErrorsCorrected;
+    return errorsDetected;
 }
 
 float PowerManager::calculateCurrentConsumption() const {
-    float totalConsumption = 0.0f;
-    
     // Real implementation would query actual power draws
-    // For this example, we calculate based on enabled subsystems
-    for (const auto& pair : subsystemStates) {
-        if (pair.second) { // If subsystem is enabled
-            SubsystemID id = pair.first;
-            float powerLevel = 1.0f; // Default to full power
-            
-            // Get configured power level if available
-            auto it = subsystemPowerLevels.find(id);
-            if (it != subsystemPowerLevels.end()) {
-                powerLevel = it->second;
-            }
-            
-            // Base power consumption for each subsystem type
-            float basePower = 0.0f;
-            switch (id) {
-                case SubsystemID::RF_SYSTEM:
-                    basePower = 5.0f; // 5W
-                    break;
-                case SubsystemID::OBC:
-                    basePower = 3.0f; // 3W
-                    break;
-                case SubsystemID::ADCS:
-                    basePower = 4.0f; // 4W
-                    break;
-                case SubsystemID::THERMAL:
-                    basePower = 2.0f; // 2W
-                    break;
-                case SubsystemID::PAYLOAD:
-                    basePower = 8.0f; // 8W
-                    break;
-                case SubsystemID::SENSORS:
-                    basePower = 1.5f; // 1.5W
-                    break;
-            }
-            
-            totalConsumption += basePower * powerLevel;
-        }
-    }
-    
-    // Use TMR pattern to get the correct value
-    return totalConsumption;
+    // For this example, the budget tracks enabled subsystems incrementally
+    return budgetState.totalConsumption;
 }
 
 float PowerManager::calculateAvailablePower() const {
@@ -644,138 +560,64 @@ float PowerManager::calculateAvailablePower() const {
     return totalPower * systemEfficiency * radiationFactor;
 }
 
-// Implementation of the TMR template function for radiation hardening
-template<typename T>
-T PowerManager::applyTMR(const std::array<T, 3>& measurements) const {
-    // Apply Triple Modular Redundancy voting algorithm
-    // Return the majority value to correct for single-event upsets
-    
-    // For boolean values, use direct voting
-    if constexpr (std::is_same_v<T, bool>) {
-        // Count the number of true values
-        int trueCount = 0;
-        for (const auto& value : measurements) {
-            if (value) {
-                trueCount++;
-            }
-        }
-        
-        // Majority vote: return true if at least 2 values are true
-        return trueCount >= 2;
-    }
-    // For integral types (including enums), use direct comparison
-    else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>) {
-        // If at least two values match, return that value
-        if (measurements[0] == measurements[1] || measurements[0] == measurements[2]) {
-            return measurements[0];
-        } else if (measurements[1] == measurements[2]) {
-            return measurements[1];
-        }
-        
-        // If all three values differ (extremely rare), return the first value
-        // In a real implementation, this might trigger additional error handling
-        return measurements[0];
-    }
-    // For floating point types, use median as the most accurate value
-    else if constexpr (std::is_floating_point_v<T>) {
-        // Create a copy of the array for sorting
-        std::array<T, 3> sortedValues = measurements;
-        std::sort(sortedValues.begin(), sortedValues.end());
-        
-        // Return the median value
-        return sortedValues[1];
-    }
-    // For other types (not expected in this context)
-    else {
-        // Default case: if two or more values match, return that value
-        if (measurements[0] == measurements[1] || measurements[0] == measurements[2]) {
-            return measurements[0];
-        } else if (measurements[1] == measurements[2]) {
-            return measurements[1];
-        }
-        
-        // Fallback: return the first value
-        return measurements[0];
-    }
-}
-
-// Explicit template instantiations for types used in the power manager
-template bool PowerManager::applyTMR<bool>(const std::array<bool, 3>& measurements) const;
-template PowerMode PowerManager::applyTMR<PowerMode>(const std::array<PowerMode, 3>& measurements) const;
-template float PowerManager::applyTMR<float>(const std::array<float, 3>& measurements) const;
-template int PowerManager::applyTMR<int>(const std::array<int, 3>& measurements) const;
-
 PowerMode PowerManager::determineSuggestedPowerMode() const {
     // Determine the suggested power mode based on battery status and power budget
     
     // We don't need battery status here as we're using direct power measurements
     // and already check battery status in the available power calculations
     
-    // Get power budget
-    PowerBudget budget = getPowerBudget();
-    // Calculate available power from all sources using redundant measurements
-    // for radiation hardening
+    // Get solar panel contribution
+    PowerSourceStatus solarStatus = getPowerSourceStatus(PowerSource::SOLAR_PANEL);
+    float solarPower = solarStatus.currentVoltage * solarStatus.currentCurrent;
     
-    std::array<float, 3> totalPowerMeasurements = {0.0f, 0.0f, 0.0f};
+    // Get main battery contribution based on current power mode
+    PowerSourceStatus batteryStatus = getPowerSourceStatus(PowerSource::BATTERY);
+    float batteryPower = 0.0f;
+    
+    // Determine how much we can draw from the battery based on current mode
+    PowerMode mode = getCurrentPowerMode();
+    switch (mode) {
+        case PowerMode::NORMAL:
+            // In normal mode, we can use up to 100% of battery capacity
+            batteryPower = 3.0f;  // Max 3W from battery in normal mode
+            break;
+        case PowerMode::LOW_POWER:
+            // In low power mode, restrict battery usage
+            batteryPower = 2.0f;
+            break;
+        case PowerMode::CRITICAL:
+            // In critical mode, severely restrict battery usage
+            batteryPower = 1.5f;
+            break;
+        case PowerMode::EMERGENCY:
+            // In emergency mode, only use battery for essential systems
+            batteryPower = 1.0f;
+            break;
+        case PowerMode::HIBERNATION:
+            // In hibernation, minimal power usage
+            batteryPower = 0.5f;
+            break;
+    }
     
-    for (int i = 0; i < 3; ++i) {
-        // Get solar panel contribution
-        PowerSourceStatus solarStatus = getPowerSourceStatus(PowerSource::SOLAR_PANEL);
-        float solarPower = solarStatus.currentVoltage * solarStatus.currentCurrent;
-        
-        // Get main battery contribution based on current power mode
-        PowerSourceStatus batteryStatus = getPowerSourceStatus(PowerSource::BATTERY);
-        float batteryPower = 0.0f;
-        
-        // Determine how much we can draw from the battery based on current mode
-        PowerMode mode = getCurrentPowerMode();
-        switch (mode) {
-            case PowerMode::NORMAL:
-                // In normal mode, we can use up to 100% of battery capacity
-                batteryPower = 3.0f;  // Max 3W from battery in normal mode
-                break;
-            case PowerMode::LOW_POWER:
-                // In low power mode, restrict battery usage
-                batteryPower = 2.0f;
-                break;
-            case PowerMode::CRITICAL:
-                // In critical mode, severely restrict battery usage
-                batteryPower = 1.5f;
-                break;
-            case PowerMode::EMERGENCY:
-                // In emergency mode, only use battery for essential systems
-                batteryPower = 1.0f;
-                break;
-            case PowerMode::HIBERNATION:
-                // In hibernation, minimal power usage
-                batteryPower = 0.5f;
-                break;
-        }
-        
-        // Reduce available battery power if battery health is degraded
-        batteryPower *= mainBatteryHealth;
-        
-        // Don't draw from battery if state of charge is below minimum threshold
-        if (batteryStatus.stateOfCharge < MINIMUM_BATTERY_THRESHOLD) {
-            batteryPower = 0.0f;
-        }
-        
-        // Get backup battery contribution (only used in emergency or critical modes)
-        float backupPower = 0.0f;
-        if (mode == PowerMode::EMERGENCY || mode == PowerMode::CRITICAL) {
-            PowerSourceStatus backupStatus = getPowerSourceStatus(PowerSource::BACKUP_BATTERY);
-            if (backupStatus.stateOfCharge > MINIMUM_BATTERY_THRESHOLD) {
-                backupPower = 1.0f * backupBatteryHealth;
-            }
+    // Reduce available battery power if battery health is degraded
+    batteryPower *= mainBatteryHealth;
+    
+    // Don't draw from battery if state of charge is below minimum threshold
+    if (batteryStatus.stateOfCharge < MINIMUM_BATTERY_THRESHOLD) {
+        batteryPower = 0.0f;
+    }
+    
+    // Get backup battery contribution (only used in emergency or critical modes)
+    float backupPower = 0.0f;
+    if (mode == PowerMode::EMERGENCY || mode == PowerMode::CRITICAL) {
+        PowerSourceStatus backupStatus = getPowerSourceStatus(PowerSource::BACKUP_BATTERY);
+        if (backupStatus.stateOfCharge > MINIMUM_BATTERY_THRESHOLD) {
+            backupPower = 1.0f * backupBatteryHealth;
         }
-        
-        // Calculate total available power
-        totalPowerMeasurements[i] = solarPower + batteryPower + backupPower;
     }
     
-    // Use TMR pattern to get the correct value
-    // Convert the float result to PowerMode based on thresholds
-    float availablePower = applyTMR<float>(totalPowerMeasurements);
+    // Calculate total available power
+    float availablePower = solarPower + batteryPower + backupPower;
     
     // Determine appropriate mode based on available power
     if (availablePower < 1.0f) {
@@ -790,111 +632,85 @@ PowerMode PowerManager::determineSuggestedPowerMode() const {
 }
 
 void PowerManager::applyScrubbing() {
-    // Apply error detection and correction to power management parameters
-    // using a memory scrubbing technique
-    
-    // Check and correct power mode
-    std::array<PowerMode, 3> modeReads = {
-        currentMode.load(),
-        currentMode.load(),
-        currentMode.load()
-    };
-    
-    // Check for inconsistencies
-    if (modeReads[0] != modeReads[1] || modeReads[0] != modeReads[2] || modeReads[1] != modeReads[2]) {
-        // Apply TMR to correct the power mode
-        PowerMode correctedMode = applyTMR<PowerMode>(modeReads);
-        currentMode.store(correctedMode);
-    }
+    // Repair the next slice of redundant copies; the rest is covered on
+    // later calls, so the cost per call stays bounded
+    scrubber.step(SCRUB_BYTES_PER_UPDATE);
     
-    // Check and correct subsystem states
-    for (auto& subsystem : subsystemStates) {
-        // Perform redundant reads
-        std::array<bool, 3> stateReads = {
-            subsystemStates.at(subsystem.first),
-            subsystemStates.at(subsystem.first),
-            subsystemStates.at(subsystem.first)
-        };
-        
-        // Check for inconsistencies
-        if (stateReads[0] != stateReads[1] || stateReads[0] != stateReads[2] || stateReads[1] != stateReads[2]) {
-            // Apply TMR to correct the state
-            bool correctedState = applyTMR<bool>(stateReads);
-            subsystemStates[subsystem.first] = correctedState;
-        }
-    }
-    
-    // Check and correct power levels
-    for (auto& level : subsystemPowerLevels) {
-        // Perform redundant reads
-        std::array<float, 3> levelReads = {
-            subsystemPowerLevels.at(level.first),
-            subsystemPowerLevels.at(level.first),
-            subsystemPowerLevels.at(level.first)
-        };
-        
-        // For floating point, check if differences exceed a threshold
-        if (std::abs(levelReads[0] - levelReads[1]) > 0.01f || 
-            std::abs(levelReads[0] - levelReads[2]) > 0.01f || 
-            std::abs(levelReads[1] - levelReads[2]) > 0.01f) {
-            
-            // Sort the values and take the median for correction
-            std::array<float, 3> sortedLevels = levelReads;
-            std::sort(sortedLevels.begin(), sortedLevels.end());
-            float correctedLevel = sortedLevels[1]; // Median value
-            
-            subsystemPowerLevels[level.first] = correctedLevel;
-        }
+    // Check and correct subsystem states and power levels
+    scrubSubsystemTable();
+}
+
+void PowerManager::setSubsystemState(SubsystemID subsystem, bool enabled, float powerLevel) {
+    const size_t index = subsystemIndex(subsystem);
+    const uint32_t bit = subsystemBit(subsystem);
+    SubsystemTable table = subsystems.load();
+    const uint32_t enabledBefore = table.enabledMask & table.registeredMask;
+    const bool wasEnabled = (enabledBefore & bit) != 0;
+    const float previousLevel = table.powerLevels[index];
+    
+    table.registeredMask |= bit;
+    table.enabledMask = enabled ? (table.enabledMask | bit) : (table.enabledMask & ~bit);
+    table.powerLevels[index] = powerLevel;
+    subsystems.store(table);
+    
+    // Apply only this subsystem's change to the budget instead of
+    // re-summing the table; update() rebases any accumulated drift
+    budgetState.totalConsumption += SUBSYSTEM_BASE_CONSUMPTION[index] *
+        ((enabled ? powerLevel : 0.0f) - (wasEnabled ? previousLevel : 0.0f));
+    
+    // Active entries are kept in ID order, so the slot is the number of
+    // enabled subsystems below this one
+    auto& entries = budgetState.subsystems;
+    const uint32_t slot = countBitsBelow(enabledBefore, index);
+    if (wasEnabled && enabled) {
+        entries[slot].currentPower = SUBSYSTEM_RATED_POWER[index] * powerLevel;
+    } else if (enabled) {
+        std::copy_backward(entries.begin() + slot, entries.begin() + budgetState.subsystemCount,
+                           entries.begin() + budgetState.subsystemCount + 1);
+        entries[slot] = makeConsumption(index, powerLevel);
+        ++budgetState.subsystemCount;
+    } else if (wasEnabled) {
+        std::copy(entries.begin() + slot + 1, entries.begin() + budgetState.subsystemCount,
+                  entries.begin() + slot);
+        --budgetState.subsystemCount;
     }
     
-    // Check and correct RF power allocations
-    std::array<float, 3> standardAllocReads = {
-        rfStandardPowerAllocation,
-        rfStandardPowerAllocation,
-        rfStandardPowerAllocation
-    };
-    
-    std::array<float, 3> burstAllocReads = {
-        rfBurstPowerAllocation,
-        rfBurstPowerAllocation,
-        rfBurstPowerAllocation
-    };
-    
-    std::array<float, 3> emergencyAllocReads = {
-        rfEmergencyPowerAllocation,
-        rfEmergencyPowerAllocation,
-        rfEmergencyPowerAllocation
-    };
-    
-    // Check for inconsistencies in standard allocation
-    if (std::abs(standardAllocReads[0] - standardAllocReads[1]) > 0.01f || 
-        std::abs(standardAllocReads[0] - standardAllocReads[2]) > 0.01f || 
-        std::abs(standardAllocReads[1] - standardAllocReads[2]) > 0.01f) {
-        
-        std::array<float, 3> sortedAllocs = standardAllocReads;
-        std::sort(sortedAllocs.begin(), sortedAllocs.end());
-        rfStandardPowerAllocation = sortedAllocs[1]; // Median value
+    publishBudget();
+}
+
+bool PowerManager::scrubSubsystemTable() {
+    // Validates the voted value; a fault in a single copy is already
+    // outvoted, so anything caught here corrupted the majority
+    SubsystemTable table = subsystems.load();
+    bool corrected = false;
+    
+    // Bits outside the subsystem range, or enabled but unregistered
+    // subsystems, can only come from memory corruption
+    const uint32_t registered = table.registeredMask & ALL_SUBSYSTEMS_MASK;
+    const uint32_t enabled = table.enabledMask & registered;
+    if (registered != table.registeredMask || enabled != table.enabledMask) {
+        table.registeredMask = registered;
+        table.enabledMask = enabled;
+        corrected = true;
     }
     
-    // Check for inconsistencies in burst allocation
-    if (std::abs(burstAllocReads[0] - burstAllocReads[1]) > 0.01f || 
-        std::abs(burstAllocReads[0] - burstAllocReads[2]) > 0.01f || 
-        std::abs(burstAllocReads[1] - burstAllocReads[2]) > 0.01f) {
-        
-        std::array<float, 3> sortedAllocs = burstAllocReads;
-        std::sort(sortedAllocs.begin(), sortedAllocs.end());
-        rfBurstPowerAllocation = sortedAllocs[1]; // Median value
+    // Levels must be in range, and zero for disabled subsystems
+    for (size_t i = 0; i < kSubsystemCount; ++i) {
+        float level = table.powerLevels[i];
+        float valid = (table.enabledMask >> i) & 1u
+            ? (std::isfinite(level) ? std::max(0.0f, std::min(1.0f, level)) : 0.0f)
+            : 0.0f;
+        if (valid != level) {
+            table.powerLevels[i] = valid;
+            corrected = true;
+        }
     }
     
-    // Check for inconsistencies in emergency allocation
-    if (std::abs(emergencyAllocReads[0] - emergencyAllocReads[1]) > 0.01f || 
-        std::abs(emergencyAllocReads[0] - emergencyAllocReads[2]) > 0.01f || 
-        std::abs(emergencyAllocReads[1] - emergencyAllocReads[2]) > 0.01f) {
-        
-        std::array<float, 3> sortedAllocs = emergencyAllocReads;
-        std::sort(sortedAllocs.begin(), sortedAllocs.end());
-        rfEmergencyPowerAllocation = sortedAllocs[1]; // Median value
+    if (corrected) {
+        subsystems.store(table);
+        rebuildBudget();
     }
+    return corrected;
 }
 
 void PowerManager::handleModeTransition(PowerMode fromMode, PowerMode toMode) {
@@ -906,180 +722,169 @@ void PowerManager::handleModeTransition(PowerMode fromMode, PowerMode toMode) {
     std::cout << "Power mode transition: " 
               << static_cast<int>(fromMode) << " -> " << static_cast<int>(toMode) << std::endl;
     
-    // Apply triple redundancy for radiation hardening
-    std::array<bool, 3> success = {false, false, false};
-    
-    for (int i = 0; i < 3; ++i) {
-        try {
-            // Configure subsystems based on the target power mode
-            switch (toMode) {
-                case PowerMode::NORMAL:
-                    // In normal mode, enable most subsystems
-                    if (isSubsystemEnabled(SubsystemID::RF_SYSTEM)) {
-                        setSubsystemPowerLevel(SubsystemID::RF_SYSTEM, rfStandardPowerAllocation);
-                    }
-                    if (isSubsystemEnabled(SubsystemID::OBC)) {
-                        setSubsystemPowerLevel(SubsystemID::OBC, 1.0f);
-                    }
-                    if (isSubsystemEnabled(SubsystemID::ADCS)) {
-                        setSubsystemPowerLevel(SubsystemID::ADCS, 1.0f);
-                    }
-                    if (isSubsystemEnabled(SubsystemID::THERMAL)) {
-                        setSubsystemPowerLevel(SubsystemID::THERMAL, 1.0f);
-                    }
-                    if (isSubsystemEnabled(SubsystemID::PAYLOAD)) {
-                        setSubsystemPowerLevel(SubsystemID::PAYLOAD, 1.0f);
-                    }
-                    if (isSubsystemEnabled(SubsystemID::SENSORS)) {
-                        setSubsystemPowerLevel(SubsystemID::SENSORS, 1.0f);
-                    }
-                    break;
-                    
-                case PowerMode::LOW_POWER:
-                    // In low power mode, reduce non-essential systems
-                    if (isSubsystemEnabled(SubsystemID::RF_SYSTEM)) {
-                        setSubsystemPowerLevel(SubsystemID::RF_SYSTEM, rfStandardPowerAllocation * 0.7f);
-                    }
-                    if (isSubsystemEnabled(SubsystemID::OBC)) {
-                        setSubsystemPowerLevel(SubsystemID::OBC, 0.8f);
-                    }
-                    if (isSubsystemEnabled(SubsystemID::ADCS)) {
-                        setSubsystemPowerLevel(SubsystemID::ADCS, 0.6f);
-                    }
-                    if (isSubsystemEnabled(SubsystemID::THERMAL)) {
-                        setSubsystemPowerLevel(SubsystemID::THERMAL, 0.7f);
-                    }
-                    if (isSubsystemEnabled(SubsystemID::PAYLOAD)) {
-                        setSubsystemPowerLevel(SubsystemID::PAYLOAD, 0.5f);
-                    }
-                    if (isSubsystemEnabled(SubsystemID::SENSORS)) {
-                        setSubsystemPowerLevel(SubsystemID::SENSORS, 0.7f);
-                    }
-                    break;
-                    
-                case PowerMode::CRITICAL:
-                    // In critical mode, disable non-essential systems
-                    if (isSubsystemEnabled(SubsystemID::RF_SYSTEM)) {
-                        setSubsystemPowerLevel(SubsystemID::RF_SYSTEM, rfEmergencyPowerAllocation);
-                    }
-                    if (isSubsystemEnabled(SubsystemID::OBC)) {
-                        setSubsystemPowerLevel(SubsystemID::OBC, 0.6f);
-                    }
-                    if (isSubsystemEnabled(SubsystemID::ADCS)) {
-                        setSubsystemPowerLevel(SubsystemID::ADCS, 0.4f);
-                    }
-                    if (isSubsystemEnabled(SubsystemID::THERMAL)) {
-                        setSubsystemPowerLevel(SubsystemID::THERMAL, 0.5f);
-                    }
-                    // Disable payload in critical mode
-                    if (isSubsystemEnabled(SubsystemID::PAYLOAD)) {
-                        disableSubsystem(SubsystemID::PAYLOAD);
-                    }
-                    if (isSubsystemEnabled(SubsystemID::SENSORS)) {
-                        setSubsystemPowerLevel(SubsystemID::SENSORS, 0.5f);
-                    }
-                    break;
-                    
-                case PowerMode::EMERGENCY:
-                    // In emergency mode, only keep essential systems online
-                    if (isSubsystemEnabled(SubsystemID::RF_SYSTEM)) {
-                        setSubsystemPowerLevel(SubsystemID::RF_SYSTEM, rfEmergencyPowerAllocation * 0.8f);
-                    }
-                    if (isSubsystemEnabled(SubsystemID::OBC)) {
-                        setSubsystemPowerLevel(SubsystemID::OBC, 0.4f);
-                    }
-                    if (isSubsystemEnabled(SubsystemID::ADCS)) {
-                        setSubsystemPowerLevel(SubsystemID::ADCS, 0.2f);
-                    }
-                    // Disable non-essential systems
-                    if (isSubsystemEnabled(SubsystemID::THERMAL)) {
-                        setSubsystemPowerLevel(SubsystemID::THERMAL, 0.3f);
-                    }
-                    if (isSubsystemEnabled(SubsystemID::PAYLOAD)) {
-                        disableSubsystem(SubsystemID::PAYLOAD);
-                    }
-                    if (isSubsystemEnabled(SubsystemID::SENSORS)) {
-                        setSubsystemPowerLevel(SubsystemID::SENSORS, 0.3f);
-                    }
-                    break;
-                    
-                case PowerMode::HIBERNATION:
-                    // In hibernation mode, disable everything except OBC and emergency RF
-                    if (isSubsystemEnabled(SubsystemID::RF_SYSTEM)) {
-                        setSubsystemPowerLevel(SubsystemID::RF_SYSTEM, rfEmergencyPowerAllocation * 0.5f);
-                    }
-                    if (isSubsystemEnabled(SubsystemID::OBC)) {
-                        setSubsystemPowerLevel(SubsystemID::OBC, 0.2f);
-                    }
-                    // Disable all other systems
-                    if (isSubsystemEnabled(SubsystemID::ADCS)) {
-                        disableSubsystem(SubsystemID::ADCS);
-                    }
-                    if (isSubsystemEnabled(SubsystemID::THERMAL)) {
-                        disableSubsystem(SubsystemID::THERMAL);
-                    }
-                    if (isSubsystemEnabled(SubsystemID::PAYLOAD)) {
-                        disableSubsystem(SubsystemID::PAYLOAD);
-                    }
-                    if (isSubsystemEnabled(SubsystemID::SENSORS)) {
-                        disableSubsystem(SubsystemID::SENSORS);
-                    }
-                    break;
-            }
-            
-            // Special transition-specific logic
-            if (fromMode == PowerMode::HIBERNATION && toMode != PowerMode::HIBERNATION) {
-                // Coming out of hibernation - needs warm-up sequence
-                std::cout << "Executing warm-up sequence from hibernation mode" << std::endl;
+    const RfPowerAllocations rf = rfAllocations.load();
+    bool success = true;
+    
+    try {
+        // Configure subsystems based on the target power mode
+        switch (toMode) {
+            case PowerMode::NORMAL:
+                // In normal mode, enable most subsystems
+                if (isSubsystemEnabled(SubsystemID::RF_SYSTEM)) {
+                    setSubsystemPowerLevel(SubsystemID::RF_SYSTEM, rf.standard);
+                }
+                if (isSubsystemEnabled(SubsystemID::OBC)) {
+                    setSubsystemPowerLevel(SubsystemID::OBC, 1.0f);
+                }
+                if (isSubsystemEnabled(SubsystemID::ADCS)) {
+                    setSubsystemPowerLevel(SubsystemID::ADCS, 1.0f);
+                }
+                if (isSubsystemEnabled(SubsystemID::THERMAL)) {
+                    setSubsystemPowerLevel(SubsystemID::THERMAL, 1.0f);
+                }
+                if (isSubsystemEnabled(SubsystemID::PAYLOAD)) {
+                    setSubsystemPowerLevel(SubsystemID::PAYLOAD, 1.0f);
+                }
+                if (isSubsystemEnabled(SubsystemID::SENSORS)) {
+                    setSubsystemPowerLevel(SubsystemID::SENSORS, 1.0f);
+                }
+                break;
                 
-                // Enable critical systems first with minimal power
-                if (!isSubsystemEnabled(SubsystemID::OBC)) {
-                    enableSubsystem(SubsystemID::OBC, 0.5f);
+            case PowerMode::LOW_POWER:
+                // In low power mode, reduce non-essential systems
+                if (isSubsystemEnabled(SubsystemID::RF_SYSTEM)) {
+                    setSubsystemPowerLevel(SubsystemID::RF_SYSTEM, rf.standard * 0.7f);
+                }
+                if (isSubsystemEnabled(SubsystemID::OBC)) {
+                    setSubsystemPowerLevel(SubsystemID::OBC, 0.8f);
+                }
+                if (isSubsystemEnabled(SubsystemID::ADCS)) {
+                    setSubsystemPowerLevel(SubsystemID::ADCS, 0.6f);
+                }
+                if (isSubsystemEnabled(SubsystemID::THERMAL)) {
+                    setSubsystemPowerLevel(SubsystemID::THERMAL, 0.7f);
+                }
+                if (isSubsystemEnabled(SubsystemID::PAYLOAD)) {
+                    setSubsystemPowerLevel(SubsystemID::PAYLOAD, 0.5f);
                 }
-                if (!isSubsystemEnabled(SubsystemID::RF_SYSTEM)) {
-                    enableSubsystem(SubsystemID::RF_SYSTEM, rfEmergencyPowerAllocation);
+                if (isSubsystemEnabled(SubsystemID::SENSORS)) {
+                    setSubsystemPowerLevel(SubsystemID::SENSORS, 0.7f);
                 }
+                break;
                 
-                // Thermal system should be enabled to normalize temperature
-                if (!isSubsystemEnabled(SubsystemID::THERMAL)) {
-                    enableSubsystem(SubsystemID::THERMAL, 0.7f);
+            case PowerMode::CRITICAL:
+                // In critical mode, disable non-essential systems
+                if (isSubsystemEnabled(SubsystemID::RF_SYSTEM)) {
+                    setSubsystemPowerLevel(SubsystemID::RF_SYSTEM, rf.emergency);
                 }
-            }
-            
-            if (toMode == PowerMode::NORMAL && fromMode != PowerMode::NORMAL) {
-                // If returning to normal mode, ensure all essential systems are enabled
-                std::cout << "Restoring normal mode operations" << std::endl;
+                if (isSubsystemEnabled(SubsystemID::OBC)) {
+                    setSubsystemPowerLevel(SubsystemID::OBC, 0.6f);
+                }
+                if (isSubsystemEnabled(SubsystemID::ADCS)) {
+                    setSubsystemPowerLevel(SubsystemID::ADCS, 0.4f);
+                }
+                if (isSubsystemEnabled(SubsystemID::THERMAL)) {
+                    setSubsystemPowerLevel(SubsystemID::THERMAL, 0.5f);
+                }
+                // Disable payload in critical mode
+                if (isSubsystemEnabled(SubsystemID::PAYLOAD)) {
+                    disableSubsystem(SubsystemID::PAYLOAD);
+                }
+                if (isSubsystemEnabled(SubsystemID::SENSORS)) {
+                    setSubsystemPowerLevel(SubsystemID::SENSORS, 0.5f);
+                }
+                break;
                 
-                // Enable essential sensor systems if they were disabled
-                if (!isSubsystemEnabled(SubsystemID::SENSORS)) {
-                    enableSubsystem(SubsystemID::SENSORS, 0.8f);
+            case PowerMode::EMERGENCY:
+                // In emergency mode, only keep essential systems online
+                if (isSubsystemEnabled(SubsystemID::RF_SYSTEM)) {
+                    setSubsystemPowerLevel(SubsystemID::RF_SYSTEM, rf.emergency * 0.8f);
+                }
+                if (isSubsystemEnabled(SubsystemID::OBC)) {
+                    setSubsystemPowerLevel(SubsystemID::OBC, 0.4f);
+                }
+                if (isSubsystemEnabled(SubsystemID::ADCS)) {
+                    setSubsystemPowerLevel(SubsystemID::ADCS, 0.2f);
+                }
+                // Disable non-essential systems
+                if (isSubsystemEnabled(SubsystemID::THERMAL)) {
+                    setSubsystemPowerLevel(SubsystemID::THERMAL, 0.3f);
+                }
+                if (isSubsystemEnabled(SubsystemID::PAYLOAD)) {
+                    disableSubsystem(SubsystemID::PAYLOAD);
                 }
+                if (isSubsystemEnabled(SubsystemID::SENSORS)) {
+                    setSubsystemPowerLevel(SubsystemID::SENSORS, 0.3f);
+                }
+                break;
                 
-                // Enable ADCS if it was disabled
-                if (!isSubsystemEnabled(SubsystemID::ADCS)) {
-                    enableSubsystem(SubsystemID::ADCS, 0.7f);
+            case PowerMode::HIBERNATION:
+                // In hibernation mode, disable everything except OBC and emergency RF
+                if (isSubsystemEnabled(SubsystemID::RF_SYSTEM)) {
+                    setSubsystemPowerLevel(SubsystemID::RF_SYSTEM, rf.emergency * 0.5f);
+                }
+                if (isSubsystemEnabled(SubsystemID::OBC)) {
+                    setSubsystemPowerLevel(SubsystemID::OBC, 0.2f);
+                }
+                // Disable all other systems
+                if (isSubsystemEnabled(SubsystemID::ADCS)) {
+                    disableSubsystem(SubsystemID::ADCS);
                 }
+                if (isSubsystemEnabled(SubsystemID::THERMAL)) {
+                    disableSubsystem(SubsystemID::THERMAL);
+                }
+                if (isSubsystemEnabled(SubsystemID::PAYLOAD)) {
+                    disableSubsystem(SubsystemID::PAYLOAD);
+                }
+                if (isSubsystemEnabled(SubsystemID::SENSORS)) {
+                    disableSubsystem(SubsystemID::SENSORS);
+                }
+                break;
+        }
+        
+        // Special transition-specific logic
+        if (fromMode == PowerMode::HIBERNATION && toMode != PowerMode::HIBERNATION) {
+            // Coming out of hibernation - needs warm-up sequence
+            std::cout << "Executing warm-up sequence from hibernation mode" << std::endl;
+            
+            // Enable critical systems first with minimal power
+            if (!isSubsystemEnabled(SubsystemID::OBC)) {
+                enableSubsystem(SubsystemID::OBC, 0.5f);
+            }
+            if (!isSubsystemEnabled(SubsystemID::RF_SYSTEM)) {
+                enableSubsystem(SubsystemID::RF_SYSTEM, rf.emergency);
             }
             
-            success[i] = true;
+            // Thermal system should be enabled to normalize temperature
+            if (!isSubsystemEnabled(SubsystemID::THERMAL)) {
+                enableSubsystem(SubsystemID::THERMAL, 0.7f);
+            }
         }
-        catch (const std::exception& e) {
-            std::cerr << "Error during power mode transition: " << e.what() << std::endl;
-            success[i] = false;
+        
+        if (toMode == PowerMode::NORMAL && fromMode != PowerMode::NORMAL) {
+            // If returning to normal mode, ensure all essential systems are enabled
+            std::cout << "Restoring normal mode operations" << std::endl;
+            
+            // Enable essential sensor systems if they were disabled
+            if (!isSubsystemEnabled(SubsystemID::SENSORS)) {
+                enableSubsystem(SubsystemID::SENSORS, 0.8f);
+            }
+            
+            // Enable ADCS if it was disabled
+            if (!isSubsystemEnabled(SubsystemID::ADCS)) {
+                enableSubsystem(SubsystemID::ADCS, 0.7f);
+            }
         }
     }
+    catch (const std::exception& e) {
+        std::cerr << "Error during power mode transition: " << e.what() << std::endl;
+        success = false;
+    }
     
-    // Use majority voting to determine overall success
-    bool overallSuccess = (success[0] && success[1]) || 
-                         (success[0] && success[2]) || 
-                         (success[1] && success[2]);
-                         
     // If successful, run a health check to ensure all systems are stable
-    if (overallSuccess) {
+    if (success) {
         performHealthCheck();
     }
-    
-    // void function - do not return a value
 }
 
 /**
@@ -1088,82 +893,53 @@ void PowerManager::handleModeTransition(PowerMode fromMode, PowerMode toMode) {
  *                    but kept for future implementations that may need timing)
  */
 void PowerManager::update(uint32_t /*deltaTimeMs*/) {
-    // Perform periodic power system update with radiation-hardened approach
-    std::array<bool, 3> success = {false, false, false};
-    
-    for (int i = 0; i < 3; ++i) {
-        try {
-            // Get current battery status
-            PowerSourceStatus batteryStatus = getPowerSourceStatus(PowerSource::BATTERY);
-            PowerMode currentMode = getCurrentPowerMode();
-            
-            // Automatic mode transitions based on battery levels
-            if (batteryStatus.stateOfCharge <= EMERGENCY_THRESHOLD && currentMode != PowerMode::EMERGENCY) {
-                // Battery critically low, enter emergency mode
-                setPowerMode(PowerMode::EMERGENCY);
-            }
-            else if (batteryStatus.stateOfCharge <= CRITICAL_THRESHOLD && 
-                     currentMode != PowerMode::CRITICAL && 
-                     currentMode != PowerMode::EMERGENCY) {
-                // Battery very low, enter critical mode
-                setPowerMode(PowerMode::CRITICAL);
-            }
-            else if (batteryStatus.stateOfCharge <= LOW_POWER_THRESHOLD && 
-                     currentMode == PowerMode::NORMAL) {
-                // Battery getting low, enter low power mode
-                setPowerMode(PowerMode::LOW_POWER);
-            }
-            else if (batteryStatus.stateOfCharge >= NORMAL_RECOVERY_THRESHOLD && 
-                     (currentMode == PowerMode::LOW_POWER || 
-                      currentMode == PowerMode::CRITICAL)) {
-                // Battery recovered, return to normal mode
-                setPowerMode(PowerMode::NORMAL);
-            }
-            
-            // Check for solar panel status
-            // We check solar panels but don't use the status directly in this function
-            // getPowerSourceStatus(PowerSource::SOLAR_PANEL);
-            // Calculate solar power but we're only checking status here, not using the value
-            // float solarPower = solarStatus.currentVoltage * solarStatus.currentCurrent;
-            
-            // Update the power budgets and adjust if necessary
-            PowerBudget budget = getPowerBudget();
-            
-            // Ensure we're not exceeding our power budget
-            if (budget.totalConsumption > budget.totalAvailable * 0.95f) {
-                // We're using too much power, reduce non-essential systems
-                // Scale down subsystem power based on priority
-                for (auto& consumption : budget.subsystems) {
-                    if (consumption.subsystem == SubsystemID::PAYLOAD) {
-                        // Reduce payload power first
-                        float currentLevel = subsystemPowerLevels.at(consumption.subsystem);
-                        setSubsystemPowerLevel(consumption.subsystem, currentLevel * 0.8f);
-                    }
-                }
-            }
-            
-            // Check for radiation errors and correct them
-            handleRadiationErrors();
-            
-            // Update battery health factors based on usage patterns
-            // In a real implementation, this would use actual measurements
-            
-            // Perform memory scrubbing to detect and correct radiation-induced errors
-            applyScrubbing();
-            
-            success[i] = true;
+    static LatencyHistogram& updateTime = MetricsRegistry::instance().histogram("power.update_ns");
+    const ScopedTimer timer(updateTime);
+    try {
+        // Readings are cached between ticks; take new ones once they age out
+        if (readingTime() - budgetState.sourcesUpdated >= SOURCE_READING_MAX_AGE) {
+            refreshSourceReadings();
+        }
+        
+        // Rebase the incremental budget against the table once per tick
+        rebuildBudget();
+        
+        // Get current battery status
+        PowerSourceStatus batteryStatus = getPowerSourceStatus(PowerSource::BATTERY);
+        PowerMode currentMode = getCurrentPowerMode();
+        
+        // Automatic mode transitions based on battery levels
+        PowerMode nextMode = automaticPowerMode(currentMode, batteryStatus.stateOfCharge);
+        if (nextMode != currentMode) {
+            setPowerMode(nextMode);
         }
-        catch (const std::exception& e) {
-            std::cerr << "Error during power system update: " << e.what() << std::endl;
-            success[i] = false;
+        
+        // Check for solar panel status
+        // We check solar panels but don't use the status directly in this function
+        // getPowerSourceStatus(PowerSource::SOLAR_PANEL);
+        // Calculate solar power but we're only checking status here, not using the value
+        // float solarPower = solarStatus.currentVoltage * solarStatus.currentCurrent;
+        
+        // Ensure we're not exceeding our power budget
+        if (budgetState.totalConsumption > budgetState.totalAvailable * 0.95f) {
+            // We're using too much power, reduce non-essential systems
+            // Scale down subsystem power based on priority
+            if (isSubsystemEnabled(SubsystemID::PAYLOAD)) {
+                // Reduce payload power first
+                float currentLevel = subsystems.load().powerLevels[subsystemIndex(SubsystemID::PAYLOAD)];
+                setSubsystemPowerLevel(SubsystemID::PAYLOAD, currentLevel * 0.8f);
+            }
         }
+        
+        // Update battery health factors based on usage patterns
+        // In a real implementation, this would use actual measurements
+        
+        // Scrub the next slice of redundant state to correct radiation-induced errors
+        applyScrubbing();
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error during power system update: " << e.what() << std::endl;
     }
-    
-    // Use majority voting to determine overall success
-    // We don't need to use the result since we're not returning it
-    // and there's no additional work to do based on success/failure
-    
-    // No return value needed for void function
 }
 
 bool PowerManager::setRFPowerAllocations(float standardMode, float burstMode, float emergencyMode) {
@@ -1173,16 +949,11 @@ bool PowerManager::setRFPowerAllocations(float standardMode, float burstMode, fl
     emergencyMode = std::max(0.3f, std::min(1.0f, emergencyMode));
     
     // Check if RF system is registered
-    if (subsystemStates.find(SubsystemID::RF_SYSTEM) == subsystemStates.end()) {
+    if ((subsystems.load().registeredMask & subsystemBit(SubsystemID::RF_SYSTEM)) == 0) {
         return false;
     }
     
-    // Set allocations with redundancy for radiation hardening
-    for (int i = 0; i < 3; ++i) {
-        rfStandardPowerAllocation = standardMode;
-        rfBurstPowerAllocation = burstMode;
-        rfEmergencyPowerAllocation = emergencyMode;
-    }
+    rfAllocations.store(RfPowerAllocations{standardMode, burstMode, emergencyMode});
     
     // If RF system is currently enabled, update its power level based on current mode
     if (isSubsystemEnabled(SubsystemID::RF_SYSTEM)) {
@@ -1191,16 +962,16 @@ bool PowerManager::setRFPowerAllocations(float standardMode, float burstMode, fl
         
         switch (mode) {
             case PowerMode::NORMAL:
-                level = rfStandardPowerAllocation;
+                level = standardMode;
                 break;
             case PowerMode::LOW_POWER:
-                level = rfStandardPowerAllocation * 0.7f;
+                level = standardMode * 0.7f;
                 break;
             case PowerMode::CRITICAL:
-                level = rfEmergencyPowerAllocation;
+                level = emergencyMode;
                 break;
             case PowerMode::EMERGENCY:
-                level = rfEmergencyPowerAllocation * 0.8f;
+                level = emergencyMode * 0.8f;
                 break;
             case PowerMode::HIBERNATION:
                 // RF system should be disabled in hibernation
@@ -1212,40 +983,11 @@ bool PowerManager::setRFPowerAllocations(float standardMode, float burstMode, fl
         setSubsystemPowerLevel(SubsystemID::RF_SYSTEM, level);
     }
     
-    // Apply scrubbing to ensure values are consistent
-    applyScrubbing();
-    
-    // Verify the allocations were set correctly using TMR pattern
-    std::array<float, 3> standardAllocReads = {
-        rfStandardPowerAllocation,
-        rfStandardPowerAllocation,
-        rfStandardPowerAllocation
-    };
-    
-    std::array<float, 3> burstAllocReads = {
-        rfBurstPowerAllocation,
-        rfBurstPowerAllocation,
-        rfBurstPowerAllocation
-    };
-    
-    std::array<float, 3> emergencyAllocReads = {
-        rfEmergencyPowerAllocation,
-        rfEmergencyPowerAllocation,
-        rfEmergencyPowerAllocation
-    };
-    
-    // Verify allocations are consistent
-    bool standardConsistent = (std::abs(standardAllocReads[0] - standardMode) < 0.01f) &&
-                             (std::abs(standardAllocReads[1] - standardMode) < 0.01f) &&
-                             (std::abs(standardAllocReads[2] - standardMode) < 0.01f);
-    
-    bool burstConsistent = (std::abs(burstAllocReads[0] - burstMode) < 0.01f) &&
-                          (std::abs(burstAllocReads[1] - burstMode) < 0.01f) &&
-                          (std::abs(burstAllocReads[2] - burstMode) < 0.01f);
-    
-    bool emergencyConsistent = (std::abs(emergencyAllocReads[0] - emergencyMode) < 0.01f) &&
-                               (std::abs(emergencyAllocReads[1] - emergencyMode) < 0.01f) &&
-                               (std::abs(emergencyAllocReads[2] - emergencyMode) < 0.01f);
+    // Verify the allocations were stored correctly
+    const RfPowerAllocations stored = rfAllocations.load();
+    bool standardConsistent = std::abs(stored.standard - standardMode) < 0.01f;
+    bool burstConsistent = std::abs(stored.burst - burstMode) < 0.01f;
+    bool emergencyConsistent = std::abs(stored.emergency - emergencyMode) < 0.01f;
     
     return standardConsistent && burstConsistent && emergencyConsistent;
 }
@@ -1262,14 +1004,13 @@ bool PowerManager::prepareForRFBurst(uint32_t durationMs, float powerLevel) {
     }
 
     // Check if we have enough power budget for the burst
-    PowerBudget budget = getPowerBudget();
     float burstPowerRequired = POWER_REQ_RF_BURST * powerLevel;
     
     // Calculate total power needed for the burst duration
     float totalEnergyRequired = (burstPowerRequired * durationMs) / 1000.0f; // Convert to watt-seconds
     
     // Check if we have enough power available
-    if ((budget.totalAvailable - budget.totalConsumption) < burstPowerRequired) {
+    if ((budgetState.totalAvailable - budgetState.totalConsumption) < burstPowerRequired) {
         return false;
     }
     
@@ -1282,13 +1023,118 @@ bool PowerManager::prepareForRFBurst(uint32_t durationMs, float powerLevel) {
     }
     
     // If all checks pass, set up for RF burst
-    for (int i = 0; i < 3; ++i) { // Triple redundancy for radiation hardening
-        rfBurstPowerAllocation = powerLevel;
+    rfAllocations.update([powerLevel](RfPowerAllocations& allocations) {
+        allocations.burst = powerLevel;
+    });
+    
+    return true;
+}
+
+// POWER checkpoint section: one fixed record, read in place
+constexpr uint32_t POWER_CHECKPOINT_SCHEMA = 1;
+
+struct PowerCheckpointRecord {
+    uint32_t schema;
+    uint32_t mode;
+    uint32_t enabledMask;
+    uint32_t registeredMask;
+    float powerLevels[kSubsystemCount];
+    float rfStandard;
+    float rfBurst;
+    float rfEmergency;
+    float mainBatteryHealth;
+    float backupBatteryHealth;
+    float solarPanelEfficiencies[6];
+    uint32_t orbitSunlightSeconds;
+    uint32_t orbitEclipseSeconds;
+    uint32_t reserved;
+    int64_t orbitEpochNs;       // system_clock since the epoch
+};
+
+// Whether a checkpointed fraction can be applied as is
+bool isUnitFraction(float value) {
+    return std::isfinite(value) && value >= 0.0f && value <= 1.0f;
+}
+
+bool PowerManager::saveCheckpoint(CheckpointStore& store) const {
+    size_t capacity = 0;
+    uint8_t* out = store.stage(CheckpointSection::POWER, capacity);
+    if (capacity < sizeof(PowerCheckpointRecord)) {
+        return false;
     }
     
-    // Apply scrubbing to ensure values are consistent
-    applyScrubbing();
+    const SubsystemTable table = subsystems.load();
+    const RfPowerAllocations rf = rfAllocations.load();
+    PowerCheckpointRecord record{};
+    record.schema = POWER_CHECKPOINT_SCHEMA;
+    record.mode = static_cast<uint32_t>(currentMode.load());
+    record.enabledMask = table.enabledMask;
+    record.registeredMask = table.registeredMask;
+    std::copy(table.powerLevels.begin(), table.powerLevels.end(), record.powerLevels);
+    record.rfStandard = rf.standard;
+    record.rfBurst = rf.burst;
+    record.rfEmergency = rf.emergency;
+    record.mainBatteryHealth = mainBatteryHealth;
+    record.backupBatteryHealth = backupBatteryHealth;
+    std::copy(solarPanelEfficiencies.begin(), solarPanelEfficiencies.end(), record.solarPanelEfficiencies);
+    record.orbitSunlightSeconds = budgetState.orbitSunlightSeconds;
+    record.orbitEclipseSeconds = budgetState.orbitEclipseSeconds;
+    record.orbitEpochNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        budgetState.orbitEpoch.time_since_epoch()).count();
+    
+    std::memcpy(out, &record, sizeof(record));
+    return store.commit(CheckpointSection::POWER, sizeof(record));
+}
+
+bool PowerManager::restoreCheckpoint(const CheckpointStore& store) {
+    CheckpointView view;
+    const CheckpointReadStatus status = store.read(CheckpointSection::POWER, view);
+    if (status == CheckpointReadStatus::EMPTY) {
+        return false;
+    }
+    if (status == CheckpointReadStatus::CORRUPT || view.size != sizeof(PowerCheckpointRecord)) {
+        SKYMESH_LOG_ERROR(kLogComponent, "Power checkpoint is corrupt; keeping default power state");
+        return false;
+    }
+    
+    // Everything is checked before anything is applied
+    const auto& record = *reinterpret_cast<const PowerCheckpointRecord*>(view.data);
+    const SubsystemTable current = subsystems.load();
+    bool valid = record.schema == POWER_CHECKPOINT_SCHEMA &&
+                 record.mode <= static_cast<uint32_t>(PowerMode::HIBERNATION) &&
+                 record.registeredMask == current.registeredMask &&
+                 (record.enabledMask & ~record.registeredMask) == 0 &&
+                 isUnitFraction(record.rfStandard) && isUnitFraction(record.rfBurst) &&
+                 isUnitFraction(record.rfEmergency) && isUnitFraction(record.mainBatteryHealth) &&
+                 isUnitFraction(record.backupBatteryHealth);
+    for (size_t i = 0; i < kSubsystemCount; ++i) {
+        valid = valid && isUnitFraction(record.powerLevels[i]);
+    }
+    for (float efficiency : record.solarPanelEfficiencies) {
+        valid = valid && isUnitFraction(efficiency);
+    }
+    if (!valid) {
+        SKYMESH_LOG_WARNING(kLogComponent, "Power checkpoint does not match this configuration; keeping default power state");
+        return false;
+    }
     
+    SubsystemTable table = current;
+    table.enabledMask = record.enabledMask;
+    std::copy(record.powerLevels, record.powerLevels + kSubsystemCount, table.powerLevels.begin());
+    subsystems.store(table);
+    currentMode.store(static_cast<PowerMode>(record.mode));
+    rfAllocations.store(RfPowerAllocations{record.rfStandard, record.rfBurst, record.rfEmergency});
+    mainBatteryHealth = record.mainBatteryHealth;
+    backupBatteryHealth = record.backupBatteryHealth;
+    std::copy(record.solarPanelEfficiencies, record.solarPanelEfficiencies + 6, solarPanelEfficiencies.begin());
+    budgetState.orbitSunlightSeconds = record.orbitSunlightSeconds;
+    budgetState.orbitEclipseSeconds = record.orbitEclipseSeconds;
+    budgetState.orbitEpoch = std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(record.orbitEpochNs)));
+    
+    // Readings depend on the restored panel and battery model
+    refreshSourceReadings();
+    rebuildBudget();
     return true;
 }
 
@@ -0,0 +1,526 @@
+/**
+ * @file reed_solomon.cpp
+ * @brief CCSDS RS(255,223) encoder and Berlekamp-Massey decoder
+ */
+
+#include "skymesh/core/reed_solomon.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSSE3__) && defined(__x86_64__)
+#include <tmmintrin.h>
+#define SKYMESH_RS_SSSE3 1
+#define SKYMESH_RS_TARGET
+#elif defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+// Built for baseline x86-64: compile the SSSE3 kernel anyway and pick it at runtime
+#include <tmmintrin.h>
+#define SKYMESH_RS_SSSE3 1
+#define SKYMESH_RS_RUNTIME_CHECK 1
+#define SKYMESH_RS_TARGET __attribute__((target("ssse3")))
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define SKYMESH_RS_NEON 1
+#endif
+
+namespace skymesh {
+namespace core {
+
+namespace {
+
+constexpr unsigned kFieldPolynomial = 0x187;  // x^8 + x^7 + x^2 + x + 1
+constexpr unsigned kFirstRoot = 112;
+constexpr unsigned kRootStep = 11;            // generator roots are alpha^(11j)
+constexpr unsigned kRootStepInverse = 116;    // 11 * 116 = 1 (mod 255)
+constexpr unsigned kFieldOrder = 255;
+constexpr uint8_t kLogZero = 255;             // log table entry for 0
+
+// Rows of the conventional-to-dual-basis matrix, from CCSDS 131.0-B
+constexpr uint8_t kDualBasis[8] = {0x8d, 0xef, 0xec, 0x86, 0xfa, 0x99, 0xaf, 0x7b};
+
+// Codewords processed together by the SIMD kernels, one per byte lane
+constexpr size_t kLanes = 16;
+
+struct RsTables {
+    uint8_t exp[2 * kFieldOrder];        // alpha^i, doubled so log sums need no reduction
+    uint8_t log[256];
+    uint8_t generator[kRsParitySize + 1];  // conventional coefficients, generator[k] of x^k
+    uint8_t toDual[256];
+    uint8_t fromDual[256];
+    // Remainder update for LFSR feedback f: byte m of row f is f * g(31 - m),
+    // packed little endian into four words
+    uint64_t feedback[256][4];
+    // Split nibble tables: f * g(31 - m) = lo[m][f & 15] ^ hi[m][f >> 4]
+    uint8_t feedbackLo[kRsParitySize][16];
+    uint8_t feedbackHi[kRsParitySize][16];
+    uint8_t fromDualLo[16];
+    uint8_t fromDualHi[16];
+
+    constexpr uint8_t mul(uint8_t a, uint8_t b) const {
+        return (a == 0 || b == 0) ? 0 : exp[log[a] + log[b]];
+    }
+
+    constexpr RsTables()
+        : exp(), log(), generator(), toDual(), fromDual(), feedback(),
+          feedbackLo(), feedbackHi(), fromDualLo(), fromDualHi() {
+        unsigned x = 1;
+        for (unsigned i = 0; i < kFieldOrder; ++i) {
+            exp[i] = static_cast<uint8_t>(x);
+            exp[i + kFieldOrder] = static_cast<uint8_t>(x);
+            log[x] = static_cast<uint8_t>(i);
+            x <<= 1;
+            if (x & 0x100) {
+                x ^= kFieldPolynomial;
+            }
+        }
+        log[0] = kLogZero;
+
+        // g(x) = product of (x + alpha^(11(112 + j))) for j < 32
+        generator[0] = 1;
+        for (unsigned j = 0; j < kRsParitySize; ++j) {
+            const uint8_t root = exp[(kRootStep * (kFirstRoot + j)) % kFieldOrder];
+            for (unsigned k = j + 1; k > 0; --k) {
+                generator[k] = static_cast<uint8_t>(generator[k - 1] ^ mul(generator[k], root));
+            }
+            generator[0] = mul(generator[0], root);
+        }
+
+        for (unsigned i = 0; i < 256; ++i) {
+            uint8_t dual = 0;
+            for (unsigned bit = 0; bit < 8; ++bit) {
+                if (i & (1u << bit)) {
+                    dual ^= kDualBasis[7 - bit];
+                }
+            }
+            toDual[i] = dual;
+            fromDual[dual] = static_cast<uint8_t>(i);
+        }
+
+        for (unsigned f = 0; f < 256; ++f) {
+            for (unsigned m = 0; m < kRsParitySize; ++m) {
+                const uint8_t product = mul(static_cast<uint8_t>(f), generator[kRsParitySize - 1 - m]);
+                feedback[f][m / 8] |= static_cast<uint64_t>(product) << (8 * (m % 8));
+                if (f < 16) {
+                    feedbackLo[m][f] = product;
+                } else if ((f & 0x0F) == 0) {
+                    feedbackHi[m][f >> 4] = product;
+                }
+            }
+        }
+        for (unsigned n = 0; n < 16; ++n) {
+            fromDualLo[n] = fromDual[n];
+            fromDualHi[n] = fromDual[n << 4];
+        }
+    }
+};
+constexpr RsTables kRs;
+
+unsigned mod255(unsigned x) {
+    return x % kFieldOrder;
+}
+
+// Remainder of data(x) * x^32 modulo g(x), in the conventional basis.
+// remainder[m] is the coefficient of x^(31 - m).
+void remainderOf(const uint8_t* data, size_t size, uint8_t* remainder) {
+    uint64_t r0 = 0, r1 = 0, r2 = 0, r3 = 0;
+    for (size_t i = 0; i < size; ++i) {
+        const uint8_t f = static_cast<uint8_t>(kRs.fromDual[data[i]] ^ (r0 & 0xFF));
+        const uint64_t* row = kRs.feedback[f];
+        r0 = ((r0 >> 8) | (r1 << 56)) ^ row[0];
+        r1 = ((r1 >> 8) | (r2 << 56)) ^ row[1];
+        r2 = ((r2 >> 8) | (r3 << 56)) ^ row[2];
+        r3 = (r3 >> 8) ^ row[3];
+    }
+    const uint64_t words[4] = {r0, r1, r2, r3};
+    for (size_t m = 0; m < kRsParitySize; ++m) {
+        remainder[m] = static_cast<uint8_t>(words[m / 8] >> (8 * (m % 8)));
+    }
+}
+
+// Locates and corrects the errors of a codeword whose syndrome remainder is
+// nonzero. remainder holds received(x) mod g(x) in the conventional basis.
+int correctErrors(const uint8_t* remainder, uint8_t* data, size_t size, uint8_t* parity) {
+    constexpr unsigned kRoots = kRsParitySize;
+    const size_t pad = kRsMaxDataSize - size;
+
+    // Syndromes S_j = received(alpha^(11(112 + j))), in log form
+    uint8_t s[kRoots];
+    for (unsigned j = 0; j < kRoots; ++j) {
+        const unsigned step = mod255(kRootStep * (kFirstRoot + j));
+        uint8_t value = 0;
+        for (unsigned m = 0; m < kRoots; ++m) {
+            value = static_cast<uint8_t>(remainder[m] ^ (value ? kRs.exp[kRs.log[value] + step] : 0));
+        }
+        s[j] = kRs.log[value];
+    }
+
+    // Berlekamp-Massey: error locator lambda(x) in polynomial form, b(x) in log form
+    uint8_t lambda[kRoots + 1] = {1};
+    uint8_t b[kRoots + 1];
+    uint8_t t[kRoots + 1];
+    for (unsigned i = 0; i <= kRoots; ++i) {
+        b[i] = kRs.log[lambda[i]];
+    }
+    unsigned degree = 0;
+    for (unsigned r = 1; r <= kRoots; ++r) {
+        uint8_t discrepancy = 0;
+        for (unsigned i = 0; i < r; ++i) {
+            if (lambda[i] != 0 && s[r - i - 1] != kLogZero) {
+                discrepancy ^= kRs.exp[kRs.log[lambda[i]] + s[r - i - 1]];
+            }
+        }
+        const uint8_t discrepancyLog = kRs.log[discrepancy];
+        if (discrepancyLog == kLogZero) {
+            std::memmove(&b[1], b, kRoots);
+            b[0] = kLogZero;
+            continue;
+        }
+
+        // t(x) = lambda(x) - discrepancy * x * b(x)
+        t[0] = lambda[0];
+        for (unsigned i = 0; i < kRoots; ++i) {
+            t[i + 1] = b[i] != kLogZero
+                ? static_cast<uint8_t>(lambda[i + 1] ^ kRs.exp[discrepancyLog + b[i]]) : lambda[i + 1];
+        }
+        if (2 * degree <= r - 1) {
+            degree = r - degree;
+            // b(x) = lambda(x) / discrepancy
+            for (unsigned i = 0; i <= kRoots; ++i) {
+                b[i] = lambda[i] == 0 ? kLogZero
+                    : static_cast<uint8_t>(mod255(kRs.log[lambda[i]] + kFieldOrder - discrepancyLog));
+            }
+        } else {
+            std::memmove(&b[1], b, kRoots);
+            b[0] = kLogZero;
+        }
+        std::memcpy(lambda, t, sizeof(lambda));
+    }
+
+    unsigned lambdaDegree = 0;
+    uint8_t lambdaLog[kRoots + 1];
+    for (unsigned i = 0; i <= kRoots; ++i) {
+        lambdaLog[i] = kRs.log[lambda[i]];
+        if (lambdaLog[i] != kLogZero) {
+            lambdaDegree = i;
+        }
+    }
+    if (lambdaDegree == 0 || lambdaDegree > kRsCorrectableErrors) {
+        return -1;
+    }
+
+    // Chien search: lambda(alpha^i) = 0 marks an error at codeword position
+    // i * 116 - 1, counting from the first (padded) symbol
+    uint8_t reg[kRoots + 1];
+    std::memcpy(reg, lambdaLog, sizeof(reg));
+    unsigned root[kRsCorrectableErrors];
+    unsigned location[kRsCorrectableErrors];
+    unsigned count = 0;
+    for (unsigned i = 1, k = kRootStepInverse - 1; i <= kFieldOrder; ++i, k = mod255(k + kRootStepInverse)) {
+        uint8_t q = 1;
+        for (unsigned j = lambdaDegree; j > 0; --j) {
+            if (reg[j] != kLogZero) {
+                reg[j] = static_cast<uint8_t>(mod255(reg[j] + j));
+                q ^= kRs.exp[reg[j]];
+            }
+        }
+        if (q != 0) {
+            continue;
+        }
+        if (k < pad) {
+            return -1;  // an error in the virtual zero fill
+        }
+        root[count] = i;
+        location[count] = k;
+        if (++count == lambdaDegree) {
+            break;
+        }
+    }
+    if (count != lambdaDegree) {
+        return -1;
+    }
+
+    // Error evaluator omega(x) = s(x) * lambda(x) mod x^(deg lambda), in log form
+    uint8_t omega[kRsCorrectableErrors];
+    for (unsigned i = 0; i < lambdaDegree; ++i) {
+        uint8_t sum = 0;
+        for (unsigned j = 0; j <= i; ++j) {
+            if (s[i - j] != kLogZero && lambdaLog[j] != kLogZero) {
+                sum ^= kRs.exp[s[i - j] + lambdaLog[j]];
+            }
+        }
+        omega[i] = kRs.log[sum];
+    }
+
+    // Forney: magnitude = omega(X^-1) * X^(-(112 - 1)) / lambda'(X^-1)
+    uint8_t magnitude[kRsCorrectableErrors];
+    for (unsigned e = 0; e < count; ++e) {
+        uint8_t numerator = 0;
+        for (unsigned i = 0; i < lambdaDegree; ++i) {
+            if (omega[i] != kLogZero) {
+                numerator ^= kRs.exp[mod255(omega[i] + i * root[e])];
+            }
+        }
+        uint8_t denominator = 0;
+        for (unsigned i = 0; i + 1 <= lambdaDegree; i += 2) {
+            if (lambdaLog[i + 1] != kLogZero) {
+                denominator ^= kRs.exp[mod255(lambdaLog[i + 1] + i * root[e])];
+            }
+        }
+        if (numerator == 0 || denominator == 0) {
+            return -1;
+        }
+        magnitude[e] = kRs.exp[mod255(kRs.log[numerator] + root[e] * (kFirstRoot - 1) +
+                                      kFieldOrder - kRs.log[denominator])];
+    }
+
+    // Only now touch the codeword; the basis change is linear, so the
+    // conventional magnitude maps straight onto the dual-basis symbol
+    for (unsigned e = 0; e < count; ++e) {
+        const size_t position = location[e] - pad;
+        uint8_t& symbol = position < size ? data[position] : parity[position - size];
+        symbol ^= kRs.toDual[magnitude[e]];
+    }
+    return static_cast<int>(count);
+}
+
+// Compares a computed remainder with the received parity and corrects the codeword if they differ
+int finishDecode(uint8_t* remainder, uint8_t* data, size_t size, uint8_t* parity) {
+    uint8_t difference = 0;
+    for (size_t m = 0; m < kRsParitySize; ++m) {
+        remainder[m] ^= kRs.fromDual[parity[m]];
+        difference |= remainder[m];
+    }
+    return difference == 0 ? 0 : correctErrors(remainder, data, size, parity);
+}
+
+#if defined(SKYMESH_RS_SSSE3) || defined(SKYMESH_RS_NEON)
+// Remainders of kLanes codewords at once: lane l of every vector holds a byte
+// of sources[l], remainders[m][l] receives remainder byte m of codeword l
+#if defined(SKYMESH_RS_SSSE3)
+// Four rounds of byte interleaving rotate the row and column index bits by
+// four, transposing a 16x16 block
+SKYMESH_RS_TARGET
+void transposeBlock(__m128i (&block)[kLanes]) {
+    for (int round = 0; round < 4; ++round) {
+        __m128i next[kLanes];
+        for (size_t k = 0; k < kLanes / 2; ++k) {
+            next[2 * k] = _mm_unpacklo_epi8(block[k], block[k + kLanes / 2]);
+            next[2 * k + 1] = _mm_unpackhi_epi8(block[k], block[k + kLanes / 2]);
+        }
+        std::copy(next, next + kLanes, block);
+    }
+}
+
+SKYMESH_RS_TARGET
+void remainderLanes(const uint8_t* const* sources, size_t size, uint8_t (*remainders)[kLanes]) {
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i dualLo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(kRs.fromDualLo));
+    const __m128i dualHi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(kRs.fromDualHi));
+    __m128i r[kRsParitySize];
+    for (auto& word : r) {
+        word = _mm_setzero_si128();
+    }
+
+    for (size_t start = 0; start < size; start += kLanes) {
+        const size_t steps = std::min(kLanes, size - start);
+        __m128i block[kLanes];
+        if (steps == kLanes) {
+            for (size_t l = 0; l < kLanes; ++l) {
+                block[l] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sources[l] + start));
+            }
+            transposeBlock(block);
+        } else {
+            alignas(16) uint8_t bytes[kLanes][kLanes] = {};
+            for (size_t l = 0; l < kLanes; ++l) {
+                for (size_t i = 0; i < steps; ++i) {
+                    bytes[i][l] = sources[l][start + i];
+                }
+            }
+            for (size_t i = 0; i < steps; ++i) {
+                block[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(bytes[i]));
+            }
+        }
+
+        for (size_t i = 0; i < steps; ++i) {
+            const __m128i x = block[i];
+            const __m128i d = _mm_xor_si128(_mm_shuffle_epi8(dualLo, _mm_and_si128(x, nibble)),
+                                            _mm_shuffle_epi8(dualHi, _mm_and_si128(_mm_srli_epi16(x, 4), nibble)));
+            const __m128i f = _mm_xor_si128(d, r[0]);
+            const __m128i lo = _mm_and_si128(f, nibble);
+            const __m128i hi = _mm_and_si128(_mm_srli_epi16(f, 4), nibble);
+            for (size_t m = 0; m < kRsParitySize; ++m) {
+                const __m128i product = _mm_xor_si128(
+                    _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(kRs.feedbackLo[m])), lo),
+                    _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(kRs.feedbackHi[m])), hi));
+                r[m] = m + 1 < kRsParitySize ? _mm_xor_si128(r[m + 1], product) : product;
+            }
+        }
+    }
+    for (size_t m = 0; m < kRsParitySize; ++m) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(remainders[m]), r[m]);
+    }
+}
+#else
+void transposeBlock(uint8x16_t (&block)[kLanes]) {
+    for (int round = 0; round < 4; ++round) {
+        uint8x16_t next[kLanes];
+        for (size_t k = 0; k < kLanes / 2; ++k) {
+            next[2 * k] = vzip1q_u8(block[k], block[k + kLanes / 2]);
+            next[2 * k + 1] = vzip2q_u8(block[k], block[k + kLanes / 2]);
+        }
+        std::copy(next, next + kLanes, block);
+    }
+}
+
+void remainderLanes(const uint8_t* const* sources, size_t size, uint8_t (*remainders)[kLanes]) {
+    const uint8x16_t nibble = vdupq_n_u8(0x0F);
+    const uint8x16_t dualLo = vld1q_u8(kRs.fromDualLo);
+    const uint8x16_t dualHi = vld1q_u8(kRs.fromDualHi);
+    uint8x16_t r[kRsParitySize];
+    for (auto& word : r) {
+        word = vdupq_n_u8(0);
+    }
+
+    for (size_t start = 0; start < size; start += kLanes) {
+        const size_t steps = std::min(kLanes, size - start);
+        uint8x16_t block[kLanes];
+        if (steps == kLanes) {
+            for (size_t l = 0; l < kLanes; ++l) {
+                block[l] = vld1q_u8(sources[l] + start);
+            }
+            transposeBlock(block);
+        } else {
+            uint8_t bytes[kLanes][kLanes] = {};
+            for (size_t l = 0; l < kLanes; ++l) {
+                for (size_t i = 0; i < steps; ++i) {
+                    bytes[i][l] = sources[l][start + i];
+                }
+            }
+            for (size_t i = 0; i < steps; ++i) {
+                block[i] = vld1q_u8(bytes[i]);
+            }
+        }
+
+        for (size_t i = 0; i < steps; ++i) {
+            const uint8x16_t x = block[i];
+            const uint8x16_t d =
+                veorq_u8(vqtbl1q_u8(dualLo, vandq_u8(x, nibble)), vqtbl1q_u8(dualHi, vshrq_n_u8(x, 4)));
+            const uint8x16_t f = veorq_u8(d, r[0]);
+            const uint8x16_t lo = vandq_u8(f, nibble);
+            const uint8x16_t hi = vshrq_n_u8(f, 4);
+            for (size_t m = 0; m < kRsParitySize; ++m) {
+                const uint8x16_t product = veorq_u8(vqtbl1q_u8(vld1q_u8(kRs.feedbackLo[m]), lo),
+                                                    vqtbl1q_u8(vld1q_u8(kRs.feedbackHi[m]), hi));
+                r[m] = m + 1 < kRsParitySize ? veorq_u8(r[m + 1], product) : product;
+            }
+        }
+    }
+    for (size_t m = 0; m < kRsParitySize; ++m) {
+        vst1q_u8(remainders[m], r[m]);
+    }
+}
+#endif
+
+// Below this many codewords a group is cheaper one codeword at a time
+constexpr size_t kMinLanesUsed = 6;
+
+// Remainders of every codeword of a batch, kLanes codewords per kernel call
+template <typename Finish>
+void forEachRemainder(const uint8_t* const* data, size_t size, size_t count, Finish&& finish) {
+    uint8_t remainders[kRsParitySize][kLanes];
+    size_t first = 0;
+    if (rsSimdAccelerated()) {
+        for (; first + kMinLanesUsed <= count; first += kLanes) {
+            const size_t used = std::min(kLanes, count - first);
+            // Idle lanes repeat the last codeword so every lane reads valid data
+            const uint8_t* sources[kLanes];
+            for (size_t l = 0; l < kLanes; ++l) {
+                sources[l] = data[first + std::min(l, used - 1)];
+            }
+            remainderLanes(sources, size, remainders);
+
+            uint8_t remainder[kRsParitySize];
+            for (size_t l = 0; l < used; ++l) {
+                for (size_t m = 0; m < kRsParitySize; ++m) {
+                    remainder[m] = remainders[m][l];
+                }
+                finish(first + l, remainder);
+            }
+        }
+    }
+    for (; first < count; ++first) {
+        uint8_t remainder[kRsParitySize];
+        remainderOf(data[first], size, remainder);
+        finish(first, remainder);
+    }
+}
+#else
+template <typename Finish>
+void forEachRemainder(const uint8_t* const* data, size_t size, size_t count, Finish&& finish) {
+    for (size_t i = 0; i < count; ++i) {
+        uint8_t remainder[kRsParitySize];
+        remainderOf(data[i], size, remainder);
+        finish(i, remainder);
+    }
+}
+#endif
+
+} // anonymous namespace
+
+bool rsSimdAccelerated() {
+#if defined(SKYMESH_RS_RUNTIME_CHECK)
+    static const bool supported = __builtin_cpu_supports("ssse3");
+    return supported;
+#elif defined(SKYMESH_RS_SSSE3) || defined(SKYMESH_RS_NEON)
+    return true;
+#else
+    return false;
+#endif
+}
+
+void rsEncode(const uint8_t* data, size_t size, uint8_t* parity) {
+    uint8_t remainder[kRsParitySize];
+    remainderOf(data, std::min(size, kRsMaxDataSize), remainder);
+    for (size_t m = 0; m < kRsParitySize; ++m) {
+        parity[m] = kRs.toDual[remainder[m]];
+    }
+}
+
+int rsDecode(uint8_t* data, size_t size, uint8_t* parity) {
+    if (size > kRsMaxDataSize) {
+        return -1;
+    }
+    uint8_t remainder[kRsParitySize];
+    remainderOf(data, size, remainder);
+    return finishDecode(remainder, data, size, parity);
+}
+
+void rsEncodeBatch(const uint8_t* const* data, uint8_t* const* parity, size_t size, size_t count) {
+    size = std::min(size, kRsMaxDataSize);
+    forEachRemainder(data, size, count, [parity](size_t i, const uint8_t* remainder) {
+        for (size_t m = 0; m < kRsParitySize; ++m) {
+            parity[i][m] = kRs.toDual[remainder[m]];
+        }
+    });
+}
+
+size_t rsDecodeBatch(uint8_t* const* data, uint8_t* const* parity, size_t size, size_t count, int* corrected) {
+    if (size > kRsMaxDataSize) {
+        for (size_t i = 0; corrected && i < count; ++i) {
+            corrected[i] = -1;
+        }
+        return count;
+    }
+    size_t failures = 0;
+    forEachRemainder(data, size, count, [&](size_t i, uint8_t* remainder) {
+        const int result = finishDecode(remainder, data[i], size, parity[i]);
+        failures += result < 0 ? 1 : 0;
+        if (corrected) {
+            corrected[i] = result;
+        }
+    });
+    return failures;
+}
+
+} // namespace core
+} // namespace skymesh
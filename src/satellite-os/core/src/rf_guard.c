@@ -0,0 +1,152 @@
+/**
+ * @file rf_guard.c
+ * @brief Checksummed redundant copies for RF controller state
+ */
+
+#include "skymesh/core/rf_guard.h"
+#include <string.h>
+
+/* Reflected CRC32C polynomial 0x82F63B78, applied a nibble at a time */
+static const uint32_t crc32c_nibble[16] = {
+    0x00000000u, 0x105EC76Fu, 0x20BD8EDEu, 0x30E349B1u,
+    0x417B1DBCu, 0x5125DAD3u, 0x61C69362u, 0x7198540Du,
+    0x82F63B78u, 0x92A8FC17u, 0xA24BB5A6u, 0xB21572C9u,
+    0xC38D26C4u, 0xD3D3E1ABu, 0xE330A81Au, 0xF36E6F75u
+};
+
+uint32_t rf_crc32c(const void* data, size_t size) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; i++) {
+        crc ^= bytes[i];
+        crc = (crc >> 4) ^ crc32c_nibble[crc & 0x0F];
+        crc = (crc >> 4) ^ crc32c_nibble[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+static uint32_t load32(const uint8_t* p) {
+    uint32_t word;
+    memcpy(&word, p, sizeof(word));
+    return word;
+}
+
+/* XOR of every word, seeded so an all-zero region has a non-zero checksum */
+static uint32_t word_parity(const uint8_t* data, size_t size) {
+    uint32_t parity = 0xA5A5A5A5u;
+    for (size_t offset = 0; offset + sizeof(uint32_t) <= size; offset += sizeof(uint32_t)) {
+        parity ^= load32(data + offset);
+    }
+    return parity;
+}
+
+static uint32_t checksum_of(const rf_guard_t* guard, const uint8_t* data) {
+    return guard->kind == RF_GUARD_HOT ? word_parity(data, guard->size) : rf_crc32c(data, guard->size);
+}
+
+static uint8_t* copy_at(const rf_guard_t* guard, uint8_t index) {
+    return guard->copies + (size_t)index * guard->size;
+}
+
+void rf_guard_init(rf_guard_t* guard, void* data, uint8_t* copies, size_t size,
+                   uint8_t copy_count, rf_guard_kind_t kind) {
+    guard->data = (uint8_t*)data;
+    guard->copies = copies;
+    guard->size = size;
+    guard->copy_count = copy_count > RF_GUARD_MAX_COPIES ? RF_GUARD_MAX_COPIES : copy_count;
+    guard->kind = kind;
+    rf_guard_commit(guard);
+}
+
+void rf_guard_sync(rf_guard_t* guard, const void* field, size_t size) {
+    if (guard->copy_count == 0) {
+        return;
+    }
+    if (guard->kind == RF_GUARD_COLD) {
+        rf_guard_commit(guard);
+        return;
+    }
+
+    /* Whole words covering the field; the first copy still holds the old value */
+    size_t first = (size_t)((const uint8_t*)field - guard->data) & ~(size_t)3;
+    size_t end = (size_t)((const uint8_t*)field - guard->data) + size;
+    for (size_t offset = first; offset < end && offset < guard->size; offset += sizeof(uint32_t)) {
+        uint32_t word = load32(guard->data + offset);
+        guard->checksum ^= load32(copy_at(guard, 0) + offset) ^ word;
+        for (uint8_t i = 0; i < guard->copy_count; i++) {
+            memcpy(copy_at(guard, i) + offset, &word, sizeof(word));
+        }
+    }
+}
+
+void rf_guard_add32(rf_guard_t* guard, uint32_t* counter, uint32_t delta) {
+    *counter += delta;
+    rf_guard_sync(guard, counter, sizeof(*counter));
+}
+
+void rf_guard_commit(rf_guard_t* guard) {
+    for (uint8_t i = 0; i < guard->copy_count; i++) {
+        memcpy(copy_at(guard, i), guard->data, guard->size);
+    }
+    guard->checksum = checksum_of(guard, guard->data);
+}
+
+/* Bitwise majority of three copies into out */
+static void vote(const rf_guard_t* guard, uint8_t* out) {
+    const uint8_t* a = copy_at(guard, 0);
+    const uint8_t* b = copy_at(guard, 1);
+    const uint8_t* c = copy_at(guard, 2);
+    for (size_t i = 0; i < guard->size; i++) {
+        out[i] = (uint8_t)((a[i] & b[i]) | (b[i] & c[i]) | (a[i] & c[i]));
+    }
+}
+
+rf_guard_result_t rf_guard_verify(rf_guard_t* guard) {
+    if (guard->copy_count == 0 || checksum_of(guard, guard->data) == guard->checksum) {
+        return RF_GUARD_OK;
+    }
+
+    /* The live data is already bad, so the vote goes straight into it */
+    if (guard->copy_count == RF_GUARD_MAX_COPIES) {
+        vote(guard, guard->data);
+        if (checksum_of(guard, guard->data) == guard->checksum) {
+            rf_guard_commit(guard);
+            return RF_GUARD_CORRECTED;
+        }
+    }
+
+    for (uint8_t i = 0; i < guard->copy_count; i++) {
+        if (checksum_of(guard, copy_at(guard, i)) == guard->checksum) {
+            memcpy(guard->data, copy_at(guard, i), guard->size);
+            rf_guard_commit(guard);
+            return RF_GUARD_CORRECTED;
+        }
+    }
+
+    /* Data and copies agree, so the upset hit the checksum itself */
+    bool agree = true;
+    for (uint8_t i = 0; i < guard->copy_count && agree; i++) {
+        agree = memcmp(guard->data, copy_at(guard, i), guard->size) == 0;
+    }
+    if (agree) {
+        guard->checksum = checksum_of(guard, guard->data);
+        return RF_GUARD_CORRECTED;
+    }
+    return RF_GUARD_UNCORRECTABLE;
+}
+
+rf_guard_result_t rf_guard_scrub(rf_guard_t* guard) {
+    rf_guard_result_t result = rf_guard_verify(guard);
+    if (result == RF_GUARD_UNCORRECTABLE) {
+        return result;
+    }
+
+    /* The live data is now known good; refresh any copy that drifted */
+    for (uint8_t i = 0; i < guard->copy_count; i++) {
+        if (memcmp(copy_at(guard, i), guard->data, guard->size) != 0) {
+            memcpy(copy_at(guard, i), guard->data, guard->size);
+            result = RF_GUARD_CORRECTED;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,93 @@
+/**
+ * @file rf_rx_queue.c
+ * @brief Implementation of the lock-free RF receive ring
+ */
+
+#include "skymesh/core/rf_rx_queue.h"
+#include <string.h>
+
+#define RF_RX_RING_MASK (RF_RX_RING_SIZE - 1)
+
+_Static_assert((RF_RX_RING_SIZE & RF_RX_RING_MASK) == 0, "ring size must be a power of two");
+_Static_assert(sizeof(rf_rx_slot_t) % 64 == 0, "slots must not share cache lines");
+
+void rf_rxq_init(rf_rxq_t* queue) {
+    memset(queue, 0, sizeof(*queue));
+}
+
+rf_rx_slot_t* rf_rxq_reserve(rf_rxq_t* queue) {
+    uint32_t tail = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+    if (tail - __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE) >= RF_RX_RING_SIZE) {
+        __atomic_store_n(&queue->overflows, queue->overflows + 1, __ATOMIC_RELAXED);
+        return NULL;
+    }
+    return &queue->slots[tail & RF_RX_RING_MASK];
+}
+
+void rf_rxq_commit(rf_rxq_t* queue) {
+    uint32_t tail = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED) + 1;
+    __atomic_store_n(&queue->tail, tail, __ATOMIC_RELEASE);
+
+    /* Head only moves forward, so this never overstates the depth */
+    uint32_t depth = tail - __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+    if (depth > queue->high_watermark) {
+        __atomic_store_n(&queue->high_watermark, depth, __ATOMIC_RELAXED);
+    }
+}
+
+bool rf_rxq_push(rf_rxq_t* queue, const uint8_t* data, size_t length, int16_t rssi) {
+    if (data == NULL || length > RF_RX_FRAME_SIZE) {
+        return false;
+    }
+    rf_rx_slot_t* slot = rf_rxq_reserve(queue);
+    if (slot == NULL) {
+        return false;
+    }
+    memcpy(slot->data, data, length);
+    slot->length = (uint32_t)length;
+    slot->rssi = rssi;
+    slot->snr = 0;
+    slot->received_ns = 0;
+    rf_rxq_commit(queue);
+    return true;
+}
+
+uint32_t rf_rxq_available(const rf_rxq_t* queue) {
+    uint32_t next = __atomic_load_n(&queue->head, __ATOMIC_RELAXED) + queue->held;
+    return __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE) - next;
+}
+
+size_t rf_rxq_acquire(rf_rxq_t* queue, rf_packet_t* out, size_t max) {
+    uint32_t next = __atomic_load_n(&queue->head, __ATOMIC_RELAXED) + queue->held;
+    uint32_t available = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE) - next;
+    size_t count = available < max ? available : max;
+
+    for (size_t i = 0; i < count; i++) {
+        rf_rx_slot_t* slot = &queue->slots[(next + i) & RF_RX_RING_MASK];
+        memset(&out[i], 0, sizeof(out[i]));
+        out[i].data = slot->data;
+        out[i].length = slot->length;
+        out[i].rssi = slot->rssi;
+        out[i].snr = slot->snr;
+        out[i].received_ns = slot->received_ns;
+    }
+    queue->held += (uint32_t)count;
+    return count;
+}
+
+void rf_rxq_release(rf_rxq_t* queue) {
+    if (queue->held == 0) {
+        return;
+    }
+    uint32_t head = __atomic_load_n(&queue->head, __ATOMIC_RELAXED);
+    __atomic_store_n(&queue->head, head + queue->held, __ATOMIC_RELEASE);
+    queue->held = 0;
+}
+
+uint32_t rf_rxq_overflows(const rf_rxq_t* queue) {
+    return __atomic_load_n(&queue->overflows, __ATOMIC_RELAXED);
+}
+
+uint32_t rf_rxq_high_watermark(const rf_rxq_t* queue) {
+    return __atomic_load_n(&queue->high_watermark, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,138 @@
+/**
+ * @file rf_tx_queue.c
+ * @brief Implementation of the zero-copy, priority-ordered RF transmit queue
+ */
+
+#include "skymesh/core/rf_tx_queue.h"
+#include <string.h>
+
+#define RF_TX_RING_MASK (RF_TX_POOL_SIZE - 1)
+
+_Static_assert(RF_TX_POOL_SIZE <= 32, "free_mask holds one bit per pool slot");
+_Static_assert((RF_TX_POOL_SIZE & RF_TX_RING_MASK) == 0, "pool size must be a power of two");
+_Static_assert(RF_TX_PRIORITIES <= 8, "priorities are 3-bit");
+
+/* Producer side of a ring */
+static void ring_push(rf_tx_ring_t* ring, uint8_t slot) {
+    uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+    ring->slots[tail & RF_TX_RING_MASK] = slot;
+    __atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);
+}
+
+/* Consumer side of a ring */
+static bool ring_pop(rf_tx_ring_t* ring, uint8_t* slot) {
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    if (head == __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE)) {
+        return false;
+    }
+    *slot = ring->slots[head & RF_TX_RING_MASK];
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+static bool ring_empty(const rf_tx_ring_t* ring) {
+    return __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) ==
+           __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+}
+
+/* Pool slot of a packet, or -1 if it is not one of the queue's descriptors */
+static int slot_of(const rf_txq_t* queue, const rf_packet_t* packet) {
+    if (packet < queue->packets || packet >= queue->packets + RF_TX_POOL_SIZE) {
+        return -1;
+    }
+    return (int)(packet - queue->packets);
+}
+
+void rf_txq_init(rf_txq_t* queue) {
+    memset(queue, 0, sizeof(*queue));
+    for (uint32_t i = 0; i < RF_TX_POOL_SIZE; i++) {
+        queue->packets[i].data = queue->buffers[i];
+    }
+    queue->free_mask = (RF_TX_POOL_SIZE == 32) ? 0xFFFFFFFFu : ((1u << RF_TX_POOL_SIZE) - 1u);
+}
+
+rf_packet_t* rf_txq_acquire(rf_txq_t* queue) {
+    if (queue->free_mask == 0) {
+        return NULL;
+    }
+    int slot = __builtin_ctz(queue->free_mask);
+    queue->free_mask &= ~(1u << slot);
+
+    rf_packet_t* packet = &queue->packets[slot];
+    memset(packet, 0, sizeof(*packet));
+    packet->data = queue->buffers[slot];
+    return packet;
+}
+
+rf_status_t rf_txq_push(rf_txq_t* queue, rf_packet_t* packet) {
+    int slot = slot_of(queue, packet);
+    if (slot < 0 || (queue->free_mask & (1u << slot)) != 0 ||
+        packet->data != queue->buffers[slot] ||
+        packet->length == 0 || packet->length > RF_TX_FRAME_SIZE) {
+        return RF_STATUS_TX_ERROR;
+    }
+
+    if (packet->priority >= RF_TX_PRIORITIES) {
+        packet->priority = RF_TX_PRIORITIES - 1;
+    }
+    ring_push(&queue->pending[packet->priority], (uint8_t)slot);
+    return RF_STATUS_OK;
+}
+
+void rf_txq_release(rf_txq_t* queue, rf_packet_t* packet) {
+    int slot = slot_of(queue, packet);
+    if (slot >= 0) {
+        queue->free_mask |= 1u << slot;
+    }
+}
+
+bool rf_txq_pending(const rf_txq_t* queue) {
+    for (int priority = RF_TX_PRIORITIES - 1; priority >= 0; priority--) {
+        if (!ring_empty(&queue->pending[priority])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint8_t rf_txq_next_batch(rf_txq_t* queue, rf_tx_batch_t* batch) {
+    batch->count = 0;
+    batch->bytes = 0;
+
+    for (int priority = RF_TX_PRIORITIES - 1; priority >= 0 && batch->count < RF_TX_BATCH_MAX; priority--) {
+        uint8_t slot;
+        while (batch->count < RF_TX_BATCH_MAX && ring_pop(&queue->pending[priority], &slot)) {
+            const rf_packet_t* packet = &queue->packets[slot];
+            batch->data[batch->count] = packet->data;
+            batch->length[batch->count] = packet->length;
+            batch->slot[batch->count] = slot;
+            batch->bytes += packet->length;
+            batch->count++;
+        }
+    }
+    return batch->count;
+}
+
+void rf_txq_complete(rf_txq_t* queue, const rf_tx_batch_t* batch, rf_status_t status) {
+    for (uint8_t i = 0; i < batch->count; i++) {
+        /* Published by the release in ring_push */
+        queue->completed_status[batch->slot[i]] = status;
+        ring_push(&queue->completed, batch->slot[i]);
+    }
+}
+
+size_t rf_txq_poll(rf_txq_t* queue, rf_tx_completion_t* completions, size_t max) {
+    size_t count = 0;
+    uint8_t slot;
+    while (count < max && ring_pop(&queue->completed, &slot)) {
+        const rf_packet_t* packet = &queue->packets[slot];
+        completions[count].packet_id = packet->packet_id;
+        completions[count].priority = packet->priority;
+        completions[count].length = packet->length;
+        completions[count].status = queue->completed_status[slot];
+        count++;
+
+        queue->free_mask |= 1u << slot;
+    }
+    return count;
+}
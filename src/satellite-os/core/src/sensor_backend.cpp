@@ -0,0 +1,218 @@
+/**
+ * @file sensor_backend.cpp
+ * @brief Hardware and simulated sensor backends
+ */
+
+#include "skymesh/core/sensor_backend.h"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace skymesh {
+namespace core {
+
+namespace {
+    constexpr double kPi = 3.14159265358979323846;
+
+    // Noise streams that are not keyed by a sensor name
+    constexpr uint64_t kDoseRateStream = 1;
+    constexpr uint64_t kPowerSourceStream = 100;
+
+    // Main battery state of charge swings between these over an orbit
+    constexpr double kBatteryChargeLow = 0.70;
+    constexpr double kBatteryChargeHigh = 0.80;
+
+    // Batteries sit inside the bus and see a smaller thermal cycle
+    constexpr float kBatteryThermalCoupling = 0.5f;
+
+    // FNV-1a, so a sensor keeps its noise stream across runs
+    uint64_t streamOf(const std::string& name) {
+        uint64_t hash = 0xcbf29ce484222325ull;
+        for (char c : name) {
+            hash = (hash ^ static_cast<uint8_t>(c)) * 0x100000001b3ull;
+        }
+        return hash;
+    }
+}
+
+class HardwareSensorBackend : public SensorBackend {
+public:
+    explicit HardwareSensorBackend(HardwareSensorDrivers drivers)
+        : drivers_(std::move(drivers)) {
+    }
+
+    std::chrono::system_clock::time_point now() const override {
+        return std::chrono::system_clock::now();
+    }
+
+    bool readDoseRate(std::chrono::system_clock::time_point, float& rads_per_hour) override {
+        return drivers_.read_dose_rate && drivers_.read_dose_rate(rads_per_hour);
+    }
+
+    bool readTemperature(const TemperatureChannel& channel,
+                         std::chrono::system_clock::time_point, float& celsius) override {
+        return drivers_.read_temperature && drivers_.read_temperature(channel, celsius);
+    }
+
+    bool readPowerSource(PowerSource source, std::chrono::system_clock::time_point,
+                         PowerSourceStatus& status) override {
+        return drivers_.read_power_source && drivers_.read_power_source(source, status);
+    }
+
+private:
+    const HardwareSensorDrivers drivers_;
+};
+
+class SimulatedSensorBackend : public SensorBackend {
+public:
+    explicit SimulatedSensorBackend(const SimulationProfile& profile)
+        : profile_(profile)
+        , real_start_(profile.clock ? profile.clock->now() : std::chrono::system_clock::now())
+        , epoch_(profile.epoch.time_since_epoch().count() == 0 ? real_start_ : profile.epoch)
+        , period_s_(std::max(1.0, std::chrono::duration<double>(profile.orbit_period).count()))
+        , eclipse_s_(period_s_ * std::min(1.0, std::max(0.0, profile.eclipse_fraction)))
+        , sunlit_s_(period_s_ - eclipse_s_)
+        , tau_s_(std::chrono::duration<double>(profile.thermal_time_constant).count()) {
+    }
+
+    std::chrono::system_clock::time_point now() const override {
+        if (profile_.clock) {
+            return profile_.clock->now();
+        }
+        const double real_elapsed =
+            std::chrono::duration<double>(std::chrono::system_clock::now() - real_start_).count();
+        return epoch_ + std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::duration<double>(real_elapsed * profile_.time_scale));
+    }
+
+    bool readDoseRate(std::chrono::system_clock::time_point now, float& rads_per_hour) override {
+        const double t = secondsSinceEpoch(now);
+        float rate = profile_.background_dose_rate;
+
+        // Half-sine dose profile across the pass
+        if (profile_.saa_orbit_interval > 0) {
+            const double orbit = std::floor(t / period_s_);
+            const double into_pass = t - orbit * period_s_ - profile_.saa_orbit_phase * period_s_;
+            const double pass_s = std::chrono::duration<double>(profile_.saa_duration).count();
+            const auto orbit_index = static_cast<int64_t>(orbit);
+            if (orbit_index % profile_.saa_orbit_interval == 0 && into_pass >= 0.0 && into_pass < pass_s) {
+                rate += profile_.saa_peak_dose_rate * static_cast<float>(std::sin(kPi * into_pass / pass_s));
+            }
+        }
+
+        const CounterRng rng(profile_.seed, kDoseRateStream);
+        rate += profile_.dose_rate_noise * rng.symmetric(counterOf(now));
+        rads_per_hour = std::max(0.0f, rate);
+        return true;
+    }
+
+    bool readTemperature(const TemperatureChannel& channel,
+                         std::chrono::system_clock::time_point now, float& celsius) override {
+        const CounterRng rng(profile_.seed, streamOf(channel.sensor_id));
+        celsius = channel.nominal_celsius + thermalOffset(now, 1.0f) +
+                  profile_.temperature_noise_celsius * rng.symmetric(counterOf(now));
+        return true;
+    }
+
+    bool readPowerSource(PowerSource source, std::chrono::system_clock::time_point now,
+                         PowerSourceStatus& status) override {
+        const CounterRng rng(profile_.seed, kPowerSourceStream + static_cast<uint64_t>(source));
+        const float noise = rng.symmetric(counterOf(now));
+        const double phase = orbitPhase(now);
+        const bool sunlit = phase < sunlit_s_;
+
+        switch (source) {
+            case PowerSource::SOLAR_PANEL:
+                status.currentVoltage = sunlit ? 4.75f : 0.0f;
+                status.currentCurrent = sunlit ? 0.19f * (1.0f + 0.01f * noise) : 0.0f;
+                status.temperature = 25.0f + thermalOffset(now, 1.0f);
+                status.stateOfCharge = 1.0f;  // Not applicable for solar panels
+                break;
+            case PowerSource::BATTERY: {
+                // Charges linearly through sunlight, discharges through eclipse
+                double charge = (kBatteryChargeLow + kBatteryChargeHigh) / 2;
+                if (eclipse_s_ > 0.0) {
+                    const double range = kBatteryChargeHigh - kBatteryChargeLow;
+                    charge = sunlit ? kBatteryChargeLow + range * phase / sunlit_s_
+                                    : kBatteryChargeHigh - range * (phase - sunlit_s_) / eclipse_s_;
+                }
+                status.stateOfCharge = static_cast<float>(charge);
+                status.currentVoltage = 3.3f + 0.6f * status.stateOfCharge;
+                status.currentCurrent = sunlit ? 0.2f : 0.5f;
+                status.temperature = 20.0f + thermalOffset(now, kBatteryThermalCoupling);
+                break;
+            }
+            case PowerSource::BACKUP_BATTERY:
+                status.currentVoltage = 3.7f;
+                status.currentCurrent = 0.1f;
+                status.temperature = 18.0f + thermalOffset(now, kBatteryThermalCoupling);
+                status.stateOfCharge = 0.95f;
+                break;
+        }
+        return true;
+    }
+
+private:
+    double secondsSinceEpoch(std::chrono::system_clock::time_point now) const {
+        return std::chrono::duration<double>(now - epoch_).count();
+    }
+
+    // Seconds into the current orbit; each orbit starts sunlit
+    double orbitPhase(std::chrono::system_clock::time_point now) const {
+        const double t = secondsSinceEpoch(now);
+        return t - std::floor(t / period_s_) * period_s_;
+    }
+
+    // Noise changes once per simulated millisecond
+    uint64_t counterOf(std::chrono::system_clock::time_point now) const {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(now - epoch_).count());
+    }
+
+    // Periodic steady state of a first-order lag driven between +swing in
+    // sunlight and -swing in eclipse, so a reading depends only on the time
+    float thermalOffset(std::chrono::system_clock::time_point now, float coupling) const {
+        const double swing = profile_.thermal_swing_celsius * coupling;
+        if (swing == 0.0) {
+            return 0.0f;
+        }
+        const double phase = orbitPhase(now);
+        if (tau_s_ <= 0.0) {
+            return static_cast<float>(phase < sunlit_s_ ? swing : -swing);
+        }
+
+        const double hot = swing;
+        const double cold = -swing;
+        const double a = std::exp(-sunlit_s_ / tau_s_);
+        const double b = std::exp(-eclipse_s_ / tau_s_);
+        const double denominator = 1.0 - a * b;
+        if (denominator <= 0.0) {
+            return 0.0f;   // Time constant far beyond the orbit: no cycle
+        }
+        const double start_of_sunlight = (cold * (1.0 - b) + b * hot * (1.0 - a)) / denominator;
+        if (phase < sunlit_s_) {
+            return static_cast<float>(hot + (start_of_sunlight - hot) * std::exp(-phase / tau_s_));
+        }
+        const double start_of_eclipse = hot + (start_of_sunlight - hot) * a;
+        return static_cast<float>(cold + (start_of_eclipse - cold) * std::exp(-(phase - sunlit_s_) / tau_s_));
+    }
+
+    const SimulationProfile profile_;
+    const std::chrono::system_clock::time_point real_start_;
+    const std::chrono::system_clock::time_point epoch_;
+    const double period_s_;
+    const double eclipse_s_;
+    const double sunlit_s_;
+    const double tau_s_;
+};
+
+std::shared_ptr<SensorBackend> createHardwareSensorBackend(HardwareSensorDrivers drivers) {
+    return std::make_shared<HardwareSensorBackend>(std::move(drivers));
+}
+
+std::shared_ptr<SensorBackend> createSimulatedSensorBackend(const SimulationProfile& profile) {
+    return std::make_shared<SimulatedSensorBackend>(profile);
+}
+
+} // namespace core
+} // namespace skymesh
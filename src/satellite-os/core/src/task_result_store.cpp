@@ -0,0 +1,114 @@
+/**
+ * @file task_result_store.cpp
+ * @brief Implementation of the bounded task result store
+ */
+
+#include "skymesh/core/task_result_store.h"
+
+namespace skymesh {
+namespace core {
+
+namespace {
+
+// Rough per-node cost of a std::map entry beyond its key and value
+constexpr size_t kMapNodeOverhead = 4 * sizeof(void*);
+
+} // anonymous namespace
+
+TaskResultStore::TaskResultStore(const ResultRetentionPolicy& policy)
+    : policy_(policy) {
+}
+
+void TaskResultStore::setPolicy(const ResultRetentionPolicy& policy, std::vector<std::string>* evicted) {
+    policy_ = policy;
+    evict(std::chrono::steady_clock::now(), evicted);
+}
+
+void TaskResultStore::put(const TaskResult& result, std::vector<std::string>* evicted) {
+    auto now = std::chrono::steady_clock::now();
+
+    auto it = index_.find(result.task_id);
+    if (it != index_.end()) {
+        // Overwrite in place and move to the young end; reuses string capacity
+        auto slot = it->second;
+        bytes_ -= slot->bytes;
+        slot->result = result;
+        slot->stored_at = now;
+        slot->bytes = estimateBytes(slot->result);
+        bytes_ += slot->bytes;
+        order_.splice(order_.end(), order_, slot);
+    } else {
+        order_.push_back(Slot{result, now, estimateBytes(result)});
+        bytes_ += order_.back().bytes;
+        index_.emplace(result.task_id, std::prev(order_.end()));
+    }
+
+    evict(now, evicted);
+}
+
+std::optional<TaskResult> TaskResultStore::get(const std::string& task_id) const {
+    auto it = index_.find(task_id);
+    if (it == index_.end()) {
+        return std::nullopt;
+    }
+    return it->second->result;
+}
+
+bool TaskResultStore::erase(const std::string& task_id) {
+    auto it = index_.find(task_id);
+    if (it == index_.end()) {
+        return false;
+    }
+
+    bytes_ -= it->second->bytes;
+    order_.erase(it->second);
+    index_.erase(it);
+    return true;
+}
+
+size_t TaskResultStore::visit(const std::function<bool(const TaskResult&)>& visitor) const {
+    size_t visited = 0;
+    for (const Slot& slot : order_) {
+        visited++;
+        if (!visitor(slot.result)) {
+            break;
+        }
+    }
+    return visited;
+}
+
+size_t TaskResultStore::estimateBytes(const TaskResult& result) {
+    size_t bytes = sizeof(Slot) + result.task_id.capacity() + result.error_message.capacity();
+    for (const auto& pair : result.output_data) {
+        bytes += kMapNodeOverhead + sizeof(pair) + pair.first.capacity() + pair.second.capacity();
+    }
+    return bytes;
+}
+
+void TaskResultStore::evict(std::chrono::steady_clock::time_point now, std::vector<std::string>* evicted) {
+    auto over_limit = [this, now] {
+        if (order_.empty()) {
+            return false;
+        }
+        if (policy_.max_results != 0 && order_.size() > policy_.max_results) {
+            return true;
+        }
+        if (policy_.max_bytes != 0 && bytes_ > policy_.max_bytes) {
+            return true;
+        }
+        return policy_.max_age.count() != 0 && now - order_.front().stored_at > policy_.max_age;
+    };
+
+    while (over_limit()) {
+        Slot& oldest = order_.front();
+        if (evicted) {
+            evicted->push_back(oldest.result.task_id);
+        }
+        bytes_ -= oldest.bytes;
+        index_.erase(oldest.result.task_id);
+        order_.pop_front();
+    }
+}
+
+} // namespace core
+} // namespace skymesh
@@ -0,0 +1,350 @@
+/**
+ * @file telemetry_stream.cpp
+ * @brief Implementation of the streaming telemetry collector and its RF sink
+ */
+
+#include "skymesh/core/telemetry_stream.h"
+#include "skymesh/core/crc32c.h"
+
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+#include <utility>
+
+namespace skymesh {
+namespace core {
+
+namespace {
+    constexpr size_t kFrameOverhead = kTelemetryFrameHeaderSize + kTelemetryFrameTrailerSize;
+
+    // Fixed part of a power budget payload, and each subsystem entry after it
+    constexpr size_t kPowerHeaderSize = 5 * 4 + 2;
+    constexpr size_t kPowerEntrySize = 2 + 3 * 4;
+
+    constexpr size_t kSensorRecordSize = 1 + 4 + 5 * 4;
+    constexpr size_t kTaskMetricsSize = 3 * 8 + 4 * kTaskStatusCount;
+
+    // Unchecked little-endian writer; callers size the payload first
+    class ByteWriter {
+    public:
+        explicit ByteWriter(uint8_t* out) : begin_(out), out_(out) {}
+
+        void put8(uint8_t value) { *out_++ = value; }
+
+        void put16(uint16_t value) {
+            put8(static_cast<uint8_t>(value));
+            put8(static_cast<uint8_t>(value >> 8));
+        }
+
+        void put32(uint32_t value) {
+            put16(static_cast<uint16_t>(value));
+            put16(static_cast<uint16_t>(value >> 16));
+        }
+
+        void put64(uint64_t value) {
+            put32(static_cast<uint32_t>(value));
+            put32(static_cast<uint32_t>(value >> 32));
+        }
+
+        void putFloat(float value) {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            put32(bits);
+        }
+
+        size_t size() const { return static_cast<size_t>(out_ - begin_); }
+
+    private:
+        uint8_t* begin_;
+        uint8_t* out_;
+    };
+
+    uint16_t load16(const uint8_t* p) {
+        return static_cast<uint16_t>(p[0] | (p[1] << 8));
+    }
+
+    uint32_t load32(const uint8_t* p) {
+        return static_cast<uint32_t>(load16(p)) | (static_cast<uint32_t>(load16(p + 2)) << 16);
+    }
+
+    TelemetryFrameType frameTypeOf(uint8_t section) {
+        static constexpr TelemetryFrameType kTypes[] = {
+            TelemetryFrameType::POWER_BUDGET, TelemetryFrameType::HEALTH_REPORT,
+            TelemetryFrameType::SENSOR_WINDOW, TelemetryFrameType::TASK_METRICS};
+        return kTypes[section];
+    }
+} // anonymous namespace
+
+bool parseTelemetryFrame(const uint8_t* frame, size_t size, TelemetryFrameView& out) {
+    if (frame == nullptr || size < kFrameOverhead || size > kTelemetryMaxFrameSize) {
+        return false;
+    }
+    const uint16_t type = load16(frame);
+    const size_t payloadSize = load16(frame + 6);
+    if (type < static_cast<uint16_t>(TelemetryFrameType::POWER_BUDGET) ||
+        type > static_cast<uint16_t>(TelemetryFrameType::TASK_METRICS) ||
+        payloadSize != size - kFrameOverhead) {
+        return false;
+    }
+    const size_t crcOffset = kTelemetryFrameHeaderSize + payloadSize;
+    if (crc32c(frame, crcOffset) != load32(frame + crcOffset)) {
+        return false;
+    }
+
+    out.type = static_cast<TelemetryFrameType>(type);
+    out.sequence = load16(frame + 2);
+    out.sweep = load16(frame + 4);
+    out.timestampMs = static_cast<uint64_t>(load32(frame + 8)) | (static_cast<uint64_t>(load32(frame + 12)) << 32);
+    out.payload = frame + kTelemetryFrameHeaderSize;
+    out.payloadSize = payloadSize;
+    return true;
+}
+
+// ---- TelemetryCollector ----
+
+TelemetryCollector::TelemetryCollector(std::shared_ptr<PowerManager> powerManager,
+                                       std::shared_ptr<HealthMonitor> healthMonitor,
+                                       std::shared_ptr<OrbitalTaskManager> orbitalTaskManager,
+                                       std::chrono::milliseconds sensorWindow)
+    : power_manager_(std::move(powerManager))
+    , health_monitor_(std::move(healthMonitor))
+    , task_manager_(std::move(orbitalTaskManager))
+    , sensor_window_(sensorWindow) {
+}
+
+void TelemetryCollector::beginSweep(bool fullTelemetry) {
+    full_ = fullTelemetry;
+    ++sweep_;
+    ++stats_.sweeps;
+    timestamp_ms_ = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+
+    if (power_manager_) {
+        power_ = power_manager_->getPowerBudgetSnapshot();
+    }
+    if (task_manager_) {
+        tasks_ = task_manager_->getTaskMetrics();
+    }
+
+    // Only sources with samples in the window are sent
+    sensor_count_ = 0;
+    next_sensor_ = 0;
+    if (full_ && health_monitor_) {
+        const TelemetryWindowStats dose = health_monitor_->getDoseRateStats(sensor_window_);
+        if (dose.count > 0) {
+            sensors_[sensor_count_++] = SensorRecord{0, dose};
+        }
+        for (size_t c = 0; c + 1 < kSensorSources; ++c) {
+            const TelemetryWindowStats temperature =
+                health_monitor_->getTemperatureStats(static_cast<ComponentType>(c), sensor_window_);
+            if (temperature.count > 0) {
+                sensors_[sensor_count_++] = SensorRecord{static_cast<uint8_t>(1 + c), temperature};
+            }
+        }
+    }
+
+    section_ = Section::POWER;
+    if (!power_manager_) {
+        advance();
+    }
+}
+
+// Moves to the next section that has something to send
+void TelemetryCollector::advance() {
+    do {
+        section_ = static_cast<Section>(static_cast<uint8_t>(section_) + 1);
+    } while ((section_ == Section::HEALTH && !health_monitor_) ||
+             (section_ == Section::SENSORS && sensor_count_ == 0) ||
+             (section_ == Section::TASKS && !task_manager_));
+}
+
+size_t TelemetryCollector::emit(TelemetrySink& sink) {
+    SKYMESH_TRACE_SPAN("telemetry.emit_ns");
+    size_t committed = 0;
+    while (section_ != Section::DONE) {
+        size_t capacity = 0;
+        uint8_t* frame = sink.acquireFrame(capacity);
+        if (frame == nullptr) {
+            ++stats_.stalls;
+            break;
+        }
+        capacity = std::min(capacity, kTelemetryMaxFrameSize);
+        if (capacity <= kFrameOverhead) {
+            sink.abortFrame();
+            ++stats_.stalls;
+            break;
+        }
+
+        const TelemetryFrameType type = frameTypeOf(static_cast<uint8_t>(section_));
+        const size_t payloadSize = writePayload(frame + kTelemetryFrameHeaderSize, capacity - kFrameOverhead);
+        if (payloadSize == 0) {
+            sink.abortFrame();
+            ++stats_.skipped;
+            continue;
+        }
+
+        const uint16_t sequence = next_sequence_++;
+        ByteWriter header(frame);
+        header.put16(static_cast<uint16_t>(type));
+        header.put16(sequence);
+        header.put16(sweep_);
+        header.put16(static_cast<uint16_t>(payloadSize));
+        header.put64(timestamp_ms_);
+        const size_t crcOffset = kTelemetryFrameHeaderSize + payloadSize;
+        ByteWriter trailer(frame + crcOffset);
+        trailer.put32(crc32c(frame, crcOffset));
+
+        const size_t length = crcOffset + kTelemetryFrameTrailerSize;
+        if (sink.commitFrame(length, type, sequence)) {
+            ++committed;
+            ++stats_.frames;
+            stats_.bytes += length;
+        } else {
+            ++stats_.dropped;
+        }
+    }
+    return committed;
+}
+
+// Serializes the current section's next frame and moves the cursor past it;
+// returns 0 if nothing fit
+size_t TelemetryCollector::writePayload(uint8_t* payload, size_t capacity) {
+    ByteWriter out(payload);
+    switch (section_) {
+    case Section::POWER: {
+        const size_t count = std::min<size_t>(power_.subsystemCount, power_.subsystems.size());
+        if (kPowerHeaderSize + count * kPowerEntrySize <= capacity) {
+            out.putFloat(power_.totalAvailable);
+            out.putFloat(power_.totalConsumption);
+            out.putFloat(power_.projectedAvailable);
+            out.putFloat(power_.batteryReserve);
+            out.putFloat(power_.solarInputRate);
+            out.put8(static_cast<uint8_t>(power_.currentMode));
+            out.put8(static_cast<uint8_t>(count));
+            for (size_t i = 0; i < count; ++i) {
+                const PowerConsumption& entry = power_.subsystems[i];
+                out.put8(static_cast<uint8_t>(entry.subsystem));
+                out.put8(entry.isActive ? 1 : 0);
+                out.putFloat(entry.currentPower);
+                out.putFloat(entry.averagePower);
+                out.putFloat(entry.peakPower);
+            }
+        }
+        advance();
+        return out.size();
+    }
+    case Section::HEALTH: {
+        const size_t size = health_monitor_->encodeHealthReport(payload, capacity, full_);
+        advance();
+        return size;
+    }
+    case Section::SENSORS: {
+        const size_t fit = std::min(capacity / kSensorRecordSize, sensor_count_ - next_sensor_);
+        for (size_t end = next_sensor_ + fit; next_sensor_ < end; ++next_sensor_) {
+            const SensorRecord& record = sensors_[next_sensor_];
+            out.put8(record.source);
+            out.put32(record.stats.count);
+            out.putFloat(record.stats.min);
+            out.putFloat(record.stats.max);
+            out.putFloat(record.stats.mean);
+            out.putFloat(record.stats.latest);
+            out.putFloat(record.stats.rate_per_second);
+        }
+        if (fit == 0 || next_sensor_ == sensor_count_) {
+            advance();
+        }
+        return out.size();
+    }
+    case Section::TASKS:
+        if (kTaskMetricsSize <= capacity) {
+            out.put64(tasks_.tasks_executed);
+            out.put64(tasks_.tasks_failed);
+            out.put64(tasks_.radiation_events);
+            for (uint32_t count : tasks_.tasks_by_status) {
+                out.put32(count);
+            }
+        }
+        advance();
+        return out.size();
+    case Section::DONE:
+        break;
+    }
+    return 0;
+}
+
+// ---- RfTxQueueSink ----
+
+RfTxQueueSink::RfTxQueueSink(rf_txq_t& queue, uint8_t priority, size_t reserve)
+    : queue_(queue)
+    , priority_(priority)
+    , reserve_(reserve)
+    , tx_latency_(MetricsRegistry::instance().histogram("rf.tx_latency_ns")) {
+}
+
+uint8_t* RfTxQueueSink::acquireFrame(size_t& capacity) {
+    auto freeBuffers = [this] { return std::bitset<32>(queue_.free_mask).count(); };
+    if (freeBuffers() <= reserve_) {
+        reclaim();
+    }
+    if (freeBuffers() <= reserve_) {
+        return nullptr;
+    }
+    current_ = rf_txq_acquire(&queue_);
+    if (current_ == nullptr) {
+        return nullptr;
+    }
+    capacity = RF_TX_FRAME_SIZE;
+    return current_->data;
+}
+
+bool RfTxQueueSink::commitFrame(size_t length, TelemetryFrameType, uint16_t sequence) {
+    rf_packet_t* packet = current_;
+    current_ = nullptr;
+    packet->length = static_cast<uint32_t>(length);
+    packet->packet_id = sequence;
+    packet->priority = priority_;
+    packet->is_ack_required = false;
+    if (rf_txq_push(&queue_, packet) != RF_STATUS_OK) {
+        rf_txq_release(&queue_, packet);
+        return false;
+    }
+    // Every in-flight frame holds a pool buffer, so the table cannot overflow
+    in_flight_[in_flight_count_++] = InFlight{sequence, monotonicNanoseconds()};
+    return true;
+}
+
+void RfTxQueueSink::abortFrame() {
+    if (current_ != nullptr) {
+        rf_txq_release(&queue_, current_);
+        current_ = nullptr;
+    }
+}
+
+size_t RfTxQueueSink::reclaim() {
+    rf_tx_completion_t completions[RF_TX_POOL_SIZE];
+    const size_t count = rf_txq_poll(&queue_, completions, RF_TX_POOL_SIZE);
+    const uint64_t now = count ? monotonicNanoseconds() : 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (completions[i].status == RF_STATUS_OK) {
+            ++sent_;
+        } else {
+            ++failed_;
+        }
+
+        // Frames of other submitters complete through the same queue
+        if (completions[i].priority != priority_) {
+            continue;
+        }
+        for (size_t f = 0; f < in_flight_count_; ++f) {
+            if (in_flight_[f].sequence == completions[i].packet_id) {
+                tx_latency_.record(now - in_flight_[f].committed_ns);
+                in_flight_[f] = in_flight_[--in_flight_count_];
+                break;
+            }
+        }
+    }
+    return count;
+}
+
+} // namespace core
+} // namespace skymesh
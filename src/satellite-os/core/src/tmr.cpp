@@ -0,0 +1,162 @@
+/**
+ * @file tmr.cpp
+ * @brief Bitwise majority voting and scrubbing for triple modular redundancy
+ */
+
+#include "skymesh/core/tmr.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace skymesh {
+namespace core {
+
+namespace {
+
+// Votes size bytes into out; a, b, c and out may alias. Returns true if
+// any bit disagreed. When repair is set, a, b and c are also rewritten.
+template <bool Repair>
+bool voteBytes(uint8_t* out, const uint8_t* a, const uint8_t* b, const uint8_t* c,
+               uint8_t* repair_a, uint8_t* repair_b, uint8_t* repair_c, size_t size) {
+    size_t offset = 0;
+    bool mismatch = false;
+
+#if defined(__SSE2__)
+    __m128i diff = _mm_setzero_si128();
+    for (; offset + 16 <= size; offset += 16) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + offset));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + offset));
+        __m128i vc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c + offset));
+        __m128i voted = _mm_or_si128(_mm_or_si128(_mm_and_si128(va, vb), _mm_and_si128(vb, vc)),
+                                     _mm_and_si128(va, vc));
+        diff = _mm_or_si128(diff, _mm_or_si128(_mm_xor_si128(va, vb), _mm_xor_si128(va, vc)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + offset), voted);
+        if (Repair) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(repair_a + offset), voted);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(repair_b + offset), voted);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(repair_c + offset), voted);
+        }
+    }
+    mismatch = _mm_movemask_epi8(_mm_cmpeq_epi8(diff, _mm_setzero_si128())) != 0xFFFF;
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    uint8x16_t diff = vdupq_n_u8(0);
+    for (; offset + 16 <= size; offset += 16) {
+        uint8x16_t va = vld1q_u8(a + offset);
+        uint8x16_t vb = vld1q_u8(b + offset);
+        uint8x16_t vc = vld1q_u8(c + offset);
+        uint8x16_t voted = vorrq_u8(vorrq_u8(vandq_u8(va, vb), vandq_u8(vb, vc)), vandq_u8(va, vc));
+        diff = vorrq_u8(diff, vorrq_u8(veorq_u8(va, vb), veorq_u8(va, vc)));
+        vst1q_u8(out + offset, voted);
+        if (Repair) {
+            vst1q_u8(repair_a + offset, voted);
+            vst1q_u8(repair_b + offset, voted);
+            vst1q_u8(repair_c + offset, voted);
+        }
+    }
+    mismatch = vmaxvq_u8(diff) != 0;
+#endif
+
+    // Remaining words, then bytes
+    uint64_t word_diff = 0;
+    for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t)) {
+        uint64_t wa, wb, wc;
+        std::memcpy(&wa, a + offset, sizeof(wa));
+        std::memcpy(&wb, b + offset, sizeof(wb));
+        std::memcpy(&wc, c + offset, sizeof(wc));
+        uint64_t voted = (wa & wb) | (wb & wc) | (wa & wc);
+        word_diff |= (wa ^ wb) | (wa ^ wc);
+        std::memcpy(out + offset, &voted, sizeof(voted));
+        if (Repair) {
+            std::memcpy(repair_a + offset, &voted, sizeof(voted));
+            std::memcpy(repair_b + offset, &voted, sizeof(voted));
+            std::memcpy(repair_c + offset, &voted, sizeof(voted));
+        }
+    }
+    for (; offset < size; ++offset) {
+        uint8_t va = a[offset], vb = b[offset], vc = c[offset];
+        uint8_t voted = static_cast<uint8_t>((va & vb) | (vb & vc) | (va & vc));
+        word_diff |= static_cast<uint8_t>((va ^ vb) | (va ^ vc));
+        out[offset] = voted;
+        if (Repair) {
+            repair_a[offset] = voted;
+            repair_b[offset] = voted;
+            repair_c[offset] = voted;
+        }
+    }
+
+    return mismatch || word_diff != 0;
+}
+
+} // anonymous namespace
+
+bool tmrVote(const void* a, const void* b, const void* c, void* out, size_t size) {
+    return voteBytes<false>(static_cast<uint8_t*>(out),
+                            static_cast<const uint8_t*>(a),
+                            static_cast<const uint8_t*>(b),
+                            static_cast<const uint8_t*>(c),
+                            nullptr, nullptr, nullptr, size);
+}
+
+bool tmrScrub(void* a, void* b, void* c, size_t size) {
+    auto* pa = static_cast<uint8_t*>(a);
+    auto* pb = static_cast<uint8_t*>(b);
+    auto* pc = static_cast<uint8_t*>(c);
+
+    // Agreement is the common case; only write when a copy must change
+    if (std::memcmp(pa, pb, size) == 0 && std::memcmp(pa, pc, size) == 0) {
+        return false;
+    }
+    return voteBytes<true>(pa, pa, pb, pc, pa, pb, pc, size);
+}
+
+size_t TmrScrubber::step(size_t budgetBytes) {
+    if (regions_.empty()) {
+        return 0;
+    }
+
+    size_t corrected = 0;
+    size_t scrubbed_bytes = 0;
+    size_t visited = 0;
+    do {
+        const Region& region = regions_[cursor_];
+        if (region.scrub(region.tmr)) {
+            ++corrected;
+        }
+        scrubbed_bytes += region.bytes;
+        cursor_ = (cursor_ + 1) % regions_.size();
+        ++visited;
+    } while (scrubbed_bytes < budgetBytes && visited < regions_.size());
+
+    totalCorrections_ += corrected;
+    return corrected;
+}
+
+size_t TmrScrubber::scrubAll() {
+    size_t corrected = 0;
+    for (const Region& region : regions_) {
+        if (region.scrub(region.tmr)) {
+            ++corrected;
+        }
+    }
+    totalCorrections_ += corrected;
+    return corrected;
+}
+
+size_t TmrScrubber::protectedBytes() const {
+    size_t bytes = 0;
+    for (const Region& region : regions_) {
+        bytes += region.bytes;
+    }
+    return bytes;
+}
+
+void TmrScrubber::clear() {
+    regions_.clear();
+    cursor_ = 0;
+}
+
+} // namespace core
+} // namespace skymesh
@@ -0,0 +1,440 @@
+/**
+ * @file checkpoint_store_test.cpp
+ * @brief Unit tests for the checkpoint store and the subsystem warm restart
+ */
+
+#include "skymesh/core/checkpoint_store.h"
+#include "skymesh/core/command_control.h"
+#include "skymesh/core/health_monitor.h"
+#include "skymesh/core/orbital_task_manager.h"
+#include "skymesh/core/power_manager.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace skymesh::core;
+using namespace std::chrono_literals;
+
+namespace {
+
+// Small sections, so tests run over a few pages
+CheckpointLayout smallLayout() {
+    CheckpointLayout layout;
+    layout.capacity = {{16 * kCheckpointPageSize, kCheckpointPageSize, 4 * kCheckpointPageSize}};
+    return layout;
+}
+
+// Page-aligned memory standing in for an MRAM window
+class Region {
+public:
+    explicit Region(const CheckpointLayout& layout)
+        : size_(CheckpointStore::requiredSize(layout)), bytes_(size_ + kCheckpointPageSize) {}
+
+    void* base() {
+        const uintptr_t address = reinterpret_cast<uintptr_t>(bytes_.data());
+        return reinterpret_cast<void*>((address + kCheckpointPageSize - 1) & ~uintptr_t{kCheckpointPageSize - 1});
+    }
+
+    size_t size() const { return size_; }
+
+private:
+    size_t size_;
+    std::vector<uint8_t> bytes_;
+};
+
+void stageBytes(CheckpointStore& store, CheckpointSection section, const std::vector<uint8_t>& bytes) {
+    size_t capacity = 0;
+    uint8_t* out = store.stage(section, capacity);
+    ASSERT_LE(bytes.size(), capacity);
+    std::memcpy(out, bytes.data(), bytes.size());
+}
+
+std::vector<uint8_t> readBytes(const CheckpointStore& store, CheckpointSection section,
+                               CheckpointReadStatus expected = CheckpointReadStatus::VALID) {
+    CheckpointView view;
+    EXPECT_EQ(store.read(section, view), expected);
+    return view.data ? std::vector<uint8_t>(view.data, view.data + view.size) : std::vector<uint8_t>{};
+}
+
+// Flip one byte of a section's latest copy in place
+void corruptLatest(CheckpointStore& store, CheckpointSection section) {
+    CheckpointView view;
+    ASSERT_NE(store.read(section, view), CheckpointReadStatus::EMPTY);
+    const_cast<uint8_t*>(view.data)[view.size / 2] ^= 0x5A;
+}
+
+std::function<bool(const TaskContext&)> noopTask(const OrbitalTask&) {
+    return [](const TaskContext&) { return true; };
+}
+
+OrbitalTask futureTask(const std::string& name) {
+    OrbitalTask task;
+    task.name = name;
+    task.type = TaskType::PAYLOAD_OPERATION;
+    task.priority = TaskPriority::NORMAL;
+    task.scheduled_time = std::chrono::system_clock::now() + std::chrono::hours(1);
+    task.timeout = 5000ms;
+    task.recovery_strategy = RecoveryStrategy::RETRY;
+    task.radiation_protected = false;
+    task.retry_count = 2;
+    task.task_function = [](const TaskContext&) { return true; };
+    return task;
+}
+
+std::string tempPath(const char* name) {
+    return ::testing::TempDir() + "skymesh_" + name + ".ckpt";
+}
+
+} // anonymous namespace
+
+TEST(CheckpointStoreTest, CommitAndReopen) {
+    const CheckpointLayout layout = smallLayout();
+    Region region(layout);
+    std::vector<uint8_t> power(200);
+    for (size_t i = 0; i < power.size(); ++i) {
+        power[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    {
+        auto store = CheckpointStore::openRegion(region.base(), region.size(), layout);
+        ASSERT_NE(store, nullptr);
+        EXPECT_FALSE(store->recovered());
+        readBytes(*store, CheckpointSection::POWER, CheckpointReadStatus::EMPTY);
+
+        stageBytes(*store, CheckpointSection::POWER, power);
+        ASSERT_TRUE(store->commit(CheckpointSection::POWER, power.size()));
+        EXPECT_EQ(readBytes(*store, CheckpointSection::POWER), power);
+        readBytes(*store, CheckpointSection::TASKS, CheckpointReadStatus::EMPTY);
+
+        // Larger than the section
+        EXPECT_FALSE(store->commit(CheckpointSection::POWER, kCheckpointPageSize + 1));
+    }
+
+    auto reopened = CheckpointStore::openRegion(region.base(), region.size(), layout);
+    ASSERT_NE(reopened, nullptr);
+    EXPECT_TRUE(reopened->recovered());
+    EXPECT_EQ(readBytes(*reopened, CheckpointSection::POWER), power);
+
+    reopened->clear();
+    readBytes(*reopened, CheckpointSection::POWER, CheckpointReadStatus::EMPTY);
+
+    // Misaligned or short regions are refused
+    EXPECT_EQ(CheckpointStore::openRegion(static_cast<uint8_t*>(region.base()) + 8, region.size() - 8, layout),
+              nullptr);
+    EXPECT_EQ(CheckpointStore::openRegion(region.base(), region.size() - kCheckpointPageSize, layout), nullptr);
+}
+
+// Only pages that differ from the target slot are written and flushed
+TEST(CheckpointStoreTest, CommitsWriteOnlyChangedPages) {
+    const CheckpointLayout layout = smallLayout();
+    Region region(layout);
+    size_t flushed = 0;
+    auto store = CheckpointStore::openRegion(region.base(), region.size(), layout,
+                                             [&flushed](const void*, size_t length) { flushed += length; });
+    ASSERT_NE(store, nullptr);
+
+    std::vector<uint8_t> tasks(8 * kCheckpointPageSize, 0x11);
+    stageBytes(*store, CheckpointSection::TASKS, tasks);
+    ASSERT_TRUE(store->commit(CheckpointSection::TASKS, tasks.size()));
+
+    // Unchanged contents cost a compare and nothing else
+    flushed = 0;
+    ASSERT_TRUE(store->commit(CheckpointSection::TASKS, tasks.size()));
+    EXPECT_EQ(store->stats().unchanged, 1u);
+    EXPECT_EQ(flushed, 0u);
+
+    tasks[3 * kCheckpointPageSize] = 0x22;
+    stageBytes(*store, CheckpointSection::TASKS, tasks);
+    ASSERT_TRUE(store->commit(CheckpointSection::TASKS, tasks.size()));
+
+    // The target slot now holds the first copy: two pages differ from it
+    tasks[3 * kCheckpointPageSize + 1] = 0x33;
+    tasks[5 * kCheckpointPageSize] = 0x44;
+    stageBytes(*store, CheckpointSection::TASKS, tasks);
+    const CheckpointStats before = store->stats();
+    flushed = 0;
+    ASSERT_TRUE(store->commit(CheckpointSection::TASKS, tasks.size()));
+    const CheckpointStats after = store->stats();
+    EXPECT_EQ(after.pagesCompared - before.pagesCompared, 8u);
+    EXPECT_EQ(after.pagesWritten - before.pagesWritten, 2u);
+    EXPECT_LT(flushed, 4 * kCheckpointPageSize);
+    EXPECT_EQ(readBytes(*store, CheckpointSection::TASKS), tasks);
+}
+
+// A damaged copy falls back to the one before it, a damaged header to the other copy
+TEST(CheckpointStoreTest, FallsBackPastCorruption) {
+    const CheckpointLayout layout = smallLayout();
+    Region region(layout);
+    auto store = CheckpointStore::openRegion(region.base(), region.size(), layout);
+    ASSERT_NE(store, nullptr);
+
+    const std::vector<uint8_t> first(300, 0xA1);
+    const std::vector<uint8_t> second(500, 0xB2);
+    stageBytes(*store, CheckpointSection::HEALTH, first);
+    ASSERT_TRUE(store->commit(CheckpointSection::HEALTH, first.size()));
+    stageBytes(*store, CheckpointSection::HEALTH, second);
+    ASSERT_TRUE(store->commit(CheckpointSection::HEALTH, second.size()));
+
+    // Trash the newer header copy (page 0 after two commits)
+    static_cast<uint8_t*>(region.base())[8] ^= 0xFF;
+    auto reopened = CheckpointStore::openRegion(region.base(), region.size(), layout);
+    ASSERT_NE(reopened, nullptr);
+    EXPECT_TRUE(reopened->recovered());
+    EXPECT_EQ(readBytes(*reopened, CheckpointSection::HEALTH), first);
+    reopened.reset();
+
+    // With the store's own header, damage the latest slot, then the previous one
+    corruptLatest(*store, CheckpointSection::HEALTH);
+    EXPECT_EQ(readBytes(*store, CheckpointSection::HEALTH, CheckpointReadStatus::PREVIOUS), first);
+    EXPECT_EQ(store->stats().fallbacks, 1u);
+    corruptLatest(*store, CheckpointSection::HEALTH);
+    readBytes(*store, CheckpointSection::HEALTH, CheckpointReadStatus::CORRUPT);
+}
+
+TEST(CheckpointStoreTest, MappedFileSurvivesReopen) {
+    const std::string path = tempPath("checkpoint_store_test");
+    std::remove(path.c_str());
+    const CheckpointLayout layout = smallLayout();
+    const std::vector<uint8_t> tasks(3 * kCheckpointPageSize + 17, 0x5C);
+
+    {
+        auto store = CheckpointStore::openFile(path, layout);
+        ASSERT_NE(store, nullptr);
+        EXPECT_FALSE(store->recovered());
+        stageBytes(*store, CheckpointSection::TASKS, tasks);
+        ASSERT_TRUE(store->commit(CheckpointSection::TASKS, tasks.size()));
+    }
+    {
+        auto store = CheckpointStore::openFile(path, layout);
+        ASSERT_NE(store, nullptr);
+        EXPECT_TRUE(store->recovered());
+        EXPECT_EQ(readBytes(*store, CheckpointSection::TASKS), tasks);
+    }
+
+    // A different layout cannot read it and starts over
+    CheckpointLayout other = layout;
+    other.capacity[0] *= 2;
+    auto store = CheckpointStore::openFile(path, other);
+    ASSERT_NE(store, nullptr);
+    EXPECT_FALSE(store->recovered());
+    readBytes(*store, CheckpointSection::TASKS, CheckpointReadStatus::EMPTY);
+    store.reset();
+    std::remove(path.c_str());
+}
+
+// Queued, suspended, recurring and armed conditional tasks come back as they were
+TEST(CheckpointStoreTest, TaskManagerRestoresSchedule) {
+    Region region(CheckpointLayout{});
+    auto store = CheckpointStore::openRegion(region.base(), region.size());
+    ASSERT_NE(store, nullptr);
+
+    std::string queued_id;
+    std::string suspended_id;
+    std::string recurring_id;
+    std::string conditional_id;
+    {
+        auto manager = createOrbitalTaskManager();
+        ASSERT_TRUE(manager->start());
+        OrbitalTask queued = futureTask("imaging");
+        queued.metadata["target"] = "kilimanjaro";
+        queued.energy_cost_wh = 1.5f;
+        queued_id = manager->scheduleTask(queued);
+        suspended_id = manager->scheduleTask(futureTask("downlink"));
+        ASSERT_TRUE(manager->suspendTask(suspended_id));
+        recurring_id = manager->scheduleRecurringTask(futureTask("housekeeping"), 10s);
+        TriggerCondition trigger;
+        trigger.event_name = "deploy";
+        conditional_id = manager->scheduleConditionalTask(futureTask("deploy_antenna"), trigger);
+        manager->scheduleTask(futureTask("unresolvable"));
+        ASSERT_FALSE(conditional_id.empty());
+
+        ASSERT_TRUE(manager->saveCheckpoint(*store));
+        const uint64_t commits = store->stats().commits;
+        ASSERT_TRUE(manager->saveCheckpoint(*store));
+        EXPECT_EQ(store->stats().commits, commits);
+        manager->stop();
+    }
+
+    std::atomic<bool> deployed{false};
+    auto resolver = [&deployed](const OrbitalTask& task) -> std::function<bool(const TaskContext&)> {
+        if (task.name == "unresolvable") {
+            return nullptr;
+        }
+        if (task.name == "deploy_antenna") {
+            return [&deployed](const TaskContext&) {
+                deployed = true;
+                return true;
+            };
+        }
+        return noopTask(task);
+    };
+
+    auto manager = createOrbitalTaskManager();
+    ASSERT_TRUE(manager->start());
+    EXPECT_EQ(manager->restoreCheckpoint(*store, resolver), 4u);
+    EXPECT_EQ(manager->getTaskStatus(queued_id), TaskStatus::PENDING);
+    EXPECT_EQ(manager->getTaskStatus(suspended_id), TaskStatus::SUSPENDED);
+    EXPECT_EQ(manager->getTaskStatus(recurring_id), TaskStatus::PENDING);
+
+    bool found = false;
+    for (const OrbitalTask& task : manager->getTasksByStatus(TaskStatus::PENDING)) {
+        if (task.task_id == queued_id) {
+            found = true;
+            EXPECT_EQ(task.name, "imaging");
+            EXPECT_EQ(task.metadata.at("target"), "kilimanjaro");
+            EXPECT_FLOAT_EQ(task.energy_cost_wh, 1.5f);
+            EXPECT_EQ(task.retry_count, 2u);
+        }
+    }
+    EXPECT_TRUE(found);
+
+    // The conditional task waits for its event again
+    EXPECT_EQ(manager->publishEvent("deploy"), 1u);
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (!deployed && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(2ms);
+    }
+    EXPECT_TRUE(deployed);
+    manager->stop();
+}
+
+TEST(CheckpointStoreTest, TaskManagerRestoresTenThousandTasks) {
+    Region region(CheckpointLayout{});
+    auto store = CheckpointStore::openRegion(region.base(), region.size());
+    ASSERT_NE(store, nullptr);
+    {
+        auto manager = createOrbitalTaskManager();
+        ASSERT_TRUE(manager->start());
+        std::vector<OrbitalTask> tasks;
+        for (int i = 0; i < 10000; ++i) {
+            tasks.push_back(futureTask("bulk_" + std::to_string(i)));
+        }
+        manager->scheduleTasks(std::move(tasks));
+        ASSERT_TRUE(manager->saveCheckpoint(*store));
+        manager->stop();
+    }
+
+    auto manager = createOrbitalTaskManager();
+    ASSERT_TRUE(manager->start());
+    EXPECT_EQ(manager->restoreCheckpoint(*store, noopTask), 10000u);
+    EXPECT_EQ(manager->getTaskMetrics().tasks_by_status[static_cast<size_t>(TaskStatus::PENDING)], 10000u);
+    manager->stop();
+}
+
+TEST(CheckpointStoreTest, PowerManagerRestoresState) {
+    Region region(smallLayout());
+    auto store = CheckpointStore::openRegion(region.base(), region.size(), smallLayout());
+    ASSERT_NE(store, nullptr);
+    const std::vector<SubsystemID> managed = {SubsystemID::OBC, SubsystemID::RF_SYSTEM, SubsystemID::PAYLOAD};
+
+    PowerManager saved;
+    ASSERT_TRUE(saved.initialize(managed));
+    ASSERT_TRUE(saved.enableSubsystem(SubsystemID::PAYLOAD, 0.5f));
+    ASSERT_TRUE(saved.setRFPowerAllocations(0.4f, 0.6f, 0.9f));
+    saved.updateOrbitPowerProfile(3500, 2100);
+    ASSERT_TRUE(saved.saveCheckpoint(*store));
+    const PowerBudgetSnapshot expected = saved.getPowerBudgetSnapshot();
+
+    PowerManager restored;
+    ASSERT_TRUE(restored.initialize(managed));
+    ASSERT_TRUE(restored.restoreCheckpoint(*store));
+    const PowerBudgetSnapshot actual = restored.getPowerBudgetSnapshot();
+    EXPECT_EQ(restored.getCurrentPowerMode(), saved.getCurrentPowerMode());
+    EXPECT_EQ(restored.isSubsystemEnabled(SubsystemID::PAYLOAD), saved.isSubsystemEnabled(SubsystemID::PAYLOAD));
+    EXPECT_FLOAT_EQ(actual.totalConsumption, expected.totalConsumption);
+    EXPECT_EQ(actual.subsystemCount, expected.subsystemCount);
+    EXPECT_EQ(actual.orbitSunlightSeconds, 3500u);
+    EXPECT_EQ(actual.orbitEclipseSeconds, 2100u);
+    EXPECT_EQ(actual.orbitEpoch, expected.orbitEpoch);
+
+    // A checkpoint from another subsystem configuration is refused
+    PowerManager other;
+    ASSERT_TRUE(other.initialize({SubsystemID::OBC}));
+    const PowerBudgetSnapshot defaults = other.getPowerBudgetSnapshot();
+    EXPECT_FALSE(other.restoreCheckpoint(*store));
+    EXPECT_EQ(other.getPowerBudgetSnapshot().orbitSunlightSeconds, defaults.orbitSunlightSeconds);
+}
+
+TEST(CheckpointStoreTest, HealthMonitorRestoresHistory) {
+    Region region(CheckpointLayout{});
+    auto store = CheckpointStore::openRegion(region.base(), region.size());
+    ASSERT_NE(store, nullptr);
+
+    auto saved = createHealthMonitor();
+    ASSERT_TRUE(saved->initialize(2));
+    ASSERT_TRUE(saved->registerComponent("obc", ComponentType::PROCESSOR));
+    ASSERT_TRUE(saved->registerTemperatureSensor("obc_temp", ComponentType::PROCESSOR, 30.0f));
+    ASSERT_TRUE(saved->start());
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (saved->getTemperatureStats(ComponentType::PROCESSOR, std::chrono::hours(1)).count < 20 &&
+           std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(2ms);
+    }
+    saved->stop();
+    ASSERT_TRUE(saved->saveCheckpoint(*store));
+
+    auto restored = createHealthMonitor();
+    ASSERT_TRUE(restored->initialize(2));
+    ASSERT_TRUE(restored->registerComponent("obc", ComponentType::PROCESSOR));
+    ASSERT_TRUE(restored->registerTemperatureSensor("obc_temp", ComponentType::PROCESSOR, 30.0f));
+    ASSERT_TRUE(restored->restoreCheckpoint(*store));
+
+    const TelemetryWindowStats before = saved->getTemperatureStats(ComponentType::PROCESSOR, std::chrono::hours(1));
+    const TelemetryWindowStats after = restored->getTemperatureStats(ComponentType::PROCESSOR, std::chrono::hours(1));
+    EXPECT_GE(after.count, 20u);
+    EXPECT_EQ(after.count, before.count);
+    EXPECT_FLOAT_EQ(after.mean, before.mean);
+    EXPECT_EQ(after.newest, before.newest);
+    EXPECT_EQ(restored->getDoseRateStats(std::chrono::hours(1)).count,
+              saved->getDoseRateStats(std::chrono::hours(1)).count);
+    EXPECT_FLOAT_EQ(restored->getRadiationData().total_dose, saved->getRadiationData().total_dose);
+    EXPECT_EQ(restored->getComponentHealth("obc").status, saved->getComponentHealth("obc").status);
+    EXPECT_FLOAT_EQ(restored->getComponentHealth("obc").health_percentage,
+                    saved->getComponentHealth("obc").health_percentage);
+}
+
+// A clean checkpoint restores quietly; a damaged one keeps defaults and enters safe mode
+TEST(CheckpointStoreTest, WarmRestartChecksIntegrity) {
+    Region region(CheckpointLayout{});
+    std::shared_ptr<CheckpointStore> store = CheckpointStore::openRegion(region.base(), region.size());
+    ASSERT_NE(store, nullptr);
+    const std::vector<SubsystemID> managed = {SubsystemID::OBC, SubsystemID::PAYLOAD};
+
+    {
+        auto power = std::make_shared<PowerManager>();
+        ASSERT_TRUE(power->initialize(managed));
+        power->updateOrbitPowerProfile(3000, 2000);
+        CommandControl control(nullptr, power, nullptr, nullptr);
+        EXPECT_FALSE(control.checkpointState());
+        control.setCheckpointStore(store);
+        ASSERT_TRUE(control.checkpointState());
+    }
+
+    auto reopened = std::shared_ptr<CheckpointStore>(CheckpointStore::openRegion(region.base(), region.size()));
+    ASSERT_NE(reopened, nullptr);
+    {
+        auto power = std::make_shared<PowerManager>();
+        ASSERT_TRUE(power->initialize(managed));
+        CommandControl control(nullptr, power, nullptr, nullptr);
+        control.setCheckpointStore(reopened);
+        EXPECT_TRUE(control.warmRestart());
+        EXPECT_EQ(power->getPowerBudgetSnapshot().orbitSunlightSeconds, 3000u);
+        EXPECT_TRUE(control.isSystemSecure());
+    }
+
+    corruptLatest(*reopened, CheckpointSection::POWER);
+    {
+        auto power = std::make_shared<PowerManager>();
+        ASSERT_TRUE(power->initialize(managed));
+        CommandControl control(nullptr, power, nullptr, nullptr);
+        control.setCheckpointStore(reopened);
+        EXPECT_FALSE(control.warmRestart());
+        EXPECT_EQ(control.getSystemMode(), SystemMode::SAFE);
+        EXPECT_EQ(power->getPowerBudgetSnapshot().orbitSunlightSeconds, 0u);
+    }
+}
@@ -0,0 +1,214 @@
+/**
+ * @file clock_test.cpp
+ * @brief Unit tests for the simulation executor and the subsystems running on it
+ */
+
+#include "skymesh/core/clock.h"
+#include "skymesh/core/command_control.h"
+#include "skymesh/core/health_monitor.h"
+#include "skymesh/core/orbital_task_manager.h"
+#include "skymesh/core/power_manager.h"
+#include "skymesh/core/sensor_backend.h"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace skymesh::core;
+using namespace std::chrono_literals;
+
+namespace {
+
+OrbitalTask makeTask(const std::string& name, std::chrono::system_clock::time_point when,
+                     std::function<bool(const TaskContext&)> function) {
+    OrbitalTask task;
+    task.name = name;
+    task.type = TaskType::MAINTENANCE;
+    task.priority = TaskPriority::NORMAL;
+    task.scheduled_time = when;
+    task.timeout = std::chrono::milliseconds(5000);
+    task.recovery_strategy = RecoveryStrategy::RETRY;
+    task.radiation_protected = false;
+    task.retry_count = 0;
+    task.task_function = std::move(function);
+    return task;
+}
+
+std::shared_ptr<SensorBackend> sensorsOn(const std::shared_ptr<SimulationExecutor>& executor) {
+    SimulationProfile profile = SimulationProfile::steady(7);
+    profile.clock = executor;
+    return createSimulatedSensorBackend(profile);
+}
+
+} // anonymous namespace
+
+TEST(SimulationExecutorTest, RunsInTimeOrderThenSchedulingOrder) {
+    SimulationExecutor executor;
+    const auto start = executor.now();
+    std::vector<int> order;
+    executor.scheduleAt(start + 2s, [&] { order.push_back(3); });
+    executor.scheduleAt(start + 1s, [&] { order.push_back(1); });
+    executor.scheduleAt(start + 1s, [&] { order.push_back(2); });
+    executor.scheduleAt(start - 1s, [&] { order.push_back(0); });
+
+    EXPECT_EQ(executor.runFor(10s), 4u);
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2, 3}));
+    EXPECT_EQ(executor.now(), start + 10s);
+    EXPECT_EQ(executor.executed(), 4u);
+}
+
+TEST(SimulationExecutorTest, ClockAdvancesToEachEvent) {
+    SimulationExecutor executor;
+    const auto start = executor.now();
+    std::vector<std::chrono::system_clock::time_point> seen;
+    executor.scheduleAt(start + 5ms, [&] { seen.push_back(executor.now()); });
+    executor.scheduleAt(start + 3s, [&] { seen.push_back(executor.now()); });
+
+    ASSERT_TRUE(executor.runNext());
+    ASSERT_TRUE(executor.runNext());
+    EXPECT_FALSE(executor.runNext());
+    ASSERT_EQ(seen.size(), 2u);
+    EXPECT_EQ(seen[0], start + 5ms);
+    EXPECT_EQ(seen[1], start + 3s);
+}
+
+TEST(SimulationExecutorTest, CancelledWorkNeverRuns) {
+    SimulationExecutor executor;
+    const auto start = executor.now();
+    int runs = 0;
+    const TimerId dropped = executor.scheduleAt(start + 1s, [&] { runs += 100; });
+    executor.scheduleAt(start + 2s, [&] { ++runs; });
+
+    EXPECT_TRUE(executor.cancel(dropped));
+    EXPECT_FALSE(executor.cancel(dropped));
+    EXPECT_EQ(executor.pending(), 1u);
+    executor.runFor(5s);
+    EXPECT_EQ(runs, 1);
+    EXPECT_EQ(executor.pending(), 0u);
+}
+
+TEST(SimulationExecutorTest, WorkCanScheduleMoreWork) {
+    SimulationExecutor executor;
+    int ticks = 0;
+    std::function<void()> tick = [&] {
+        if (++ticks < 10) {
+            executor.scheduleAt(executor.now() + 100ms, tick);
+        }
+    };
+    executor.scheduleAt(executor.now(), tick);
+
+    executor.runFor(450ms);
+    EXPECT_EQ(ticks, 5);
+    executor.runFor(10s);
+    EXPECT_EQ(ticks, 10);
+}
+
+TEST(ExecutorModeTest, TaskManagerRunsTasksAtSimulatedTimes) {
+    auto executor = std::make_shared<SimulationExecutor>();
+    auto manager = createOrbitalTaskManager();
+    ExecutionPoolConfig pool;
+    pool.executor = executor;
+    ASSERT_TRUE(manager->configureExecutionPool(pool));
+    ASSERT_TRUE(manager->start());
+
+    const auto start = executor->now();
+    std::vector<std::chrono::system_clock::time_point> ran;
+    const std::thread::id caller = std::this_thread::get_id();
+    bool inline_run = true;
+    manager->scheduleTask(makeTask("Later", start + 1h, [&](const TaskContext&) {
+        ran.push_back(executor->now());
+        inline_run = inline_run && std::this_thread::get_id() == caller;
+        return true;
+    }));
+    const std::string recurring = manager->scheduleRecurringTask(
+        makeTask("Tick", start, [&](const TaskContext&) {
+            inline_run = inline_run && std::this_thread::get_id() == caller;
+            return true;
+        }), 10min);
+    ASSERT_FALSE(recurring.empty());
+
+    // Two simulated hours pass in well under a real second
+    const auto wall_start = std::chrono::steady_clock::now();
+    executor->runFor(2h);
+    EXPECT_LT(std::chrono::steady_clock::now() - wall_start, 5s);
+
+    ASSERT_EQ(ran.size(), 1u);
+    EXPECT_GE(ran[0], start + 1h);
+    EXPECT_LT(ran[0], start + 1h + 1s);
+    EXPECT_TRUE(inline_run);
+    EXPECT_GE(manager->getTaskMetrics().tasks_executed, 12u);
+    manager->stop();
+}
+
+TEST(ExecutorModeTest, StoppedTaskManagerLeavesNothingScheduled) {
+    auto executor = std::make_shared<SimulationExecutor>();
+    auto manager = createOrbitalTaskManager();
+    ExecutionPoolConfig pool;
+    pool.executor = executor;
+    manager->configureExecutionPool(pool);
+    manager->start();
+    manager->scheduleRecurringTask(makeTask("Tick", executor->now(), [](const TaskContext&) { return true; }), 1s);
+    executor->runFor(5s);
+
+    manager->stop();
+    const uint64_t executed = manager->getTaskMetrics().tasks_executed;
+    executor->runFor(1min);
+    EXPECT_EQ(manager->getTaskMetrics().tasks_executed, executed);
+}
+
+TEST(ExecutorModeTest, HealthMonitorSamplesOnSimulatedTime) {
+    auto executor = std::make_shared<SimulationExecutor>();
+    auto monitor = createHealthMonitor("", nullptr, sensorsOn(executor), executor);
+    ASSERT_TRUE(monitor->initialize(1000));
+    ASSERT_TRUE(monitor->start());
+
+    // Settled readings back off to the 4 s quiet interval
+    executor->runFor(10min);
+    const RadiationData radiation = monitor->getRadiationData();
+    EXPECT_GE(radiation.timestamp, executor->now() - 4s);
+    EXPECT_LE(radiation.timestamp, executor->now());
+    EXPECT_GT(monitor->getDoseRateStats(1min).count, 0u);
+
+    monitor->stop();
+    EXPECT_EQ(executor->pending(), 0u);
+}
+
+TEST(ExecutorModeTest, PowerManagerFollowsSensorClock) {
+    auto executor = std::make_shared<SimulationExecutor>();
+    PowerManager power(sensorsOn(executor));
+    ASSERT_TRUE(power.initialize({SubsystemID::OBC, SubsystemID::THERMAL}));
+
+    executor->runFor(3h);
+    power.update(1000);
+    const auto status = power.getPowerSourceStatus(PowerSource::BATTERY);
+    EXPECT_GE(status.lastUpdated, executor->now() - 1s);
+    EXPECT_LE(status.lastUpdated, executor->now());
+}
+
+TEST(ExecutorModeTest, CommandControlDispatchesInExecutorPasses) {
+    auto executor = std::make_shared<SimulationExecutor>();
+    CommandControl control(nullptr, nullptr, nullptr, nullptr);
+    ASSERT_TRUE(control.setExecutor(executor));
+    ASSERT_TRUE(control.initialize());
+    EXPECT_FALSE(control.setExecutor(nullptr));
+
+    std::vector<uint16_t> order;
+    for (uint16_t code : {0x0101, 0x0102}) {
+        control.registerCommandHandler(code, [&order](const Command& command, std::string&) {
+            order.push_back(command.commandCode);
+            return CommandStatus::SUCCESS;
+        });
+    }
+    EXPECT_EQ(control.processCommand(control.createCommand(0x0101, CommandPriority::LOW, {})),
+              CommandStatus::PENDING);
+    EXPECT_EQ(control.processCommand(control.createCommand(0x0102, CommandPriority::HIGH, {})),
+              CommandStatus::PENDING);
+    EXPECT_TRUE(order.empty()) << "Nothing runs until the executor does";
+
+    executor->runFor(1ms);
+    EXPECT_EQ(order, (std::vector<uint16_t>{0x0102, 0x0101}));
+    EXPECT_EQ(control.getDispatchStats().executed, 2u);
+    EXPECT_EQ(executor->pending(), 0u);
+}
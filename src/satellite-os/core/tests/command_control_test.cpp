@@ -0,0 +1,379 @@
+/**
+ * @file command_control_test.cpp
+ * @brief Unit tests for the CommandControl dispatcher
+ */
+
+#include "skymesh/core/command_control.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace skymesh::core;
+
+namespace {
+
+constexpr uint16_t kRecordCode = 0x0101;
+constexpr uint16_t kBlockCode = 0x0102;
+
+class CommandControlTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        control = std::make_unique<CommandControl>(nullptr, nullptr, nullptr, nullptr);
+        ASSERT_TRUE(control->initialize());
+
+        control->registerCommandHandler(kRecordCode, [this](const Command& command, std::string&) {
+            std::lock_guard<std::mutex> lock(order_mutex);
+            order.push_back(command.data.empty() ? 0 : command.data[0]);
+            return CommandStatus::SUCCESS;
+        });
+        control->registerCommandHandler(kBlockCode, [this](const Command&, std::string&) {
+            blocked.set_value();
+            release_future.wait();
+            return CommandStatus::SUCCESS;
+        });
+    }
+
+    void TearDown() override {
+        control.reset();
+    }
+
+    Command makeCommand(uint16_t code, CommandPriority priority, uint8_t tag = 0,
+                        CommandSource source = CommandSource::GROUND_STATION) {
+        Command command = control->createCommand(code, priority, {tag});
+        command.source = source;
+        return command;
+    }
+
+    // Occupies the shared dispatch thread until release() is called
+    void blockQueuedLane() {
+        ASSERT_EQ(control->processCommand(makeCommand(kBlockCode, CommandPriority::NORMAL)),
+                  CommandStatus::PENDING);
+        blocked.get_future().wait();
+    }
+
+    void release() {
+        release_promise.set_value();
+    }
+
+    std::vector<uint8_t> recorded() {
+        std::lock_guard<std::mutex> lock(order_mutex);
+        return order;
+    }
+
+    std::unique_ptr<CommandControl> control;
+    std::mutex order_mutex;
+    std::vector<uint8_t> order;
+    std::promise<void> blocked;
+    std::promise<void> release_promise;
+    std::shared_future<void> release_future{release_promise.get_future().share()};
+};
+
+} // anonymous namespace
+
+// Queued work runs highest priority first, oldest first within a priority
+TEST_F(CommandControlTest, DispatchesByPriority) {
+    blockQueuedLane();
+    const CommandPriority priorities[] = {
+        CommandPriority::DEFERRED, CommandPriority::LOW, CommandPriority::NORMAL,
+        CommandPriority::HIGH, CommandPriority::NORMAL, CommandPriority::HIGH};
+    for (uint8_t i = 0; i < 6; ++i) {
+        ASSERT_EQ(control->processCommand(makeCommand(kRecordCode, priorities[i], i)), CommandStatus::PENDING);
+    }
+    release();
+    ASSERT_TRUE(control->waitForIdle());
+
+    EXPECT_EQ(recorded(), (std::vector<uint8_t>{3, 5, 2, 4, 1, 0}));
+    EXPECT_EQ(control->getDispatchStats().executed, 7u);
+}
+
+// EMERGENCY commands run even while another command is still executing
+TEST_F(CommandControlTest, EmergencyBypassesRunningWork) {
+    blockQueuedLane();
+    std::promise<CommandStatus> done;
+    ASSERT_EQ(control->processCommand(makeCommand(kRecordCode, CommandPriority::EMERGENCY, 9),
+                                      [&done](CommandStatus status, const std::string&) {
+                                          done.set_value(status);
+                                      }),
+              CommandStatus::PENDING);
+
+    auto result = done.get_future();
+    ASSERT_EQ(result.wait_for(std::chrono::seconds(2)), std::future_status::ready);
+    EXPECT_EQ(result.get(), CommandStatus::SUCCESS);
+    EXPECT_EQ(recorded(), std::vector<uint8_t>{9});
+    release();
+    EXPECT_TRUE(control->waitForIdle());
+}
+
+// Corrupted, unauthenticated and unknown commands are refused or reported
+TEST_F(CommandControlTest, ValidatesCommands) {
+    Command bad_checksum = makeCommand(kRecordCode, CommandPriority::NORMAL);
+    bad_checksum.data[0] ^= 0xFF;
+    EXPECT_EQ(control->processCommand(bad_checksum), CommandStatus::INVALID_COMMAND);
+
+    // One upset copy of the code is outvoted; three different copies are not
+    Command upset = makeCommand(kRecordCode, CommandPriority::NORMAL, 7);
+    upset.commandCode ^= 0x40;
+    EXPECT_FALSE(upset.validateTMR());
+    EXPECT_EQ(upset.getCommandCodeTMR(), kRecordCode);
+    EXPECT_EQ(control->processCommand(upset), CommandStatus::PENDING);
+    Command scrambled = makeCommand(kRecordCode, CommandPriority::NORMAL);
+    scrambled.commandCode_copy1 ^= 0x01;
+    scrambled.commandCode_copy2 ^= 0x02;
+    EXPECT_EQ(control->processCommand(scrambled), CommandStatus::REDUNDANCY_MISMATCH);
+
+    // With a key set, ground commands must carry a matching signature
+    CommandKey key{};
+    key[0] = 0x5A;
+    control->setSourceKey(CommandSource::GROUND_STATION, key);
+    Command unsigned_command = makeCommand(kRecordCode, CommandPriority::NORMAL);
+    EXPECT_EQ(control->processCommand(unsigned_command), CommandStatus::UNAUTHORIZED);
+    Command signed_command = makeCommand(kRecordCode, CommandPriority::NORMAL, 8);
+    const auto signature = computeCommandSignature(signed_command, key);
+    signed_command.signature.assign(signature.begin(), signature.end());
+    EXPECT_EQ(control->processCommand(signed_command), CommandStatus::PENDING);
+    signed_command.timestamp++;
+    EXPECT_EQ(control->processCommand(signed_command), CommandStatus::UNAUTHORIZED);
+
+    std::promise<CommandStatus> unknown;
+    EXPECT_EQ(control->processCommand(makeCommand(0x7777, CommandPriority::NORMAL, 0, CommandSource::MESH_PEER),
+                                      [&unknown](CommandStatus status, const std::string&) {
+                                          unknown.set_value(status);
+                                      }),
+              CommandStatus::PENDING);
+    EXPECT_EQ(unknown.get_future().get(), CommandStatus::INVALID_COMMAND);
+
+    ASSERT_TRUE(control->waitForIdle());
+    EXPECT_EQ(recorded(), (std::vector<uint8_t>{7, 8}));
+    EXPECT_EQ(control->getDispatchStats().rejected, 4u);
+}
+
+// A rate-limited source is cut off after its burst without affecting others
+TEST_F(CommandControlTest, RateLimitsPerSource) {
+    control->setRateLimit(CommandSource::MESH_PEER, 1.0, 5);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(control->processCommand(makeCommand(kRecordCode, CommandPriority::LOW, 0, CommandSource::MESH_PEER)),
+                  CommandStatus::PENDING);
+    }
+    EXPECT_EQ(control->processCommand(makeCommand(kRecordCode, CommandPriority::LOW, 0, CommandSource::MESH_PEER)),
+              CommandStatus::RESOURCE_UNAVAILABLE);
+    EXPECT_EQ(control->processCommand(makeCommand(kRecordCode, CommandPriority::LOW)), CommandStatus::PENDING);
+    EXPECT_EQ(control->getDispatchStats().rateLimited, 1u);
+
+    control->setRateLimit(CommandSource::MESH_PEER, 0.0);
+    EXPECT_EQ(control->processCommand(makeCommand(kRecordCode, CommandPriority::LOW, 0, CommandSource::MESH_PEER)),
+              CommandStatus::PENDING);
+    EXPECT_TRUE(control->waitForIdle());
+}
+
+// Safe mode holds back routine work until the mode is left
+TEST_F(CommandControlTest, SafeModeHoldsRoutineCommands) {
+    control->enterSafeMode(42, "test");
+    EXPECT_EQ(control->getSystemMode(), SystemMode::SAFE);
+    EXPECT_FALSE(control->isSystemSecure());
+
+    ASSERT_EQ(control->processCommand(makeCommand(kRecordCode, CommandPriority::NORMAL, 1)), CommandStatus::PENDING);
+    ASSERT_EQ(control->processCommand(makeCommand(kRecordCode, CommandPriority::HIGH, 2)), CommandStatus::PENDING);
+    EXPECT_FALSE(control->waitForIdle(std::chrono::milliseconds(50)));
+    EXPECT_EQ(recorded(), std::vector<uint8_t>{2});
+
+    control->changeSystemMode(SystemMode::NORMAL);
+    ASSERT_TRUE(control->waitForIdle());
+    EXPECT_EQ(recorded(), (std::vector<uint8_t>{2, 1}));
+}
+
+// EMERGENCY latency stays low while mesh peers flood the queues
+TEST_F(CommandControlTest, EmergencyLatencyUnderMeshFlood) {
+    control->registerCommandHandler(0x0200, [](const Command&, std::string&) {
+        const auto until = std::chrono::steady_clock::now() + std::chrono::microseconds(50);
+        while (std::chrono::steady_clock::now() < until) {
+        }
+        return CommandStatus::SUCCESS;
+    });
+
+    std::atomic<bool> flooding{true};
+    std::vector<std::thread> peers;
+    for (int t = 0; t < 3; ++t) {
+        peers.emplace_back([&] {
+            while (flooding.load(std::memory_order_relaxed)) {
+                control->processCommand(makeCommand(0x0200, CommandPriority::NORMAL, 0, CommandSource::MESH_PEER));
+            }
+        });
+    }
+
+    std::atomic<int> handled{0};
+    for (int i = 0; i < 50; ++i) {
+        control->processCommand(makeCommand(kRecordCode, CommandPriority::EMERGENCY),
+                                [&handled](CommandStatus, const std::string&) { handled++; });
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    flooding = false;
+    for (auto& peer : peers) {
+        peer.join();
+    }
+    ASSERT_TRUE(control->waitForIdle());
+
+    const CommandDispatchStats stats = control->getDispatchStats();
+    EXPECT_EQ(handled.load(), 50);
+    EXPECT_GT(stats.queueFull, 0u);
+    // Generous for loaded CI machines; the benchmark tracks the real figure
+    EXPECT_LT(stats.maxQueueLatency[static_cast<size_t>(CommandPriority::EMERGENCY)],
+              std::chrono::milliseconds(20));
+}
+
+// Signatures are SipHash-2-4 over the 16-byte header followed by the data
+TEST(CommandSignatureTest, MatchesSipHashReferenceVectors) {
+    CommandKey key;
+    for (size_t i = 0; i < key.size(); ++i) {
+        key[i] = static_cast<uint8_t>(i);
+    }
+    // Header bytes 00..0f, as in the SipHash reference test messages
+    Command command{};
+    command.commandId = 0x03020100;
+    command.commandCode = command.commandCode_copy1 = command.commandCode_copy2 = 0x0504;
+    command.priority = static_cast<CommandPriority>(0x06);
+    command.source = static_cast<CommandSource>(0x07);
+    command.timestamp = 0x0F0E0D0C0B0A0908ull;
+
+    auto tag = [](const CommandSignature& signature) {
+        uint64_t value = 0;
+        for (size_t i = signature.size(); i-- > 0;) {
+            value = (value << 8) | signature[i];
+        }
+        return value;
+    };
+    EXPECT_EQ(tag(computeCommandSignature(command, key)), 0x3F2ACC7F57C29BDBull);
+    for (uint8_t i = 0x10; i < 0x1B; ++i) {
+        command.data.push_back(i);
+    }
+    EXPECT_EQ(tag(computeCommandSignature(command, key)), 0x2F2E6163076BCFADull);
+}
+
+// Lane-interleaved signing agrees with signing one command at a time
+TEST(CommandSignatureTest, BatchMatchesSingleSignatures) {
+    CommandKey first{};
+    CommandKey second{};
+    second.fill(0xC3);
+    const CommandKeySchedule schedules[2] = {CommandKeySchedule(first), CommandKeySchedule(second)};
+
+    std::vector<Command> commands(23);
+    std::vector<const Command*> pointers;
+    std::vector<const CommandKeySchedule*> keys;
+    for (size_t i = 0; i < commands.size(); ++i) {
+        commands[i].commandId = static_cast<uint32_t>(i);
+        commands[i].commandCode = commands[i].commandCode_copy1 = commands[i].commandCode_copy2 = 0x10;
+        commands[i].data.assign((i * 7) % 41, static_cast<uint8_t>(i));
+        pointers.push_back(&commands[i]);
+        keys.push_back(&schedules[i % 2]);
+    }
+
+    std::vector<CommandSignature> batch(commands.size());
+    computeCommandSignatures(pointers.data(), keys.data(), commands.size(), batch.data());
+    for (size_t i = 0; i < commands.size(); ++i) {
+        EXPECT_EQ(batch[i], computeCommandSignature(commands[i], *keys[i])) << "command " << i;
+    }
+}
+
+// Batched admission applies the same checks as processCommand() and keeps uplink order
+TEST_F(CommandControlTest, BatchAdmissionMatchesSingleCommands) {
+    CommandKey key{};
+    key[7] = 0x11;
+    control->setSourceKey(CommandSource::GROUND_STATION, key);
+    auto signedCommand = [&](uint8_t tag) {
+        Command command = makeCommand(kRecordCode, CommandPriority::NORMAL, tag);
+        const CommandSignature signature = computeCommandSignature(command, key);
+        command.signature.assign(signature.begin(), signature.end());
+        return command;
+    };
+
+    std::vector<Command> burst;
+    burst.push_back(signedCommand(1));
+    burst.push_back(makeCommand(kRecordCode, CommandPriority::NORMAL, 2));     // unsigned
+    burst.push_back(signedCommand(3));
+    burst.back().data[0] ^= 0x80;                                              // corrupted
+    burst.push_back(signedCommand(4));
+    burst.back().commandCode_copy2 ^= 0x08;                                    // single upset
+    burst.push_back(signedCommand(5));
+    burst.back().signature[3] ^= 0x01;                                         // forged
+    burst.push_back(signedCommand(6));
+    burst.back().commandCode ^= 0x01;
+    burst.back().commandCode_copy1 ^= 0x02;                                    // no majority
+    burst.push_back(makeCommand(kRecordCode, CommandPriority::NORMAL, 7, CommandSource::MESH_PEER));
+    burst.push_back(signedCommand(8));
+
+    const std::vector<CommandStatus> statuses = control->processCommandBatch(burst);
+    EXPECT_EQ(statuses, (std::vector<CommandStatus>{
+        CommandStatus::PENDING, CommandStatus::UNAUTHORIZED, CommandStatus::INVALID_COMMAND,
+        CommandStatus::PENDING, CommandStatus::UNAUTHORIZED, CommandStatus::REDUNDANCY_MISMATCH,
+        CommandStatus::PENDING, CommandStatus::PENDING}));
+    for (size_t i = 0; i < burst.size(); ++i) {
+        EXPECT_EQ(statuses[i], control->processCommand(burst[i])) << "command " << i;
+    }
+
+    ASSERT_TRUE(control->waitForIdle());
+    EXPECT_EQ(recorded(), (std::vector<uint8_t>{1, 4, 7, 8, 1, 4, 7, 8}));
+}
+
+// Telemetry ECC corrects bursts in every block, including a shortened last one
+TEST(TelemetryPacketTest, EccCorrectsCorruptedPayload) {
+    TelemetryPacket packet{};
+    packet.data.resize(3 * kRsMaxDataSize + 54);
+    for (size_t i = 0; i < packet.data.size(); ++i) {
+        packet.data[i] = static_cast<uint8_t>(i * 37 + 11);
+    }
+    packet.generateChecksum();
+    packet.generateECC();
+    ASSERT_EQ(packet.ecc.size(), 4 * kRsParitySize);
+    const std::vector<uint8_t> original = packet.data;
+
+    for (size_t block = 0; block < 4; ++block) {
+        for (size_t e = 0; e < kRsCorrectableErrors; ++e) {
+            const size_t offset = block * kRsMaxDataSize + (e * 3) % (block == 3 ? 54 : kRsMaxDataSize);
+            packet.data[offset] ^= 0xA5;
+        }
+    }
+    EXPECT_FALSE(packet.validateChecksum());
+    EXPECT_TRUE(packet.applyECCCorrection());
+    EXPECT_EQ(packet.data, original);
+    EXPECT_TRUE(packet.validateChecksum());
+
+    for (size_t e = 0; e < kRsCorrectableErrors + 1; ++e) {
+        packet.data[kRsMaxDataSize + e] ^= 0x5A;
+    }
+    EXPECT_FALSE(packet.applyECCCorrection());
+    packet.ecc.pop_back();
+    EXPECT_FALSE(packet.applyECCCorrection());
+}
+
+// collectTelemetry() and streamTelemetry() run the same sweep of frames
+TEST(CommandControlTelemetryTest, CollectsAndStreamsSweeps) {
+    auto power = std::make_shared<PowerManager>();
+    ASSERT_TRUE(power->initialize({SubsystemID::OBC}));
+    std::shared_ptr<OrbitalTaskManager> tasks = createOrbitalTaskManager();
+    CommandControl control(nullptr, power, tasks, nullptr);
+
+    const std::vector<TelemetryPacket> packets = control.collectTelemetry();
+    ASSERT_EQ(packets.size(), 2u);
+    EXPECT_EQ(packets[0].packetType, static_cast<uint16_t>(TelemetryFrameType::POWER_BUDGET));
+    EXPECT_EQ(packets[1].packetType, static_cast<uint16_t>(TelemetryFrameType::TASK_METRICS));
+    for (const TelemetryPacket& packet : packets) {
+        EXPECT_TRUE(packet.validateChecksum());
+        TelemetryFrameView view{};
+        EXPECT_TRUE(parseTelemetryFrame(packet.data.data(), packet.data.size(), view));
+    }
+
+    auto queue = std::make_unique<rf_txq_t>();
+    rf_txq_init(queue.get());
+    RfTxQueueSink sink(*queue, 1, RF_TX_POOL_SIZE - 1);
+    EXPECT_FALSE(control.streamTelemetry(sink));
+    rf_tx_batch_t batch;
+    ASSERT_EQ(rf_txq_next_batch(queue.get(), &batch), 1u);
+    rf_txq_complete(queue.get(), &batch, RF_STATUS_OK);
+    EXPECT_TRUE(control.streamTelemetry(sink));
+    EXPECT_EQ(rf_txq_next_batch(queue.get(), &batch), 1u);
+    EXPECT_EQ(batch.data[0][0], static_cast<uint8_t>(TelemetryFrameType::TASK_METRICS));
+}
@@ -0,0 +1,66 @@
+/**
+ * @file crc32c_test.cpp
+ * @brief Unit tests for the CRC32C implementation
+ */
+
+#include "skymesh/core/crc32c.h"
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace skymesh::core;
+
+namespace {
+
+uint32_t bitwiseCrc32c(const uint8_t* data, size_t size) {
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; ++i) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ ((crc & 1u) ? 0x82F63B78u : 0u);
+        }
+    }
+    return ~crc;
+}
+
+} // anonymous namespace
+
+TEST(Crc32cTest, MatchesReferenceVectors) {
+    const char* check = "123456789";
+    EXPECT_EQ(crc32c(check, std::strlen(check)), 0xE3069283u);
+    EXPECT_EQ(crc32c(nullptr, 0), 0u);
+
+    // RFC 3720 (iSCSI) test patterns
+    std::vector<uint8_t> zeros(32, 0x00);
+    std::vector<uint8_t> ones(32, 0xFF);
+    EXPECT_EQ(crc32c(zeros.data(), zeros.size()), 0x8A9136AAu);
+    EXPECT_EQ(crc32c(ones.data(), ones.size()), 0x62A8AB43u);
+}
+
+// Every length and alignment around the 8-byte block size
+TEST(Crc32cTest, MatchesBitwiseForUnalignedLengths) {
+    std::vector<uint8_t> buffer(300);
+    for (size_t i = 0; i < buffer.size(); ++i) {
+        buffer[i] = static_cast<uint8_t>(i * 131 + 7);
+    }
+    for (size_t offset = 0; offset < 8; ++offset) {
+        for (size_t size = 0; size + offset <= buffer.size(); size += 1 + size / 16) {
+            ASSERT_EQ(crc32c(buffer.data() + offset, size), bitwiseCrc32c(buffer.data() + offset, size))
+                << "offset " << offset << " size " << size;
+        }
+    }
+}
+
+TEST(Crc32cTest, ExtendEqualsWholeBuffer) {
+    std::vector<uint8_t> buffer(97);
+    for (size_t i = 0; i < buffer.size(); ++i) {
+        buffer[i] = static_cast<uint8_t>(i ^ 0x5C);
+    }
+    const uint32_t whole = crc32c(buffer.data(), buffer.size());
+    for (size_t split = 0; split <= buffer.size(); ++split) {
+        const uint32_t head = crc32c(buffer.data(), split);
+        EXPECT_EQ(crc32cExtend(head, buffer.data() + split, buffer.size() - split), whole);
+    }
+}
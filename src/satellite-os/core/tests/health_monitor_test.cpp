@@ -0,0 +1,209 @@
+/**
+ * @file health_monitor_test.cpp
+ * @brief Unit tests for the HealthMonitor telemetry and lock-free queries
+ */
+
+#include "skymesh/core/health_monitor.h"
+#include "skymesh/core/health_report_codec.h"
+
+#include <gtest/gtest.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+
+using namespace skymesh::core;
+
+namespace {
+
+bool waitFor(const std::function<bool()>& condition,
+             std::chrono::milliseconds timeout = std::chrono::seconds(2)) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (condition()) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    return condition();
+}
+
+} // anonymous namespace
+
+// Registered sensors build a time series the windowed queries read back
+TEST(HealthMonitorTest, TemperatureTelemetry) {
+    auto monitor = createHealthMonitor();
+    ASSERT_TRUE(monitor->initialize(5));
+    ASSERT_TRUE(monitor->registerComponent("obc", ComponentType::PROCESSOR));
+    ASSERT_FALSE(monitor->registerComponent("obc", ComponentType::PROCESSOR));
+    ASSERT_TRUE(monitor->registerTemperatureSensor("obc_temp", ComponentType::PROCESSOR, 25.0f));
+
+    // The initial reading is available before monitoring starts
+    TemperatureData temperature = monitor->getTemperature(ComponentType::PROCESSOR);
+    EXPECT_EQ(temperature.sensor_id, "obc_temp");
+    EXPECT_FLOAT_EQ(temperature.temperature_celsius, 25.0f);
+
+    ASSERT_TRUE(monitor->start());
+    ASSERT_TRUE(waitFor([&] {
+        return monitor->getTemperatureStats(ComponentType::PROCESSOR, std::chrono::seconds(60)).count >= 10;
+    }));
+    monitor->stop();
+
+    TelemetryWindowStats stats = monitor->getTemperatureStats(
+        ComponentType::PROCESSOR, std::chrono::seconds(60), "obc_temp");
+    EXPECT_LE(stats.min, stats.mean);
+    EXPECT_LE(stats.mean, stats.max);
+    EXPECT_NEAR(stats.mean, 25.0f, 0.25f * stats.count);
+    EXPECT_FLOAT_EQ(stats.latest, monitor->getTemperature(ComponentType::PROCESSOR).temperature_celsius);
+    EXPECT_EQ(monitor->getTemperatureStats(ComponentType::PAYLOAD, std::chrono::seconds(60)).count, 0u);
+
+    EXPECT_GE(monitor->getDoseRateStats(std::chrono::seconds(60)).count, 1u);
+    EXPECT_EQ(monitor->getComponentHealth("obc").status, HealthStatus::NOMINAL);
+    EXPECT_FLOAT_EQ(monitor->getComponentHealth("obc").health_percentage, 100.0f);
+}
+
+// A blocked status subscriber stalls neither monitoring nor queries, and a
+// component that stays critical is reported once
+TEST(HealthMonitorTest, SlowStatusCallbackDoesNotStallMonitoring) {
+    auto monitor = createHealthMonitor();
+    monitor->initialize(5);
+    ASSERT_TRUE(monitor->registerComponent("payload", ComponentType::PAYLOAD));
+    ASSERT_TRUE(monitor->registerTemperatureSensor("payload_temp", ComponentType::PAYLOAD, 95.0f));
+
+    std::promise<void> entered;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic<int> calls{0};
+    monitor->registerStatusCallback([&](const ComponentHealth& health) {
+        EXPECT_EQ(health.status, HealthStatus::CRITICAL);
+        if (calls.fetch_add(1) == 0) {
+            entered.set_value();
+            released.wait();
+        }
+    }, ComponentType::PAYLOAD);
+
+    ASSERT_TRUE(monitor->start());
+    ASSERT_EQ(entered.get_future().wait_for(std::chrono::seconds(2)), std::future_status::ready);
+
+    // Sampling continues while the callback is blocked
+    auto samples = [&] {
+        return monitor->getTemperatureStats(ComponentType::PAYLOAD, std::chrono::hours(1)).count;
+    };
+    const uint32_t before = samples();
+    EXPECT_TRUE(waitFor([&] { return samples() > before + 5; }));
+
+    ComponentHealth health = monitor->getComponentHealth("payload");
+    EXPECT_EQ(health.status, HealthStatus::CRITICAL);
+    EXPECT_EQ(health.diagnostic_info, "Temperature critically high");
+    EXPECT_EQ(monitor->getAllComponentHealth().size(), 1u);
+    EXPECT_GT(monitor->getTemperature(ComponentType::PAYLOAD).temperature_celsius, 80.0f);
+
+    release.set_value();
+    monitor->stop();
+    EXPECT_EQ(calls.load(), 1);
+}
+
+// Auto-recovery from an alert runs inside the pass without deadlocking
+TEST(HealthMonitorTest, AlertTriggersRecovery) {
+    auto monitor = createHealthMonitor();
+    monitor->initialize(5);
+    ASSERT_TRUE(monitor->registerComponent("radio", ComponentType::COMMUNICATION_SYSTEM));
+    ASSERT_TRUE(monitor->registerTemperatureSensor("radio_temp", ComponentType::COMMUNICATION_SYSTEM, 70.0f));
+    monitor->configureAlert({ComponentType::COMMUNICATION_SYSTEM, HealthStatus::WARNING, false, true, 0});
+
+    ASSERT_TRUE(monitor->start());
+    ASSERT_TRUE(waitFor([&] {
+        return monitor->getComponentHealth("radio").diagnostic_info == "Recovery procedure initiated";
+    }));
+    monitor->stop();
+    EXPECT_FALSE(monitor->initiateRecovery("unknown"));
+}
+
+// An immediate check wakes a monitor whose next regular sample is far off
+TEST(HealthMonitorTest, ImmediateCheckWakesMonitor) {
+    auto monitor = createHealthMonitor();
+    monitor->initialize(60000);
+    ASSERT_TRUE(monitor->registerTemperatureSensor("obc_temp", ComponentType::PROCESSOR, 25.0f));
+    ASSERT_TRUE(monitor->start());
+
+    // Initial reading plus the first scheduled sample
+    auto samples = [&] {
+        return monitor->getTemperatureStats(ComponentType::PROCESSOR, std::chrono::hours(1)).count;
+    };
+    ASSERT_TRUE(waitFor([&] { return samples() == 2; }));
+    const uint32_t dose_samples = monitor->getDoseRateStats(std::chrono::hours(1)).count;
+
+    monitor->requestImmediateCheck(ComponentType::PROCESSOR);
+    EXPECT_TRUE(waitFor([&] { return samples() == 3; }, std::chrono::milliseconds(500)));
+    EXPECT_EQ(monitor->getDoseRateStats(std::chrono::hours(1)).count, dose_samples + 1);
+    monitor->stop();
+}
+
+// Excursions sample fast, and settled components drop to the quiet rate
+TEST(HealthMonitorTest, SamplingAdaptsToConditions) {
+    auto monitor = createHealthMonitor();
+    monitor->initialize(20);
+    ASSERT_TRUE(monitor->registerTemperatureSensor("radio_temp", ComponentType::COMMUNICATION_SYSTEM, 70.0f));
+    ASSERT_TRUE(monitor->registerTemperatureSensor("eps_temp", ComponentType::POWER_SYSTEM, 20.0f));
+
+    SamplingPolicy policy;
+    policy.nominal_interval = std::chrono::milliseconds(20);
+    policy.fast_interval = std::chrono::milliseconds(5);
+    policy.quiet_interval = std::chrono::milliseconds(80);
+    policy.quiet_after_samples = 3;
+    monitor->setSamplingPolicy(ComponentType::COMMUNICATION_SYSTEM, policy);
+    monitor->setSamplingPolicy(ComponentType::POWER_SYSTEM, policy);
+    EXPECT_EQ(monitor->currentSamplingInterval(ComponentType::POWER_SYSTEM), std::chrono::milliseconds(20));
+
+    ASSERT_TRUE(monitor->start());
+    EXPECT_TRUE(waitFor([&] {
+        return monitor->currentSamplingInterval(ComponentType::COMMUNICATION_SYSTEM) ==
+               std::chrono::milliseconds(5);
+    }));
+    EXPECT_TRUE(waitFor([&] {
+        return monitor->currentSamplingInterval(ComponentType::POWER_SYSTEM) ==
+               std::chrono::milliseconds(80);
+    }));
+
+    // Over the same span the hot radio is sampled far more often
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    monitor->stop();
+    const auto window = std::chrono::milliseconds(150);
+    EXPECT_GT(monitor->getTemperatureStats(ComponentType::COMMUNICATION_SYSTEM, window).count,
+              2 * monitor->getTemperatureStats(ComponentType::POWER_SYSTEM, window).count);
+}
+
+// Downlink reports carry the snapshot in registration order and become
+// deltas once the ground acknowledges one
+TEST(HealthMonitorTest, EncodesSnapshotForDownlink) {
+    auto monitor = createHealthMonitor();
+    ASSERT_TRUE(monitor->registerComponent("eps", ComponentType::POWER_SYSTEM));
+    ASSERT_TRUE(monitor->registerComponent("obc", ComponentType::PROCESSOR));
+    ASSERT_TRUE(monitor->registerTemperatureSensor("obc_temp", ComponentType::PROCESSOR, 31.5f));
+
+    const HealthSnapshot snapshot = monitor->getHealthSnapshot();
+    ASSERT_EQ(snapshot.components.size(), 2u);
+    EXPECT_EQ(snapshot.components[1].component_id, "obc");
+    ASSERT_EQ(snapshot.temperatures.size(), 1u);
+    EXPECT_FLOAT_EQ(snapshot.temperatures[0].temperature_celsius, 31.5f);
+
+    std::array<uint8_t, HealthReportEncoder::kMaxFrameBytes> frame;
+    HealthReportDecoder decoder;
+    DecodedHealthReport report;
+    size_t size = monitor->encodeHealthReport(frame.data(), frame.size());
+    ASSERT_TRUE(decoder.decode(frame.data(), size, report));
+    EXPECT_FALSE(report.delta);
+    ASSERT_EQ(report.status.size(), 2u);
+    EXPECT_EQ(report.status[0], HealthStatus::NOMINAL);
+    EXPECT_FLOAT_EQ(report.health_percentage[1], 100.0f);
+    EXPECT_FLOAT_EQ(report.temperature_celsius[0], 31.5f);
+
+    ASSERT_TRUE(monitor->acknowledgeHealthReport(report.sequence));
+    const size_t delta_size = monitor->encodeHealthReport(frame.data(), frame.size());
+    ASSERT_TRUE(decoder.decode(frame.data(), delta_size, report));
+    EXPECT_TRUE(report.delta);
+    EXPECT_LT(delta_size, size);
+
+    EXPECT_TRUE(monitor->reportToGround(true));
+}
@@ -0,0 +1,169 @@
+/**
+ * @file health_report_codec_test.cpp
+ * @brief Unit tests for the binary health report encoder and decoder
+ */
+
+#include "skymesh/core/health_report_codec.h"
+
+#include <gtest/gtest.h>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+using namespace skymesh::core;
+
+namespace {
+
+HealthSnapshot makeSnapshot(size_t components, size_t sensors) {
+    HealthSnapshot snapshot;
+    snapshot.timestamp = std::chrono::system_clock::time_point(std::chrono::seconds(1700000000));
+    snapshot.radiation = {12.34f, 1.5f, 3, snapshot.timestamp};
+    for (size_t i = 0; i < components; ++i) {
+        ComponentHealth health;
+        health.type = static_cast<ComponentType>(i % 9);
+        health.component_id = "component_" + std::to_string(i);
+        health.status = static_cast<HealthStatus>(i % 6);
+        health.health_percentage = 100.0f - static_cast<float>(i);
+        snapshot.components.push_back(health);
+    }
+    for (size_t i = 0; i < sensors; ++i) {
+        TemperatureData data;
+        data.temperature_celsius = -40.0f + 1.25f * static_cast<float>(i);
+        data.component = static_cast<ComponentType>(i % 9);
+        data.sensor_id = "sensor_" + std::to_string(i);
+        data.timestamp = snapshot.timestamp;
+        snapshot.temperatures.push_back(data);
+    }
+    return snapshot;
+}
+
+void expectMatches(const DecodedHealthReport& report, const HealthSnapshot& snapshot) {
+    EXPECT_EQ(report.timestamp, snapshot.timestamp);
+    EXPECT_NEAR(report.total_dose, snapshot.radiation.total_dose, 0.005f);
+    EXPECT_NEAR(report.dose_rate, snapshot.radiation.dose_rate, 0.05f);
+    EXPECT_EQ(report.single_event_upsets, static_cast<uint32_t>(snapshot.radiation.single_event_upsets));
+    ASSERT_EQ(report.status.size(), snapshot.components.size());
+    for (size_t i = 0; i < snapshot.components.size(); ++i) {
+        EXPECT_EQ(report.status[i], snapshot.components[i].status);
+        EXPECT_NEAR(report.health_percentage[i], snapshot.components[i].health_percentage, 0.25f);
+    }
+    ASSERT_EQ(report.temperature_celsius.size(), snapshot.temperatures.size());
+    for (size_t i = 0; i < snapshot.temperatures.size(); ++i) {
+        EXPECT_NEAR(report.temperature_celsius[i], snapshot.temperatures[i].temperature_celsius, 0.005f);
+    }
+}
+
+} // anonymous namespace
+
+// A full report of the largest schema fits one RF frame and round-trips
+TEST(HealthReportCodecTest, FullReportFitsOneFrame) {
+    const HealthSnapshot snapshot = makeSnapshot(QuantizedHealthReport::kMaxComponents,
+                                                 QuantizedHealthReport::kMaxSensors);
+    HealthReportEncoder encoder;
+    std::array<uint8_t, HealthReportEncoder::kMaxFrameBytes> frame;
+    const size_t size = encoder.encode(snapshot, frame.data(), frame.size());
+    ASSERT_GT(size, 0u);
+    EXPECT_LE(size, HealthReportEncoder::kMaxFrameBytes);
+
+    HealthReportDecoder decoder;
+    DecodedHealthReport report;
+    ASSERT_TRUE(decoder.decode(frame.data(), size, report));
+    EXPECT_EQ(report.sequence, 0);
+    EXPECT_FALSE(report.delta);
+    expectMatches(report, snapshot);
+
+    // Too small a buffer is refused rather than truncated
+    EXPECT_EQ(encoder.encode(snapshot, frame.data(), size - 1), 0u);
+    EXPECT_FALSE(decoder.decode(frame.data(), size - 1, report));
+}
+
+// After an acknowledgement, reports are deltas that decode to the same data
+TEST(HealthReportCodecTest, DeltaAgainstAcknowledgedReport) {
+    HealthSnapshot snapshot = makeSnapshot(16, 8);
+    HealthReportEncoder encoder;
+    HealthReportDecoder decoder;
+    DecodedHealthReport report;
+    std::array<uint8_t, HealthReportEncoder::kMaxFrameBytes> frame;
+
+    const size_t full_size = encoder.encode(snapshot, frame.data(), frame.size());
+    ASSERT_TRUE(decoder.decode(frame.data(), full_size, report));
+
+    // Without an acknowledgement the next report is full again
+    size_t size = encoder.encode(snapshot, frame.data(), frame.size());
+    ASSERT_TRUE(decoder.decode(frame.data(), size, report));
+    EXPECT_FALSE(report.delta);
+    EXPECT_EQ(report.sequence, 1);
+
+    ASSERT_TRUE(encoder.acknowledge(1));
+    EXPECT_FALSE(encoder.acknowledge(7));
+
+    // Nothing changed: a header-only delta
+    size = encoder.encode(snapshot, frame.data(), frame.size());
+    EXPECT_LT(size, 16u);
+    ASSERT_TRUE(decoder.decode(frame.data(), size, report));
+    EXPECT_TRUE(report.delta);
+    expectMatches(report, snapshot);
+
+    // A few changes stay far below a full report
+    snapshot.radiation.total_dose += 0.5f;
+    snapshot.components[3].status = HealthStatus::CRITICAL;
+    snapshot.components[3].health_percentage = 20.0f;
+    snapshot.components[12].health_percentage = 90.5f;
+    snapshot.temperatures[5].temperature_celsius = 71.5f;
+    snapshot.timestamp += std::chrono::seconds(30);
+    size = encoder.encode(snapshot, frame.data(), frame.size());
+    EXPECT_LT(size, full_size / 2);
+    ASSERT_TRUE(decoder.decode(frame.data(), size, report));
+    EXPECT_TRUE(report.delta);
+    expectMatches(report, snapshot);
+
+    // Forcing a full report still works
+    size = encoder.encode(snapshot, frame.data(), frame.size(), true);
+    EXPECT_EQ(size, full_size);
+    ASSERT_TRUE(decoder.decode(frame.data(), size, report));
+    EXPECT_FALSE(report.delta);
+    expectMatches(report, snapshot);
+}
+
+// Schema changes and unknown bases fall back to or fail safely
+TEST(HealthReportCodecTest, FallsBackWhenDeltaIsUnusable) {
+    HealthSnapshot snapshot = makeSnapshot(8, 4);
+    HealthReportEncoder encoder;
+    std::array<uint8_t, HealthReportEncoder::kMaxFrameBytes> frame;
+
+    encoder.encode(snapshot, frame.data(), frame.size());
+    ASSERT_TRUE(encoder.acknowledge(0));
+
+    // A decoder that missed the base cannot decode the delta
+    size_t size = encoder.encode(snapshot, frame.data(), frame.size());
+    uint16_t sequence = 0;
+    bool delta = false;
+    ASSERT_TRUE(HealthReportDecoder::readHeader(frame.data(), size, sequence, delta));
+    EXPECT_TRUE(delta);
+    EXPECT_EQ(sequence, 1);
+    HealthReportDecoder late_decoder;
+    DecodedHealthReport report;
+    EXPECT_FALSE(late_decoder.decode(frame.data(), size, report));
+
+    // A newly registered component forces a full report
+    snapshot.components.push_back(snapshot.components.front());
+    size = encoder.encode(snapshot, frame.data(), frame.size());
+    ASSERT_TRUE(late_decoder.decode(frame.data(), size, report));
+    EXPECT_FALSE(report.delta);
+    expectMatches(report, snapshot);
+
+    // Out-of-range values saturate instead of wrapping
+    snapshot.temperatures[0].temperature_celsius = 1000.0f;
+    snapshot.radiation.dose_rate = -1.0f;
+    snapshot.components[0].health_percentage = 150.0f;
+    size = encoder.encode(snapshot, frame.data(), frame.size());
+    ASSERT_TRUE(late_decoder.decode(frame.data(), size, report));
+    EXPECT_NEAR(report.temperature_celsius[0], 327.67f, 0.005f);
+    EXPECT_FLOAT_EQ(report.dose_rate, 0.0f);
+    EXPECT_FLOAT_EQ(report.health_percentage[0], 100.0f);
+
+    // Too many components for the schema
+    EXPECT_EQ(encoder.encode(makeSnapshot(QuantizedHealthReport::kMaxComponents + 1, 0),
+                             frame.data(), frame.size()), 0u);
+}
@@ -0,0 +1,128 @@
+/**
+ * @file logger_test.cpp
+ * @brief Unit tests for the asynchronous core logger and its ring buffer
+ */
+
+#include "skymesh/core/logger.h"
+#include "skymesh/core/mpmc_ring.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace skymesh::core;
+
+// Arguments are encoded at the call site and formatted by the drain thread
+TEST(LoggerTest, FormatsDeferredArguments) {
+    std::ostringstream out;
+    std::ostringstream err;
+
+    Logger logger(16);
+    logger.setStreams(out, err);
+    logger.start();
+
+    std::string task_name = "Downlink";
+    logger.log(LogLevel::INFO, "test", "Task ", task_name, " took ", 42, " ms, ok=", true);
+    task_name = "overwritten";
+    logger.log(LogLevel::ERROR, "test", "Failure code ", -7);
+    logger.flush();
+
+    EXPECT_NE(out.str().find("[INFO] test: Task Downlink took 42 ms, ok=true\n"), std::string::npos);
+    EXPECT_NE(err.str().find("[ERROR] test: Failure code -7\n"), std::string::npos);
+    EXPECT_EQ(out.str().find("overwritten"), std::string::npos);
+
+    logger.stop();
+}
+
+// A full ring drops and counts messages instead of blocking the producer
+TEST(LoggerTest, DropsAndCountsWhenRingIsFull) {
+    std::ostringstream out;
+    std::ostringstream err;
+
+    Logger logger(4);
+    logger.setStreams(out, err);
+
+    // Not started: nothing drains, so the fifth message onwards is dropped
+    for (int i = 0; i < 10; ++i) {
+        logger.log(LogLevel::WARNING, "test", "message ", i);
+    }
+    EXPECT_EQ(logger.droppedCount(), 6u);
+
+    logger.flush();
+    EXPECT_NE(out.str().find("message 3\n"), std::string::npos);
+    EXPECT_EQ(out.str().find("message 4\n"), std::string::npos);
+    EXPECT_NE(err.str().find("6 messages dropped"), std::string::npos);
+}
+
+// Oversized messages are cut at the record size and marked
+TEST(LoggerTest, TruncatesOversizedMessages) {
+    std::ostringstream out;
+    std::ostringstream err;
+
+    Logger logger(4);
+    logger.setStreams(out, err);
+    logger.log(LogLevel::INFO, "test", std::string(2000, 'x'));
+    logger.flush();
+
+    EXPECT_NE(out.str().find("[truncated]"), std::string::npos);
+    EXPECT_LT(out.str().size(), 1000u);
+}
+
+// Disabled levels are removed at compile time, arguments included
+TEST(LoggerTest, DisabledLevelsDoNotEvaluateArguments) {
+    int evaluations = 0;
+    auto expensive = [&evaluations] {
+        evaluations++;
+        return 1;
+    };
+
+    SKYMESH_LOG_AT(static_cast<LogLevel>(SKYMESH_LOG_LEVEL - 1), "test", "value ", expensive());
+    EXPECT_EQ(evaluations, 0);
+}
+
+// Every pushed element is popped exactly once under concurrent producers
+TEST(BoundedMpmcRingTest, ConcurrentProducersLoseNothing) {
+    BoundedMpmcRing<uint64_t> ring(1024);
+    constexpr int kProducers = 4;
+    constexpr uint64_t kPerProducer = 20000;
+
+    std::atomic<bool> done{false};
+    std::vector<uint64_t> seen(kProducers * kPerProducer, 0);
+
+    std::thread consumer([&] {
+        uint64_t value = 0;
+        for (;;) {
+            if (ring.tryPop(value)) {
+                seen[value]++;
+            } else if (done) {
+                if (!ring.tryPop(value)) {
+                    break;
+                }
+                seen[value]++;
+            }
+        }
+    });
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&ring, p] {
+            for (uint64_t i = 0; i < kPerProducer; ++i) {
+                while (!ring.tryPush(p * kPerProducer + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    done = true;
+    consumer.join();
+
+    for (uint64_t count : seen) {
+        ASSERT_EQ(count, 1u);
+    }
+}
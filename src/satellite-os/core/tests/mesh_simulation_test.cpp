@@ -0,0 +1,158 @@
+/**
+ * @file mesh_simulation_test.cpp
+ * @brief Unit tests for the multi-satellite mesh simulation
+ */
+
+#include "skymesh/core/mesh_simulation.h"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <vector>
+
+using namespace skymesh::core;
+using namespace std::chrono_literals;
+
+namespace {
+
+CommandKey meshKey() {
+    CommandKey key{};
+    for (size_t i = 0; i < key.size(); ++i) {
+        key[i] = static_cast<uint8_t>(0x30 + i);
+    }
+    return key;
+}
+
+MeshSimulationConfig smallMesh(size_t satellites) {
+    MeshSimulationConfig config;
+    config.satellites = satellites;
+    config.seed = 11;
+    config.mesh_key = meshKey();
+    return config;
+}
+
+} // anonymous namespace
+
+TEST(MeshSimulationTest, TreeTopologyRoutesTowardRoot) {
+    MeshSimulation mesh(smallMesh(13));
+    mesh.connectTree(3);
+    EXPECT_EQ(mesh.hopsToRoot(0), 0u);
+    EXPECT_EQ(mesh.hopsToRoot(3), 1u);
+    EXPECT_EQ(mesh.hopsToRoot(4), 2u);
+    EXPECT_EQ(mesh.hopsToRoot(12), 2u);
+    EXPECT_FALSE(mesh.link(0, 1)) << "Already linked";
+    EXPECT_FALSE(mesh.link(2, 2));
+    EXPECT_FALSE(mesh.link(0, 13));
+}
+
+TEST(MeshSimulationTest, BroadcastFloodsEverySatelliteOnce) {
+    MeshSimulation mesh(smallMesh(40));
+    mesh.connectTree(3);
+    mesh.connectRing();
+    ASSERT_TRUE(mesh.start());
+
+    const uint32_t id = mesh.broadcastCommand({0xAA, 0xBB});
+    ASSERT_NE(id, 0u);
+    mesh.run(5s);
+
+    const BroadcastCoverage coverage = mesh.coverage(id);
+    EXPECT_EQ(coverage.reached, 40u);
+    EXPECT_GT(coverage.max_latency, 0ns);
+    EXPECT_LT(coverage.max_latency, 1s);
+
+    const MeshSimulationStats stats = mesh.stats();
+    EXPECT_EQ(stats.broadcasts_executed, 40u);
+    EXPECT_EQ(stats.commands_rejected, 0u);
+    EXPECT_GT(stats.commands_accepted, 40u) << "Every satellite also hears duplicates";
+    EXPECT_EQ(stats.simulated_time, 5s);
+}
+
+TEST(MeshSimulationTest, CorruptedPeerCommandsAreRejected) {
+    MeshSimulationConfig config = smallMesh(20);
+    config.link.corruption_probability = 0.5;
+    config.telemetry_interval = 0ms;
+    MeshSimulation mesh(config);
+    mesh.connectRing();
+    ASSERT_TRUE(mesh.start());
+
+    const uint32_t id = mesh.broadcastCommand({1, 2, 3, 4});
+    mesh.run(5s);
+
+    const MeshSimulationStats stats = mesh.stats();
+    EXPECT_GT(stats.frames_corrupted, 0u);
+    EXPECT_GT(stats.commands_rejected, 0u);
+    // Every corrupted frame fails decoding, the checksum or the signature
+    EXPECT_EQ(stats.broadcasts_executed, mesh.coverage(id).reached);
+    EXPECT_EQ(stats.commands_accepted + stats.commands_rejected, stats.frames_delivered + 1);
+}
+
+TEST(MeshSimulationTest, LossyLinksStillCoverRedundantMesh) {
+    MeshSimulationConfig config = smallMesh(30);
+    config.link.loss_probability = 0.1;
+    MeshSimulation mesh(config);
+    mesh.connectTree(2);
+    mesh.connectRing();
+    ASSERT_TRUE(mesh.start());
+
+    const uint32_t id = mesh.broadcastCommand({});
+    mesh.run(5s);
+
+    EXPECT_GT(mesh.stats().frames_lost, 0u);
+    EXPECT_GE(mesh.coverage(id).reached, 25u);
+}
+
+TEST(MeshSimulationTest, TelemetryStreamsToRootWithBackpressure) {
+    MeshSimulationConfig config = smallMesh(15);
+    config.telemetry_interval = 1s;
+    config.link.bit_rate = 64.0e3;
+    config.link.queue_limit = 4;
+    MeshSimulation mesh(config);
+    mesh.connectTree(2);
+    ASSERT_TRUE(mesh.start());
+
+    mesh.run(2min);
+
+    const MeshSimulationStats stats = mesh.stats();
+    EXPECT_GT(stats.telemetry_frames, 15u * 4u);
+    EXPECT_GT(stats.telemetry_bytes, stats.telemetry_frames * 20u);
+    EXPECT_GT(stats.queue_drops, 0u) << "A slow tree cannot carry every relayed frame";
+}
+
+TEST(MeshSimulationTest, SameSeedReplaysSameRun) {
+    auto runOnce = [] {
+        MeshSimulationConfig config = smallMesh(25);
+        config.link.loss_probability = 0.2;
+        config.link.corruption_probability = 0.05;
+        MeshSimulation mesh(config);
+        mesh.connectTree(4);
+        mesh.connectRing();
+        mesh.start();
+        const uint32_t id = mesh.broadcastCommand({9});
+        mesh.run(30s);
+        return std::make_pair(mesh.stats(), mesh.coverage(id));
+    };
+
+    const auto first = runOnce();
+    const auto second = runOnce();
+    EXPECT_EQ(first.first.frames_sent, second.first.frames_sent);
+    EXPECT_EQ(first.first.frames_lost, second.first.frames_lost);
+    EXPECT_EQ(first.first.commands_rejected, second.first.commands_rejected);
+    EXPECT_EQ(first.first.telemetry_frames, second.first.telemetry_frames);
+    EXPECT_EQ(first.second.reached, second.second.reached);
+    EXPECT_EQ(first.second.max_latency, second.second.max_latency);
+}
+
+TEST(MeshSimulationTest, HundredsOfSatellitesRunFasterThanRealTime) {
+    MeshSimulationConfig config = smallMesh(200);
+    MeshSimulation mesh(config);
+    mesh.connectTree(4);
+    ASSERT_TRUE(mesh.start());
+
+    const auto wall_start = std::chrono::steady_clock::now();
+    const uint32_t id = mesh.broadcastCommand({});
+    mesh.run(60s);
+    const auto wall = std::chrono::steady_clock::now() - wall_start;
+
+    EXPECT_EQ(mesh.coverage(id).reached, 200u);
+    EXPECT_LT(wall, 60s);
+    EXPECT_GT(mesh.executor().executed(), 200u * 60u);
+}
@@ -0,0 +1,202 @@
+/**
+ * @file metrics_test.cpp
+ * @brief Unit tests for the metrics registry, histograms and snapshot codec
+ */
+
+#include "skymesh/core/metrics.h"
+#include "skymesh/core/orbital_task_manager.h"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace skymesh::core;
+using namespace std::chrono_literals;
+
+// Every value lands in a bucket that contains it, within 12.5 % of its bounds
+TEST(MetricsTest, HistogramBucketsBoundRelativeError) {
+    for (uint64_t value : {0ull, 1ull, 7ull, 8ull, 9ull, 15ull, 16ull, 1000ull, 123456789ull, (1ull << 40) + 5}) {
+        const size_t index = LatencyHistogram::bucketIndex(value);
+        const uint64_t lower = LatencyHistogram::bucketLowerBound(index);
+        const uint64_t upper = LatencyHistogram::bucketUpperBound(index);
+        EXPECT_LE(lower, value);
+        EXPECT_GE(upper, value);
+        EXPECT_LE(static_cast<double>(upper - lower), 0.125 * static_cast<double>(lower) + 1.0) << value;
+    }
+
+    // Buckets are contiguous and ordered
+    for (size_t i = 1; i + 1 < LatencyHistogram::kBucketCount; ++i) {
+        EXPECT_EQ(LatencyHistogram::bucketLowerBound(i), LatencyHistogram::bucketUpperBound(i - 1) + 1);
+        EXPECT_EQ(LatencyHistogram::bucketIndex(LatencyHistogram::bucketLowerBound(i)), i);
+    }
+    EXPECT_EQ(LatencyHistogram::bucketIndex(UINT64_MAX), LatencyHistogram::kBucketCount - 1);
+}
+
+TEST(MetricsTest, HistogramQuantiles) {
+    LatencyHistogram histogram;
+    for (uint64_t v = 1; v <= 1000; ++v) {
+        histogram.record(v * 1000);
+    }
+    const HistogramSnapshot snapshot = histogram.snapshot();
+    EXPECT_EQ(snapshot.count, 1000u);
+    EXPECT_EQ(snapshot.max, 1000000u);
+    EXPECT_DOUBLE_EQ(snapshot.mean(), 500500.0);
+
+    const uint64_t median = snapshot.quantile(0.5);
+    EXPECT_GE(median, 500000u);
+    EXPECT_LE(median, 500000u * 9 / 8);
+    const uint64_t p99 = snapshot.quantile(0.99);
+    EXPECT_GE(p99, 990000u);
+    EXPECT_LE(p99, 1000000u);
+    EXPECT_EQ(snapshot.quantile(1.0), 1000000u);
+
+    histogram.reset();
+    EXPECT_EQ(histogram.snapshot().count, 0u);
+    EXPECT_EQ(histogram.snapshot().quantile(0.5), 0u);
+}
+
+// Adds from many threads all land, whatever shard they hit
+TEST(MetricsTest, ShardedCounterSumsAcrossThreads) {
+    MetricsRegistry registry;
+    MetricCounter& counter = registry.counter("test.events");
+    LatencyHistogram& histogram = registry.histogram("test.values");
+    EXPECT_EQ(&counter, &registry.counter("test.events"));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 12; ++t) {
+        threads.emplace_back([&counter, &histogram] {
+            for (int i = 0; i < 10000; ++i) {
+                counter.add();
+                histogram.record(static_cast<uint64_t>(i));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(counter.value(), 120000u);
+    EXPECT_EQ(histogram.snapshot().count, 120000u);
+    EXPECT_EQ(histogram.snapshot().max, 9999u);
+
+    registry.reset();
+    EXPECT_EQ(counter.value(), 0u);
+}
+
+TEST(MetricsTest, SnapshotRoundTrip) {
+    MetricsRegistry registry;
+    registry.counter("test.frames").add(42);
+    registry.counter("test.big").add(1ull << 50);
+    LatencyHistogram& histogram = registry.histogram("test.latency_ns");
+    for (uint64_t v : {3ull, 300ull, 30000ull, 3000000ull}) {
+        histogram.record(v);
+    }
+
+    const std::vector<uint8_t> encoded = registry.encodeSnapshot();
+    MetricsSnapshot decoded;
+    ASSERT_TRUE(decodeMetricsSnapshot(encoded.data(), encoded.size(), decoded));
+    EXPECT_EQ(decoded.counter("test.frames"), 42u);
+    EXPECT_EQ(decoded.counter("test.big"), 1ull << 50);
+    EXPECT_EQ(decoded.counter("test.missing"), 0u);
+    const HistogramSnapshot* latency = decoded.histogram("test.latency_ns");
+    ASSERT_NE(latency, nullptr);
+    EXPECT_EQ(latency->count, 4u);
+    EXPECT_EQ(latency->sum, 3030303u);
+    EXPECT_EQ(latency->max, 3000000u);
+    EXPECT_EQ(latency->buckets, histogram.snapshot().buckets);
+
+    // The buffer form fails cleanly when too small, and truncation is caught
+    std::vector<uint8_t> buffer(encoded.size());
+    EXPECT_EQ(registry.encodeSnapshot(buffer.data(), buffer.size()), encoded.size());
+    EXPECT_EQ(registry.encodeSnapshot(buffer.data(), buffer.size() - 1), 0u);
+    EXPECT_FALSE(decodeMetricsSnapshot(encoded.data(), encoded.size() - 1, decoded));
+}
+
+// Contended acquisitions are timed, uncontended ones are not
+TEST(MetricsTest, InstrumentedLockRecordsContention) {
+    std::mutex mutex;
+    LatencyHistogram waits;
+    {
+        auto lock = lockInstrumented(mutex, waits);
+        EXPECT_TRUE(lock.owns_lock());
+    }
+    EXPECT_EQ(waits.snapshot().count, 0u);
+
+    std::unique_lock<std::mutex> held(mutex);
+    std::thread waiter([&mutex, &waits] {
+        auto lock = lockInstrumented(mutex, waits);
+    });
+    std::this_thread::sleep_for(20ms);
+    held.unlock();
+    waiter.join();
+
+    const HistogramSnapshot snapshot = waits.snapshot();
+    EXPECT_EQ(snapshot.count, 1u);
+    EXPECT_GE(snapshot.max, 10000000u);
+}
+
+TEST(MetricsTest, TraceSpanTimesScope) {
+    const HistogramSnapshot before = MetricsRegistry::instance().histogram("test.span_ns").snapshot();
+    for (int i = 0; i < 3; ++i) {
+        SKYMESH_TRACE_SPAN("test.span_ns");
+        std::this_thread::sleep_for(1ms);
+    }
+    const HistogramSnapshot after = MetricsRegistry::instance().histogram("test.span_ns").snapshot();
+#if SKYMESH_ENABLE_TRACING
+    EXPECT_EQ(after.count - before.count, 3u);
+    EXPECT_GE(after.max, 1000000u);
+#else
+    EXPECT_EQ(after.count, before.count);
+#endif
+}
+
+// The task manager reports runtime per type and its counters to the registry
+TEST(MetricsTest, TaskManagerPopulatesRegistry) {
+    MetricsRegistry& registry = MetricsRegistry::instance();
+    const uint64_t executed = registry.counter("task.executed").value();
+    const uint64_t runs = registry.histogram("task.runtime_ns.telemetry").snapshot().count;
+
+    std::unique_ptr<OrbitalTaskManager> manager = createOrbitalTaskManager();
+    ASSERT_TRUE(manager->start());
+    std::mutex mutex;
+    std::condition_variable done;
+    int completed = 0;
+    for (int i = 0; i < 4; ++i) {
+        OrbitalTask task;
+        task.name = "metrics_" + std::to_string(i);
+        task.type = TaskType::TELEMETRY;
+        task.priority = TaskPriority::NORMAL;
+        task.scheduled_time = std::chrono::system_clock::now();
+        task.timeout = 5000ms;
+        task.recovery_strategy = RecoveryStrategy::RETRY;
+        task.radiation_protected = false;
+        task.retry_count = 0;
+        task.task_function = [&](const TaskContext&) {
+            std::this_thread::sleep_for(1ms);
+            std::lock_guard<std::mutex> lock(mutex);
+            ++completed;
+            done.notify_all();
+            return true;
+        };
+        ASSERT_FALSE(manager->scheduleTask(task).empty());
+    }
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(done.wait_for(lock, 5s, [&] { return completed == 4; }));
+    }
+    // Runtime is recorded just after the task function returns
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (registry.counter("task.executed").value() - executed < 4 &&
+           std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(5ms);
+    }
+    manager->stop();
+
+    EXPECT_GE(registry.counter("task.executed").value() - executed, 4u);
+    const HistogramSnapshot runtime = registry.histogram("task.runtime_ns.telemetry").snapshot();
+    EXPECT_EQ(runtime.count - runs, 4u);
+    EXPECT_GE(runtime.max, 1000000u);
+    EXPECT_GE(registry.histogram("task.dispatch_latency_ns").snapshot().count, 4u);
+}
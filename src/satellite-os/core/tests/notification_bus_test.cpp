@@ -0,0 +1,147 @@
+/**
+ * @file notification_bus_test.cpp
+ * @brief Unit tests for the asynchronous notification bus
+ */
+
+#include "skymesh/core/notification_bus.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace skymesh::core;
+
+namespace {
+
+constexpr const char* kTopicName = "notification_bus_test";
+
+} // anonymous namespace
+
+// Events reach matching subscribers, in order, on the delivery thread
+TEST(NotificationBusTest, DeliversFilteredEventsInOrder) {
+    auto bus = std::make_shared<NotificationBus>();
+    NotificationTopic<int, int> topic(kTopicName, bus);
+
+    std::mutex mutex;
+    std::vector<int> received;
+    std::thread::id delivery_thread;
+    topic.subscribe([&](const int& value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        received.push_back(value);
+        delivery_thread = std::this_thread::get_id();
+    }, 1);
+
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_TRUE(topic.publish(i, i % 2 == 0 ? 1 : 2));
+    }
+    ASSERT_TRUE(topic.flush());
+
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_EQ(received, (std::vector<int>{0, 2, 4, 6, 8}));
+    EXPECT_NE(delivery_thread, std::this_thread::get_id());
+    EXPECT_EQ(bus->deliveredCount(), 10u);
+}
+
+// A blocked subscriber holds up neither publishers nor subscription changes
+TEST(NotificationBusTest, SlowSubscriberDoesNotBlockPublishers) {
+    auto bus = std::make_shared<NotificationBus>();
+    NotificationTopic<int, int> topic(kTopicName, bus, 4);
+
+    std::promise<void> entered;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic<int> calls{0};
+    topic.subscribe([&](const int&) {
+        if (calls.fetch_add(1) == 0) {
+            entered.set_value();
+            released.wait();
+        }
+    }, 0);
+
+    topic.publish(0, 0);
+    ASSERT_EQ(entered.get_future().wait_for(std::chrono::seconds(2)), std::future_status::ready);
+
+    // The queue fills and further events are dropped, without blocking
+    int queued = 0;
+    for (int i = 1; i <= 8; ++i) {
+        queued += topic.publish(i, 0) ? 1 : 0;
+    }
+    EXPECT_EQ(queued, 4);
+    EXPECT_EQ(topic.droppedCount(), 4u);
+
+    int late_id = topic.subscribe([](const int&) {}, 0);
+    EXPECT_GE(late_id, 0);
+
+    release.set_value();
+    ASSERT_TRUE(topic.flush());
+    EXPECT_EQ(calls.load(), 5);
+}
+
+// Once unsubscribe returns the callback is neither running nor called again
+TEST(NotificationBusTest, UnsubscribeWaitsForRunningCallback) {
+    auto bus = std::make_shared<NotificationBus>();
+    NotificationTopic<int, int> topic(kTopicName, bus);
+
+    std::atomic<bool> running{false};
+    std::atomic<bool> called_after{false};
+    std::atomic<bool> unsubscribed{false};
+    int id = topic.subscribe([&](const int&) {
+        if (unsubscribed) {
+            called_after = true;
+        }
+        running = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        running = false;
+    }, 0);
+
+    topic.publish(1, 0);
+    while (!running) {
+        std::this_thread::yield();
+    }
+    EXPECT_TRUE(topic.unsubscribe(id));
+    unsubscribed = true;
+    EXPECT_FALSE(running);
+    EXPECT_FALSE(topic.unsubscribe(id));
+
+    topic.publish(2, 0);
+    ASSERT_TRUE(topic.flush());
+    EXPECT_FALSE(called_after);
+}
+
+// Topics of different event types share one delivery thread
+TEST(NotificationBusTest, TopicsShareBus) {
+    auto bus = std::make_shared<NotificationBus>();
+    NotificationTopic<int, int> numbers(kTopicName, bus);
+    auto names = std::make_unique<NotificationTopic<std::string, int>>(kTopicName, bus);
+
+    std::atomic<std::thread::id> number_thread{};
+    std::atomic<std::thread::id> name_thread{};
+    std::string last_name;
+    numbers.subscribe([&](const int&) { number_thread = std::this_thread::get_id(); }, 0);
+    names->subscribe([&](const std::string& name) {
+        name_thread = std::this_thread::get_id();
+        last_name = name;
+    }, 0);
+
+    // Exceptions are contained to the throwing subscriber
+    names->subscribe([](const std::string&) { throw std::runtime_error("subscriber failure"); }, 0);
+
+    numbers.publish(7, 0);
+    names->publish("obc", 0);
+    ASSERT_TRUE(bus->flush());
+    EXPECT_EQ(number_thread.load(), name_thread.load());
+    EXPECT_EQ(last_name, "obc");
+
+    // Remaining topics keep being delivered after one is destroyed
+    names.reset();
+    number_thread = std::thread::id();
+    numbers.publish(8, 0);
+    EXPECT_TRUE(bus->flush());
+    EXPECT_EQ(number_thread.load(), name_thread.load());
+}
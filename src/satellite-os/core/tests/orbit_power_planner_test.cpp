@@ -0,0 +1,116 @@
+/**
+ * @file orbit_power_planner_test.cpp
+ * @brief Unit tests for the orbit power planner
+ */
+
+#include "skymesh/core/orbit_power_planner.h"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+
+using namespace skymesh::core;
+using namespace std::chrono_literals;
+
+namespace {
+
+OrbitalTask makePayloadTask(const std::string& task_id,
+                            std::chrono::system_clock::time_point scheduled_time,
+                            std::chrono::milliseconds duration) {
+    OrbitalTask task{};
+    task.task_id = task_id;
+    task.type = TaskType::PAYLOAD_OPERATION;
+    task.priority = TaskPriority::NORMAL;
+    task.scheduled_time = scheduled_time;
+    task.timeout = duration;
+    return task;
+}
+
+} // anonymous namespace
+
+// Without an orbit profile there is nothing to plan against
+TEST(OrbitPowerPlannerTest, AdmitsEverythingWithoutProfile) {
+    PowerManager power_manager;
+    OrbitPowerPlanner planner(power_manager);
+    const auto now = std::chrono::system_clock::now();
+
+    EXPECT_FALSE(planner.plan(now));
+    EXPECT_TRUE(planner.modeTimeline().empty());
+    EXPECT_TRUE(planner.canAfford(makePayloadTask("big", now, 10h), {now, now + 1min}));
+}
+
+// A draw the panels cannot cover is predicted to cross into LOW_POWER
+TEST(OrbitPowerPlannerTest, PredictsLowPowerFromEclipseDrain) {
+    PowerManager power_manager;
+    ASSERT_TRUE(power_manager.initialize({SubsystemID::OBC}));
+    ASSERT_TRUE(power_manager.enableSubsystem(SubsystemID::OBC, 1.0f));
+    power_manager.updateOrbitPowerProfile(3600, 2100);
+
+    OrbitPowerPlanner planner(power_manager);
+    const auto now = std::chrono::system_clock::now();
+    ASSERT_TRUE(planner.plan(now));
+
+    auto timeline = planner.modeTimeline();
+    ASSERT_GE(timeline.size(), 2u);
+    EXPECT_EQ(PowerMode::NORMAL, timeline[0].mode);
+    EXPECT_EQ(PowerMode::LOW_POWER, timeline[1].mode);
+
+    // 4.5 Wh down to the threshold: 2.1 Wh in the first sunlit hour at a
+    // 2.1 W deficit, 1.75 Wh in 35 minutes of eclipse at 3 W, and the
+    // remaining 0.65 Wh about 19 minutes into the next sunlit pass
+    EXPECT_GT(timeline[1].start, now + 1h + 50min);
+    EXPECT_LT(timeline[1].start, now + 1h + 58min);
+    EXPECT_LE(timeline[1].min_state_of_charge, 0.30f);
+    EXPECT_GT(planner.predictedStateOfCharge(now), planner.predictedStateOfCharge(now + 1h));
+}
+
+// Queued tasks are admitted in order against the charge left by earlier ones
+TEST(OrbitPowerPlannerTest, AdmitsQueuedTasksAgainstReserve) {
+    PowerManager power_manager;
+    ASSERT_TRUE(power_manager.initialize({SubsystemID::SENSORS}));
+    ASSERT_TRUE(power_manager.enableSubsystem(SubsystemID::SENSORS, 0.1f));
+    power_manager.updateOrbitPowerProfile(3600, 2100);
+
+    OrbitPowerPlanner planner(power_manager);
+    const auto now = std::chrono::system_clock::now();
+    planner.addTask(makePayloadTask("short", now + 10min, 10min));
+    planner.addTask(makePayloadTask("long", now + 1h, 40min));
+    ASSERT_TRUE(planner.plan(now));
+
+    auto shortDecision = planner.decisionFor("short");
+    auto longDecision = planner.decisionFor("long");
+    ASSERT_TRUE(shortDecision.has_value());
+    ASSERT_TRUE(longDecision.has_value());
+    EXPECT_TRUE(shortDecision->admitted);
+    EXPECT_FALSE(longDecision->admitted);
+    EXPECT_GE(shortDecision->min_state_of_charge, 0.30f);
+
+    EXPECT_TRUE(planner.canAfford(makePayloadTask("short", now, 10min), {now, now + 20min}));
+    EXPECT_FALSE(planner.canAfford(makePayloadTask("other", now, 40min), {now, now + 3h}));
+    EXPECT_FALSE(planner.canAfford(makePayloadTask("late", now, 1min), {now + 24h, now + 25h}));
+
+    ASSERT_TRUE(planner.removeTask("long"));
+    ASSERT_TRUE(planner.plan(now));
+    EXPECT_FALSE(planner.decisionFor("long").has_value());
+}
+
+// A task waits for the predicted return to NORMAL mode
+TEST(OrbitPowerPlannerTest, FindsStartAfterModeRecovers) {
+    PowerManager power_manager;
+    ASSERT_TRUE(power_manager.initialize({SubsystemID::SENSORS}));
+    ASSERT_TRUE(power_manager.setPowerMode(PowerMode::LOW_POWER));
+    power_manager.updateOrbitPowerProfile(3600, 2100);
+
+    OrbitPlannerConfig config;
+    config.step = 30s;
+    OrbitPowerPlanner planner(power_manager, config);
+    const auto now = std::chrono::system_clock::now();
+    ASSERT_TRUE(planner.plan(now));
+
+    // The battery is above the recovery threshold, so update() returns to
+    // NORMAL on its next tick
+    auto start = planner.findAffordableStart(makePayloadTask("p", now, 1min), {now, now + 5min});
+    ASSERT_TRUE(start.has_value());
+    EXPECT_EQ(now + 30s, *start);
+    EXPECT_EQ(PowerMode::NORMAL, planner.predictedModeAt(now + 1min));
+}
@@ -0,0 +1,112 @@
+/**
+ * @file orbit_trigger_index_test.cpp
+ * @brief Unit tests for the orbit-position trigger grid
+ */
+
+#include "skymesh/core/orbit_trigger_index.h"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+
+using namespace skymesh::core;
+
+namespace {
+
+OrbitPosition makePosition(double latitude, double longitude, double altitude_km = 550.0) {
+    OrbitPosition position{};
+    position.altitude_km = altitude_km;
+    position.latitude = latitude;
+    position.longitude = longitude;
+    position.velocity_kmps = 7.6;
+    return position;
+}
+
+bool contains(const std::vector<uint64_t>& ids, uint64_t id) {
+    return std::find(ids.begin(), ids.end(), id) != ids.end();
+}
+
+} // anonymous namespace
+
+// Points inside the per-trigger box match, points outside do not
+TEST(OrbitTriggerIndexTest, PointMatchUsesPerTriggerTolerance) {
+    OrbitTriggerIndex index;
+    index.insert(1, makePosition(45.0, 90.0), 5.0, 10.0);
+    index.insert(2, makePosition(45.0, 90.0), 0.5, 10.0);
+
+    std::vector<uint64_t> hits;
+    index.queryPoint(makePosition(47.0, 92.0), hits);
+    EXPECT_TRUE(contains(hits, 1));
+    EXPECT_FALSE(contains(hits, 2));
+
+    hits.clear();
+    index.queryPoint(makePosition(45.2, 90.1), hits);
+    EXPECT_TRUE(contains(hits, 1));
+    EXPECT_TRUE(contains(hits, 2));
+
+    // Outside the altitude band
+    hits.clear();
+    index.queryPoint(makePosition(45.0, 90.0, 600.0), hits);
+    EXPECT_TRUE(hits.empty());
+}
+
+// Trigger boxes and ground tracks wrap across the antimeridian
+TEST(OrbitTriggerIndexTest, LongitudeWrapAround) {
+    OrbitTriggerIndex index;
+    index.insert(1, makePosition(0.0, 179.0), 3.0, 10.0);
+
+    std::vector<uint64_t> hits;
+    index.queryPoint(makePosition(0.0, -179.5), hits);
+    EXPECT_TRUE(contains(hits, 1));
+
+    // Crossing from east to west of the antimeridian
+    OrbitTriggerIndex crossing;
+    crossing.insert(7, makePosition(10.0, 180.0), 0.5, 10.0);
+    hits.clear();
+    crossing.querySegment(makePosition(10.0, 175.0), makePosition(10.0, -175.0), hits);
+    EXPECT_TRUE(contains(hits, 7));
+}
+
+// A trigger passed over between two samples is reported
+TEST(OrbitTriggerIndexTest, DetectsCrossingBetweenSamples) {
+    OrbitTriggerIndex index;
+    index.insert(1, makePosition(20.0, 30.0), 0.5, 10.0);
+    index.insert(2, makePosition(25.0, 30.0), 0.5, 10.0);
+
+    // Neither sample is inside either box, but the track passes over trigger 1
+    std::vector<uint64_t> hits;
+    index.querySegment(makePosition(18.0, 28.0), makePosition(22.0, 32.0), hits);
+    EXPECT_TRUE(contains(hits, 1));
+    EXPECT_FALSE(contains(hits, 2));
+
+    // Endpoints alone would miss it
+    hits.clear();
+    index.queryPoint(makePosition(18.0, 28.0), hits);
+    index.queryPoint(makePosition(22.0, 32.0), hits);
+    EXPECT_TRUE(hits.empty());
+}
+
+// Removed triggers never match and many distant triggers are not reported
+TEST(OrbitTriggerIndexTest, RemoveAndSparseMatches) {
+    OrbitTriggerIndex index;
+
+    // Ground-track style grid of windows every 3 degrees
+    uint64_t id = 1;
+    for (int lat = -60; lat <= 60; lat += 3) {
+        for (int lon = -180; lon < 180; lon += 3) {
+            index.insert(id++, makePosition(lat, lon), 1.0, 10.0);
+        }
+    }
+    EXPECT_EQ(index.size(), id - 1);
+
+    std::vector<uint64_t> hits;
+    index.queryPoint(makePosition(0.2, 0.3), hits);
+    ASSERT_EQ(hits.size(), 1u);
+
+    EXPECT_TRUE(index.remove(hits[0]));
+    EXPECT_FALSE(index.remove(hits[0]));
+
+    std::vector<uint64_t> after;
+    index.queryPoint(makePosition(0.2, 0.3), after);
+    EXPECT_TRUE(after.empty());
+}
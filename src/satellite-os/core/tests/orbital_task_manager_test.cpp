@@ -12,6 +12,8 @@
 #include <mutex>
 #include <condition_variable>
 #include <functional>
+#include <algorithm>
+#include <vector>
 
 using namespace skymesh::core;
 using namespace std::chrono_literals;
@@ -164,6 +166,70 @@ TEST_F(OrbitalTaskManagerTest, TripleModularRedundancy) {
     ASSERT_EQ(manager->getTaskStatus(task_id), TaskStatus::COMPLETED);
 }
 
+// Test concurrent and dual + tie-break TMR modes
+TEST_F(OrbitalTaskManagerTest, ConcurrentTmrModes) {
+    // Parallel replicas fit a timeout that even two back-to-back runs would exceed
+    std::atomic<int> parallel_count{0};
+    OrbitalTask parallel = createBasicTask("ParallelTmrTask");
+    parallel.radiation_protected = true;
+    parallel.tmr_mode = TmrMode::PARALLEL;
+    parallel.timeout = std::chrono::milliseconds(150);
+    parallel.retry_count = 0;
+    parallel.task_function = [&parallel_count](const TaskContext&) -> bool {
+        parallel_count++;
+        std::this_thread::sleep_for(100ms);
+        return true;
+    };
+
+    std::string parallel_id = manager->scheduleTask(parallel);
+    ASSERT_TRUE(waitForTaskCompletion(parallel_id));
+    ASSERT_EQ(manager->getTaskStatus(parallel_id), TaskStatus::COMPLETED);
+
+    auto parallel_result = manager->getTaskResult(parallel_id);
+    ASSERT_TRUE(parallel_result.has_value());
+    EXPECT_FALSE(parallel_result->radiation_event_detected);
+
+    // Agreeing dual replicas overlap and skip the tie-break
+    std::atomic<int> dual_count{0};
+    OrbitalTask dual = createBasicTask("DualTmrTask");
+    dual.radiation_protected = true;
+    dual.tmr_mode = TmrMode::DUAL_TIE_BREAK;
+    dual.timeout = std::chrono::milliseconds(150);
+    dual.retry_count = 0;
+    dual.task_function = [&dual_count](const TaskContext&) -> bool {
+        dual_count++;
+        std::this_thread::sleep_for(100ms);
+        return true;
+    };
+
+    std::string dual_id = manager->scheduleTask(dual);
+    ASSERT_TRUE(waitForTaskCompletion(dual_id));
+    ASSERT_EQ(manager->getTaskStatus(dual_id), TaskStatus::COMPLETED);
+    EXPECT_EQ(dual_count, 2);
+
+    // A single upset replica is outvoted and reported on the result
+    std::atomic<int> upset_count{0};
+    OrbitalTask upset = createBasicTask("UpsetTmrTask");
+    upset.radiation_protected = true;
+    upset.tmr_mode = TmrMode::DUAL_TIE_BREAK;
+    upset.task_function = [&upset_count](const TaskContext&) -> bool {
+        return upset_count++ != 0;
+    };
+
+    std::string upset_id = manager->scheduleTask(upset);
+    ASSERT_TRUE(waitForTaskCompletion(upset_id));
+    EXPECT_EQ(upset_count, 3);
+    EXPECT_EQ(manager->getTaskStatus(upset_id), TaskStatus::COMPLETED);
+
+    auto upset_result = manager->getTaskResult(upset_id);
+    ASSERT_TRUE(upset_result.has_value());
+    EXPECT_TRUE(upset_result->radiation_event_detected);
+
+    // Stopping runs any replica still finishing after an early return
+    manager->stop();
+    EXPECT_EQ(parallel_count, 3);
+}
+
 // Test radiation recovery strategies
 TEST_F(OrbitalTaskManagerTest, RadiationRecoveryStrategies) {
     // Create a task that will fail
@@ -253,6 +319,65 @@ TEST_F(OrbitalTaskManagerTest, OrbitalPositionTriggers) {
     ASSERT_EQ(manager->getTaskStatus(task_id), TaskStatus::COMPLETED);
 }
 
+// Test event, dependency and time triggers
+TEST_F(OrbitalTaskManagerTest, EventDependencyAndTimeTriggers) {
+    std::atomic<int> event_runs{0};
+    std::atomic<bool> dependent_executed{false};
+    std::atomic<bool> timed_executed{false};
+    
+    // Event trigger fires only once the event is published
+    OrbitalTask event_task = createBasicTask("EventTriggeredTask");
+    event_task.task_function = [&](const TaskContext&) -> bool {
+        event_runs++;
+        return true;
+    };
+    TriggerCondition event_trigger;
+    event_trigger.event_name = "ground_station_acquired";
+    std::string event_id = manager->scheduleConditionalTask(event_task, event_trigger);
+    ASSERT_FALSE(event_id.empty());
+    
+    EXPECT_EQ(manager->publishEvent("unrelated_event"), 0u);
+    std::this_thread::sleep_for(50ms);
+    EXPECT_EQ(event_runs, 0);
+    
+    EXPECT_EQ(manager->publishEvent("ground_station_acquired"), 1u);
+    ASSERT_TRUE(waitForTaskCompletion(event_id, 1s));
+    EXPECT_EQ(manager->publishEvent("ground_station_acquired"), 0u);
+    EXPECT_EQ(event_runs, 1);
+    
+    // Dependency trigger fires from the completion of the task it waits on
+    OrbitalTask parent = createBasicTask("ParentTask");
+    parent.scheduled_time = std::chrono::system_clock::now() + 100ms;
+    std::string parent_id = manager->scheduleTask(parent);
+    
+    OrbitalTask dependent = createBasicTask("DependentTask");
+    dependent.task_function = [&](const TaskContext&) -> bool {
+        dependent_executed = true;
+        return true;
+    };
+    TriggerCondition dependency_trigger;
+    dependency_trigger.dependency_task_id = parent_id;
+    std::string dependent_id = manager->scheduleConditionalTask(dependent, dependency_trigger);
+    
+    std::this_thread::sleep_for(20ms);
+    EXPECT_FALSE(dependent_executed);
+    ASSERT_TRUE(waitForTaskCompletion(dependent_id, 1s));
+    EXPECT_EQ(manager->getTaskStatus(parent_id), TaskStatus::COMPLETED);
+    
+    // Time trigger waits in the timer queue until its deadline
+    OrbitalTask timed = createBasicTask("TimedTask");
+    auto deadline = std::chrono::system_clock::now() + 100ms;
+    timed.task_function = [&](const TaskContext&) -> bool {
+        timed_executed = std::chrono::system_clock::now() >= deadline;
+        return true;
+    };
+    TriggerCondition time_trigger;
+    time_trigger.time_point = deadline;
+    std::string timed_id = manager->scheduleConditionalTask(timed, time_trigger);
+    ASSERT_TRUE(waitForTaskCompletion(timed_id, 1s));
+    EXPECT_TRUE(timed_executed);
+}
+
 // Test task completion callbacks
 TEST_F(OrbitalTaskManagerTest, TaskCompletionCallbacks) {
     std::atomic<bool> callback_called{false};
@@ -338,6 +463,440 @@ TEST_F(OrbitalTaskManagerTest, RecurringTasks) {
     ASSERT_TRUE(manager->cancelTask(task_id));
 }
 
+// Test that ready tasks are dispatched on time while many future tasks are queued
+TEST_F(OrbitalTaskManagerTest, DispatchJitterWithManyFutureTasks) {
+    // Queue 10k high-priority tasks due in an hour; they must not delay ready work
+    auto far_future = std::chrono::system_clock::now() + 1h;
+    for (int i = 0; i < 10000; ++i) {
+        OrbitalTask future_task = createBasicTask("FutureTask", TaskPriority::CRITICAL);
+        future_task.scheduled_time = far_future + std::chrono::milliseconds(i);
+        ASSERT_FALSE(manager->scheduleTask(future_task).empty());
+    }
+    
+    // Schedule near-future tasks one at a time and record how late each one starts
+    constexpr int kSamples = 50;
+    std::vector<double> lateness_us;
+    lateness_us.reserve(kSamples);
+    
+    for (int i = 0; i < kSamples; ++i) {
+        std::atomic<bool> executed{false};
+        std::chrono::system_clock::time_point started;
+        
+        OrbitalTask task = createBasicTask("JitterProbe", TaskPriority::LOW);
+        task.scheduled_time = std::chrono::system_clock::now() + 5ms;
+        auto scheduled = task.scheduled_time;
+        task.task_function = [&](const TaskContext&) -> bool {
+            started = std::chrono::system_clock::now();
+            executed = true;
+            return true;
+        };
+        
+        std::string task_id = manager->scheduleTask(task);
+        ASSERT_TRUE(waitForTaskCompletion(task_id));
+        ASSERT_TRUE(executed);
+        
+        lateness_us.push_back(
+            std::chrono::duration<double, std::micro>(started - scheduled).count());
+    }
+    
+    std::sort(lateness_us.begin(), lateness_us.end());
+    double median_us = lateness_us[kSamples / 2];
+    double p95_us = lateness_us[(kSamples * 95) / 100];
+    
+    RecordProperty("dispatch_lateness_median_us", std::to_string(median_us));
+    RecordProperty("dispatch_lateness_p95_us", std::to_string(p95_us));
+    
+    // Tasks never start early, and start well within a millisecond of their deadline
+    EXPECT_GE(lateness_us.front(), 0.0);
+    EXPECT_LT(median_us, 1000.0);
+    EXPECT_LT(p95_us, 1000.0);
+}
+
+// Test that reserved workers keep critical work moving past saturated low-priority work
+TEST_F(OrbitalTaskManagerTest, ReservedWorkersAndTypeLimits) {
+    manager->stop();
+    manager = createOrbitalTaskManager();
+    
+    ExecutionPoolConfig config;
+    config.worker_count = 3;
+    config.reserved_workers[TaskPriority::HIGH] = 1;
+    config.max_concurrent_by_type[TaskType::ATTITUDE_CONTROL] = 1;
+    
+    // Reservations must leave a worker for the lowest priorities
+    ExecutionPoolConfig invalid = config;
+    invalid.reserved_workers[TaskPriority::CRITICAL] = 2;
+    EXPECT_FALSE(manager->configureExecutionPool(invalid));
+    ASSERT_TRUE(manager->configureExecutionPool(config));
+    ASSERT_TRUE(manager->start());
+    EXPECT_FALSE(manager->configureExecutionPool(config));
+    
+    std::mutex gate_mutex;
+    std::condition_variable gate_condition;
+    bool gate_open = false;
+    std::atomic<int> blocked_running{0};
+    
+    auto blocking_function = [&](const TaskContext&) -> bool {
+        blocked_running++;
+        std::unique_lock<std::mutex> lock(gate_mutex);
+        gate_condition.wait_for(lock, 4s, [&] { return gate_open; });
+        return true;
+    };
+    
+    // Saturate every unreserved worker with low-priority payload work
+    std::vector<std::string> low_ids;
+    for (int i = 0; i < 3; ++i) {
+        OrbitalTask task = createBasicTask("SlowPayload", TaskPriority::LOW);
+        task.type = TaskType::PAYLOAD_OPERATION;
+        task.task_function = blocking_function;
+        low_ids.push_back(manager->scheduleTask(task));
+    }
+    
+    auto deadline = std::chrono::steady_clock::now() + 2s;
+    while (blocked_running < 2 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(5ms);
+    }
+    ASSERT_EQ(blocked_running, 2);
+    
+    // The third low task must wait; the critical task runs on the reserved worker
+    std::string critical_id = manager->scheduleTask(createBasicTask("Critical", TaskPriority::CRITICAL));
+    ASSERT_TRUE(waitForTaskCompletion(critical_id, 1s));
+    EXPECT_EQ(manager->getTaskStatus(low_ids[2]), TaskStatus::PENDING);
+    
+    {
+        std::lock_guard<std::mutex> lock(gate_mutex);
+        gate_open = true;
+    }
+    gate_condition.notify_all();
+    for (const auto& id : low_ids) {
+        ASSERT_TRUE(waitForTaskCompletion(id));
+    }
+    
+    // Attitude control tasks never overlap, even with idle workers available
+    std::atomic<int> attitude_running{0};
+    std::atomic<int> attitude_peak{0};
+    std::vector<std::string> attitude_ids;
+    for (int i = 0; i < 4; ++i) {
+        OrbitalTask task = createBasicTask("Attitude", TaskPriority::HIGH);
+        task.type = TaskType::ATTITUDE_CONTROL;
+        task.task_function = [&](const TaskContext&) -> bool {
+            int running = ++attitude_running;
+            int peak = attitude_peak;
+            while (running > peak && !attitude_peak.compare_exchange_weak(peak, running)) {
+            }
+            std::this_thread::sleep_for(20ms);
+            attitude_running--;
+            return true;
+        };
+        attitude_ids.push_back(manager->scheduleTask(task));
+    }
+    for (const auto& id : attitude_ids) {
+        ASSERT_TRUE(waitForTaskCompletion(id));
+    }
+    EXPECT_EQ(attitude_peak, 1);
+}
+
+// A pool configuration keeps the actuator limits it does not override
+TEST_F(OrbitalTaskManagerTest, TypeLimitDefaultsSurviveConfiguration) {
+    manager->stop();
+    manager = createOrbitalTaskManager();
+
+    ExecutionPoolConfig config;
+    config.worker_count = 4;
+    config.max_concurrent_by_type[TaskType::ATTITUDE_CONTROL] = 0;
+    ASSERT_TRUE(manager->configureExecutionPool(config));
+    ASSERT_TRUE(manager->start());
+
+    std::atomic<int> maneuver_running{0};
+    std::atomic<int> maneuver_peak{0};
+    std::vector<std::string> ids;
+    for (int i = 0; i < 3; ++i) {
+        OrbitalTask task = createBasicTask("Maneuver", TaskPriority::HIGH);
+        task.type = TaskType::ORBITAL_MANEUVER;
+        task.task_function = [&](const TaskContext&) -> bool {
+            int running = ++maneuver_running;
+            int peak = maneuver_peak;
+            while (running > peak && !maneuver_peak.compare_exchange_weak(peak, running)) {
+            }
+            std::this_thread::sleep_for(20ms);
+            maneuver_running--;
+            return true;
+        };
+        ids.push_back(manager->scheduleTask(task));
+    }
+
+    // An explicit 0 lifts the attitude control default: both run at once
+    std::atomic<int> attitude_running{0};
+    std::atomic<bool> overlapped{false};
+    for (int i = 0; i < 2; ++i) {
+        OrbitalTask task = createBasicTask("Attitude", TaskPriority::HIGH);
+        task.type = TaskType::ATTITUDE_CONTROL;
+        task.task_function = [&](const TaskContext&) -> bool {
+            attitude_running++;
+            auto deadline = std::chrono::steady_clock::now() + 2s;
+            while (attitude_running < 2 && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::sleep_for(1ms);
+            }
+            if (attitude_running == 2) {
+                overlapped = true;
+            }
+            return true;
+        };
+        ids.push_back(manager->scheduleTask(task));
+    }
+
+    for (const auto& id : ids) {
+        ASSERT_TRUE(waitForTaskCompletion(id));
+    }
+    EXPECT_EQ(maneuver_peak, 1);
+    EXPECT_TRUE(overlapped);
+}
+
+// Test batch scheduling and cancellation
+TEST_F(OrbitalTaskManagerTest, BatchScheduleAndCancel) {
+    std::atomic<int> executed{0};
+
+    std::vector<OrbitalTask> batch;
+    for (int i = 0; i < 20; ++i) {
+        OrbitalTask task = createBasicTask("BatchTask");
+        task.task_function = [&executed](const TaskContext&) -> bool {
+            executed++;
+            return true;
+        };
+        batch.push_back(std::move(task));
+    }
+
+    // Invalid limits are rejected individually without failing the batch
+    OrbitalTask invalid = createBasicTask("InvalidBatchTask");
+    invalid.metadata["memory_limit_bytes"] = "lots";
+    batch.push_back(std::move(invalid));
+
+    // Future tasks are canceled before they run
+    for (int i = 0; i < 5; ++i) {
+        OrbitalTask task = createBasicTask("FutureBatchTask");
+        task.scheduled_time = std::chrono::system_clock::now() + 1h;
+        batch.push_back(std::move(task));
+    }
+
+    std::vector<std::string> ids = manager->scheduleTasks(std::move(batch));
+    ASSERT_EQ(ids.size(), 26u);
+    EXPECT_TRUE(ids[20].empty());
+
+    for (int i = 0; i < 20; ++i) {
+        ASSERT_FALSE(ids[i].empty());
+        ASSERT_TRUE(waitForTaskCompletion(ids[i]));
+    }
+    EXPECT_EQ(executed, 20);
+
+    std::vector<std::string> future_ids(ids.begin() + 21, ids.end());
+    future_ids.push_back("no-such-task");
+    EXPECT_EQ(manager->cancelTasks(future_ids), 5u);
+    for (int i = 21; i < 26; ++i) {
+        EXPECT_EQ(manager->getTaskStatus(ids[i]), TaskStatus::CANCELED);
+    }
+}
+
+// Test result retention and the visitor query API
+TEST_F(OrbitalTaskManagerTest, ResultRetentionAndVisitors) {
+    ResultRetentionPolicy policy;
+    policy.max_results = 5;
+    manager->configureResultRetention(policy);
+
+    std::vector<std::string> ids;
+    for (int i = 0; i < 10; ++i) {
+        ids.push_back(manager->scheduleTask(createBasicTask("RetainedTask")));
+        ASSERT_TRUE(waitForTaskCompletion(ids.back()));
+    }
+
+    OrbitalTask future = createBasicTask("FutureTask");
+    future.scheduled_time = std::chrono::system_clock::now() + 1h;
+    std::string future_id = manager->scheduleTask(future);
+
+    // Only the newest results, and their tasks, are kept
+    std::vector<std::string> retained;
+    EXPECT_EQ(manager->visitTaskResults([&retained](const TaskResult& result) {
+        retained.push_back(result.task_id);
+        return true;
+    }), 5u);
+    EXPECT_EQ(retained, std::vector<std::string>(ids.begin() + 5, ids.end()));
+    EXPECT_FALSE(manager->getTaskResult(ids[0]).has_value());
+    EXPECT_TRUE(manager->getTaskResult(ids[9]).has_value());
+    EXPECT_EQ(manager->getTasksByStatus(TaskStatus::COMPLETED).size(), 5u);
+
+    // Status queries only see matching tasks, and visitors may stop early
+    std::vector<std::string> pending;
+    manager->visitTasks(TaskStatus::PENDING, [&pending](const TaskSummary& summary) {
+        pending.emplace_back(summary.task_id);
+        return true;
+    });
+    EXPECT_EQ(pending, std::vector<std::string>{future_id});
+
+    size_t visited = manager->visitTasks(std::nullopt, [](const TaskSummary&) { return false; });
+    EXPECT_EQ(visited, 1u);
+
+    // Visitors run unlocked and may call back into the manager
+    manager->visitTasks(TaskStatus::PENDING, [this](const TaskSummary& summary) {
+        EXPECT_TRUE(manager->cancelTask(std::string(summary.task_id)));
+        return true;
+    });
+    EXPECT_EQ(manager->getTaskStatus(future_id), TaskStatus::CANCELED);
+    EXPECT_TRUE(manager->getTasksByStatus(TaskStatus::PENDING).empty());
+}
+
+// Evicting a result forgets the task but not how it ended
+TEST_F(OrbitalTaskManagerTest, EvictedTasksKeepFinalStatus) {
+    ResultRetentionPolicy policy;
+    policy.max_results = 1;
+    manager->configureResultRetention(policy);
+
+    std::string done_id = manager->scheduleTask(createBasicTask("Done"));
+    ASSERT_TRUE(waitForTaskCompletion(done_id));
+
+    std::atomic<int> attempts{0};
+    OrbitalTask flaky = createBasicTask("Flaky");
+    flaky.retry_count = 0;
+    flaky.task_function = [&](const TaskContext&) -> bool {
+        return ++attempts > 1;
+    };
+    std::string flaky_id = manager->scheduleTask(flaky);
+    ASSERT_TRUE(waitForTaskCompletion(flaky_id));
+    ASSERT_EQ(manager->getTaskStatus(flaky_id), TaskStatus::FAILED);
+
+    std::string filler_id = manager->scheduleTask(createBasicTask("Filler"));
+    ASSERT_TRUE(waitForTaskCompletion(filler_id));
+    ASSERT_FALSE(manager->getTaskResult(done_id).has_value());
+    ASSERT_FALSE(manager->getTaskResult(flaky_id).has_value());
+
+    EXPECT_EQ(manager->getTaskStatus(done_id), TaskStatus::COMPLETED);
+    EXPECT_TRUE(manager->getTasksByStatus(TaskStatus::COMPLETED).size() == 1u);
+
+    // A failed task stays recoverable
+    ASSERT_TRUE(manager->recoverTask(flaky_id, RecoveryStrategy::RETRY));
+    auto deadline = std::chrono::steady_clock::now() + 2s;
+    while (manager->getTaskStatus(flaky_id) != TaskStatus::COMPLETED &&
+           std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(5ms);
+    }
+    EXPECT_EQ(manager->getTaskStatus(flaky_id), TaskStatus::COMPLETED);
+
+    // A task depending on the forgotten one runs at once
+    std::atomic<bool> dependent_ran{false};
+    OrbitalTask dependent = createBasicTask("LateDependent");
+    dependent.task_function = [&](const TaskContext&) -> bool {
+        dependent_ran = true;
+        return true;
+    };
+    TriggerCondition trigger;
+    trigger.dependency_task_id = done_id;
+    std::string dependent_id = manager->scheduleConditionalTask(dependent, trigger);
+    ASSERT_FALSE(dependent_id.empty());
+    ASSERT_TRUE(waitForTaskCompletion(dependent_id, 1s));
+    EXPECT_TRUE(dependent_ran);
+}
+
+// Compare 10k individual scheduleTask calls against one batch
+TEST_F(OrbitalTaskManagerTest, BatchSchedulingThroughput) {
+    constexpr int kTasks = 10000;
+    auto far_future = std::chrono::system_clock::now() + 1h;
+
+    auto make_plan = [&] {
+        std::vector<OrbitalTask> plan;
+        plan.reserve(kTasks);
+        for (int i = 0; i < kTasks; ++i) {
+            OrbitalTask task = createBasicTask("PlanTask");
+            task.scheduled_time = far_future + std::chrono::milliseconds(i);
+            task.metadata["plan_step"] = std::to_string(i);
+            plan.push_back(std::move(task));
+        }
+        return plan;
+    };
+
+    std::vector<OrbitalTask> individual_plan = make_plan();
+    auto individual_start = std::chrono::steady_clock::now();
+    for (const auto& task : individual_plan) {
+        ASSERT_FALSE(manager->scheduleTask(task).empty());
+    }
+    auto individual_us = std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - individual_start).count();
+
+    std::vector<OrbitalTask> batch_plan = make_plan();
+    auto batch_start = std::chrono::steady_clock::now();
+    std::vector<std::string> ids = manager->scheduleTasks(std::move(batch_plan));
+    auto batch_us = std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - batch_start).count();
+
+    ASSERT_EQ(ids.size(), static_cast<size_t>(kTasks));
+    EXPECT_TRUE(std::none_of(ids.begin(), ids.end(), [](const std::string& id) { return id.empty(); }));
+
+    RecordProperty("individual_schedule_us", std::to_string(individual_us));
+    RecordProperty("batch_schedule_us", std::to_string(batch_us));
+
+    EXPECT_LT(batch_us, individual_us);
+}
+
+// Test the admission stage: deferral, and coalescing released by batch size or time
+TEST_F(OrbitalTaskManagerTest, AdmissionDeferAndCoalesce) {
+    struct ScriptedPolicy : TaskAdmissionPolicy {
+        std::atomic<int> maintenance_checks{0};
+        std::mutex mutex;
+        std::vector<size_t> batches;
+
+        TaskAdmission admit(const OrbitalTask& task, std::chrono::system_clock::time_point now) override {
+            TaskAdmission admission;
+            if (task.type == TaskType::MAINTENANCE && maintenance_checks++ == 0) {
+                admission.action = AdmissionAction::DEFER;
+                admission.not_before = now + 100ms;
+            } else if (task.type == TaskType::COMMUNICATION) {
+                admission.action = AdmissionAction::COALESCE;
+                admission.not_before = now + (task.name == "Lone" ? 200ms : 1h);
+                admission.batch_size = 3;
+            }
+            return admission;
+        }
+
+        void onBatchReleased(TaskType, const std::vector<const OrbitalTask*>& tasks) override {
+            std::lock_guard<std::mutex> lock(mutex);
+            batches.push_back(tasks.size());
+        }
+    };
+    auto policy = std::make_shared<ScriptedPolicy>();
+    manager->setAdmissionPolicy(policy);
+
+    // A deferred task runs once the policy admits it on the retry
+    auto deferred_start = std::chrono::system_clock::now();
+    std::string deferred_id = manager->scheduleTask(createBasicTask("Deferred"));
+    ASSERT_TRUE(waitForTaskCompletion(deferred_id));
+    EXPECT_EQ(policy->maintenance_checks, 2);
+    auto deferred_result = manager->getTaskResult(deferred_id);
+    ASSERT_TRUE(deferred_result.has_value());
+    EXPECT_GE(deferred_result->start_time - deferred_start, 100ms);
+
+    // Communication tasks wait until three are held, then go together
+    std::vector<std::string> burst_ids;
+    for (int i = 0; i < 2; ++i) {
+        OrbitalTask task = createBasicTask("Burst");
+        task.type = TaskType::COMMUNICATION;
+        burst_ids.push_back(manager->scheduleTask(task));
+    }
+    std::this_thread::sleep_for(100ms);
+    EXPECT_EQ(manager->getTaskStatus(burst_ids[0]), TaskStatus::PENDING);
+
+    OrbitalTask third = createBasicTask("Burst");
+    third.type = TaskType::COMMUNICATION;
+    burst_ids.push_back(manager->scheduleTask(third));
+    for (const auto& id : burst_ids) {
+        ASSERT_TRUE(waitForTaskCompletion(id));
+    }
+
+    // A group that never fills is released at its deadline
+    OrbitalTask lone = createBasicTask("Lone");
+    lone.type = TaskType::COMMUNICATION;
+    std::string lone_id = manager->scheduleTask(lone);
+    ASSERT_TRUE(waitForTaskCompletion(lone_id));
+
+    std::lock_guard<std::mutex> lock(policy->mutex);
+    EXPECT_EQ(policy->batches, (std::vector<size_t>{3, 1}));
+}
+
 // Main function
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
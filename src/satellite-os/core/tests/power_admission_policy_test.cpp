@@ -0,0 +1,95 @@
+/**
+ * @file power_admission_policy_test.cpp
+ * @brief Unit tests for the power-aware task admission policy
+ */
+
+#include "skymesh/core/power_admission_policy.h"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <vector>
+
+using namespace skymesh::core;
+using namespace std::chrono_literals;
+
+namespace {
+
+OrbitalTask makeTask(TaskType type, TaskPriority priority = TaskPriority::NORMAL) {
+    OrbitalTask task{};
+    task.task_id = "task";
+    task.type = type;
+    task.priority = priority;
+    task.timeout = 2min;
+    return task;
+}
+
+} // anonymous namespace
+
+// Constrained modes defer non-essential work and coalesce communication
+TEST(PowerAdmissionPolicyTest, LowPowerDefersAndCoalesces) {
+    PowerManager power_manager;
+    ASSERT_TRUE(power_manager.setPowerMode(PowerMode::LOW_POWER));
+
+    PowerAdmissionConfig config;
+    config.burst_batch_size = 3;
+    PowerAwareAdmissionPolicy policy(power_manager, nullptr, config);
+    const auto now = std::chrono::system_clock::now();
+
+    TaskAdmission payload = policy.admit(makeTask(TaskType::PAYLOAD_OPERATION), now);
+    EXPECT_EQ(AdmissionAction::DEFER, payload.action);
+    EXPECT_EQ(now + config.deferral, payload.not_before);
+
+    TaskAdmission comms = policy.admit(makeTask(TaskType::COMMUNICATION), now);
+    EXPECT_EQ(AdmissionAction::COALESCE, comms.action);
+    EXPECT_EQ(now + config.burst_hold, comms.not_before);
+    EXPECT_EQ(3u, comms.batch_size);
+
+    EXPECT_EQ(AdmissionAction::ADMIT, policy.admit(makeTask(TaskType::HEALTH_CHECK), now).action);
+    EXPECT_EQ(AdmissionAction::ADMIT,
+              policy.admit(makeTask(TaskType::PAYLOAD_OPERATION, TaskPriority::CRITICAL), now).action);
+    EXPECT_EQ(1u, policy.deferredCount());
+
+    ASSERT_TRUE(power_manager.setPowerMode(PowerMode::EMERGENCY));
+    EXPECT_EQ(AdmissionAction::DEFER, policy.admit(makeTask(TaskType::COMMUNICATION), now).action);
+    EXPECT_EQ(AdmissionAction::ADMIT, policy.admit(makeTask(TaskType::POWER_MANAGEMENT), now).action);
+}
+
+// A released group opens one RF burst covering all of its tasks
+TEST(PowerAdmissionPolicyTest, ReleasedGroupOpensOneBurst) {
+    PowerManager power_manager;
+    std::vector<RfBurstWindow> windows;
+    PowerAdmissionConfig config;
+    config.on_rf_burst = [&windows](const RfBurstWindow& window) { windows.push_back(window); };
+    PowerAwareAdmissionPolicy policy(power_manager, nullptr, config);
+
+    OrbitalTask quiet = makeTask(TaskType::COMMUNICATION);
+    quiet.peak_power_w = 0.5f;
+    OrbitalTask loud = makeTask(TaskType::COMMUNICATION);
+    loud.peak_power_w = 1.25f;
+    loud.timeout = 3min;
+    policy.onBatchReleased(TaskType::COMMUNICATION, {&quiet, &loud});
+
+    ASSERT_EQ(1u, windows.size());
+    EXPECT_EQ(5min, windows[0].duration);
+    EXPECT_EQ(2u, windows[0].task_count);
+    EXPECT_FLOAT_EQ(1.25f / 2.5f, windows[0].power_level); // RF peak is 2.5 W
+    EXPECT_EQ(1u, policy.burstCount());
+}
+
+// In NORMAL mode payload work waits for a start the planner can afford
+TEST(PowerAdmissionPolicyTest, NormalModeConsultsPlanner) {
+    PowerManager power_manager;
+    ASSERT_TRUE(power_manager.initialize({SubsystemID::SENSORS}));
+    power_manager.updateOrbitPowerProfile(3600, 2100);
+    OrbitPowerPlanner planner(power_manager);
+    const auto now = std::chrono::system_clock::now();
+    ASSERT_TRUE(planner.plan(now));
+
+    PowerAwareAdmissionPolicy policy(power_manager, &planner);
+    OrbitalTask small = makeTask(TaskType::PAYLOAD_OPERATION);
+    EXPECT_EQ(AdmissionAction::ADMIT, policy.admit(small, now).action);
+
+    OrbitalTask heavy = makeTask(TaskType::TELEMETRY);
+    heavy.energy_cost_wh = 8.0f;
+    EXPECT_EQ(AdmissionAction::DEFER, policy.admit(heavy, now).action);
+}
@@ -0,0 +1,143 @@
+/**
+ * @file reed_solomon_test.cpp
+ * @brief Unit tests for the CCSDS Reed-Solomon codec
+ */
+
+#include "skymesh/core/reed_solomon.h"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace skymesh::core;
+
+namespace {
+
+using Codeword = std::array<uint8_t, kRsCodewordSize>;
+
+Codeword makeCodeword(size_t size, uint32_t seed) {
+    std::mt19937 rng(seed);
+    Codeword codeword{};
+    for (size_t i = 0; i < size; ++i) {
+        codeword[i] = static_cast<uint8_t>(rng());
+    }
+    rsEncode(codeword.data(), size, codeword.data() + size);
+    return codeword;
+}
+
+// Flips errors distinct symbols among the size + kRsParitySize transmitted ones
+void corrupt(Codeword& codeword, size_t size, size_t errors, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::vector<size_t> positions(size + kRsParitySize);
+    std::iota(positions.begin(), positions.end(), size_t{0});
+    std::shuffle(positions.begin(), positions.end(), rng);
+    for (size_t e = 0; e < errors; ++e) {
+        codeword[positions[e]] ^= static_cast<uint8_t>(1 + rng() % 255);
+    }
+}
+
+} // anonymous namespace
+
+// Known answer from an independent polynomial-division implementation of
+// the CCSDS code (dual basis in and out)
+TEST(ReedSolomonTest, MatchesReferenceParity) {
+    std::array<uint8_t, kRsMaxDataSize> data;
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i);
+    }
+    std::array<uint8_t, kRsParitySize> parity;
+    rsEncode(data.data(), data.size(), parity.data());
+    const std::array<uint8_t, kRsParitySize> expected = {
+        0x4F, 0xFB, 0x92, 0xDD, 0x55, 0x7E, 0xC6, 0x7F, 0x27, 0xFB, 0x89, 0x82, 0xCF, 0x58, 0xF8, 0xFD,
+        0x02, 0x8A, 0xD1, 0x17, 0xFC, 0xEF, 0x6B, 0x27, 0x93, 0xD0, 0x41, 0x88, 0x26, 0x57, 0x86, 0x51,
+    };
+    EXPECT_EQ(parity, expected);
+
+    std::array<uint8_t, kRsParitySize> zero_parity;
+    rsEncode(data.data(), 0, zero_parity.data());
+    EXPECT_EQ(zero_parity, (std::array<uint8_t, kRsParitySize>{}));
+}
+
+TEST(ReedSolomonTest, CleanCodewordsDecodeUnchanged) {
+    for (size_t size : {kRsMaxDataSize, size_t{100}, size_t{1}}) {
+        Codeword codeword = makeCodeword(size, 7);
+        const Codeword original = codeword;
+        EXPECT_EQ(rsDecode(codeword.data(), size, codeword.data() + size), 0);
+        EXPECT_EQ(codeword, original);
+    }
+}
+
+// Any 16 symbol errors in data or parity are corrected, including in shortened codewords
+TEST(ReedSolomonTest, CorrectsUpToSixteenErrors) {
+    for (size_t size : {kRsMaxDataSize, size_t{64}}) {
+        for (size_t errors = 1; errors <= kRsCorrectableErrors; ++errors) {
+            const Codeword original = makeCodeword(size, static_cast<uint32_t>(errors));
+            for (uint32_t trial = 0; trial < 8; ++trial) {
+                Codeword received = original;
+                corrupt(received, size, errors, trial * 100 + static_cast<uint32_t>(errors));
+                ASSERT_EQ(rsDecode(received.data(), size, received.data() + size), static_cast<int>(errors))
+                    << "size " << size << " errors " << errors << " trial " << trial;
+                ASSERT_EQ(received, original);
+            }
+        }
+    }
+}
+
+TEST(ReedSolomonTest, RejectsTooManyErrorsUnchanged) {
+    const Codeword original = makeCodeword(kRsMaxDataSize, 3);
+    for (uint32_t trial = 0; trial < 20; ++trial) {
+        Codeword received = original;
+        corrupt(received, kRsMaxDataSize, kRsCorrectableErrors + 1 + trial % 8, trial);
+        const Codeword corrupted = received;
+        EXPECT_EQ(rsDecode(received.data(), kRsMaxDataSize, received.data() + kRsMaxDataSize), -1);
+        EXPECT_EQ(received, corrupted);
+    }
+}
+
+// Batches of every size around the lane count agree with the single-codeword codec
+TEST(ReedSolomonTest, BatchMatchesSingleCodewords) {
+    for (size_t count : {size_t{1}, size_t{5}, size_t{16}, size_t{37}}) {
+        const size_t size = count % 2 ? kRsMaxDataSize : 150;
+        std::vector<Codeword> codewords(count);
+        std::vector<const uint8_t*> data(count);
+        std::vector<uint8_t*> parity(count);
+        std::vector<uint8_t*> mutable_data(count);
+        for (size_t i = 0; i < count; ++i) {
+            codewords[i] = makeCodeword(size, static_cast<uint32_t>(1000 + i));
+            std::fill(codewords[i].begin() + size, codewords[i].end(), 0);
+            data[i] = mutable_data[i] = codewords[i].data();
+            parity[i] = codewords[i].data() + size;
+        }
+        rsEncodeBatch(data.data(), parity.data(), size, count);
+        for (size_t i = 0; i < count; ++i) {
+            ASSERT_EQ(codewords[i], makeCodeword(size, static_cast<uint32_t>(1000 + i))) << "codeword " << i;
+        }
+
+        const std::vector<Codeword> originals = codewords;
+        for (size_t i = 0; i < count; ++i) {
+            corrupt(codewords[i], size, i % 3 == 0 ? 0 : (i % 2 ? kRsCorrectableErrors : kRsCorrectableErrors + 4),
+                    static_cast<uint32_t>(i));
+        }
+        std::vector<int> corrected(count);
+        size_t expected_failures = 0;
+        for (size_t i = 0; i < count; ++i) {
+            expected_failures += (i % 3 != 0 && i % 2 == 0) ? 1 : 0;
+        }
+        EXPECT_EQ(rsDecodeBatch(mutable_data.data(), parity.data(), size, count, corrected.data()),
+                  expected_failures);
+        for (size_t i = 0; i < count; ++i) {
+            if (i % 3 == 0) {
+                EXPECT_EQ(corrected[i], 0);
+            } else if (i % 2) {
+                EXPECT_EQ(corrected[i], static_cast<int>(kRsCorrectableErrors));
+                EXPECT_EQ(codewords[i], originals[i]);
+            } else {
+                EXPECT_EQ(corrected[i], -1);
+            }
+        }
+    }
+}
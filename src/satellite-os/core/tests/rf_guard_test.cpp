@@ -0,0 +1,126 @@
+/**
+ * @file rf_guard_test.cpp
+ * @brief Unit tests for the RF controller's checksummed state guards
+ */
+
+#include "skymesh/core/rf_guard.h"
+
+#include <gtest/gtest.h>
+#include <cstring>
+
+namespace {
+
+struct HotState {
+    uint32_t packets;
+    uint32_t bytes;
+    uint32_t errors;
+    bool transmitting;
+    uint8_t antenna;
+    uint16_t reserved;
+};
+
+struct ColdConfig {
+    uint32_t frequency_hz;
+    uint32_t bandwidth_hz;
+    uint8_t sync_word[8];
+    uint8_t power_level;
+};
+
+void flipBit(void* data, size_t byte, int bit) {
+    static_cast<uint8_t*>(data)[byte] ^= static_cast<uint8_t>(1u << bit);
+}
+
+} // anonymous namespace
+
+TEST(RfGuardTest, Crc32cMatchesReferenceVector) {
+    const char message[] = "123456789";
+    EXPECT_EQ(rf_crc32c(message, 9), 0xE3069283u);
+    EXPECT_EQ(rf_crc32c(message, 0), 0u);
+}
+
+// Counter writes keep the checksum current, and an upset is voted away
+TEST(RfGuardTest, HotRegionUpdatesIncrementally) {
+    HotState state{};
+    uint8_t copies[RF_GUARD_MAX_COPIES][sizeof(HotState)];
+    rf_guard_t guard;
+    rf_guard_init(&guard, &state, &copies[0][0], sizeof(state), 3, RF_GUARD_HOT);
+
+    for (int i = 0; i < 100; ++i) {
+        rf_guard_add32(&guard, &state.packets, 1);
+        rf_guard_add32(&guard, &state.bytes, 128);
+    }
+    state.transmitting = true;
+    state.antenna = 2;
+    rf_guard_sync(&guard, &state.transmitting, sizeof(state.transmitting));
+    rf_guard_sync(&guard, &state.antenna, sizeof(state.antenna));
+    EXPECT_EQ(rf_guard_verify(&guard), RF_GUARD_OK);
+
+    flipBit(&state, offsetof(HotState, bytes) + 1, 3);
+    EXPECT_EQ(rf_guard_verify(&guard), RF_GUARD_CORRECTED);
+    EXPECT_EQ(state.packets, 100u);
+    EXPECT_EQ(state.bytes, 12800u);
+    EXPECT_TRUE(state.transmitting);
+    EXPECT_EQ(state.antenna, 2);
+    EXPECT_EQ(rf_guard_verify(&guard), RF_GUARD_OK);
+
+    // Upsets in different copies at the same bit still vote correctly
+    flipBit(&state, 0, 0);
+    flipBit(copies[1], 0, 1);
+    flipBit(copies[2], 4, 0);
+    EXPECT_EQ(rf_guard_verify(&guard), RF_GUARD_CORRECTED);
+    EXPECT_EQ(state.packets, 100u);
+    EXPECT_EQ(state.bytes, 12800u);
+}
+
+// The checksum picks the good copy when there are too few copies to vote
+TEST(RfGuardTest, ColdRegionRestoresFromMatchingCopy) {
+    ColdConfig config{437000000, 25000, {0xAA, 0xBB, 0xCC, 0xDD}, 2};
+    uint8_t copies[2][sizeof(ColdConfig)];
+    rf_guard_t guard;
+    rf_guard_init(&guard, &config, &copies[0][0], sizeof(config), 2, RF_GUARD_COLD);
+
+    config.power_level = 3;
+    rf_guard_sync(&guard, &config.power_level, sizeof(config.power_level));
+    EXPECT_EQ(rf_guard_verify(&guard), RF_GUARD_OK);
+
+    flipBit(&config, offsetof(ColdConfig, frequency_hz), 7);
+    flipBit(copies[0], offsetof(ColdConfig, sync_word), 0);
+    EXPECT_EQ(rf_guard_verify(&guard), RF_GUARD_CORRECTED);
+    EXPECT_EQ(config.frequency_hz, 437000000u);
+    EXPECT_EQ(config.sync_word[0], 0xAA);
+    EXPECT_EQ(config.power_level, 3);
+    EXPECT_EQ(std::memcmp(copies[0], &config, sizeof(config)), 0);
+
+    // Verify only looks at the live data; the scrub also repairs the copies
+    flipBit(copies[1], offsetof(ColdConfig, bandwidth_hz), 2);
+    EXPECT_EQ(rf_guard_verify(&guard), RF_GUARD_OK);
+    EXPECT_EQ(rf_guard_scrub(&guard), RF_GUARD_CORRECTED);
+    EXPECT_EQ(std::memcmp(copies[1], &config, sizeof(config)), 0);
+    EXPECT_EQ(rf_guard_scrub(&guard), RF_GUARD_OK);
+}
+
+// An upset in the stored checksum is repaired from data and copies that agree;
+// copies that all disagree cannot be repaired
+TEST(RfGuardTest, ChecksumUpsetAndUncorrectableRegion) {
+    ColdConfig config{437000000, 25000, {0xAA}, 2};
+    uint8_t copies[RF_GUARD_MAX_COPIES][sizeof(ColdConfig)];
+    rf_guard_t guard;
+    rf_guard_init(&guard, &config, &copies[0][0], sizeof(config), 3, RF_GUARD_COLD);
+
+    guard.checksum ^= 0x10;
+    EXPECT_EQ(rf_guard_verify(&guard), RF_GUARD_CORRECTED);
+    EXPECT_EQ(rf_guard_verify(&guard), RF_GUARD_OK);
+
+    flipBit(&config, 0, 0);
+    flipBit(copies[0], 0, 0);
+    flipBit(copies[1], 0, 0);
+    flipBit(copies[2], 1, 0);
+    EXPECT_EQ(rf_guard_verify(&guard), RF_GUARD_UNCORRECTABLE);
+
+    // Without copies the guard does nothing
+    rf_guard_t disabled;
+    rf_guard_init(&disabled, &config, nullptr, sizeof(config), 0, RF_GUARD_COLD);
+    flipBit(&config, 0, 1);
+    EXPECT_EQ(rf_guard_verify(&disabled), RF_GUARD_OK);
+    EXPECT_EQ(rf_guard_scrub(&disabled), RF_GUARD_OK);
+}
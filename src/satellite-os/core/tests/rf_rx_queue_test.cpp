@@ -0,0 +1,143 @@
+/**
+ * @file rf_rx_queue_test.cpp
+ * @brief Unit tests for the RF receive ring
+ */
+
+#include "skymesh/core/rf_rx_queue.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <thread>
+
+namespace {
+
+// Receive a frame the way a driver does: straight into the reserved slot
+bool receiveFrame(rf_rxq_t* queue, uint8_t marker, uint32_t length) {
+    rf_rx_slot_t* slot = rf_rxq_reserve(queue);
+    if (slot == nullptr) {
+        return false;
+    }
+    std::memset(slot->data, marker, length);
+    slot->length = length;
+    slot->rssi = -static_cast<int16_t>(marker);
+    rf_rxq_commit(queue);
+    return true;
+}
+
+} // anonymous namespace
+
+// Frames are read in place, in arrival order, and stay put until released
+TEST(RfRxQueueTest, BatchesInPlace) {
+    auto queue = std::make_unique<rf_rxq_t>();
+    rf_rxq_init(queue.get());
+
+    for (uint8_t i = 1; i <= 5; ++i) {
+        ASSERT_TRUE(receiveFrame(queue.get(), i, 10u * i));
+    }
+    const uint8_t copied[] = {9, 9, 9};
+    ASSERT_TRUE(rf_rxq_push(queue.get(), copied, sizeof(copied), -40));
+    EXPECT_FALSE(rf_rxq_push(queue.get(), copied, RF_RX_FRAME_SIZE + 1, -40));
+    EXPECT_EQ(rf_rxq_available(queue.get()), 6u);
+
+    rf_packet_t packets[4];
+    ASSERT_EQ(rf_rxq_acquire(queue.get(), packets, 4), 4u);
+    for (uint8_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(packets[i].length, 10u * (i + 1));
+        EXPECT_EQ(packets[i].data[0], i + 1);
+        EXPECT_EQ(packets[i].rssi, -(i + 1));
+        EXPECT_EQ(packets[i].data, queue->slots[i].data);
+    }
+
+    // A second batch continues after the frames still held
+    ASSERT_EQ(rf_rxq_acquire(queue.get(), packets, 4), 2u);
+    EXPECT_EQ(packets[0].data[0], 5);
+    EXPECT_EQ(packets[1].length, sizeof(copied));
+    EXPECT_EQ(packets[1].rssi, -40);
+    EXPECT_EQ(rf_rxq_available(queue.get()), 0u);
+    EXPECT_EQ(rf_rxq_acquire(queue.get(), packets, 4), 0u);
+    rf_rxq_release(queue.get());
+    EXPECT_EQ(rf_rxq_high_watermark(queue.get()), 6u);
+    EXPECT_EQ(rf_rxq_overflows(queue.get()), 0u);
+}
+
+// The driver's receive time reaches the consumer for latency; push() has none
+TEST(RfRxQueueTest, CarriesReceiveTime) {
+    auto queue = std::make_unique<rf_rxq_t>();
+    rf_rxq_init(queue.get());
+
+    rf_rx_slot_t* slot = rf_rxq_reserve(queue.get());
+    ASSERT_NE(slot, nullptr);
+    slot->length = 1;
+    slot->received_ns = 123456789u;
+    rf_rxq_commit(queue.get());
+    const uint8_t copied[] = {1};
+    ASSERT_TRUE(rf_rxq_push(queue.get(), copied, sizeof(copied), -40));
+
+    rf_packet_t packets[2];
+    ASSERT_EQ(rf_rxq_acquire(queue.get(), packets, 2), 2u);
+    EXPECT_EQ(packets[0].received_ns, 123456789u);
+    EXPECT_EQ(packets[1].received_ns, 0u);
+    rf_rxq_release(queue.get());
+}
+
+// A full ring drops and counts new frames until the consumer releases slots
+TEST(RfRxQueueTest, CountsOverflowAndHighWatermark) {
+    auto queue = std::make_unique<rf_rxq_t>();
+    rf_rxq_init(queue.get());
+
+    for (uint32_t i = 0; i < RF_RX_RING_SIZE; ++i) {
+        ASSERT_TRUE(receiveFrame(queue.get(), static_cast<uint8_t>(i), 1));
+    }
+    EXPECT_FALSE(receiveFrame(queue.get(), 0xEE, 1));
+    EXPECT_FALSE(receiveFrame(queue.get(), 0xEE, 1));
+    EXPECT_EQ(rf_rxq_overflows(queue.get()), 2u);
+    EXPECT_EQ(rf_rxq_high_watermark(queue.get()), static_cast<uint32_t>(RF_RX_RING_SIZE));
+
+    // Acquired slots are still owned by the consumer
+    rf_packet_t packets[8];
+    ASSERT_EQ(rf_rxq_acquire(queue.get(), packets, 8), 8u);
+    EXPECT_FALSE(receiveFrame(queue.get(), 0xEE, 1));
+    EXPECT_EQ(rf_rxq_overflows(queue.get()), 3u);
+
+    rf_rxq_release(queue.get());
+    ASSERT_TRUE(receiveFrame(queue.get(), 0xAB, 1));
+    ASSERT_EQ(rf_rxq_acquire(queue.get(), packets, 8), 8u);
+    EXPECT_EQ(packets[0].data[0], 8);
+    EXPECT_EQ(rf_rxq_high_watermark(queue.get()), static_cast<uint32_t>(RF_RX_RING_SIZE));
+}
+
+// A driver thread and a consumer thread exchange frames without loss or tearing
+TEST(RfRxQueueTest, DriverAndConsumerRunConcurrently) {
+    auto queue = std::make_unique<rf_rxq_t>();
+    rf_rxq_init(queue.get());
+    constexpr uint32_t kFrames = 5000;
+
+    std::thread driver([&] {
+        for (uint32_t sent = 0; sent < kFrames;) {
+            if (receiveFrame(queue.get(), static_cast<uint8_t>(sent), 1 + sent % RF_RX_FRAME_SIZE)) {
+                ++sent;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint32_t received = 0;
+    rf_packet_t packets[16];
+    while (received < kFrames) {
+        const size_t count = rf_rxq_acquire(queue.get(), packets, 16);
+        for (size_t i = 0; i < count; ++i, ++received) {
+            ASSERT_EQ(packets[i].length, 1 + received % RF_RX_FRAME_SIZE);
+            ASSERT_EQ(packets[i].data[0], static_cast<uint8_t>(received));
+            ASSERT_EQ(packets[i].data[packets[i].length - 1], static_cast<uint8_t>(received));
+        }
+        rf_rxq_release(queue.get());
+    }
+    driver.join();
+
+    // Everything committed was delivered
+    EXPECT_EQ(rf_rxq_available(queue.get()), 0u);
+    EXPECT_LE(rf_rxq_high_watermark(queue.get()), static_cast<uint32_t>(RF_RX_RING_SIZE));
+}
@@ -0,0 +1,158 @@
+/**
+ * @file rf_tx_queue_test.cpp
+ * @brief Unit tests for the RF transmit queue
+ */
+
+#include "skymesh/core/rf_tx_queue.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+rf_packet_t* queueFrame(rf_txq_t* queue, uint16_t packet_id, uint8_t priority, uint32_t length) {
+    rf_packet_t* packet = rf_txq_acquire(queue);
+    if (packet == nullptr) {
+        return nullptr;
+    }
+    std::memset(packet->data, static_cast<int>(packet_id & 0xFF), length);
+    packet->length = length;
+    packet->packet_id = packet_id;
+    packet->priority = priority;
+    return rf_txq_push(queue, packet) == RF_STATUS_OK ? packet : nullptr;
+}
+
+} // anonymous namespace
+
+// Batches take the highest priority first, in order within a priority
+TEST(RfTxQueueTest, BatchesByPriority) {
+    auto queue = std::make_unique<rf_txq_t>();
+    rf_txq_init(queue.get());
+    EXPECT_FALSE(rf_txq_pending(queue.get()));
+
+    const uint8_t priorities[] = {0, 3, 7, 3, 0, 7, 5, 1, 0, 2};
+    for (uint16_t i = 0; i < 10; ++i) {
+        ASSERT_NE(queueFrame(queue.get(), i, priorities[i], 10 + i), nullptr);
+    }
+    EXPECT_TRUE(rf_txq_pending(queue.get()));
+
+    rf_tx_batch_t batch;
+    ASSERT_EQ(rf_txq_next_batch(queue.get(), &batch), RF_TX_BATCH_MAX);
+    const uint16_t expected_order[] = {2, 5, 6, 1, 3, 9, 7, 0};
+    uint32_t bytes = 0;
+    for (uint8_t i = 0; i < batch.count; ++i) {
+        const uint16_t id = expected_order[i];
+        EXPECT_EQ(batch.length[i], 10u + id);
+        EXPECT_EQ(batch.data[i][0], id);
+        bytes += batch.length[i];
+    }
+    EXPECT_EQ(batch.bytes, bytes);
+    rf_txq_complete(queue.get(), &batch, RF_STATUS_OK);
+
+    ASSERT_EQ(rf_txq_next_batch(queue.get(), &batch), 2);
+    rf_txq_complete(queue.get(), &batch, RF_STATUS_TX_ERROR);
+    EXPECT_FALSE(rf_txq_pending(queue.get()));
+    EXPECT_EQ(rf_txq_next_batch(queue.get(), &batch), 0);
+
+    // Completions arrive in send order with their outcome
+    rf_tx_completion_t completions[16];
+    ASSERT_EQ(rf_txq_poll(queue.get(), completions, 16), 10u);
+    EXPECT_EQ(completions[0].packet_id, 2);
+    EXPECT_EQ(completions[0].priority, 7);
+    EXPECT_EQ(completions[0].status, RF_STATUS_OK);
+    EXPECT_EQ(completions[8].packet_id, 4);
+    EXPECT_EQ(completions[9].packet_id, 8);
+    EXPECT_EQ(completions[9].status, RF_STATUS_TX_ERROR);
+    EXPECT_EQ(rf_txq_poll(queue.get(), completions, 16), 0u);
+}
+
+// Buffers come back to the pool only once their completion has been polled
+TEST(RfTxQueueTest, PoolRecyclesOnCompletion) {
+    auto queue = std::make_unique<rf_txq_t>();
+    rf_txq_init(queue.get());
+
+    std::vector<rf_packet_t*> packets;
+    while (rf_packet_t* packet = rf_txq_acquire(queue.get())) {
+        packets.push_back(packet);
+    }
+    ASSERT_EQ(packets.size(), static_cast<size_t>(RF_TX_POOL_SIZE));
+
+    // Invalid frames are refused and stay with the caller
+    packets[0]->length = 0;
+    EXPECT_EQ(rf_txq_push(queue.get(), packets[0]), RF_STATUS_TX_ERROR);
+    packets[0]->length = RF_TX_FRAME_SIZE + 1;
+    EXPECT_EQ(rf_txq_push(queue.get(), packets[0]), RF_STATUS_TX_ERROR);
+    rf_packet_t foreign{};
+    foreign.length = 1;
+    EXPECT_EQ(rf_txq_push(queue.get(), &foreign), RF_STATUS_TX_ERROR);
+
+    rf_txq_release(queue.get(), packets[0]);
+    packets[1]->length = 4;
+    packets[1]->priority = 200;  // Clamped to the top priority
+    ASSERT_EQ(rf_txq_push(queue.get(), packets[1]), RF_STATUS_OK);
+    EXPECT_EQ(packets[1]->priority, RF_TX_PRIORITIES - 1);
+
+    // Only the released buffer is free while the frame is in flight
+    EXPECT_EQ(rf_txq_acquire(queue.get()), packets[0]);
+    EXPECT_EQ(rf_txq_acquire(queue.get()), nullptr);
+
+    rf_tx_batch_t batch;
+    ASSERT_EQ(rf_txq_next_batch(queue.get(), &batch), 1);
+    rf_txq_complete(queue.get(), &batch, RF_STATUS_OK);
+    EXPECT_EQ(rf_txq_acquire(queue.get()), nullptr);
+
+    rf_tx_completion_t completion;
+    ASSERT_EQ(rf_txq_poll(queue.get(), &completion, 1), 1u);
+    EXPECT_EQ(rf_txq_acquire(queue.get()), packets[1]);
+}
+
+// A submitter and a radio context on different threads exchange every frame
+TEST(RfTxQueueTest, SubmitterAndRadioRunConcurrently) {
+    auto queue = std::make_unique<rf_txq_t>();
+    rf_txq_init(queue.get());
+    constexpr uint16_t kFrames = 5000;
+    std::atomic<bool> done{false};
+
+    std::thread radio([&] {
+        rf_tx_batch_t batch;
+        while (!done.load(std::memory_order_acquire) || rf_txq_pending(queue.get())) {
+            if (rf_txq_next_batch(queue.get(), &batch) == 0) {
+                std::this_thread::yield();
+                continue;
+            }
+            for (uint8_t i = 0; i < batch.count; ++i) {
+                // Contents must be complete when the radio sees the frame
+                ASSERT_EQ(batch.data[i][batch.length[i] - 1], batch.data[i][0]);
+            }
+            rf_txq_complete(queue.get(), &batch, RF_STATUS_OK);
+        }
+    });
+
+    uint16_t submitted = 0;
+    size_t completed = 0;
+    uint32_t checksum = 0;
+    rf_tx_completion_t completions[RF_TX_POOL_SIZE];
+    while (completed < kFrames) {
+        if (submitted < kFrames) {
+            const uint32_t length = 1 + submitted % RF_TX_FRAME_SIZE;
+            if (queueFrame(queue.get(), submitted, submitted % RF_TX_PRIORITIES, length)) {
+                ++submitted;
+            }
+        }
+        const size_t count = rf_txq_poll(queue.get(), completions, RF_TX_POOL_SIZE);
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_EQ(completions[i].status, RF_STATUS_OK);
+            EXPECT_EQ(completions[i].length, 1u + completions[i].packet_id % RF_TX_FRAME_SIZE);
+            checksum += completions[i].packet_id;
+        }
+        completed += count;
+    }
+    done.store(true, std::memory_order_release);
+    radio.join();
+
+    EXPECT_EQ(checksum, static_cast<uint32_t>(kFrames) * (kFrames - 1) / 2);
+}
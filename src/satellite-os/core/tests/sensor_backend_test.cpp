@@ -0,0 +1,184 @@
+/**
+ * @file sensor_backend_test.cpp
+ * @brief Unit tests for the hardware and simulated sensor backends
+ */
+
+#include "skymesh/core/sensor_backend.h"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace skymesh::core;
+
+namespace {
+
+const std::chrono::system_clock::time_point kEpoch{std::chrono::hours(24 * 365 * 50)};
+
+std::chrono::system_clock::time_point at(double seconds) {
+    return kEpoch + std::chrono::duration_cast<std::chrono::system_clock::duration>(
+        std::chrono::duration<double>(seconds));
+}
+
+SimulationProfile orbitProfile(uint64_t seed = 7) {
+    SimulationProfile profile;
+    profile.seed = seed;
+    profile.epoch = kEpoch;
+    return profile;
+}
+
+} // anonymous namespace
+
+// The same seed reproduces every reading exactly, from any thread
+TEST(SensorBackendTest, SimulationIsReproducible) {
+    auto first = createSimulatedSensorBackend(orbitProfile());
+    auto second = createSimulatedSensorBackend(orbitProfile());
+    auto other_seed = createSimulatedSensorBackend(orbitProfile(8));
+    const std::string sensor_id = "obc_temp";
+    const TemperatureChannel channel{sensor_id, ComponentType::PROCESSOR, 25.0f};
+
+    std::vector<float> expected;
+    size_t differing = 0;
+    for (int i = 0; i < 200; ++i) {
+        float a = 0.0f;
+        float b = 0.0f;
+        float c = 0.0f;
+        ASSERT_TRUE(first->readTemperature(channel, at(i * 7.5), a));
+        ASSERT_TRUE(second->readTemperature(channel, at(i * 7.5), b));
+        ASSERT_TRUE(other_seed->readTemperature(channel, at(i * 7.5), c));
+        EXPECT_EQ(a, b);
+        differing += a != c;
+        expected.push_back(a);
+    }
+    EXPECT_GT(differing, 150u);
+
+    // Concurrent readers of a shared backend see the same values
+    std::vector<std::thread> readers;
+    std::vector<int> mismatches(4, 0);
+    for (size_t t = 0; t < mismatches.size(); ++t) {
+        readers.emplace_back([&, t] {
+            for (int i = 0; i < 200; ++i) {
+                float value = 0.0f;
+                first->readTemperature(channel, at(i * 7.5), value);
+                mismatches[t] += value != expected[i];
+            }
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    for (int count : mismatches) {
+        EXPECT_EQ(count, 0);
+    }
+}
+
+// Temperatures cycle with eclipse and dose rate spikes in the SAA
+TEST(SensorBackendTest, OrbitDrivesThermalCycleAndSaa) {
+    SimulationProfile profile = orbitProfile();
+    profile.temperature_noise_celsius = 0.0f;
+    profile.dose_rate_noise = 0.0f;
+    auto sensors = createSimulatedSensorBackend(profile);
+    const std::string sensor_id = "panel_temp";
+    const TemperatureChannel channel{sensor_id, ComponentType::POWER_SYSTEM, 20.0f};
+
+    const double period = 5400.0;
+    const double sunlit = period * (1.0 - profile.eclipse_fraction);
+    float start_of_sunlight = 0.0f;
+    float end_of_sunlight = 0.0f;
+    float end_of_eclipse = 0.0f;
+    sensors->readTemperature(channel, at(0.0), start_of_sunlight);
+    sensors->readTemperature(channel, at(sunlit - 1.0), end_of_sunlight);
+    sensors->readTemperature(channel, at(period - 1.0), end_of_eclipse);
+    EXPECT_GT(end_of_sunlight, 20.0f + 10.0f);
+    EXPECT_LT(start_of_sunlight, 20.0f - 5.0f);
+    EXPECT_NEAR(end_of_eclipse, start_of_sunlight, 0.05f);
+
+    // The cycle repeats every orbit
+    float next_orbit = 0.0f;
+    sensors->readTemperature(channel, at(period + sunlit - 1.0), next_orbit);
+    EXPECT_NEAR(next_orbit, end_of_sunlight, 0.01f);
+
+    // SAA passes on orbits 0, 3, ... at phase 0.55, lasting 600 s
+    const double saa_centre = 0.55 * period + 300.0;
+    float rate = 0.0f;
+    sensors->readDoseRate(at(saa_centre), rate);
+    EXPECT_NEAR(rate, profile.background_dose_rate + profile.saa_peak_dose_rate, 0.01f);
+    sensors->readDoseRate(at(period + saa_centre), rate);
+    EXPECT_NEAR(rate, profile.background_dose_rate, 0.01f);
+    sensors->readDoseRate(at(3 * period + saa_centre), rate);
+    EXPECT_GT(rate, 5.0f);
+
+    // Solar output follows the eclipse
+    PowerSourceStatus solar{};
+    sensors->readPowerSource(PowerSource::SOLAR_PANEL, at(100.0), solar);
+    EXPECT_GT(solar.currentVoltage * solar.currentCurrent, 0.8f);
+    sensors->readPowerSource(PowerSource::SOLAR_PANEL, at(sunlit + 100.0), solar);
+    EXPECT_FLOAT_EQ(solar.currentCurrent, 0.0f);
+}
+
+// A compressed clock covers a whole orbit in a fraction of a second
+TEST(SensorBackendTest, TimeCompression) {
+    SimulationProfile profile = SimulationProfile::steady();
+    profile.time_scale = 10000.0;
+    auto sensors = createSimulatedSensorBackend(profile);
+
+    const auto simulated_start = sensors->now();
+    const auto real_start = std::chrono::system_clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    const auto simulated = sensors->now() - simulated_start;
+    const auto real = std::chrono::system_clock::now() - real_start;
+    EXPECT_GE(simulated, std::chrono::seconds(400));
+    EXPECT_LE(simulated, 10000 * real + std::chrono::seconds(1));
+
+    // A steady profile only adds noise to the nominal value
+    const std::string sensor_id = "obc_temp";
+    float celsius = 0.0f;
+    ASSERT_TRUE(sensors->readTemperature({sensor_id, ComponentType::PROCESSOR, 25.0f}, sensors->now(), celsius));
+    EXPECT_NEAR(celsius, 25.0f, profile.temperature_noise_celsius);
+}
+
+// The hardware backend reads through its drivers and reports missing ones
+TEST(SensorBackendTest, HardwareBackendUsesDrivers) {
+    HardwareSensorDrivers drivers;
+    drivers.read_dose_rate = [](float& rads_per_hour) {
+        rads_per_hour = 0.4f;
+        return true;
+    };
+    auto sensors = createHardwareSensorBackend(drivers);
+
+    float rate = 0.0f;
+    EXPECT_TRUE(sensors->readDoseRate(sensors->now(), rate));
+    EXPECT_FLOAT_EQ(rate, 0.4f);
+
+    const std::string sensor_id = "obc_temp";
+    float celsius = 0.0f;
+    EXPECT_FALSE(sensors->readTemperature({sensor_id, ComponentType::PROCESSOR, 25.0f}, sensors->now(), celsius));
+    PowerSourceStatus status{};
+    EXPECT_FALSE(sensors->readPowerSource(PowerSource::BATTERY, sensors->now(), status));
+}
+
+// Subsystems sample the backend they are given
+TEST(SensorBackendTest, SubsystemsReadFromBackend) {
+    SimulationProfile profile = orbitProfile();
+    profile.epoch = {};
+    profile.time_scale = 2000.0;
+    auto sensors = createSimulatedSensorBackend(profile);
+
+    // Compressed time accumulates dose far faster than real time would
+    auto monitor = createHealthMonitor("", nullptr, sensors);
+    ASSERT_TRUE(monitor->initialize(5));
+    ASSERT_TRUE(monitor->start());
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    monitor->stop();
+    const RadiationData radiation = monitor->getRadiationData();
+    EXPECT_GT(radiation.total_dose, 0.5f * profile.background_dose_rate * 2000.0f * 0.1f / 3600.0f);
+    EXPECT_LE(radiation.timestamp, sensors->now());
+
+    PowerManager power(sensors);
+    const PowerSourceStatus battery = power.getPowerSourceStatus(PowerSource::BATTERY);
+    EXPECT_GE(battery.stateOfCharge, 0.70f);
+    EXPECT_LE(battery.stateOfCharge, 0.80f);
+    EXPECT_LE(battery.lastUpdated, sensors->now());
+}
@@ -0,0 +1,106 @@
+/**
+ * @file task_allocation_test.cpp
+ * @brief Verifies that steady-state task dispatch performs no heap allocations
+ *
+ * Replaces the global allocation functions for the test binary with counting
+ * wrappers around malloc/free.
+ */
+
+#include "skymesh/core/orbital_task_manager.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <thread>
+
+using namespace skymesh::core;
+using namespace std::chrono_literals;
+
+namespace {
+std::atomic<uint64_t> g_allocation_count{0};
+} // anonymous namespace
+
+void* operator new(std::size_t size) {
+    g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+// Recurring dispatch re-arms the same entry and result in place
+TEST(TaskAllocationTest, RecurringDispatchDoesNotAllocate) {
+    auto manager = createOrbitalTaskManager();
+    ASSERT_TRUE(manager != nullptr);
+    ASSERT_TRUE(manager->start());
+
+    std::atomic<uint64_t> ticks{0};
+
+    OrbitalTask task;
+    task.name = "AllocationProbe";
+    task.type = TaskType::TELEMETRY;
+    task.priority = TaskPriority::NORMAL;
+    task.scheduled_time = std::chrono::system_clock::now();
+    task.timeout = std::chrono::milliseconds(1000);
+    task.recovery_strategy = RecoveryStrategy::RETRY;
+    task.radiation_protected = false;
+    task.retry_count = 0;
+    task.metadata["cpu_time_limit_ms"] = "250";
+    task.task_function = [&ticks](const TaskContext& context) -> bool {
+        ticks.fetch_add(1, std::memory_order_relaxed);
+        return context.cpu_time_limit_ms == 250;
+    };
+
+    std::string task_id = manager->scheduleRecurringTask(task, std::chrono::milliseconds(1));
+    ASSERT_FALSE(task_id.empty());
+
+    // Warm up: first result insertion and queue capacity growth may allocate
+    auto wait_for_ticks = [&ticks](uint64_t target) {
+        auto deadline = std::chrono::steady_clock::now() + 5s;
+        while (ticks.load() < target && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(1ms);
+        }
+        return ticks.load() >= target;
+    };
+    ASSERT_TRUE(wait_for_ticks(20));
+
+    uint64_t ticks_before = ticks.load();
+    uint64_t allocations_before = g_allocation_count.load();
+    ASSERT_TRUE(wait_for_ticks(ticks_before + 200));
+    uint64_t allocations = g_allocation_count.load() - allocations_before;
+    uint64_t dispatched = ticks.load() - ticks_before;
+
+    manager->cancelTask(task_id);
+    manager->stop();
+
+    RecordProperty("steady_state_dispatches", std::to_string(dispatched));
+    RecordProperty("steady_state_allocations", std::to_string(allocations));
+
+    EXPECT_EQ(allocations, 0u) << "over " << dispatched << " dispatches";
+
+    auto result = manager->getTaskResult(task_id);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->status, TaskStatus::COMPLETED);
+}
@@ -0,0 +1,108 @@
+/**
+ * @file task_result_store_test.cpp
+ * @brief Unit tests for the bounded task result store
+ */
+
+#include "skymesh/core/task_result_store.h"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace skymesh::core;
+using namespace std::chrono_literals;
+
+namespace {
+
+TaskResult makeResult(const std::string& task_id, TaskStatus status = TaskStatus::COMPLETED) {
+    TaskResult result{};
+    result.task_id = task_id;
+    result.status = status;
+    result.start_time = std::chrono::system_clock::now();
+    result.end_time = result.start_time;
+    return result;
+}
+
+std::vector<std::string> visitIds(const TaskResultStore& store) {
+    std::vector<std::string> ids;
+    store.visit([&ids](const TaskResult& result) {
+        ids.push_back(result.task_id);
+        return true;
+    });
+    return ids;
+}
+
+} // anonymous namespace
+
+// The oldest results are evicted first once the count limit is exceeded
+TEST(TaskResultStoreTest, EvictsOldestByCount) {
+    ResultRetentionPolicy policy;
+    policy.max_results = 3;
+    TaskResultStore store(policy);
+
+    std::vector<std::string> evicted;
+    for (int i = 0; i < 5; ++i) {
+        store.put(makeResult("task-" + std::to_string(i)), &evicted);
+    }
+
+    EXPECT_EQ(store.size(), 3u);
+    EXPECT_EQ(evicted, (std::vector<std::string>{"task-0", "task-1"}));
+    EXPECT_FALSE(store.get("task-1").has_value());
+    EXPECT_EQ(visitIds(store), (std::vector<std::string>{"task-2", "task-3", "task-4"}));
+}
+
+// Re-storing a result replaces it and makes it the youngest
+TEST(TaskResultStoreTest, OverwriteRefreshesOrder) {
+    ResultRetentionPolicy policy;
+    policy.max_results = 2;
+    TaskResultStore store(policy);
+
+    store.put(makeResult("recurring"));
+    store.put(makeResult("one-shot"));
+    store.put(makeResult("recurring", TaskStatus::FAILED));
+    ASSERT_EQ(store.size(), 2u);
+
+    std::vector<std::string> evicted;
+    store.put(makeResult("newest"), &evicted);
+    EXPECT_EQ(evicted, std::vector<std::string>{"one-shot"});
+
+    auto recurring = store.get("recurring");
+    ASSERT_TRUE(recurring.has_value());
+    EXPECT_EQ(recurring->status, TaskStatus::FAILED);
+}
+
+// Byte and age limits, and tightening the policy, evict immediately
+TEST(TaskResultStoreTest, ByteAndAgeLimits) {
+    TaskResultStore store;
+
+    TaskResult large = makeResult("large");
+    large.output_data["payload"] = std::string(4096, 'x');
+    store.put(large);
+    store.put(makeResult("small"));
+    EXPECT_GT(store.bytes(), 4096u);
+
+    ResultRetentionPolicy by_bytes;
+    by_bytes.max_results = 0;
+    by_bytes.max_bytes = 2048;
+    std::vector<std::string> evicted;
+    store.setPolicy(by_bytes, &evicted);
+    EXPECT_EQ(evicted, std::vector<std::string>{"large"});
+    EXPECT_LE(store.bytes(), 2048u);
+
+    ResultRetentionPolicy by_age;
+    by_age.max_results = 0;
+    by_age.max_age = std::chrono::seconds(1);
+    store.setPolicy(by_age);
+    EXPECT_EQ(store.size(), 1u);
+
+    std::this_thread::sleep_for(1100ms);
+    store.put(makeResult("fresh"));
+    EXPECT_EQ(visitIds(store), std::vector<std::string>{"fresh"});
+
+    EXPECT_TRUE(store.erase("fresh"));
+    EXPECT_FALSE(store.erase("fresh"));
+    EXPECT_EQ(store.size(), 0u);
+    EXPECT_EQ(store.bytes(), 0u);
+}
@@ -0,0 +1,112 @@
+/**
+ * @file telemetry_ring_test.cpp
+ * @brief Unit tests for the telemetry time-series ring
+ */
+
+#include "skymesh/core/telemetry_ring.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace skymesh::core;
+
+namespace {
+
+const std::chrono::system_clock::time_point kEpoch{std::chrono::hours(24 * 365 * 50)};
+
+std::chrono::system_clock::time_point at(int seconds) {
+    return kEpoch + std::chrono::seconds(seconds);
+}
+
+} // anonymous namespace
+
+// Window statistics match a direct computation, across block boundaries
+TEST(TelemetryRingTest, WindowStatistics) {
+    TelemetryRing<64> ring;
+    TelemetrySample sample;
+    EXPECT_FALSE(ring.latest(sample));
+    EXPECT_EQ(ring.window(std::chrono::seconds(10)).count, 0u);
+
+    // One sample per second, value = 2 * t, with a spike at t = 20
+    for (int t = 0; t < 40; ++t) {
+        ring.push(at(t), t == 20 ? 500.0f : 2.0f * t);
+    }
+
+    ASSERT_TRUE(ring.latest(sample));
+    EXPECT_EQ(sample.timestamp, at(39));
+    EXPECT_FLOAT_EQ(sample.value, 78.0f);
+
+    // Last 10 s is t = 29..39
+    TelemetryWindowStats stats = ring.window(std::chrono::seconds(10));
+    EXPECT_EQ(stats.count, 11u);
+    EXPECT_FLOAT_EQ(stats.min, 58.0f);
+    EXPECT_FLOAT_EQ(stats.max, 78.0f);
+    EXPECT_FLOAT_EQ(stats.mean, 68.0f);
+    EXPECT_FLOAT_EQ(stats.latest, 78.0f);
+    EXPECT_FLOAT_EQ(stats.rate_per_second, 2.0f);
+    EXPECT_EQ(stats.oldest, at(29));
+    EXPECT_EQ(stats.newest, at(39));
+
+    // Last 25 s spans two whole blocks' worth and includes the spike
+    stats = ring.window(std::chrono::seconds(25));
+    EXPECT_EQ(stats.count, 26u);
+    EXPECT_FLOAT_EQ(stats.min, 28.0f);
+    EXPECT_FLOAT_EQ(stats.max, 500.0f);
+    float expected = 0.0f;
+    for (int t = 14; t < 40; ++t) {
+        expected += t == 20 ? 500.0f : 2.0f * t;
+    }
+    EXPECT_FLOAT_EQ(stats.mean, expected / 26.0f);
+}
+
+// Old samples fall out of the window once the ring wraps
+TEST(TelemetryRingTest, WrapKeepsNewestSamples) {
+    TelemetryRing<64> ring;
+    for (int t = 0; t < 1000; ++t) {
+        ring.push(at(t), static_cast<float>(t));
+    }
+    EXPECT_EQ(ring.totalPushed(), 1000u);
+
+    // A window longer than the ring is limited to the retained samples
+    TelemetryWindowStats stats = ring.window(std::chrono::hours(1));
+    EXPECT_EQ(stats.count, 64u - TelemetryRing<64>::kBlockSize);
+    EXPECT_FLOAT_EQ(stats.max, 999.0f);
+    EXPECT_FLOAT_EQ(stats.min, 1000.0f - stats.count);
+    EXPECT_FLOAT_EQ(stats.rate_per_second, 1.0f);
+}
+
+// Readers racing the writer only ever see windows the writer produced
+TEST(TelemetryRingTest, ConcurrentReadersSeeConsistentWindows) {
+    TelemetryRing<64> ring;
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> inconsistent{0};
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 3; ++i) {
+        readers.emplace_back([&] {
+            while (!done.load()) {
+                // value == seconds, so every consistent window has rate 1
+                // and min/max exactly count - 1 apart
+                TelemetryWindowStats stats = ring.window(std::chrono::seconds(20));
+                if (stats.count > 1 &&
+                    (stats.rate_per_second != 1.0f || stats.max - stats.min != stats.count - 1.0f ||
+                     stats.latest != stats.max)) {
+                    inconsistent.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    for (int t = 0; t < 200000; ++t) {
+        ring.push(at(t), static_cast<float>(t));
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(inconsistent.load(), 0u);
+}
@@ -0,0 +1,195 @@
+/**
+ * @file telemetry_stream_test.cpp
+ * @brief Unit tests for the streaming telemetry collector and its RF sink
+ */
+
+#include "skymesh/core/telemetry_stream.h"
+#include "skymesh/core/health_report_codec.h"
+
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace skymesh::core;
+
+namespace {
+
+// Keeps every committed frame; refuses new frames beyond limit until resumed
+class CaptureSink : public TelemetrySink {
+public:
+    explicit CaptureSink(size_t limit = SIZE_MAX) : limit(limit) {}
+
+    uint8_t* acquireFrame(size_t& capacity) override {
+        if (frames.size() >= limit) {
+            return nullptr;
+        }
+        capacity = buffer.size();
+        return buffer.data();
+    }
+
+    bool commitFrame(size_t length, TelemetryFrameType, uint16_t) override {
+        frames.emplace_back(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(length));
+        return true;
+    }
+
+    void abortFrame() override { ++aborted; }
+
+    size_t limit;
+    size_t aborted = 0;
+    std::array<uint8_t, kTelemetryMaxFrameSize> buffer{};
+    std::vector<std::vector<uint8_t>> frames;
+};
+
+TelemetryFrameView parse(const std::vector<uint8_t>& frame) {
+    TelemetryFrameView view{};
+    EXPECT_TRUE(parseTelemetryFrame(frame.data(), frame.size(), view));
+    return view;
+}
+
+float loadFloat(const uint8_t* p) {
+    uint32_t bits = static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+                    (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+std::shared_ptr<PowerManager> makePowerManager() {
+    auto power = std::make_shared<PowerManager>();
+    EXPECT_TRUE(power->initialize({SubsystemID::OBC, SubsystemID::SENSORS}));
+    EXPECT_TRUE(power->enableSubsystem(SubsystemID::OBC, 0.1f));
+    return power;
+}
+
+std::shared_ptr<HealthMonitor> makeHealthMonitor() {
+    std::shared_ptr<HealthMonitor> health = createHealthMonitor();
+    EXPECT_TRUE(health->initialize(60000));
+    EXPECT_TRUE(health->registerComponent("obc", ComponentType::PROCESSOR));
+    EXPECT_TRUE(health->registerTemperatureSensor("obc_temp", ComponentType::PROCESSOR, 25.0f));
+    return health;
+}
+
+} // anonymous namespace
+
+// One sweep yields checksummed power, health, sensor and task frames in order
+TEST(TelemetryStreamTest, FullSweepSerializesEverySubsystem) {
+    auto power = makePowerManager();
+    auto health = makeHealthMonitor();
+    std::shared_ptr<OrbitalTaskManager> tasks = createOrbitalTaskManager();
+    TelemetryCollector collector(power, health, tasks);
+    CaptureSink sink;
+
+    collector.beginSweep(true);
+    const size_t emitted = collector.emit(sink);
+    EXPECT_FALSE(collector.sweepInProgress());
+    ASSERT_EQ(emitted, sink.frames.size());
+    ASSERT_GE(sink.frames.size(), 3u);
+
+    std::vector<TelemetryFrameType> types;
+    for (size_t i = 0; i < sink.frames.size(); ++i) {
+        const TelemetryFrameView view = parse(sink.frames[i]);
+        EXPECT_EQ(view.sequence, i);
+        EXPECT_EQ(view.sweep, 1u);
+        types.push_back(view.type);
+    }
+    EXPECT_EQ(types.front(), TelemetryFrameType::POWER_BUDGET);
+    EXPECT_EQ(types[1], TelemetryFrameType::HEALTH_REPORT);
+    EXPECT_EQ(types.back(), TelemetryFrameType::TASK_METRICS);
+
+    // The power frame carries the published budget snapshot
+    const TelemetryFrameView power_frame = parse(sink.frames[0]);
+    const PowerBudgetSnapshot snapshot = power->getPowerBudgetSnapshot();
+    ASSERT_EQ(power_frame.payloadSize, 22u + 14u * snapshot.subsystemCount);
+    EXPECT_FLOAT_EQ(loadFloat(power_frame.payload + 4), snapshot.totalConsumption);
+    EXPECT_EQ(power_frame.payload[21], snapshot.subsystemCount);
+
+    // The health frame is a full report the ground decoder accepts
+    const TelemetryFrameView health_frame = parse(sink.frames[1]);
+    HealthReportDecoder decoder;
+    DecodedHealthReport report;
+    ASSERT_TRUE(decoder.decode(health_frame.payload, health_frame.payloadSize, report));
+    EXPECT_FALSE(report.delta);
+    ASSERT_EQ(report.temperature_celsius.size(), 1u);
+
+    EXPECT_EQ(collector.stats().frames, sink.frames.size());
+    EXPECT_EQ(collector.stats().stalls, 0u);
+}
+
+// A full sink pauses the sweep; the next emit() continues without gaps
+TEST(TelemetryStreamTest, PausedSweepResumesWhereItStopped) {
+    auto power = makePowerManager();
+    std::shared_ptr<OrbitalTaskManager> tasks = createOrbitalTaskManager();
+    TelemetryCollector collector(power, nullptr, tasks);
+    CaptureSink sink(1);
+
+    collector.beginSweep();
+    EXPECT_EQ(collector.emit(sink), 1u);
+    EXPECT_TRUE(collector.sweepInProgress());
+    EXPECT_EQ(collector.stats().stalls, 1u);
+
+    sink.limit = SIZE_MAX;
+    EXPECT_EQ(collector.emit(sink), 1u);
+    EXPECT_FALSE(collector.sweepInProgress());
+    ASSERT_EQ(sink.frames.size(), 2u);
+    EXPECT_EQ(parse(sink.frames[0]).type, TelemetryFrameType::POWER_BUDGET);
+    EXPECT_EQ(parse(sink.frames[1]).type, TelemetryFrameType::TASK_METRICS);
+    EXPECT_EQ(parse(sink.frames[1]).sequence, 1u);
+    EXPECT_EQ(parse(sink.frames[1]).sweep, parse(sink.frames[0]).sweep);
+
+    // Task counts are sent in TaskStatus order after the three counters
+    const TelemetryFrameView task_frame = parse(sink.frames[1]);
+    EXPECT_EQ(task_frame.payloadSize, 3 * 8 + 4 * kTaskStatusCount);
+}
+
+// Frames stream into pool buffers; a backed-up radio holds the collector back
+TEST(TelemetryStreamTest, RfSinkAppliesBackpressure) {
+    auto queue = std::make_unique<rf_txq_t>();
+    rf_txq_init(queue.get());
+    auto power = makePowerManager();
+    auto health = makeHealthMonitor();
+    std::shared_ptr<OrbitalTaskManager> tasks = createOrbitalTaskManager();
+    TelemetryCollector collector(power, health, tasks);
+
+    // Leave all but one buffer to other traffic
+    RfTxQueueSink sink(*queue, 2, RF_TX_POOL_SIZE - 1);
+    collector.beginSweep(true);
+    size_t sent = 0;
+    for (int round = 0; round < 16 && collector.sweepInProgress(); ++round) {
+        EXPECT_LE(collector.emit(sink), 1u);
+
+        rf_tx_batch_t batch;
+        const uint8_t count = rf_txq_next_batch(queue.get(), &batch);
+        ASSERT_LE(count, 1u);
+        for (uint8_t i = 0; i < count; ++i) {
+            TelemetryFrameView view{};
+            ASSERT_TRUE(parseTelemetryFrame(batch.data[i], batch.length[i], view));
+            EXPECT_EQ(view.sequence, sent);
+            ++sent;
+        }
+        rf_txq_complete(queue.get(), &batch, RF_STATUS_OK);
+    }
+    EXPECT_FALSE(collector.sweepInProgress());
+    EXPECT_EQ(sent, collector.stats().frames);
+    EXPECT_GE(collector.stats().stalls, sent - 1);
+    sink.reclaim();
+    EXPECT_EQ(sink.sent(), sent);
+    EXPECT_FALSE(rf_txq_pending(queue.get()));
+}
+
+TEST(TelemetryStreamTest, RejectsCorruptFrames) {
+    auto power = makePowerManager();
+    TelemetryCollector collector(power, nullptr, nullptr);
+    CaptureSink sink;
+    collector.beginSweep();
+    ASSERT_EQ(collector.emit(sink), 1u);
+
+    std::vector<uint8_t> frame = sink.frames[0];
+    TelemetryFrameView view{};
+    EXPECT_TRUE(parseTelemetryFrame(frame.data(), frame.size(), view));
+    EXPECT_FALSE(parseTelemetryFrame(frame.data(), frame.size() - 1, view));
+    frame[kTelemetryFrameHeaderSize] ^= 0x01;
+    EXPECT_FALSE(parseTelemetryFrame(frame.data(), frame.size(), view));
+}
@@ -0,0 +1,101 @@
+/**
+ * @file tmr_test.cpp
+ * @brief Unit tests for triple modular redundant storage and scrubbing
+ */
+
+#include "skymesh/core/tmr.h"
+
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+using namespace skymesh::core;
+
+namespace {
+
+enum class Mode : uint8_t { A = 1, B = 2, C = 4 };
+
+struct Sample {
+    uint32_t mask;
+    std::array<float, 5> levels;
+};
+
+template <typename T, size_t Alignment>
+void flipBit(Tmr<T, Alignment>& value, size_t copy, size_t bit) {
+    auto* bytes = reinterpret_cast<uint8_t*>(value.unsafeCopy(copy));
+    bytes[bit / 8] ^= static_cast<uint8_t>(1u << (bit % 8));
+}
+
+} // anonymous namespace
+
+// A single upset in any copy is outvoted on read
+TEST(TmrTest, LoadOutvotesSingleCopyUpset) {
+    for (size_t copy = 0; copy < 3; ++copy) {
+        Tmr<uint32_t> value(0xDEADBEEFu);
+        flipBit(value, copy, 7);
+        EXPECT_FALSE(value.consistent());
+        EXPECT_EQ(0xDEADBEEFu, value.load());
+    }
+}
+
+// Voting is per bit, so upsets in different bits of every copy still recover
+TEST(TmrTest, BitwiseVoteRecoversScatteredUpsets) {
+    Sample original{0x2Au, {0.1f, 0.2f, 0.3f, 0.4f, 0.5f}};
+    Tmr<Sample, kTmrCacheLine> value(original);
+    flipBit(value, 0, 1);
+    flipBit(value, 1, 40);
+    flipBit(value, 2, 150);
+
+    Sample loaded = value.load();
+    EXPECT_EQ(original.mask, loaded.mask);
+    EXPECT_EQ(original.levels, loaded.levels);
+
+    EXPECT_TRUE(value.scrub());
+    EXPECT_TRUE(value.consistent());
+    EXPECT_FALSE(value.scrub());
+}
+
+TEST(TmrTest, EnumAndUpdateRoundTrip) {
+    Tmr<Mode> mode(Mode::A);
+    flipBit(mode, 1, 2);
+    EXPECT_EQ(Mode::A, mode.load());
+
+    mode.update([](Mode& value) { value = Mode::C; });
+    EXPECT_TRUE(mode.consistent());
+    EXPECT_EQ(Mode::C, mode.load());
+}
+
+// The byte-range vote covers SIMD blocks, whole words and a byte tail
+TEST(TmrTest, ScrubRepairsEveryPositionOfOddSizedBuffer) {
+    const size_t size = 16 * 3 + 8 + 5;
+    for (size_t offset = 0; offset < size; ++offset) {
+        std::vector<uint8_t> a(size, 0x33), b(size, 0x33), c(size, 0x33);
+        c[offset] ^= 0x80;
+        EXPECT_TRUE(tmrScrub(a.data(), b.data(), c.data(), size)) << "offset " << offset;
+        EXPECT_EQ(a, c) << "offset " << offset;
+    }
+}
+
+// Each step covers at least its byte budget and resumes where it stopped
+TEST(TmrTest, ScrubberStepsRoundRobin) {
+    std::vector<Tmr<std::array<uint8_t, 64>>> regions(4);
+    TmrScrubber scrubber;
+    for (auto& region : regions) {
+        scrubber.add(region);
+    }
+    EXPECT_EQ(4u * 64u, scrubber.protectedBytes());
+
+    flipBit(regions[0], 0, 3);
+    flipBit(regions[3], 2, 9);
+
+    EXPECT_EQ(1u, scrubber.step(128)); // regions 0 and 1
+    EXPECT_TRUE(regions[0].consistent());
+    EXPECT_FALSE(regions[3].consistent());
+
+    EXPECT_EQ(1u, scrubber.step(128)); // regions 2 and 3
+    EXPECT_TRUE(regions[3].consistent());
+    EXPECT_EQ(2u, scrubber.totalCorrections());
+
+    EXPECT_EQ(0u, scrubber.scrubAll());
+}